@@ -0,0 +1,137 @@
+#include "benchmark.hpp"
+#include <axiom/container/array.hpp>
+#include <axiom/container/string.hpp>
+#include <vector>
+
+struct Particle
+{
+    float position[3];
+    float velocity[3];
+};
+
+void benchArray(void)
+{
+    bench::section("array: push 1M ints");
+    bench::run("axc::Array", 20, [] {
+        axc::Array<int> array;
+        for (int i = 0; i < (1 << 20); i++)
+        {
+            array.pushBack(i);
+        }
+        bench::doNotOptimize(array.data());
+    });
+    bench::run("std::vector", 20, [] {
+        std::vector<int> array;
+        for (int i = 0; i < (1 << 20); i++)
+        {
+            array.push_back(i);
+        }
+        bench::doNotOptimize(array.data());
+    });
+
+    bench::section("array: emplace 256K particles of 24 bytes");
+    bench::run("axc::Array", 20, [] {
+        axc::Array<Particle> array;
+        for (int i = 0; i < (1 << 18); i++)
+        {
+            array.emplaceBack(Particle{{1, 2, 3}, {4, 5, 6}});
+        }
+        bench::doNotOptimize(array.data());
+    });
+    bench::run("std::vector", 20, [] {
+        std::vector<Particle> array;
+        for (int i = 0; i < (1 << 18); i++)
+        {
+            array.emplace_back(Particle{{1, 2, 3}, {4, 5, 6}});
+        }
+        bench::doNotOptimize(array.data());
+    });
+
+    bench::section("array: push 64K strings of 32 characters");
+    bench::run("axc::Array<axc::String>", 20, [] {
+        axc::Array<axc::String> array;
+        for (int i = 0; i < 65536; i++)
+        {
+            array.emplaceBack("uniform sampler2D uDiffuseMap[4]");
+        }
+        bench::doNotOptimize(array.data());
+    });
+    bench::run("std::vector<axc::String>", 20, [] {
+        std::vector<axc::String> array;
+        for (int i = 0; i < 65536; i++)
+        {
+            array.emplace_back("uniform sampler2D uDiffuseMap[4]");
+        }
+        bench::doNotOptimize(array.data());
+    });
+
+    std::vector<float> vector(1 << 20, 1.0f);
+    axc::Array<float> array(1 << 20, 1.0f);
+
+    bench::section("array: iterate over 1M floats");
+    bench::run("axc::Array", 100, [&] {
+        float sum = 0.0f;
+        for (float value : array)
+        {
+            sum += value;
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("std::vector", 100, [&] {
+        float sum = 0.0f;
+        for (float value : vector)
+        {
+            sum += value;
+        }
+        bench::doNotOptimize(sum);
+    });
+
+    bench::section("array: erase 1000 ints from the front half of 64K");
+    bench::run("axc::Array", 20, [] {
+        axc::Array<int> array(65536, 7);
+        for (int i = 0; i < 1000; i++)
+        {
+            array.erase(i * 16);
+        }
+        bench::doNotOptimize(array.data());
+    });
+    bench::run("axc::Array eraseUnordered", 20, [] {
+        axc::Array<int> array(65536, 7);
+        for (int i = 0; i < 1000; i++)
+        {
+            array.eraseUnordered(i * 16);
+        }
+        bench::doNotOptimize(array.data());
+    });
+    bench::run("std::vector", 20, [] {
+        std::vector<int> array(65536, 7);
+        for (int i = 0; i < 1000; i++)
+        {
+            array.erase(array.begin() + i * 16);
+        }
+        bench::doNotOptimize(array.data());
+    });
+
+    bench::section("array: build 3 element arrays");
+    bench::run("axc::SmallArray<int, 4>", 1000000, [] {
+        axc::SmallArray<int, 4> array;
+        array.pushBack(1);
+        array.pushBack(2);
+        array.pushBack(3);
+        bench::doNotOptimize(array.data());
+    });
+    bench::run("axc::Array<int>", 1000000, [] {
+        axc::Array<int> array;
+        array.pushBack(1);
+        array.pushBack(2);
+        array.pushBack(3);
+        bench::doNotOptimize(array.data());
+    });
+    bench::run("std::vector<int>", 1000000, [] {
+        std::vector<int> array;
+        array.push_back(1);
+        array.push_back(2);
+        array.push_back(3);
+        bench::doNotOptimize(array.data());
+    });
+}
@@ -0,0 +1,161 @@
+#include "benchmark.hpp"
+#include <axiom/math.hpp>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+struct Variant
+{
+    axm::Batch::Implementation implementation;
+    const char* name;
+};
+
+const Variant variants[] = {
+    {axm::Batch::Implementation::Scalar, "scalar"},
+    {axm::Batch::Implementation::Float4, "Float4, 4 lanes"},
+    {axm::Batch::Implementation::Avx2, "AVX2, 8 lanes"},
+    {axm::Batch::Implementation::Avx512, "AVX-512, 16 lanes"},
+};
+
+} // namespace
+
+void benchBatch(void)
+{
+    // The same particles stored as an array of Vector3 and as a Vector3Batch
+    const int count = 65536;
+    std::vector<axm::Vector3> positions(count);
+    std::vector<axm::Vector3> velocities(count);
+    axm::Vector3Batch batchPositions;
+    axm::Vector3Batch batchVelocities;
+    for (int i = 0; i < count; i++)
+    {
+        float f = (float)i;
+        positions[i] = axm::Vector3(f, f * 0.5f, -f);
+        velocities[i] = axm::Vector3(1.f, (float)(i % 7), 0.25f);
+        batchPositions.pushBack(positions[i]);
+        batchVelocities.pushBack(velocities[i]);
+    }
+    std::vector<float> out(count);
+    const axm::Vector3 camera(10.f, 20.f, 30.f);
+    const float step = 1.f / 60.f;
+    const axm::Batch::Implementation initial =
+        axm::Batch::getImplementation();
+
+    bench::section("batch: 65536 integrations, p += v * dt");
+    bench::run("array of Vector3", 200, [&] {
+        for (int i = 0; i < count; i++)
+        {
+            positions[i] += velocities[i] * step;
+        }
+        bench::doNotOptimize(positions[0]);
+    });
+    for (const Variant& variant : variants)
+    {
+        if (axm::Batch::setImplementation(variant.implementation))
+        {
+            bench::run(variant.name, 200, [&] {
+                batchPositions.multiplyAdd(batchVelocities, step);
+                bench::doNotOptimize(batchPositions.getX()[0]);
+            });
+        }
+    }
+
+    bench::section("batch: 65536 distances to a point");
+    bench::run("array of Vector3", 200, [&] {
+        for (int i = 0; i < count; i++)
+        {
+            axm::Vector3 delta = positions[i] - camera;
+            out[i] = std::sqrt(delta | delta);
+        }
+        bench::doNotOptimize(out[0]);
+    });
+    for (const Variant& variant : variants)
+    {
+        if (axm::Batch::setImplementation(variant.implementation))
+        {
+            bench::run(variant.name, 200, [&] {
+                batchPositions.getDistances(camera, out.data());
+                bench::doNotOptimize(out[0]);
+            });
+        }
+    }
+
+    bench::section("batch: 65536 normalizations");
+    bench::run("array of Vector3", 200, [&] {
+        for (int i = 0; i < count; i++)
+        {
+            axm::Vector3 v = velocities[i];
+            float squared = v | v;
+            velocities[i] = squared > SMALL_NUMBER
+                ? v * (1.f / std::sqrt(squared)) : axm::Vector3(0.f);
+        }
+        bench::doNotOptimize(velocities[0]);
+    });
+    for (const Variant& variant : variants)
+    {
+        if (axm::Batch::setImplementation(variant.implementation))
+        {
+            bench::run(variant.name, 200, [&] {
+                batchVelocities.normalize();
+                bench::doNotOptimize(batchVelocities.getX()[0]);
+            });
+        }
+    }
+
+    bench::section("batch: 65536 affine transforms");
+    const axm::Vector3 xAxis(0.f, 1.f, 0.f);
+    const axm::Vector3 yAxis(-1.f, 0.f, 0.f);
+    const axm::Vector3 zAxis(0.f, 0.f, 1.f);
+    const axm::Vector3 translation(0.5f, 0.25f, 0.f);
+    bench::run("array of Vector3", 200, [&] {
+        for (int i = 0; i < count; i++)
+        {
+            const axm::Vector3& p = positions[i];
+            positions[i] = xAxis * p.x + yAxis * p.y + zAxis * p.z
+                + translation;
+        }
+        bench::doNotOptimize(positions[0]);
+    });
+    for (const Variant& variant : variants)
+    {
+        if (axm::Batch::setImplementation(variant.implementation))
+        {
+            bench::run(variant.name, 200, [&] {
+                batchPositions.transform(xAxis, yAxis, zAxis, translation);
+                bench::doNotOptimize(batchPositions.getX()[0]);
+            });
+        }
+    }
+
+    bench::section("batch: bounds of 65536 points");
+    bench::run("array of Vector3", 200, [&] {
+        axm::Vector3 low = positions[0];
+        axm::Vector3 high = positions[0];
+        for (int i = 1; i < count; i++)
+        {
+            const axm::Vector3& p = positions[i];
+            low = axm::Vector3(p.x < low.x ? p.x : low.x,
+                p.y < low.y ? p.y : low.y, p.z < low.z ? p.z : low.z);
+            high = axm::Vector3(p.x > high.x ? p.x : high.x,
+                p.y > high.y ? p.y : high.y, p.z > high.z ? p.z : high.z);
+        }
+        bench::doNotOptimize(low);
+        bench::doNotOptimize(high);
+    });
+    for (const Variant& variant : variants)
+    {
+        if (axm::Batch::setImplementation(variant.implementation))
+        {
+            bench::run(variant.name, 200, [&] {
+                axm::Vector3 low;
+                axm::Vector3 high;
+                batchPositions.getBounds(low, high);
+                bench::doNotOptimize(low);
+                bench::doNotOptimize(high);
+            });
+        }
+    }
+    axm::Batch::setImplementation(initial);
+}
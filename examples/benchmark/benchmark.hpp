@@ -0,0 +1,70 @@
+#pragma once
+
+#include <axiom/math/types.hpp>
+#include <axiom/memory/allocator.hpp>
+#include <chrono>
+#include <cstdio>
+
+namespace bench
+{
+
+// Keeps the optimizer from discarding a value computed by a benchmark body
+template<typename T>
+inline void doNotOptimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Prints a section title before a group of measurements
+inline void section(const char* title)
+{
+    std::printf("\n[%s]\n", title);
+}
+
+// Runs `function` `iterations` times, five rounds, and reports the best
+// round in nanoseconds per iteration
+template<typename F>
+double run(const char* name, Uint64 iterations, F&& function)
+{
+    using Clock = std::chrono::steady_clock;
+    double best = 0.0;
+
+    function();
+    for (int round = 0; round < 5; round++)
+    {
+        Clock::time_point start = Clock::now();
+        for (Uint64 i = 0; i < iterations; i++)
+        {
+            function();
+        }
+        double elapsed = std::chrono::duration<double, std::nano>(
+            Clock::now() - start).count() / (double)iterations;
+        if (round == 0 || elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+    std::printf("  %-44s %12.2f ns\n", name, best);
+    return (best);
+}
+
+// Runs `function` `iterations` times and reports how many allocations the
+// default allocator served per iteration
+template<typename F>
+double allocations(const char* name, Uint64 iterations, F&& function)
+{
+    ax::memory::Allocator& allocator = ax::memory::Allocator::getDefault();
+
+    function();
+    allocator.resetStats();
+    for (Uint64 i = 0; i < iterations; i++)
+    {
+        function();
+    }
+    double count = (double)allocator.getStats().allocations
+        / (double)iterations;
+    std::printf("  %-44s %12.2f allocs\n", name, count);
+    return (count);
+}
+
+} // namespace bench
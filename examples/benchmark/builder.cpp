@@ -0,0 +1,63 @@
+#include "benchmark.hpp"
+#include <axiom/container.hpp>
+#include <cstdio>
+#include <vector>
+
+void benchBuilder(void)
+{
+    // A shader assembled from defines and a few hundred snippets, of a line
+    // each or of an included file each
+    const int lineCounts[] = {1, 16};
+
+    for (int lines : lineCounts)
+    {
+        std::vector<axc::String> fragments;
+        for (int i = 0; i < 300; i++)
+        {
+            char line[96];
+            std::snprintf(line, sizeof(line),
+                "    color += texture(u_layer%d, uv * %d.0).rgb * weight;\n",
+                i % 8, i % 5 + 1);
+            axc::String fragment;
+            for (int j = 0; j < lines; j++)
+            {
+                fragment += line;
+            }
+            fragments.push_back(fragment);
+        }
+        char title[64];
+        std::snprintf(title, sizeof(title),
+            "builder: 300 fragments of %d lines and 300 defines", lines);
+        bench::section(title);
+
+        bench::run("String operator+", 20, [&] {
+            axc::String source;
+            for (int i = 0; i < 300; i++)
+            {
+                source = source + "#define LAYER_" + axc::String(
+                    std::to_string(i).c_str()) + "\n" + fragments[i];
+            }
+            bench::doNotOptimize(source.length());
+        });
+        bench::run("String +=", 200, [&] {
+            axc::String source;
+            for (int i = 0; i < 300; i++)
+            {
+                source += "#define LAYER_";
+                source.appendInt(i);
+                source += '\n';
+                source += fragments[i];
+            }
+            bench::doNotOptimize(source.length());
+        });
+        bench::run("StringBuilder", 200, [&] {
+            axc::StringBuilder builder(1200);
+            for (int i = 0; i < 300; i++)
+            {
+                builder.append("#define LAYER_").appendInt(i).append('\n');
+                builder.append(fragments[i]);
+            }
+            bench::doNotOptimize(builder.toString().length());
+        });
+    }
+}
@@ -0,0 +1,76 @@
+#include "benchmark.hpp"
+#include <axiom/container.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <vector>
+
+void benchChar(void)
+{
+    const Uint64 lengths[] = {32, 1 << 20};
+    std::vector<char> source(1 << 20);
+
+    // Mixed-case asset-like names separated by spaces and slashes
+    for (Uint64 i = 0; i < source.size(); i++)
+    {
+        Uint32 hash = (Uint32)i * 2654435761u;
+        switch (hash >> 29)
+        {
+            case 0: source[i] = ' '; break;
+            case 1: source[i] = '/'; break;
+            case 2: source[i] = (char)('0' + (hash >> 8) % 10); break;
+            case 3:
+            case 4: source[i] = (char)('A' + (hash >> 8) % 26); break;
+            default: source[i] = (char)('a' + (hash >> 8) % 26); break;
+        }
+    }
+    std::vector<char> buffer(source);
+
+    for (Uint64 length : lengths)
+    {
+        Uint64 iterations = 200000000 / (length + 64);
+        char title[64];
+        std::snprintf(title, sizeof(title), "char: %llu bytes",
+            (unsigned long long)length);
+        bench::section(title);
+
+        bench::run("std::transform tolower", iterations, [&] {
+            std::transform(buffer.begin(), buffer.begin() + length,
+                buffer.begin(), [](char ch) {
+                    return ((char)std::tolower((unsigned char)ch));
+                });
+            bench::doNotOptimize(buffer.data());
+        });
+        bench::run("Char::toLower loop", iterations, [&] {
+            for (Uint64 i = 0; i < length; i++)
+            {
+                buffer[i] = axc::Char::toLower(buffer[i]);
+            }
+            bench::doNotOptimize(buffer.data());
+        });
+        bench::run("Char::toLowerCase", iterations, [&] {
+            axc::Char::toLowerCase(buffer.data(), length);
+            bench::doNotOptimize(buffer.data());
+        });
+        bench::run("Char::toUpperCase", iterations, [&] {
+            axc::Char::toUpperCase(buffer.data(), length);
+            bench::doNotOptimize(buffer.data());
+        });
+
+        std::copy(source.begin(), source.end(), buffer.begin());
+        bench::run("std::count_if isspace", iterations, [&] {
+            bench::doNotOptimize(std::count_if(source.begin(),
+                source.begin() + length, [](char ch) {
+                    return (std::isspace((unsigned char)ch) != 0);
+                }));
+        });
+        bench::run("Char::count Space", iterations, [&] {
+            bench::doNotOptimize(axc::Char::count(source.data(), length,
+                axc::Char::Space));
+        });
+        bench::run("Char::span Print", iterations, [&] {
+            bench::doNotOptimize(axc::Char::span(source.data(), length,
+                axc::Char::Print));
+        });
+    }
+}
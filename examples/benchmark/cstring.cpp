@@ -0,0 +1,96 @@
+#include "benchmark.hpp"
+#include <axiom/container.hpp>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+using Implementation = axc::CString::Implementation;
+
+struct Variant
+{
+    const char* name;
+    Implementation implementation;
+};
+
+const Variant variants[] = {
+    {"scalar", Implementation::Scalar},
+    {"sse2", Implementation::Sse2},
+    {"avx2", Implementation::Avx2},
+};
+
+} // namespace
+
+void benchCString(void)
+{
+    const Uint64 lengths[] = {7, 16, 64, 256, 4096};
+    const Uint64 offsets[] = {0, 1, 13};
+    const Implementation selected = axc::CString::getImplementation();
+    std::vector<char> lhsBuffer(8192 + 64, 'a');
+    std::vector<char> rhsBuffer(8192 + 64, 'a');
+    char name[64];
+
+    for (Uint64 length : lengths)
+    {
+        for (Uint64 offset : offsets)
+        {
+            // Both strings share a prefix and differ on their last
+            // character, so every function scans the whole length
+            char* lhs = lhsBuffer.data() + offset;
+            char* rhs = rhsBuffer.data() + 32;
+            std::memset(lhs, 'a', length);
+            std::memset(rhs, 'a', length);
+            lhs[length - 1] = 'x';
+            rhs[length - 1] = 'y';
+            lhs[length] = '\0';
+            rhs[length] = '\0';
+            Uint64 iterations = 20000000 / (length + 16);
+
+            char title[96];
+            std::snprintf(title, sizeof(title),
+                "cstring: %llu bytes at offset %llu",
+                (unsigned long long)length, (unsigned long long)offset);
+            bench::section(title);
+            for (const Variant& variant : variants)
+            {
+                if (!axc::CString::setImplementation(variant.implementation))
+                {
+                    continue;
+                }
+                std::snprintf(name, sizeof(name), "strlen %s", variant.name);
+                bench::run(name, iterations, [&] {
+                    bench::doNotOptimize(axc::CString::strlen(lhs));
+                });
+                std::snprintf(name, sizeof(name), "strcmp %s", variant.name);
+                bench::run(name, iterations, [&] {
+                    bench::doNotOptimize(axc::CString::strcmp(lhs, rhs));
+                });
+                std::snprintf(name, sizeof(name), "memchr %s", variant.name);
+                bench::run(name, iterations, [&] {
+                    bench::doNotOptimize(axc::CString::memchr(lhs, 'x',
+                        length));
+                });
+                std::snprintf(name, sizeof(name), "memcmp %s", variant.name);
+                bench::run(name, iterations, [&] {
+                    bench::doNotOptimize(axc::CString::memcmp(lhs, rhs,
+                        length));
+                });
+            }
+            bench::run("strlen libc", iterations, [&] {
+                bench::doNotOptimize(std::strlen(lhs));
+            });
+            bench::run("strcmp libc", iterations, [&] {
+                bench::doNotOptimize(std::strcmp(lhs, rhs));
+            });
+            bench::run("memchr libc", iterations, [&] {
+                bench::doNotOptimize(std::memchr(lhs, 'x', length));
+            });
+            bench::run("memcmp libc", iterations, [&] {
+                bench::doNotOptimize(std::memcmp(lhs, rhs, length));
+            });
+        }
+    }
+    axc::CString::setImplementation(selected);
+}
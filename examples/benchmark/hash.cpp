@@ -0,0 +1,104 @@
+#include "benchmark.hpp"
+#include <axiom/container.hpp>
+#include <axiom/hash.hpp>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+void benchHash(void)
+{
+    const Uint64 lengths[] = {8, 16, 32, 64, 256, 4096, 65536};
+    std::vector<char> buffer(65536 + 8);
+
+    for (Uint64 i = 0; i < buffer.size(); i++)
+    {
+        buffer[i] = (char)(i * 2654435761u >> 24);
+    }
+
+    for (Uint64 length : lengths)
+    {
+        Uint64 iterations = 200000000 / (length + 32);
+        char title[64];
+        std::snprintf(title, sizeof(title), "hash: %llu bytes",
+            (unsigned long long)length);
+        bench::section(title);
+
+        std::string_view view(buffer.data() + 1, length);
+        bench::run("std::hash<std::string_view>", iterations, [&] {
+            bench::doNotOptimize(std::hash<std::string_view>()(view));
+        });
+        bench::run("axh::hashBytes", iterations, [&] {
+            bench::doNotOptimize(axh::hashBytes(buffer.data() + 1, length));
+        });
+    }
+
+    // Lookups of asset names, the hashed keys never rehash their characters
+    const int count = 1 << 14;
+    std::vector<axc::String> names;
+    std::vector<axh::HashedString> hashedNames;
+    axc::Map<axc::String, int> stringMap;
+    axc::Map<axh::HashedString, int> hashedMap;
+    char name[96];
+
+    for (int i = 0; i < count; i++)
+    {
+        std::snprintf(name, sizeof(name),
+            "assets/textures/environment/rock_%05d_albedo.png", i);
+        names.emplace_back(name);
+        hashedNames.emplace_back(name);
+        stringMap.tryEmplace(names.back(), i);
+        hashedMap.tryEmplace(hashedNames.back(), i);
+    }
+
+    bench::section("hash: map of 16384 asset names");
+    bench::run("find String", 100, [&] {
+        int sum = 0;
+        for (const axc::String& key : names)
+        {
+            sum += *stringMap.get(key);
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("find HashedString", 100, [&] {
+        int sum = 0;
+        for (const axh::HashedString& key : hashedNames)
+        {
+            sum += *hashedMap.get(key);
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("rehash String", 20, [&] {
+        axc::Map<axc::String, int> map;
+        for (int i = 0; i < count; i++)
+        {
+            map.tryEmplace(names[i], i);
+        }
+        bench::doNotOptimize(map.size());
+    });
+    bench::run("rehash HashedString", 20, [&] {
+        axc::Map<axh::HashedString, int> map;
+        for (int i = 0; i < count; i++)
+        {
+            map.tryEmplace(hashedNames[i], i);
+        }
+        bench::doNotOptimize(map.size());
+    });
+
+    // Small math keys
+    axh::Hasher<axm::Vector3> vectorHasher;
+    std::vector<axm::Vector3> vectors;
+    for (int i = 0; i < count; i++)
+    {
+        vectors.emplace_back((float)i, (float)(i * 3), (float)(i * 7));
+    }
+    bench::run("Hasher<Vector3> x16384", 200, [&] {
+        Uint64 sum = 0;
+        for (const axm::Vector3& vector : vectors)
+        {
+            sum += vectorHasher(vector);
+        }
+        bench::doNotOptimize(sum);
+    });
+}
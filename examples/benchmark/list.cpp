@@ -0,0 +1,133 @@
+#include "benchmark.hpp"
+#include <axiom/container.hpp>
+#include <list>
+#include <vector>
+
+namespace
+{
+
+struct Sprite : axc::ListHook<>
+{
+    int depth = 0;
+};
+
+} // namespace
+
+void benchList(void)
+{
+    const int count = 1 << 16;
+    std::vector<int> values;
+    for (int i = 0; i < count; i++)
+    {
+        values.push_back((int)((Uint32)i * 2654435761u >> 8));
+    }
+
+    bench::section("list: push 64K ints into a new list");
+    bench::run("axc::List", 50, [&] {
+        axc::List<int> list;
+        for (int value : values)
+        {
+            list.pushBack(value);
+        }
+        bench::doNotOptimize(list.size());
+    });
+    bench::run("std::list", 50, [&] {
+        std::list<int> list;
+        for (int value : values)
+        {
+            list.push_back(value);
+        }
+        bench::doNotOptimize(list.size());
+    });
+
+    axc::List<int> list;
+    std::list<int> stdList;
+    for (int value : values)
+    {
+        list.pushBack(value);
+        stdList.push_back(value);
+    }
+
+    bench::section("list: erase and re-insert 64K ints");
+    bench::run("axc::List", 50, [&] {
+        for (int i = 0; i < count; i++)
+        {
+            list.pushBack(list.front());
+            list.popFront();
+        }
+        bench::doNotOptimize(list.front());
+    });
+    bench::run("std::list", 50, [&] {
+        for (int i = 0; i < count; i++)
+        {
+            stdList.push_back(stdList.front());
+            stdList.pop_front();
+        }
+        bench::doNotOptimize(stdList.front());
+    });
+
+    bench::section("list: sum 64K ints");
+    bench::run("axc::List", 50, [&] {
+        Int64 sum = 0;
+        for (int value : list)
+        {
+            sum += value;
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("std::list", 50, [&] {
+        Int64 sum = 0;
+        for (int value : stdList)
+        {
+            sum += value;
+        }
+        bench::doNotOptimize(sum);
+    });
+
+    bench::section("list: sort 64K ints");
+    bench::run("axc::List", 20, [&] {
+        axc::List<int> copy(list);
+        copy.sort();
+        bench::doNotOptimize(copy.front());
+    });
+    bench::run("std::list", 20, [&] {
+        std::list<int> copy(stdList);
+        copy.sort();
+        bench::doNotOptimize(copy.front());
+    });
+
+    std::vector<Sprite> sprites(count);
+    axc::IntrusiveList<Sprite> queue;
+    for (Sprite& sprite : sprites)
+    {
+        queue.pushBack(sprite);
+    }
+
+    bench::section("list: unlink and requeue 64K sprites");
+    bench::run("axc::IntrusiveList", 50, [&] {
+        for (Sprite& sprite : sprites)
+        {
+            sprite.unlink();
+            queue.pushBack(sprite);
+        }
+        bench::doNotOptimize(queue.front().depth);
+    });
+
+    // Whole-list splices hand slabs over, clearing must give the surplus back
+    ax::memory::Allocator& allocator = ax::memory::Allocator::getDefault();
+    axc::List<int> frame;
+    axc::List<int> pending;
+    Uint64 before = allocator.getStats().bytesInUse;
+
+    bench::section("list: splice 4 ints into a frame list and clear it");
+    bench::run("axc::List", 20000, [&] {
+        for (int i = 0; i < 4; i++)
+        {
+            pending.pushBack(i);
+        }
+        frame.splice(frame.end(), pending);
+        frame.clear();
+    });
+    std::printf("  frame list: %llu bytes still in use after 100K frames\n",
+        (unsigned long long)(allocator.getStats().bytesInUse - before));
+}
@@ -0,0 +1,73 @@
+#include <cstdio>
+#include <cstring>
+
+void benchArray(void);
+void benchString(void);
+void benchMemory(void);
+void benchMap(void);
+void benchSet(void);
+void benchQueue(void);
+void benchList(void);
+void benchUnion(void);
+void benchCString(void);
+void benchChar(void);
+void benchHash(void);
+void benchName(void);
+void benchNumber(void);
+void benchBuilder(void);
+void benchRope(void);
+void benchMove(void);
+void benchReader(void);
+void benchVector(void);
+void benchBatch(void);
+void benchMatrix(void);
+void benchQuaternion(void);
+void benchTransform(void);
+
+struct Suite
+{
+    const char* name;
+    void (*run)(void);
+};
+
+static const Suite suites[] = {
+    {"array", benchArray},
+    {"string", benchString},
+    {"memory", benchMemory},
+    {"map", benchMap},
+    {"set", benchSet},
+    {"queue", benchQueue},
+    {"list", benchList},
+    {"union", benchUnion},
+    {"cstring", benchCString},
+    {"char", benchChar},
+    {"hash", benchHash},
+    {"name", benchName},
+    {"number", benchNumber},
+    {"builder", benchBuilder},
+    {"rope", benchRope},
+    {"move", benchMove},
+    {"reader", benchReader},
+    {"vector", benchVector},
+    {"batch", benchBatch},
+    {"matrix", benchMatrix},
+    {"quaternion", benchQuaternion},
+    {"transform", benchTransform},
+};
+
+int main(int argc, char** argv)
+{
+    for (const Suite& suite : suites)
+    {
+        bool selected = (argc < 2);
+        for (int i = 1; i < argc; i++)
+        {
+            selected |= (std::strcmp(argv[i], suite.name) == 0);
+        }
+        if (selected)
+        {
+            suite.run();
+        }
+    }
+    return (0);
+}
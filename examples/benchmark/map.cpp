@@ -0,0 +1,129 @@
+#include "benchmark.hpp"
+#include <axiom/container/map.hpp>
+#include <axiom/container/string.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+void benchMap(void)
+{
+    std::vector<std::string> names;
+    for (int i = 0; i < 4096; i++)
+    {
+        names.push_back("uUniformBlock[" + std::to_string(i) + "].color");
+    }
+
+    axc::Map<axc::String, int> map;
+    std::unordered_map<std::string, int> stdMap;
+    for (int i = 0; i < 4096; i++)
+    {
+        map[names[i].c_str()] = i;
+        stdMap[names[i]] = i;
+    }
+
+    bench::section("map: look up 4K uniform names");
+    bench::run("axc::Map by const char*", 200, [&] {
+        int sum = 0;
+        for (const std::string& name : names)
+        {
+            sum += *map.get(name.c_str());
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("axc::Map by StringView", 200, [&] {
+        int sum = 0;
+        for (const std::string& name : names)
+        {
+            sum += *map.get(axc::StringView(name.data(), name.size()));
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("std::unordered_map by std::string", 200, [&] {
+        int sum = 0;
+        for (const std::string& name : names)
+        {
+            sum += stdMap.find(name)->second;
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("std::unordered_map by const char*", 200, [&] {
+        int sum = 0;
+        for (const std::string& name : names)
+        {
+            sum += stdMap.find(name.c_str())->second;
+        }
+        bench::doNotOptimize(sum);
+    });
+
+    std::vector<Uint64> hashes;
+    for (const std::string& name : names)
+    {
+        hashes.push_back(map.hash(name.c_str()));
+    }
+
+    bench::section("map: look up 4K uniform names with precomputed hashes");
+    bench::run("axc::Map", 200, [&] {
+        int sum = 0;
+        for (Uint64 i = 0; i < names.size(); i++)
+        {
+            sum += *map.get(axc::StringView(names[i].data(), names[i].size()),
+                hashes[i]);
+        }
+        bench::doNotOptimize(sum);
+    });
+
+    std::vector<int> keys;
+    for (int i = 0; i < (1 << 19); i++)
+    {
+        keys.push_back((int)((Uint32)i * 2654435761u));
+    }
+
+    bench::section("map: insert 256K ints");
+    bench::run("axc::Map", 20, [&] {
+        axc::Map<int, int> map;
+        for (int i = 0; i < (1 << 18); i++)
+        {
+            map[keys[i]] = i;
+        }
+        bench::doNotOptimize(map.size());
+    });
+    bench::run("std::unordered_map", 20, [&] {
+        std::unordered_map<int, int> map;
+        for (int i = 0; i < (1 << 18); i++)
+        {
+            map[keys[i]] = i;
+        }
+        bench::doNotOptimize(map.size());
+    });
+
+    axc::Map<int, int> intMap;
+    std::unordered_map<int, int> stdIntMap;
+    for (int i = 0; i < (1 << 18); i++)
+    {
+        intMap[keys[i]] = i;
+        stdIntMap[keys[i]] = i;
+    }
+
+    bench::section("map: look up 256K ints, half missing");
+    bench::run("axc::Map", 20, [&] {
+        int found = 0;
+        for (int i = 0; i < (1 << 19); i++)
+        {
+            found += intMap.contains(keys[i]);
+        }
+        bench::doNotOptimize(found);
+    });
+    bench::run("std::unordered_map", 20, [&] {
+        int found = 0;
+        for (int i = 0; i < (1 << 19); i++)
+        {
+            found += stdIntMap.count(keys[i]) != 0;
+        }
+        bench::doNotOptimize(found);
+    });
+
+    axc::Map<int, int>::Stats stats = intMap.getStats();
+    std::printf("  int map: load %.2f, %.3f groups probed on average, %llu at "
+        "most\n", stats.loadFactor, stats.averageProbeLength,
+        (unsigned long long)stats.maxProbeLength);
+}
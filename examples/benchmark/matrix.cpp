@@ -0,0 +1,110 @@
+#include "benchmark.hpp"
+#include <axiom/math.hpp>
+#include <vector>
+
+namespace
+{
+
+// The product written the plain way, over column-major float arrays
+void multiplyScalar(const float* lhs, const float* rhs, float* out)
+{
+    for (int column = 0; column < 4; column++)
+    {
+        for (int row = 0; row < 4; row++)
+        {
+            float sum = 0.f;
+            for (int k = 0; k < 4; k++)
+            {
+                sum += lhs[k * 4 + row] * rhs[column * 4 + k];
+            }
+            out[column * 4 + row] = sum;
+        }
+    }
+}
+
+} // namespace
+
+void benchMatrix(void)
+{
+    // A chain of bone matrices, as a skeleton update concatenates them
+    const int count = 1024;
+    std::vector<axm::Matrix> locals(count);
+    for (int i = 0; i < count; i++)
+    {
+        float f = (float)i * 0.001f;
+        locals[i] = axm::Matrix::makeTranslation(axm::Vector3(f, 1.f, -f))
+            * axm::Matrix::makeScale(axm::Vector3(1.f + f));
+    }
+    std::vector<axm::Matrix> worlds(count);
+    std::vector<float> scalarWorlds(count * 16);
+
+    bench::section("matrix: 1024 concatenated products");
+    bench::run("float[16], triple loop", 2000, [&] {
+        multiplyScalar(locals[0].getData(), locals[0].getData(),
+            scalarWorlds.data());
+        for (int i = 1; i < count; i++)
+        {
+            multiplyScalar(&scalarWorlds[(i - 1) * 16], locals[i].getData(),
+                &scalarWorlds[i * 16]);
+        }
+        bench::doNotOptimize(scalarWorlds[0]);
+    });
+    bench::run("Matrix operator*, SIMD columns", 2000, [&] {
+        worlds[0] = locals[0] * locals[0];
+        for (int i = 1; i < count; i++)
+        {
+            worlds[i] = worlds[i - 1] * locals[i];
+        }
+        bench::doNotOptimize(worlds[0]);
+    });
+
+    bench::section("matrix: 1024 inverses");
+    bench::run("getInverse, cofactors", 2000, [&] {
+        for (int i = 0; i < count; i++)
+        {
+            worlds[i] = locals[i].getInverse();
+        }
+        bench::doNotOptimize(worlds[0]);
+    });
+    bench::run("getInverseAffine, cross products", 2000, [&] {
+        for (int i = 0; i < count; i++)
+        {
+            worlds[i] = locals[i].getInverseAffine();
+        }
+        bench::doNotOptimize(worlds[0]);
+    });
+
+    // Vertices of a mesh, skinned to a single bone
+    const int vertices = 65536;
+    std::vector<axm::Vector3> positions(vertices);
+    std::vector<axm::Vector3> skinned(vertices);
+    for (int i = 0; i < vertices; i++)
+    {
+        positions[i] = axm::Vector3((float)i, (float)(i % 13), 1.f);
+    }
+    const axm::Matrix& bone = locals[count / 2];
+
+    bench::section("matrix: 65536 transformed points");
+    bench::run("float[16], auto-vectorized scalar loop", 200, [&] {
+        const float* m = bone.getData();
+        for (int i = 0; i < vertices; i++)
+        {
+            const axm::Vector3& p = positions[i];
+            skinned[i].x = m[0] * p.x + m[4] * p.y + m[8] * p.z + m[12];
+            skinned[i].y = m[1] * p.x + m[5] * p.y + m[9] * p.z + m[13];
+            skinned[i].z = m[2] * p.x + m[6] * p.y + m[10] * p.z + m[14];
+        }
+        bench::doNotOptimize(skinned[0]);
+    });
+    bench::run("transformPoint, one point at a time", 200, [&] {
+        for (int i = 0; i < vertices; i++)
+        {
+            skinned[i] = bone.transformPoint(positions[i]);
+        }
+        bench::doNotOptimize(skinned[0]);
+    });
+    bench::run("transformPoints, four points per register", 200, [&] {
+        bone.transformPoints(positions.data(), skinned.data(), vertices);
+        bench::doNotOptimize(skinned[0]);
+    });
+}
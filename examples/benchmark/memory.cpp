@@ -0,0 +1,53 @@
+#include "benchmark.hpp"
+#include <axiom/container/string.hpp>
+#include <axiom/memory.hpp>
+
+static const char label[] = "entity/transform/local/position.x #";
+
+void benchMemory(void)
+{
+    bench::section("memory: 4096 labels of 36 bytes per frame");
+    bench::run("system allocator", 200, [] {
+        for (int i = 0; i < 4096; i++)
+        {
+            axc::String str(label);
+            str.append('0' + i % 10);
+            bench::doNotOptimize(str);
+        }
+    });
+    axmem::ArenaAllocator frame;
+    bench::run("arena allocator + reset", 200, [&] {
+        for (int i = 0; i < 4096; i++)
+        {
+            axc::String str(label, frame);
+            str.append('0' + i % 10);
+            bench::doNotOptimize(str);
+        }
+        frame.reset();
+    });
+
+    bench::section("memory: 65536 node sized blocks, freed in reverse");
+    static void* blocks[65536];
+    axmem::Allocator& system = axmem::Allocator::getDefault();
+    bench::run("system allocator", 50, [&] {
+        for (int i = 0; i < 65536; i++)
+        {
+            blocks[i] = system.allocate(24, 8);
+        }
+        for (int i = 65535; i >= 0; i--)
+        {
+            system.deallocate(blocks[i], 24, 8);
+        }
+    });
+    axmem::PoolAllocator pool(24, 1024);
+    bench::run("pool allocator", 50, [&] {
+        for (int i = 0; i < 65536; i++)
+        {
+            blocks[i] = pool.allocate(24, 8);
+        }
+        for (int i = 65535; i >= 0; i--)
+        {
+            pool.deallocate(blocks[i], 24, 8);
+        }
+    });
+}
@@ -0,0 +1,69 @@
+#include "benchmark.hpp"
+#include <axiom/container.hpp>
+
+void benchMove(void)
+{
+    axc::String path("/usr/local/share/axiom/shaders");
+    axc::String name("lighting_forward_plus");
+    axc::String extension(".frag.glsl");
+    axc::String other(64, 'x');
+    axc::String target(96, 'y');
+
+    bench::section("move: concatenation of four heap strings");
+    bench::allocations("operator+ through named temporaries", 1000, [&] {
+        axc::String first = path + '/';
+        axc::String second = first + name;
+        axc::String third = second + extension;
+        bench::doNotOptimize(third.length());
+    });
+    bench::allocations("operator+ chain, rvalue left-hand side", 1000, [&] {
+        axc::String result = path + '/' + name + extension;
+        bench::doNotOptimize(result.length());
+    });
+    bench::run("operator+ through named temporaries", 100000, [&] {
+        axc::String first = path + '/';
+        axc::String second = first + name;
+        axc::String third = second + extension;
+        bench::doNotOptimize(third.length());
+    });
+    bench::run("operator+ chain, rvalue left-hand side", 100000, [&] {
+        axc::String result = path + '/' + name + extension;
+        bench::doNotOptimize(result.length());
+    });
+
+    bench::section("move: swap and assignment");
+    bench::allocations("swap of two heap strings", 1000, [&] {
+        target.swap(other);
+    });
+    bench::allocations("copy assignment into a larger string", 1000, [&] {
+        axc::String copy(128, 'z');
+        copy = path;
+        bench::doNotOptimize(copy.length());
+    });
+    bench::run("swap of two heap strings", 1000000, [&] {
+        target.swap(other);
+        bench::doNotOptimize(target.length());
+    });
+    bench::run("copy assignment, capacity reused", 1000000, [&] {
+        target = other;
+        bench::doNotOptimize(target.length());
+    });
+
+    bench::section("move: Array<String> growth, 4096 strings");
+    bench::allocations("pushBack without reserve", 20, [&] {
+        axc::Array<axc::String> strings;
+        for (int i = 0; i < 4096; i++)
+        {
+            strings.pushBack(axc::String(40, 'a'));
+        }
+        bench::doNotOptimize(strings.size());
+    });
+    bench::run("pushBack without reserve", 200, [&] {
+        axc::Array<axc::String> strings;
+        for (int i = 0; i < 4096; i++)
+        {
+            strings.pushBack(axc::String(40, 'a'));
+        }
+        bench::doNotOptimize(strings.size());
+    });
+}
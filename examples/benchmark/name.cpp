@@ -0,0 +1,76 @@
+#include "benchmark.hpp"
+#include <axiom/container.hpp>
+#include <cstdio>
+#include <vector>
+
+void benchName(void)
+{
+    // A frame setting the same handful of uniforms over and over
+    const char* uniforms[] = {
+        "u_modelMatrix", "u_viewMatrix", "u_projectionMatrix", "u_time",
+        "u_lightDirection", "u_lightColor", "u_albedoTexture", "u_exposure",
+    };
+    const int count = (int)(sizeof(uniforms) / sizeof(uniforms[0]));
+    std::vector<axc::String> strings;
+    std::vector<axc::Name> names;
+    axc::Map<axc::String, int> stringLocations;
+    axc::Map<axc::Name, int> nameLocations;
+
+    for (int i = 0; i < count; i++)
+    {
+        strings.emplace_back(uniforms[i]);
+        names.emplace_back(uniforms[i]);
+        stringLocations.tryEmplace(strings.back(), i);
+        nameLocations.tryEmplace(names.back(), i);
+    }
+
+    bench::section("name: uniform lookups, 8 per frame");
+    bench::run("Map<String> by String", 1000000, [&] {
+        int sum = 0;
+        for (const axc::String& name : strings)
+        {
+            sum += *stringLocations.get(name);
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("Map<Name> by Name", 1000000, [&] {
+        int sum = 0;
+        for (axc::Name name : names)
+        {
+            sum += *nameLocations.get(name);
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("intern known C string", 1000000, [&] {
+        bench::doNotOptimize(axc::Name(uniforms[3]));
+    });
+    bench::run("AXIOM_NAME", 1000000, [&] {
+        bench::doNotOptimize(AXIOM_NAME("u_time"));
+    });
+
+    bench::section("name: equality");
+    bench::run("String == String", 1000000, [&] {
+        int equal = 0;
+        for (int i = 0; i < count; i++)
+        {
+            equal += strings[i] == strings[(i + 1) % count];
+        }
+        bench::doNotOptimize(equal);
+    });
+    bench::run("Name == Name", 1000000, [&] {
+        int equal = 0;
+        for (int i = 0; i < count; i++)
+        {
+            equal += names[i] == names[(i + 1) % count];
+        }
+        bench::doNotOptimize(equal);
+    });
+
+    // Interning new names, the only path that takes the lock
+    char buffer[64];
+    int next = 0;
+    bench::run("intern new name", 100000, [&] {
+        std::snprintf(buffer, sizeof(buffer), "bench/asset_%d", next++);
+        bench::doNotOptimize(axc::Name(buffer));
+    });
+}
@@ -0,0 +1,152 @@
+#include "benchmark.hpp"
+#include <axiom/container.hpp>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+void benchNumber(void)
+{
+    // Values of a scene file: counts, ids, coordinates and ratios
+    const int count = 1024;
+    std::vector<Int64> integers(count);
+    std::vector<double> reals(count);
+    Uint64 state = 0x9E3779B97F4A7C15ull;
+
+    for (int i = 0; i < count; i++)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        integers[i] = (Int64)(state >> (33 + (state >> 60))) - 1000;
+        reals[i] = (double)(Int64)(state >> 40) / 1024.0 - 4096.0;
+        if (i % 4 == 0)
+        {
+            reals[i] /= 3.0;
+        }
+    }
+
+    std::vector<std::string> integerTexts;
+    std::vector<std::string> realTexts;
+    for (int i = 0; i < count; i++)
+    {
+        integerTexts.push_back(std::to_string(integers[i]));
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.17g", reals[i]);
+        realTexts.push_back(buffer);
+    }
+
+    axc::String text;
+    text.reserve(64);
+    bench::section("number: format 1024 integers");
+    bench::run("std::to_string", 2000, [&] {
+        Uint64 length = 0;
+        for (Int64 value : integers)
+        {
+            length += std::to_string(value).size();
+        }
+        bench::doNotOptimize(length);
+    });
+    bench::run("snprintf %lld", 2000, [&] {
+        Uint64 length = 0;
+        char buffer[32];
+        for (Int64 value : integers)
+        {
+            length += (Uint64)std::snprintf(buffer, sizeof(buffer), "%lld",
+                (long long)value);
+        }
+        bench::doNotOptimize(length);
+    });
+    bench::run("String::appendInt", 2000, [&] {
+        Uint64 length = 0;
+        for (Int64 value : integers)
+        {
+            text.clear();
+            length += text.appendInt(value).length();
+        }
+        bench::doNotOptimize(length);
+    });
+
+    bench::section("number: format 1024 doubles, round trip");
+    bench::run("snprintf %.17g", 500, [&] {
+        Uint64 length = 0;
+        char buffer[32];
+        for (double value : reals)
+        {
+            length += (Uint64)std::snprintf(buffer, sizeof(buffer), "%.17g",
+                value);
+        }
+        bench::doNotOptimize(length);
+    });
+    bench::run("std::to_chars", 500, [&] {
+        Uint64 length = 0;
+        char buffer[32];
+        for (double value : reals)
+        {
+            length += (Uint64)(std::to_chars(buffer, buffer + sizeof(buffer),
+                value).ptr - buffer);
+        }
+        bench::doNotOptimize(length);
+    });
+    bench::run("String::appendFloat", 500, [&] {
+        Uint64 length = 0;
+        for (double value : reals)
+        {
+            text.clear();
+            length += text.appendFloat(value).length();
+        }
+        bench::doNotOptimize(length);
+    });
+
+    bench::section("number: parse 1024 integers");
+    bench::run("strtoll", 2000, [&] {
+        Int64 sum = 0;
+        for (const std::string& value : integerTexts)
+        {
+            sum += std::strtoll(value.c_str(), nullptr, 10);
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("String::parseInt", 2000, [&] {
+        Int64 sum = 0;
+        for (const std::string& value : integerTexts)
+        {
+            Int64 result = 0;
+            axc::String::parseInt(axc::StringView(value.data(),
+                value.size()), result);
+            sum += result;
+        }
+        bench::doNotOptimize(sum);
+    });
+
+    bench::section("number: parse 1024 doubles");
+    bench::run("strtod", 500, [&] {
+        double sum = 0.0;
+        for (const std::string& value : realTexts)
+        {
+            sum += std::strtod(value.c_str(), nullptr);
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("std::from_chars", 500, [&] {
+        double sum = 0.0;
+        for (const std::string& value : realTexts)
+        {
+            double result = 0.0;
+            std::from_chars(value.data(), value.data() + value.size(),
+                result);
+            sum += result;
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("String::parseFloat", 500, [&] {
+        double sum = 0.0;
+        for (const std::string& value : realTexts)
+        {
+            double result = 0.0;
+            axc::String::parseFloat(axc::StringView(value.data(),
+                value.size()), result);
+            sum += result;
+        }
+        bench::doNotOptimize(sum);
+    });
+}
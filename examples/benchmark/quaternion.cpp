@@ -0,0 +1,107 @@
+#include "benchmark.hpp"
+#include <axiom/math.hpp>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+// Normalized lerp written the plain way, over float[4] quaternions
+void blendScalar(const float* from, const float* to, float* out, int count,
+    float alpha)
+{
+    for (int i = 0; i < count; i++)
+    {
+        const float* a = from + i * 4;
+        const float* b = to + i * 4;
+        float dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+        float weight = dot < 0.f ? -alpha : alpha;
+        float r[4];
+        for (int k = 0; k < 4; k++)
+        {
+            r[k] = a[k] * (1.f - alpha) + b[k] * weight;
+        }
+        float inv = 1.f / std::sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2]
+            + r[3] * r[3]);
+        for (int k = 0; k < 4; k++)
+        {
+            out[i * 4 + k] = r[k] * inv;
+        }
+    }
+}
+
+} // namespace
+
+void benchQuaternion(void)
+{
+    // Two poses of a crowd of skeletons, 10k bones in all, blended into a
+    // third as an animation cross-fade does every frame
+    const int bones = 10000;
+    std::vector<axm::Quaternion> idle(bones);
+    std::vector<axm::Quaternion> walk(bones);
+    std::vector<axm::Quaternion> pose(bones);
+    for (int i = 0; i < bones; i++)
+    {
+        float f = (float)i * 0.01f;
+        idle[i] = axm::Quaternion(axm::Rotator(f, 2.f * f, -f));
+        walk[i] = axm::Quaternion(axm::Rotator(-f, 30.f + f, 3.f * f));
+    }
+    const float* idleData = idle[0].xyzw;
+    const float* walkData = walk[0].xyzw;
+    float* poseData = pose[0].xyzw;
+
+    bench::section("quaternion: blending two 10k-bone poses");
+    bench::run("float[4], scalar nlerp", 1000, [&] {
+        blendScalar(idleData, walkData, poseData, bones, 0.3f);
+        bench::doNotOptimize(pose[0]);
+    });
+    bench::run("Quaternion::slerp, one bone at a time", 1000, [&] {
+        for (int i = 0; i < bones; i++)
+        {
+            pose[i] = axm::Quaternion::slerp(idle[i], walk[i], 0.3f);
+        }
+        bench::doNotOptimize(pose[0]);
+    });
+    bench::run("Quaternion::nlerp, one bone at a time", 1000, [&] {
+        for (int i = 0; i < bones; i++)
+        {
+            pose[i] = axm::Quaternion::nlerp(idle[i], walk[i], 0.3f);
+        }
+        bench::doNotOptimize(pose[0]);
+    });
+    bench::run("Quaternion::blend, four bones per register", 1000, [&] {
+        axm::Quaternion::blend(idle.data(), walk.data(), pose.data(), bones,
+            0.3f);
+        bench::doNotOptimize(pose[0]);
+    });
+
+    const int vertices = 65536;
+    std::vector<axm::Vector3> normals(vertices);
+    std::vector<axm::Vector3> rotated(vertices);
+    for (int i = 0; i < vertices; i++)
+    {
+        normals[i] = axm::Vector3((float)(i % 7), (float)(i % 13), 1.f);
+    }
+    const axm::Quaternion& bone = walk[bones / 2];
+
+    bench::section("quaternion: 65536 rotated vectors");
+    bench::run("rotateVector, one vector at a time", 200, [&] {
+        for (int i = 0; i < vertices; i++)
+        {
+            rotated[i] = bone.rotateVector(normals[i]);
+        }
+        bench::doNotOptimize(rotated[0]);
+    });
+    bench::run("getMatrix, then transformVector", 200, [&] {
+        const axm::Matrix matrix = bone.getMatrix();
+        for (int i = 0; i < vertices; i++)
+        {
+            rotated[i] = matrix.transformVector(normals[i]);
+        }
+        bench::doNotOptimize(rotated[0]);
+    });
+    bench::run("rotateVectors, four vectors per register", 200, [&] {
+        bone.rotateVectors(normals.data(), rotated.data(), vertices);
+        bench::doNotOptimize(rotated[0]);
+    });
+}
@@ -0,0 +1,161 @@
+#include "benchmark.hpp"
+#include <axiom/container.hpp>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static const Uint64 itemCount = 1 << 18;
+
+// Spreads `itemCount` items over `producers` threads, drains them with
+// `consumers` threads, and waits for every thread to finish
+template<typename Push, typename Pop>
+static void transfer(int producers, int consumers, Push&& push, Pop&& pop)
+{
+    std::vector<std::thread> threads;
+    std::atomic<Uint64> popped(0);
+
+    for (int p = 0; p < producers; p++)
+    {
+        threads.emplace_back([&] {
+            for (Uint64 i = 0; i < itemCount / producers; i++)
+            {
+                while (!push(i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++)
+    {
+        threads.emplace_back([&] {
+            Uint64 item;
+            while (popped.load(std::memory_order_relaxed)
+                < itemCount / producers * producers)
+            {
+                if (pop(item))
+                {
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Reports a transfer measured by bench::run as a cost per item
+static void perItem(double nanoseconds)
+{
+    std::printf("  %-44s %12.2f ns\n", "  per item", nanoseconds / itemCount);
+}
+
+void benchQueue(void)
+{
+    bench::section("queue: 256K items, 1 producer and 1 consumer");
+    axc::SpscQueue<Uint64> spsc(1024);
+    perItem(bench::run("axc::SpscQueue", 5, [&] {
+        transfer(1, 1, [&](Uint64 item) { return (spsc.tryPush(item)); },
+            [&](Uint64& item) { return (spsc.tryPop(item)); });
+    }));
+    perItem(bench::run("axc::SpscQueue in batches of 32", 5, [&] {
+        std::thread producer([&] {
+            Uint64 batch[32] = {};
+            for (Uint64 i = 0; i < itemCount; )
+            {
+                Uint64 pushed = spsc.pushBatch(batch, 32);
+                i += pushed;
+                if (pushed == 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        Uint64 batch[32];
+        for (Uint64 i = 0; i < itemCount; )
+        {
+            Uint64 popped = spsc.popBatch(batch, 32);
+            i += popped;
+            if (popped == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+    }));
+
+    for (int threads : {1, 2, 4})
+    {
+        char title[64];
+        std::snprintf(title, sizeof(title),
+            "queue: 256K items, %d producers and %d consumers", threads,
+            threads);
+        bench::section(title);
+
+        axc::MpmcQueue<Uint64> mpmc(1024);
+        perItem(bench::run("axc::MpmcQueue", 5, [&] {
+            transfer(threads, threads,
+                [&](Uint64 item) { return (mpmc.tryPush(item)); },
+                [&](Uint64& item) { return (mpmc.tryPop(item)); });
+        }));
+
+        std::mutex mutex;
+        std::deque<Uint64> deque;
+        perItem(bench::run("std::deque + std::mutex", 5, [&] {
+            transfer(threads, threads, [&](Uint64 item) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (deque.size() >= 1024)
+                {
+                    return (false);
+                }
+                deque.push_back(item);
+                return (true);
+            }, [&](Uint64& item) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (deque.empty())
+                {
+                    return (false);
+                }
+                item = deque.front();
+                deque.pop_front();
+                return (true);
+            });
+        }));
+    }
+
+    bench::section("queue: 16K round trips between two threads");
+    axc::SpscQueue<Uint64> ping(64);
+    axc::SpscQueue<Uint64> pong(64);
+    double roundTrips = bench::run("axc::SpscQueue", 5, [&] {
+        std::thread echo([&] {
+            Uint64 item;
+            for (int i = 0; i < 16384; i++)
+            {
+                while (!ping.tryPop(item))
+                {
+                    std::this_thread::yield();
+                }
+                pong.tryPush(item);
+            }
+        });
+        Uint64 item;
+        for (Uint64 i = 0; i < 16384; i++)
+        {
+            ping.tryPush(i);
+            while (!pong.tryPop(item))
+            {
+                std::this_thread::yield();
+            }
+        }
+        echo.join();
+    });
+    std::printf("  %-44s %12.2f ns\n", "  per round trip", roundTrips / 16384);
+}
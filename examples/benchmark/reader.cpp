@@ -0,0 +1,89 @@
+#include "benchmark.hpp"
+#include <axiom/container.hpp>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+void benchReader(void)
+{
+    // About 8 MB of log lines of varying length
+    std::string text;
+    for (int i = 0; text.size() < 8 * 1024 * 1024; i++)
+    {
+        char line[160];
+        std::snprintf(line, sizeof(line),
+            "[%08d] renderer: frame %d submitted %d draw calls in %d us%s\n",
+            i, i / 3, i % 700, i % 9000,
+            (i % 5 == 0) ? ", shadow cascades rebuilt for 4 lights" : "");
+        text += line;
+    }
+    std::FILE* file = std::tmpfile();
+    std::fwrite(text.data(), 1, text.size(), file);
+
+    bench::section("reader: 8 MB of log lines");
+    bench::run("std::getline, std::istringstream", 5, [&] {
+        std::istringstream stream(text);
+        std::string line;
+        Uint64 count = 0;
+        while (std::getline(stream, line))
+        {
+            count += line.size();
+        }
+        bench::doNotOptimize(count);
+    });
+    bench::run("getline to String, std::istringstream", 5, [&] {
+        std::istringstream stream(text);
+        axc::String line;
+        Uint64 count = 0;
+        while (getline(stream, line))
+        {
+            count += line.length();
+        }
+        bench::doNotOptimize(count);
+    });
+    bench::run("StringReader to String, std::istringstream", 5, [&] {
+        std::istringstream stream(text);
+        axc::StringReader reader(stream);
+        axc::String line;
+        Uint64 count = 0;
+        while (reader.readLine(line))
+        {
+            count += line.length();
+        }
+        bench::doNotOptimize(count);
+    });
+    bench::run("fgets, FILE*", 5, [&] {
+        std::rewind(file);
+        char line[256];
+        Uint64 count = 0;
+        while (std::fgets(line, sizeof(line), file))
+        {
+            count += std::strlen(line);
+        }
+        bench::doNotOptimize(count);
+    });
+    bench::run("StringReader to String, FILE*", 5, [&] {
+        std::rewind(file);
+        axc::StringReader reader(file);
+        axc::String line;
+        Uint64 count = 0;
+        while (reader.readLine(line))
+        {
+            count += line.length();
+        }
+        bench::doNotOptimize(count);
+    });
+    bench::run("StringReader to StringView, FILE*", 5, [&] {
+        std::rewind(file);
+        axc::StringReader reader(file);
+        axc::StringView line;
+        Uint64 count = 0;
+        while (reader.readLine(line))
+        {
+            count += line.length();
+        }
+        bench::doNotOptimize(count);
+    });
+    std::fclose(file);
+}
@@ -0,0 +1,54 @@
+#include "benchmark.hpp"
+#include <axiom/container.hpp>
+#include <cstdio>
+#include <string>
+
+void benchRope(void)
+{
+    const Uint64 lengths[] = {1 << 16, 1 << 22};
+    std::string line(63, 'x');
+    line += '\n';
+
+    for (Uint64 length : lengths)
+    {
+        axc::String text;
+        axc::Rope rope;
+        while (text.length() < length)
+        {
+            text.append(line.data(), line.size());
+            rope.append(axc::StringView(line.data(), line.size()));
+        }
+        char title[64];
+        std::snprintf(title, sizeof(title), "rope: %llu bytes of text",
+            (unsigned long long)length);
+        bench::section(title);
+
+        // Edits spread over the text, as an editor with several cursors
+        Uint64 state = 1;
+        auto next = [&state](Uint64 bound) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            return ((state >> 33) % bound);
+        };
+        bench::run("String insert and erase", 2000, [&] {
+            const Uint64 position = next(text.length());
+            text.insert(position, "edit");
+            text.erase(position, 4);
+            bench::doNotOptimize(text.length());
+        });
+        bench::run("Rope insert and erase", 2000, [&] {
+            const Uint64 position = next(rope.length());
+            rope.insert(position, "edit");
+            rope.erase(position, 4);
+            bench::doNotOptimize(rope.length());
+        });
+        bench::run("Rope at", 100000, [&] {
+            bench::doNotOptimize(rope.at(next(rope.length())));
+        });
+        bench::run("Rope toString", 20, [&] {
+            bench::doNotOptimize(rope.toString().length());
+        });
+        bench::run("String copy", 20, [&] {
+            bench::doNotOptimize(axc::String(text).length());
+        });
+    }
+}
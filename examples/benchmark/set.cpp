@@ -0,0 +1,90 @@
+#include "benchmark.hpp"
+#include <axiom/container/set.hpp>
+#include <algorithm>
+#include <set>
+#include <unordered_set>
+#include <vector>
+
+void benchSet(void)
+{
+    std::vector<int> values;
+    for (int i = 0; i < (1 << 16); i++)
+    {
+        values.push_back((int)((Uint32)i * 2654435761u >> 8));
+    }
+
+    bench::section("set: build from 64K unsorted ints");
+    bench::run("axc::Set bulk insert", 50, [&] {
+        axc::Set<int> set(values.data(), values.size());
+        bench::doNotOptimize(set.data());
+    });
+    bench::run("axc::HashSet", 50, [&] {
+        axc::HashSet<int> set;
+        set.insert(values.data(), values.size());
+        bench::doNotOptimize(set.size());
+    });
+    bench::run("std::set", 50, [&] {
+        std::set<int> set(values.begin(), values.end());
+        bench::doNotOptimize(set.size());
+    });
+
+    axc::Set<int> set(values.data(), values.size());
+    axc::HashSet<int> hashSet;
+    hashSet.insert(values.data(), values.size());
+    std::set<int> stdSet(values.begin(), values.end());
+    std::vector<int> sorted(values);
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<int> queries;
+    for (Uint64 i = 0; i < values.size(); i++)
+    {
+        queries.push_back(values[i * 7919 % values.size()]);
+    }
+
+    bench::section("set: look up 64K ints in random order");
+    bench::run("axc::Set", 50, [&] {
+        int found = 0;
+        for (int value : queries)
+        {
+            found += set.contains(value);
+        }
+        bench::doNotOptimize(found);
+    });
+    bench::run("axc::HashSet", 50, [&] {
+        int found = 0;
+        for (int value : queries)
+        {
+            found += hashSet.contains(value);
+        }
+        bench::doNotOptimize(found);
+    });
+    bench::run("std::binary_search", 50, [&] {
+        int found = 0;
+        for (int value : queries)
+        {
+            found += std::binary_search(sorted.begin(), sorted.end(), value);
+        }
+        bench::doNotOptimize(found);
+    });
+    bench::run("std::set", 50, [&] {
+        int found = 0;
+        for (int value : queries)
+        {
+            found += stdSet.count(value) != 0;
+        }
+        bench::doNotOptimize(found);
+    });
+
+    axc::Set<int> other(values.data() + values.size() / 2, values.size() / 2);
+
+    bench::section("set: intersect 64K and 32K ints");
+    bench::run("axc::Set", 50, [&] {
+        bench::doNotOptimize(set.intersectionWith(other).size());
+    });
+    bench::run("std::set_intersection", 50, [&] {
+        std::vector<int> result;
+        std::set_intersection(set.begin(), set.end(), other.begin(),
+            other.end(), std::back_inserter(result));
+        bench::doNotOptimize(result.size());
+    });
+}
@@ -0,0 +1,181 @@
+#include "benchmark.hpp"
+#include <axiom/container/string.hpp>
+#include <string>
+
+static const char chunk[] = "uniform vec3 ab;";
+
+static std::string makeText(Uint64 length)
+{
+    static const char words[] = "vec3 float uniform in out layout main ";
+    std::string text;
+
+    while (text.size() < length)
+    {
+        text.append(words);
+    }
+    text.resize(length);
+    return (text);
+}
+
+void benchString(void)
+{
+    bench::section("string: append 1 MiB in 16 byte chunks");
+    bench::run("axc::String", 20, [] {
+        axc::String str;
+        for (int i = 0; i < 65536; i++)
+        {
+            str.append(chunk, 16);
+        }
+        bench::doNotOptimize(str);
+    });
+    bench::run("std::string", 20, [] {
+        std::string str;
+        for (int i = 0; i < 65536; i++)
+        {
+            str.append(chunk, 16);
+        }
+        bench::doNotOptimize(str);
+    });
+
+    bench::section("string: append 1 MiB one character at a time");
+    bench::run("axc::String", 20, [] {
+        axc::String str;
+        for (int i = 0; i < (1 << 20); i++)
+        {
+            str.append('x');
+        }
+        bench::doNotOptimize(str);
+    });
+    bench::run("std::string", 20, [] {
+        std::string str;
+        for (int i = 0; i < (1 << 20); i++)
+        {
+            str.push_back('x');
+        }
+        bench::doNotOptimize(str);
+    });
+
+    bench::section("string: construct a short identifier");
+    bench::run("axc::String", 1000000, [] {
+        axc::String str("uModelViewMatrix");
+        bench::doNotOptimize(str);
+    });
+    bench::run("std::string", 1000000, [] {
+        std::string str("uModelViewMatrix");
+        bench::doNotOptimize(str);
+    });
+
+    const std::string text = makeText(1 << 20);
+    const axc::String atext(text.c_str());
+    const std::string longNeedle = makeText(300) + "#";
+
+    bench::section("string: find in 1 MiB of text");
+    bench::run("axc::String find(char)", 50, [&] {
+        bench::doNotOptimize(atext.find('#'));
+    });
+    bench::run("std::string find(char)", 50, [&] {
+        bench::doNotOptimize(text.find('#'));
+    });
+    bench::run("axc::String find(\"gl_Position\")", 50, [&] {
+        bench::doNotOptimize(atext.find("gl_Position"));
+    });
+    bench::run("std::string find(\"gl_Position\")", 50, [&] {
+        bench::doNotOptimize(text.find("gl_Position"));
+    });
+    bench::run("axc::String find(\"main()\")", 50, [&] {
+        bench::doNotOptimize(atext.find("main()"));
+    });
+    bench::run("std::string find(\"main()\")", 50, [&] {
+        bench::doNotOptimize(text.find("main()"));
+    });
+    bench::run("axc::String find(301 characters)", 50, [&] {
+        bench::doNotOptimize(atext.find(longNeedle.c_str()));
+    });
+    bench::run("std::string find(301 characters)", 50, [&] {
+        bench::doNotOptimize(text.find(longNeedle));
+    });
+    bench::run("axc::String rfind(\"gl_Position\")", 50, [&] {
+        bench::doNotOptimize(atext.rfind("gl_Position"));
+    });
+    bench::run("std::string rfind(\"gl_Position\")", 50, [&] {
+        bench::doNotOptimize(text.rfind("gl_Position"));
+    });
+
+    bench::section("string: edits in the middle of 64 KiB");
+    const std::string middle = makeText(1 << 16);
+    bench::run("axc::String insert + erase", 2000, [&] {
+        static axc::String str(middle.c_str());
+        str.insert(str.length() / 2, "uniform");
+        str.erase(str.length() / 2, 7);
+        bench::doNotOptimize(str);
+    });
+    bench::run("std::string insert + erase", 2000, [&] {
+        static std::string str(middle);
+        str.insert(str.length() / 2, "uniform");
+        str.erase(str.length() / 2, 7);
+        bench::doNotOptimize(str);
+    });
+
+    bench::section("string: replace every \"float\" in 1 MiB of text");
+    bench::run("axc::String replaceAll by \"vec4\"", 20, [&] {
+        axc::String str(atext);
+        str.replaceAll("float", "vec4");
+        bench::doNotOptimize(str);
+    });
+    bench::run("std::string find + replace by \"vec4\"", 2, [&] {
+        std::string str(text);
+        for (Uint64 i = str.find("float"); i != std::string::npos;
+            i = str.find("float", i + 4))
+        {
+            str.replace(i, 5, "vec4");
+        }
+        bench::doNotOptimize(str);
+    });
+    bench::run("axc::String replaceAll by \"double\"", 20, [&] {
+        axc::String str(atext);
+        str.replaceAll("float", "double");
+        bench::doNotOptimize(str);
+    });
+
+    bench::section("string: tokenize 1 MiB of text");
+    bench::run("axc::String tokenize (views)", 20, [&] {
+        Uint64 count = 0;
+        for (axc::StringView token : atext.tokenize(axc::CharSet(" ")))
+        {
+            count += token.length();
+        }
+        bench::doNotOptimize(count);
+    });
+    bench::run("std::string find + substr", 20, [&] {
+        Uint64 count = 0;
+        Uint64 start = text.find_first_not_of(' ');
+        while (start != std::string::npos)
+        {
+            Uint64 stop = text.find(' ', start);
+            count += text.substr(start, stop - start).length();
+            start = text.find_first_not_of(' ', stop);
+        }
+        bench::doNotOptimize(count);
+    });
+
+    const axc::CharSet delimiters("#;{}");
+
+    bench::section("string: character sets over 1 MiB of text");
+    bench::run("axc::String findFirstOf(\"#;{}\")", 50, [&] {
+        bench::doNotOptimize(atext.findFirstOf("#;{}"));
+    });
+    bench::run("axc::String findFirstOf(CharSet)", 50, [&] {
+        bench::doNotOptimize(atext.findFirstOf(delimiters));
+    });
+    bench::run("std::string find_first_of(\"#;{}\")", 50, [&] {
+        bench::doNotOptimize(text.find_first_of("#;{}"));
+    });
+    bench::run("axc::String findFirstNotOf(\"a-z 3\")", 50, [&] {
+        bench::doNotOptimize(atext.findFirstNotOf(
+            "abcdefghijklmnopqrstuvwxyz 3"));
+    });
+    bench::run("std::string find_first_not_of(\"a-z 3\")", 50, [&] {
+        bench::doNotOptimize(text.find_first_not_of(
+            "abcdefghijklmnopqrstuvwxyz 3"));
+    });
+}
@@ -0,0 +1,72 @@
+#include "benchmark.hpp"
+#include <axiom/math.hpp>
+#include <vector>
+
+void benchTransform(void)
+{
+    // A crowd of 100 characters of 100 bones, each bone under the third of
+    // the bones before it, so 10k nodes in all
+    const Uint32 characters = 100;
+    const Uint32 bones = 100;
+    const Uint32 count = characters * bones;
+    axm::TransformHierarchy hierarchy;
+    std::vector<axm::Transform> locals(count);
+    std::vector<Uint32> parents(count);
+    hierarchy.reserve(count);
+    for (Uint32 i = 0; i < count; i++)
+    {
+        Uint32 bone = i % bones;
+        float f = (float)i * 0.01f;
+        locals[i] = axm::Transform(axm::Vector3(0.f, 0.1f, 0.f),
+            axm::Quaternion(axm::Rotator(f, 2.f * f, -f)));
+        parents[i] = bone == 0 ? axm::TransformHierarchy::noParent
+            : i - bone + (bone - 1) / 3;
+        hierarchy.add(locals[i], parents[i]);
+    }
+    hierarchy.update();
+    std::vector<axm::Matrix> worlds(count);
+
+    bench::section("transform: 10k-node hierarchy, per frame");
+    bench::run("recompute every node, no dirty flags", 200, [&] {
+        for (Uint32 i = 0; i < count; i++)
+        {
+            worlds[i] = parents[i] == axm::TransformHierarchy::noParent
+                ? locals[i].getMatrix()
+                : worlds[parents[i]] * locals[i].getMatrix();
+        }
+        bench::doNotOptimize(worlds[0]);
+    });
+    bench::run("update, every local set", 200, [&] {
+        for (Uint32 i = 0; i < count; i++)
+        {
+            hierarchy.setLocal(i, locals[i]);
+        }
+        hierarchy.update();
+        bench::doNotOptimize(hierarchy.getWorld(0));
+    });
+    bench::run("update, every character moved", 200, [&] {
+        for (Uint32 i = 0; i < characters; i++)
+        {
+            hierarchy.setLocal(i * bones, locals[i * bones]);
+        }
+        hierarchy.update();
+        bench::doNotOptimize(hierarchy.getWorld(0));
+    });
+    bench::run("update, one character moved", 200, [&] {
+        hierarchy.setLocal(count / 2, locals[count / 2]);
+        hierarchy.update();
+        bench::doNotOptimize(hierarchy.getWorld(0));
+    });
+    bench::run("update, one hand per character changed", 200, [&] {
+        for (Uint32 i = 0; i < characters; i++)
+        {
+            hierarchy.setLocal(i * bones + 40, locals[i * bones + 40]);
+        }
+        hierarchy.update();
+        bench::doNotOptimize(hierarchy.getWorld(0));
+    });
+    bench::run("update, nothing changed", 200, [&] {
+        hierarchy.update();
+        bench::doNotOptimize(hierarchy.getWorld(0));
+    });
+}
@@ -0,0 +1,143 @@
+#include "benchmark.hpp"
+#include <axiom/container.hpp>
+#include <memory>
+#include <variant>
+#include <vector>
+
+namespace
+{
+
+struct Circle
+{
+    float radius;
+};
+
+struct Rect
+{
+    float width;
+    float height;
+};
+
+struct Triangle
+{
+    float base;
+    float height;
+};
+
+struct Area
+{
+    float operator()(const Circle& shape) const
+    {
+        return (3.14159f * shape.radius * shape.radius);
+    }
+
+    float operator()(const Rect& shape) const
+    {
+        return (shape.width * shape.height);
+    }
+
+    float operator()(const Triangle& shape) const
+    {
+        return (0.5f * shape.base * shape.height);
+    }
+};
+
+struct Shape
+{
+    virtual ~Shape(void) = default;
+    virtual float area(void) const = 0;
+};
+
+struct VirtualCircle : Shape
+{
+    Circle shape;
+    explicit VirtualCircle(Circle s) : shape(s) {}
+    float area(void) const override { return (Area()(shape)); }
+};
+
+struct VirtualRect : Shape
+{
+    Rect shape;
+    explicit VirtualRect(Rect s) : shape(s) {}
+    float area(void) const override { return (Area()(shape)); }
+};
+
+struct VirtualTriangle : Shape
+{
+    Triangle shape;
+    explicit VirtualTriangle(Triangle s) : shape(s) {}
+    float area(void) const override { return (Area()(shape)); }
+};
+
+} // namespace
+
+void benchUnion(void)
+{
+    const int count = 1 << 16;
+    axc::Array<axc::Union<Circle, Rect, Triangle>> unions;
+    std::vector<std::variant<Circle, Rect, Triangle>> variants;
+    std::vector<std::unique_ptr<Shape>> shapes;
+
+    for (int i = 0; i < count; i++)
+    {
+        float size = (float)(i % 100);
+        switch ((Uint32)i * 2654435761u >> 30)
+        {
+            case 0:
+            case 1:
+                unions.pushBack(Circle{size});
+                variants.push_back(Circle{size});
+                shapes.push_back(std::make_unique<VirtualCircle>(
+                    Circle{size}));
+                break;
+            case 2:
+                unions.pushBack(Rect{size, 2.0f});
+                variants.push_back(Rect{size, 2.0f});
+                shapes.push_back(std::make_unique<VirtualRect>(
+                    Rect{size, 2.0f}));
+                break;
+            default:
+                unions.pushBack(Triangle{size, 3.0f});
+                variants.push_back(Triangle{size, 3.0f});
+                shapes.push_back(std::make_unique<VirtualTriangle>(
+                    Triangle{size, 3.0f}));
+                break;
+        }
+    }
+
+    bench::section("union: sum the areas of 64K mixed shapes");
+    bench::run("axc::Union::visit", 100, [&] {
+        float sum = 0.0f;
+        for (const auto& shape : unions)
+        {
+            sum += shape.visit(Area());
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("std::visit", 100, [&] {
+        float sum = 0.0f;
+        for (const auto& shape : variants)
+        {
+            sum += std::visit(Area(), shape);
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("virtual call", 100, [&] {
+        float sum = 0.0f;
+        for (const auto& shape : shapes)
+        {
+            sum += shape->area();
+        }
+        bench::doNotOptimize(sum);
+    });
+
+    bench::section("union: copy 64K trivially copyable unions");
+    bench::run("axc::Array<axc::Union>", 100, [&] {
+        axc::Array<axc::Union<Circle, Rect, Triangle>> copy(unions);
+        bench::doNotOptimize(copy.data());
+    });
+    bench::run("std::vector<std::variant>", 100, [&] {
+        std::vector<std::variant<Circle, Rect, Triangle>> copy(variants);
+        bench::doNotOptimize(copy.data());
+    });
+}
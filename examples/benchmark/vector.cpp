@@ -0,0 +1,131 @@
+#include "benchmark.hpp"
+#include <axiom/math.hpp>
+#include <cmath>
+#include <vector>
+
+void benchVector(void)
+{
+    // Particles stored as Vector3, Vector3A and Vector4
+    const int count = 4096;
+    std::vector<axm::Vector3> positions3(count);
+    std::vector<axm::Vector3> velocities3(count);
+    std::vector<axm::Vector3A> positions3A(count);
+    std::vector<axm::Vector3A> velocities3A(count);
+    std::vector<axm::Vector4> positions4(count);
+    std::vector<axm::Vector4> velocities4(count);
+    for (int i = 0; i < count; i++)
+    {
+        float f = (float)i;
+        positions3[i] = axm::Vector3(f, f * 0.5f, -f);
+        velocities3[i] = axm::Vector3(1.f, (float)(i % 7), 0.25f);
+        positions3A[i] = axm::Vector3A(positions3[i]);
+        velocities3A[i] = axm::Vector3A(velocities3[i]);
+        positions4[i] = axm::Vector4(positions3[i], 1.f);
+        velocities4[i] = axm::Vector4(velocities3[i], 0.f);
+    }
+    const float step = 1.f / 60.f;
+
+    bench::section("vector: 4096 integrations, p += v * dt");
+    bench::run("Vector3, out-of-line scalar operators", 2000, [&] {
+        for (int i = 0; i < count; i++)
+        {
+            positions3[i] += velocities3[i] * step;
+        }
+        bench::doNotOptimize(positions3[0]);
+    });
+    bench::run("Vector3A, inline SIMD operators", 2000, [&] {
+        for (int i = 0; i < count; i++)
+        {
+            positions3A[i] += velocities3A[i] * step;
+        }
+        bench::doNotOptimize(positions3A[0]);
+    });
+    bench::run("Vector4, inline SIMD operators", 2000, [&] {
+        for (int i = 0; i < count; i++)
+        {
+            positions4[i] += velocities4[i] * step;
+        }
+        bench::doNotOptimize(positions4[0]);
+    });
+
+    bench::section("vector: 4096 dot and cross products");
+    bench::run("Vector3 operator| and operator^", 2000, [&] {
+        axm::Vector3 sum;
+        float dot = 0.f;
+        for (int i = 0; i < count; i++)
+        {
+            dot += positions3[i] | velocities3[i];
+            sum += positions3[i] ^ velocities3[i];
+        }
+        bench::doNotOptimize(dot);
+        bench::doNotOptimize(sum);
+    });
+    bench::run("Vector3A operator| and operator^", 2000, [&] {
+        axm::Vector3A sum;
+        float dot = 0.f;
+        for (int i = 0; i < count; i++)
+        {
+            dot += positions3A[i] | velocities3A[i];
+            sum += positions3A[i] ^ velocities3A[i];
+        }
+        bench::doNotOptimize(dot);
+        bench::doNotOptimize(sum);
+    });
+
+    bench::section("vector: 4096 normalizations and lerps");
+    bench::run("Vector3, v / sqrt(v | v) and a + (b - a) * t", 2000, [&] {
+        axm::Vector3 sum;
+        for (int i = 0; i < count; i++)
+        {
+            axm::Vector3 v = velocities3[i];
+            axm::Vector3 normal = v / std::sqrt(v | v);
+            sum += positions3[i] + (normal - positions3[i]) * 0.25f;
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("Vector3A getSafeNormal and lerp", 2000, [&] {
+        axm::Vector3A sum;
+        for (int i = 0; i < count; i++)
+        {
+            axm::Vector3A normal = velocities3A[i].getSafeNormal();
+            sum += axm::Vector3A::lerp(positions3A[i], normal, 0.25f);
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::run("Vector4 getSafeNormal and lerp", 2000, [&] {
+        axm::Vector4 sum;
+        for (int i = 0; i < count; i++)
+        {
+            axm::Vector4 normal = velocities4[i].getSafeNormal();
+            sum += axm::Vector4::lerp(positions4[i], normal, 0.25f);
+        }
+        bench::doNotOptimize(sum);
+    });
+
+    bench::section("vector: 4096 bounds updates");
+    bench::run("Vector3A min and max", 2000, [&] {
+        axm::Vector3A low(1e30f);
+        axm::Vector3A high(-1e30f);
+        for (int i = 0; i < count; i++)
+        {
+            low = axm::Vector3A::min(low, positions3A[i]);
+            high = axm::Vector3A::max(high, positions3A[i]);
+        }
+        bench::doNotOptimize(low);
+        bench::doNotOptimize(high);
+    });
+    bench::run("Vector3 component-wise comparisons", 2000, [&] {
+        axm::Vector3 low(1e30f);
+        axm::Vector3 high(-1e30f);
+        for (int i = 0; i < count; i++)
+        {
+            const axm::Vector3& p = positions3[i];
+            low = axm::Vector3(p.x < low.x ? p.x : low.x,
+                p.y < low.y ? p.y : low.y, p.z < low.z ? p.z : low.z);
+            high = axm::Vector3(p.x > high.x ? p.x : high.x,
+                p.y > high.y ? p.y : high.y, p.z > high.z ? p.z : high.z);
+        }
+        bench::doNotOptimize(low);
+        bench::doNotOptimize(high);
+    });
+}
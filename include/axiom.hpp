@@ -37,5 +37,6 @@
 #include <axiom/container.hpp>
 #include <axiom/graphics.hpp>
 #include <axiom/math.hpp>
+#include <axiom/memory.hpp>
 #include <axiom/reader.hpp>
 #include <axiom/utility.hpp>
@@ -76,6 +76,35 @@
     #error This OS is not supported by Axiom Library
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Identify the SIMD instruction sets available at compile time
+///////////////////////////////////////////////////////////////////////////////
+#if !defined(AXIOM_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || \
+        (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define AXIOM_SIMD_SSE2
+    #endif
+    #if defined(__SSSE3__) || defined(__AVX2__)
+        #define AXIOM_SIMD_SSSE3
+    #endif
+    #if defined(__AVX2__)
+        #define AXIOM_SIMD_AVX2
+    #endif
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define AXIOM_SIMD_NEON
+    #endif
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the size of a cache line, to keep data written by different threads
+// apart
+///////////////////////////////////////////////////////////////////////////////
+#if defined(__APPLE__) && defined(__aarch64__)
+    #define AXIOM_CACHE_LINE_SIZE 128
+#else
+    #define AXIOM_CACHE_LINE_SIZE 64
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Define helpers to create portable import / export macros for each module
 ///////////////////////////////////////////////////////////////////////////////
@@ -113,6 +142,17 @@
     #define AXIOM_DEPRECATED
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Define an helper to mark code paths that can never be taken
+///////////////////////////////////////////////////////////////////////////////
+#if defined(_MSC_VER)
+    #define AXIOM_UNREACHABLE() __assume(0)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define AXIOM_UNREACHABLE() __builtin_unreachable()
+#else
+    #define AXIOM_UNREACHABLE()
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Define a portable check macro to throw an exception on false
 ///////////////////////////////////////////////////////////////////////////////
@@ -34,12 +34,21 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <axiom/container/array.hpp>
 #include <axiom/container/char.hpp>
+#include <axiom/container/charSet.hpp>
 #include <axiom/container/cstring.hpp>
+#include <axiom/container/hashTable.hpp>
 #include <axiom/container/list.hpp>
 #include <axiom/container/map.hpp>
+#include <axiom/container/name.hpp>
 #include <axiom/container/queue.hpp>
+#include <axiom/container/rope.hpp>
 #include <axiom/container/set.hpp>
 #include <axiom/container/string.hpp>
+#include <axiom/container/stringBuilder.hpp>
+#include <axiom/container/stringNumber.hpp>
+#include <axiom/container/stringReader.hpp>
+#include <axiom/container/stringSearch.hpp>
+#include <axiom/container/stringView.hpp>
 #include <axiom/container/union.hpp>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -29,19 +29,1491 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/memory/allocator.hpp>
+#include <axiom/utility.hpp>
+#include <initializer_list>
+#include <cstring>
+#include <new>
+
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace ax::container
 ///////////////////////////////////////////////////////////////////////////////
 namespace ax::container
 {
 
+// SECTION - Array
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Contiguous growable array.
+///
+/// The capacity doubles whenever it runs out, so appending is amortized
+/// O(1). Elements are moved to a new buffer with a single memcpy when `T`
+/// is trivially relocatable, and one by one through their move constructor
+/// otherwise. Storage comes from the allocator given at construction, the
+/// default one of the process otherwise.
+///
+/// \tparam T
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class Array
+{
+public:
+    // ANCHOR - Member Data
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Uint64 npos = -1;  //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Capacity of the first heap buffer.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 minCapacity = 4;    //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Iterator = T*;
+    using ConstIterator = const T*;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    T* m_data = nullptr;                        //<!
+    Uint64 m_size = 0;                          //<!
+    Uint64 m_capacity = 0;                      //<!
+    Uint64 m_inlineCapacity = 0;                //<! Zero without a buffer
+    memory::Allocator* m_allocator = nullptr;   //<! nullptr for the default
+
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Array(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build an empty array whose storage comes from `allocator`,
+    /// which must outlive it.
+    ///
+    /// \param allocator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Array(memory::Allocator& allocator);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build an array of `size` value-initialized elements.
+    ///
+    /// \param size
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Array(Uint64 size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param size
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Array(Uint64 size, const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param items
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Array(const T* items, Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param items
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Array(std::initializer_list<T> items);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy `other` into an array using the default allocator.
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Array(const Array& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take the buffer of `other`, along with its allocator. Elements
+    /// stored inline in `other` are moved one by one.
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Array(Array&& other);
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build an empty array using the inline buffer of `SmallArray`.
+    ///
+    /// \param inlineCapacity
+    /// \param allocator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Array(Uint64 inlineCapacity, memory::Allocator* allocator);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build an array using the inline buffer of `SmallArray` and
+    /// take the elements and allocator of `other`.
+    ///
+    /// \param inlineCapacity
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Array(Uint64 inlineCapacity, Array&& other);
+
+public:
+    // ANCHOR - Destructor
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~Array(void);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Array& operator=(const Array& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take the buffer of `other` when both arrays share the same
+    /// allocator and it is not inline, move the elements otherwise.
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Array& operator=(Array&& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param items
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Array& operator=(std::initializer_list<T> items);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    T& operator[](Uint64 index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const T& operator[](Uint64 index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator==(const Array& other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator!=(const Array& other) const;
+
+public:
+    // SECTION - Public Methods
+
+    // ANCHOR - Access
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Bounds checked access.
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD T& at(Uint64 index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Bounds checked access.
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const T& at(Uint64 index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD T& front(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const T& front(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD T& back(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const T& back(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD T* data(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const T* data(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator begin(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator begin(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator end(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator end(void) const;
+
+    // ANCHOR - Modification
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void pushBack(const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void pushBack(T&& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Construct an element in place at the end of the array.
+    ///
+    /// The arguments may refer to elements of the array itself.
+    ///
+    /// \tparam Args
+    ///
+    /// \param args Constructor arguments
+    ///
+    /// \return The new element
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Args>
+    T& emplaceBack(Args&&... args);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void popBack(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append `count` copies of the elements starting at `items`.
+    ///
+    /// \param items
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void append(const T* items, Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void insert(Uint64 position, const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void insert(Uint64 position, T&& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Construct an element in place before `position`, shifting
+    /// the following elements.
+    ///
+    /// \tparam Args
+    ///
+    /// \param position
+    /// \param args Constructor arguments
+    ///
+    /// \return The new element
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Args>
+    T& emplace(Uint64 position, Args&&... args);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove `count` elements, shifting the following ones down.
+    ///
+    /// \param position
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void erase(Uint64 position, Uint64 count = 1);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove an element in O(1) by moving the last element into its
+    /// slot. The order of the elements is not preserved.
+    ///
+    /// \param position
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void eraseUnordered(Uint64 position);
+
+    // ANCHOR - Research
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    /// \param position
+    ///
+    /// \return The index of the first match from `position`, or npos
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 find(const T& value, Uint64 position = 0) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool contains(const T& value) const;
+
+    // ANCHOR - Information
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 capacity(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the allocator the storage comes from.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD memory::Allocator& getAllocator(void) const;
+
+    // ANCHOR - Transform
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param capacity
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void reserve(Uint64 capacity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Resize the array, value-initializing the new elements.
+    ///
+    /// \param size
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void resize(Uint64 size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param size
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void resize(Uint64 size, const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destroy every element, keeping the storage.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Release the unused capacity, going back to the inline buffer
+    /// when the elements fit in it.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void shrinkToFit(void);
+
+    // !SECTION
+
+private:
+    // ANCHOR - Private Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the inline buffer of `SmallArray`, which directly follows
+    /// the `Array` base in memory.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    T* _inlineData(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool _isInline(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the capacity to grow to so that `needed` elements fit.
+    ///
+    /// \param needed
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 _grownCapacity(Uint64 needed) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get a buffer of `capacity` elements, the inline one when it is
+    /// big enough.
+    ///
+    /// \param capacity
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    T* _allocate(Uint64 capacity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Give the current buffer back, unless it is the inline one.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _deallocate(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move the elements to a buffer of `capacity` elements.
+    ///
+    /// \param capacity
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _reallocate(Uint64 capacity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Grow the buffer and construct one element at the end. The new
+    /// element is built before the old ones are moved, so `args` may refer
+    /// to them.
+    ///
+    /// \tparam Args
+    ///
+    /// \param args
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Args>
+    T& _emplaceBackSlow(Args&&... args);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take the elements of `other`, stealing its heap buffer when
+    /// possible.
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _take(Array& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move `count` elements from `source` to the uninitialized
+    /// `destination`, leaving `source` uninitialized.
+    ///
+    /// \param destination
+    /// \param source
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void _relocate(T* destination, T* source, Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param first
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void _destroy(T* first, Uint64 count);
+};
+
+// !SECTION
+
+// SECTION - Small Array
+
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Array storing up to `N` elements inline, without any heap
+/// allocation, before spilling to the allocator.
+///
+/// It can be passed wherever an `Array<T>&` is expected.
+///
+/// \tparam T
+/// \tparam N Inline capacity
 ///
 ///////////////////////////////////////////////////////////////////////////////
-struct Array
+template <typename T, Uint64 N>
+class SmallArray : public Array<T>
 {
+    static_assert(N != 0, "SmallArray needs an inline capacity");
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    alignas(T) unsigned char m_storage[N * sizeof(T)];  //<!
+
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SmallArray(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param allocator Allocator used once the inline buffer is full
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit SmallArray(memory::Allocator& allocator);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param items
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SmallArray(std::initializer_list<T> items);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SmallArray(const Array<T>& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SmallArray(const SmallArray& other);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SmallArray(Array<T>&& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SmallArray(SmallArray&& other);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SmallArray& operator=(const SmallArray& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SmallArray& operator=(SmallArray&& other);
+
+    using Array<T>::operator=;
 };
 
+// !SECTION
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>::Array(void) {}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>::Array(memory::Allocator& allocator)
+    : m_allocator(&allocator)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>::Array(Uint64 size)
+{
+    resize(size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>::Array(Uint64 size, const T& value)
+{
+    resize(size, value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>::Array(const T* items, Uint64 count)
+{
+    append(items, count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>::Array(std::initializer_list<T> items)
+{
+    append(items.begin(), items.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>::Array(const Array& other)
+{
+    append(other.m_data, other.m_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>::Array(Array&& other)
+    : m_allocator(other.m_allocator)
+{
+    _take(other);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>::Array(Uint64 inlineCapacity, memory::Allocator* allocator)
+    : m_capacity(inlineCapacity)
+    , m_inlineCapacity(inlineCapacity)
+    , m_allocator(allocator)
+{
+    m_data = _inlineData();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>::Array(Uint64 inlineCapacity, Array&& other)
+    : m_capacity(inlineCapacity)
+    , m_inlineCapacity(inlineCapacity)
+    , m_allocator(other.m_allocator)
+{
+    m_data = _inlineData();
+    _take(other);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>::~Array(void)
+{
+    _destroy(m_data, m_size);
+    _deallocate();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>& Array<T>::operator=(const Array& other)
+{
+    if (this != &other)
+    {
+        clear();
+        append(other.m_data, other.m_size);
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>& Array<T>::operator=(Array&& other)
+{
+    if (this != &other)
+    {
+        clear();
+        _take(other);
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Array<T>& Array<T>::operator=(std::initializer_list<T> items)
+{
+    clear();
+    append(items.begin(), items.size());
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T& Array<T>::operator[](Uint64 index)
+{
+    return (m_data[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+const T& Array<T>::operator[](Uint64 index) const
+{
+    return (m_data[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool Array<T>::operator==(const Array& other) const
+{
+    if (m_size != other.m_size)
+    {
+        return (false);
+    }
+    for (Uint64 i = 0; i < m_size; i++)
+    {
+        if (!(m_data[i] == other.m_data[i]))
+        {
+            return (false);
+        }
+    }
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool Array<T>::operator!=(const Array& other) const
+{
+    return (!(*this == other));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD T& Array<T>::at(Uint64 index)
+{
+    CHECK(index < m_size);
+    return (m_data[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD const T& Array<T>::at(Uint64 index) const
+{
+    CHECK(index < m_size);
+    return (m_data[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD T& Array<T>::front(void)
+{
+    return (m_data[0]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD const T& Array<T>::front(void) const
+{
+    return (m_data[0]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD T& Array<T>::back(void)
+{
+    return (m_data[m_size - 1]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD const T& Array<T>::back(void) const
+{
+    return (m_data[m_size - 1]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD T* Array<T>::data(void)
+{
+    return (m_data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD const T* Array<T>::data(void) const
+{
+    return (m_data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD typename Array<T>::Iterator Array<T>::begin(void)
+{
+    return (m_data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD typename Array<T>::ConstIterator Array<T>::begin(void) const
+{
+    return (m_data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD typename Array<T>::Iterator Array<T>::end(void)
+{
+    return (m_data + m_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD typename Array<T>::ConstIterator Array<T>::end(void) const
+{
+    return (m_data + m_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::pushBack(const T& value)
+{
+    emplaceBack(value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::pushBack(T&& value)
+{
+    emplaceBack(axu::move(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+template <typename... Args>
+T& Array<T>::emplaceBack(Args&&... args)
+{
+    if (m_size == m_capacity)
+    {
+        return (_emplaceBackSlow(axu::forward<Args>(args)...));
+    }
+    T* slot = new (m_data + m_size) T(axu::forward<Args>(args)...);
+    m_size++;
+    return (*slot);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::popBack(void)
+{
+    CHECK(m_size != 0);
+    m_size--;
+    _destroy(m_data + m_size, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::append(const T* items, Uint64 count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    if (m_size + count > m_capacity)
+    {
+        if (items >= m_data && items < m_data + m_size)
+        {
+            Array copy(items, count);
+            append(copy.m_data, count);
+            return;
+        }
+        _reallocate(_grownCapacity(m_size + count));
+    }
+    if (std::is_trivially_copyable<T>::value)
+    {
+        std::memcpy(static_cast<void*>(m_data + m_size), items,
+            count * sizeof(T));
+    }
+    else
+    {
+        for (Uint64 i = 0; i < count; i++)
+        {
+            new (m_data + m_size + i) T(items[i]);
+        }
+    }
+    m_size += count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::insert(Uint64 position, const T& value)
+{
+    emplace(position, value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::insert(Uint64 position, T&& value)
+{
+    emplace(position, axu::move(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+template <typename... Args>
+T& Array<T>::emplace(Uint64 position, Args&&... args)
+{
+    CHECK(position <= m_size);
+    if (position == m_size)
+    {
+        return (emplaceBack(axu::forward<Args>(args)...));
+    }
+    T value(axu::forward<Args>(args)...);
+
+    if (m_size == m_capacity)
+    {
+        _reallocate(_grownCapacity(m_size + 1));
+    }
+    T* slot = m_data + position;
+    if (axu::is_trivially_relocatable<T>::value)
+    {
+        std::memmove(static_cast<void*>(slot + 1), slot,
+            (m_size - position) * sizeof(T));
+        new (slot) T(axu::move(value));
+    }
+    else
+    {
+        new (m_data + m_size) T(axu::move(m_data[m_size - 1]));
+        for (T* it = m_data + m_size - 1; it != slot; --it)
+        {
+            *it = axu::move(*(it - 1));
+        }
+        *slot = axu::move(value);
+    }
+    m_size++;
+    return (*slot);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::erase(Uint64 position, Uint64 count)
+{
+    CHECK(position <= m_size);
+    if (count > m_size - position)
+    {
+        count = m_size - position;
+    }
+    if (count == 0)
+    {
+        return;
+    }
+    T* first = m_data + position;
+    const Uint64 tail = m_size - position - count;
+
+    if (axu::is_trivially_relocatable<T>::value)
+    {
+        _destroy(first, count);
+        std::memmove(static_cast<void*>(first), first + count,
+            tail * sizeof(T));
+    }
+    else
+    {
+        for (Uint64 i = 0; i < tail; i++)
+        {
+            first[i] = axu::move(first[i + count]);
+        }
+        _destroy(first + tail, count);
+    }
+    m_size -= count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::eraseUnordered(Uint64 position)
+{
+    CHECK(position < m_size);
+    m_size--;
+    if (position != m_size)
+    {
+        m_data[position] = axu::move(m_data[m_size]);
+    }
+    _destroy(m_data + m_size, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD Uint64 Array<T>::find(const T& value, Uint64 position) const
+{
+    for (Uint64 i = position; i < m_size; i++)
+    {
+        if (m_data[i] == value)
+        {
+            return (i);
+        }
+    }
+    return (npos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD bool Array<T>::contains(const T& value) const
+{
+    return (find(value) != npos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD Uint64 Array<T>::size(void) const
+{
+    return (m_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD Uint64 Array<T>::capacity(void) const
+{
+    return (m_capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD bool Array<T>::isEmpty(void) const
+{
+    return (m_size == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD memory::Allocator& Array<T>::getAllocator(void) const
+{
+    return (m_allocator ? *m_allocator : memory::Allocator::getDefault());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::reserve(Uint64 capacity)
+{
+    if (capacity > m_capacity)
+    {
+        _reallocate(capacity);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::resize(Uint64 size)
+{
+    if (size < m_size)
+    {
+        _destroy(m_data + size, m_size - size);
+        m_size = size;
+        return;
+    }
+    reserve(size);
+    for (Uint64 i = m_size; i < size; i++)
+    {
+        new (m_data + i) T();
+    }
+    m_size = size;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::resize(Uint64 size, const T& value)
+{
+    if (size <= m_size)
+    {
+        resize(size);
+        return;
+    }
+    if (size > m_capacity && &value >= m_data && &value < m_data + m_size)
+    {
+        T copy(value);
+        resize(size, copy);
+        return;
+    }
+    reserve(size);
+    for (Uint64 i = m_size; i < size; i++)
+    {
+        new (m_data + i) T(value);
+    }
+    m_size = size;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::clear(void)
+{
+    _destroy(m_data, m_size);
+    m_size = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::shrinkToFit(void)
+{
+    if (m_capacity > m_size && !_isInline())
+    {
+        _reallocate(m_size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T* Array<T>::_inlineData(void) const
+{
+    const Uint64 offset = (sizeof(Array) + alignof(T) - 1)
+        / alignof(T) * alignof(T);
+
+    return (reinterpret_cast<T*>(const_cast<char*>(
+        reinterpret_cast<const char*>(this)) + offset));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool Array<T>::_isInline(void) const
+{
+    return (m_inlineCapacity != 0 && m_data == _inlineData());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Uint64 Array<T>::_grownCapacity(Uint64 needed) const
+{
+    Uint64 capacity = m_capacity * 2;
+
+    if (capacity < minCapacity)
+    {
+        capacity = minCapacity;
+    }
+    return (capacity < needed ? needed : capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T* Array<T>::_allocate(Uint64 capacity)
+{
+    if (capacity == 0)
+    {
+        return (m_inlineCapacity != 0 ? _inlineData() : nullptr);
+    }
+    if (capacity <= m_inlineCapacity)
+    {
+        return (_inlineData());
+    }
+    return (getAllocator().template allocateArray<T>(capacity));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::_deallocate(void)
+{
+    if (m_data && !_isInline())
+    {
+        getAllocator().deallocateArray(m_data, m_capacity);
+    }
+    m_data = m_inlineCapacity != 0 ? _inlineData() : nullptr;
+    m_capacity = m_inlineCapacity;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::_reallocate(Uint64 capacity)
+{
+    T* buffer = _allocate(capacity);
+
+    if (buffer == m_data)
+    {
+        return;
+    }
+    _relocate(buffer, m_data, m_size);
+    _deallocate();
+    m_data = buffer;
+    m_capacity = capacity < m_inlineCapacity ? m_inlineCapacity : capacity;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+template <typename... Args>
+T& Array<T>::_emplaceBackSlow(Args&&... args)
+{
+    const Uint64 capacity = _grownCapacity(m_size + 1);
+    T* buffer = _allocate(capacity);
+    T* slot = new (buffer + m_size) T(axu::forward<Args>(args)...);
+
+    _relocate(buffer, m_data, m_size);
+    _deallocate();
+    m_data = buffer;
+    m_capacity = capacity;
+    m_size++;
+    return (*slot);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::_take(Array& other)
+{
+    if (other._isInline() || (m_allocator != other.m_allocator
+        && &getAllocator() != &other.getAllocator()))
+    {
+        reserve(other.m_size);
+        _relocate(m_data, other.m_data, other.m_size);
+        m_size = other.m_size;
+        other.m_size = 0;
+        return;
+    }
+    _deallocate();
+    m_data = other.m_data;
+    m_size = other.m_size;
+    m_capacity = other.m_capacity;
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other._deallocate();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::_relocate(T* destination, T* source, Uint64 count)
+{
+    if (axu::is_trivially_relocatable<T>::value)
+    {
+        if (count != 0)
+        {
+            std::memcpy(static_cast<void*>(destination), source,
+                count * sizeof(T));
+        }
+        return;
+    }
+    for (Uint64 i = 0; i < count; i++)
+    {
+        new (destination + i) T(axu::move(source[i]));
+        source[i].~T();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Array<T>::_destroy(T* first, Uint64 count)
+{
+    if (!std::is_trivially_destructible<T>::value)
+    {
+        for (Uint64 i = 0; i < count; i++)
+        {
+            first[i].~T();
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, Uint64 N>
+SmallArray<T, N>::SmallArray(void)
+    : Array<T>(N, nullptr)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, Uint64 N>
+SmallArray<T, N>::SmallArray(memory::Allocator& allocator)
+    : Array<T>(N, &allocator)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, Uint64 N>
+SmallArray<T, N>::SmallArray(std::initializer_list<T> items)
+    : Array<T>(N, nullptr)
+{
+    Array<T>::append(items.begin(), items.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, Uint64 N>
+SmallArray<T, N>::SmallArray(const Array<T>& other)
+    : Array<T>(N, nullptr)
+{
+    Array<T>::append(other.data(), other.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, Uint64 N>
+SmallArray<T, N>::SmallArray(const SmallArray& other)
+    : Array<T>(N, nullptr)
+{
+    Array<T>::append(other.data(), other.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, Uint64 N>
+SmallArray<T, N>::SmallArray(Array<T>&& other)
+    : Array<T>(N, axu::move(other))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, Uint64 N>
+SmallArray<T, N>::SmallArray(SmallArray&& other)
+    : Array<T>(N, axu::move(other))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, Uint64 N>
+SmallArray<T, N>& SmallArray<T, N>::operator=(const SmallArray& other)
+{
+    Array<T>::operator=(other);
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, Uint64 N>
+SmallArray<T, N>& SmallArray<T, N>::operator=(SmallArray&& other)
+{
+    Array<T>::operator=(axu::move(other));
+    return (*this);
+}
+
 } // namespace ax::container
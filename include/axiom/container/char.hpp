@@ -33,6 +33,7 @@
 // Headers
 ///////////////////////////////////////////////////////////////////////////////
 #include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace ax::container
@@ -41,12 +42,109 @@ namespace ax::container
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Classes of the 256 byte values, built at compile time.
+///
+/// Each entry is a combination of `Char::Class` bits, bytes above 127
+/// belonging to no class.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct CharClassTable
+{
+    Uint8 values[256];  //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr CharClassTable(void)
+        : values()
+    {
+        for (int ch = 0; ch < 128; ch++)
+        {
+            bool lower = (ch >= 'a' && ch <= 'z');
+            bool upper = (ch >= 'A' && ch <= 'Z');
+            bool digit = (ch >= '0' && ch <= '9');
+            bool space = (ch == ' ' || (ch >= '\t' && ch <= '\r'));
+            bool print = (ch >= ' ' && ch <= '~');
+            values[ch] = (Uint8)(
+                (lower ? 1 : 0) |
+                (upper ? 2 : 0) |
+                (digit ? 4 : 0) |
+                (digit || (ch >= 'a' && ch <= 'f') ||
+                    (ch >= 'A' && ch <= 'F') ? 8 : 0) |
+                (space ? 16 : 0) |
+                (print && ch != ' ' && !lower && !upper && !digit ? 32 : 0) |
+                (ch < ' ' || ch == 127 ? 64 : 0) |
+                (print ? 128 : 0));
+        }
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief ASCII character classification and case conversion.
+///
+/// Single characters are classified through a 256-entry table and inline in
+/// the caller. The bulk functions work on whole buffers, 16 or 32 bytes at a
+/// time with SSE2 or AVX2, and leave bytes above 127 untouched.
 ///
 ///////////////////////////////////////////////////////////////////////////////
 struct Char
 {
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Character classes, combined as bit masks.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum Class : Uint8
+    {
+        Lower   = 1 << 0,               //<! a-z
+        Upper   = 1 << 1,               //<! A-Z
+        Digit   = 1 << 2,               //<! 0-9
+        XDigit  = 1 << 3,               //<! 0-9, a-f, A-F
+        Space   = 1 << 4,               //<! Space, \t, \n, \v, \f, \r
+        Punct   = 1 << 5,               //<! Printable, neither space nor
+                                        //<! alphanumeric
+        Cntrl   = 1 << 6,               //<! 0-31 and 127
+        Print   = 1 << 7,               //<! 32-126
+        Alpha   = Lower | Upper,        //<!
+        AlNum   = Alpha | Digit,        //<!
+        Graph   = AlNum | Punct         //<!
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr CharClassTable classes{};  //<!
+
 public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param ch
+    ///
+    /// \return The `Class` bits of `ch`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static constexpr Uint8 classify(char ch)
+    {
+        return (classes.values[(Uint8)ch]);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param ch
+    /// \param mask Combination of `Class` bits
+    ///
+    /// \return Whether `ch` belongs to any class of `mask`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static constexpr bool is(char ch, Uint8 mask)
+    {
+        return ((classify(ch) & mask) != 0);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -55,7 +153,10 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static bool isAlNum(char ch);
+    AXIOM_NODISCARD static constexpr bool isAlNum(char ch)
+    {
+        return (is(ch, AlNum));
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -65,7 +166,10 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static bool isAlpha(char ch);
+    AXIOM_NODISCARD static constexpr bool isAlpha(char ch)
+    {
+        return (is(ch, Alpha));
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -75,7 +179,10 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static bool isCntrl(char ch);
+    AXIOM_NODISCARD static constexpr bool isCntrl(char ch)
+    {
+        return (is(ch, Cntrl));
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -85,7 +192,10 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static bool isDigit(char ch);
+    AXIOM_NODISCARD static constexpr bool isDigit(char ch)
+    {
+        return (is(ch, Digit));
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -95,7 +205,10 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static bool isGraph(char ch);
+    AXIOM_NODISCARD static constexpr bool isGraph(char ch)
+    {
+        return (is(ch, Graph));
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -105,7 +218,10 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static bool isLower(char ch);
+    AXIOM_NODISCARD static constexpr bool isLower(char ch)
+    {
+        return (is(ch, Lower));
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -115,7 +231,10 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static bool isPrint(char ch);
+    AXIOM_NODISCARD static constexpr bool isPrint(char ch)
+    {
+        return (is(ch, Print));
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -125,7 +244,10 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static bool isPunct(char ch);
+    AXIOM_NODISCARD static constexpr bool isPunct(char ch)
+    {
+        return (is(ch, Punct));
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -135,7 +257,10 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static bool isSpace(char ch);
+    AXIOM_NODISCARD static constexpr bool isSpace(char ch)
+    {
+        return (is(ch, Space));
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -145,7 +270,10 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static bool isUpper(char ch);
+    AXIOM_NODISCARD static constexpr bool isUpper(char ch)
+    {
+        return (is(ch, Upper));
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -155,7 +283,10 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static bool isXDigit(char ch);
+    AXIOM_NODISCARD static constexpr bool isXDigit(char ch)
+    {
+        return (is(ch, XDigit));
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -165,7 +296,10 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static char toLower(char ch);
+    AXIOM_NODISCARD static constexpr char toLower(char ch)
+    {
+        return (isUpper(ch) ? (char)(ch + 32) : ch);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -175,7 +309,68 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static char toUpper(char ch);
+    AXIOM_NODISCARD static constexpr char toUpper(char ch)
+    {
+        return (isLower(ch) ? (char)(ch - 32) : ch);
+    }
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Convert every character of a buffer to lower case, in place.
+    ///
+    /// \param data
+    /// \param length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void toLowerCase(char* data, Uint64 length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Convert every character of a buffer to upper case, in place.
+    ///
+    /// \param data
+    /// \param length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void toUpperCase(char* data, Uint64 length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Count the characters belonging to any class of `mask`.
+    ///
+    /// \param data
+    /// \param length
+    /// \param mask Combination of `Class` bits
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 count(const char* data, Uint64 length,
+        Uint8 mask);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Measure the leading run of characters belonging to `mask`.
+    ///
+    /// \param data
+    /// \param length
+    /// \param mask Combination of `Class` bits
+    ///
+    /// \return Index of the first other character, or `length`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 span(const char* data, Uint64 length,
+        Uint8 mask);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Measure the leading run of characters outside of `mask`.
+    ///
+    /// \param data
+    /// \param length
+    /// \param mask Combination of `Class` bits
+    ///
+    /// \return Index of the first character of `mask`, or `length`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 spanNot(const char* data, Uint64 length,
+        Uint8 mask);
 };
 
 } // namespace ax::container
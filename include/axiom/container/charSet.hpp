@@ -0,0 +1,261 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::container
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::container
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Set of byte values, built once and scanned many times.
+///
+/// Membership is stored as a 256-bit bitmap and as a nibble lookup table.
+/// With SSSE3 or AVX2 the table classifies 16 or 32 bytes per step whatever
+/// the size of the set. Plain SSE2 compares against each member directly,
+/// which is kept for sets of up to `maxListed` characters.
+///
+///////////////////////////////////////////////////////////////////////////////
+class CharSet
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Uint64 npos = -1;      //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Largest set scanned with per-member comparisons.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Uint64 maxListed = 8;  //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Characters checked one by one before vectorized scanning, so
+    /// that short tokens do not pay for the SIMD setup.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Uint64 scalarPrefix = 8;   //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    CharSet(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param chars
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    CharSet(const char* chars);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param chars
+    /// \param length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    CharSet(const char* chars, Uint64 length);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Set of the characters matched by `Char::isSpace`.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static const CharSet& whitespace(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param ch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void insert(char ch);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param chars
+    /// \param length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void insert(const char* chars, Uint64 length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param ch
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool contains(char ch) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the first member of the set at or after `position`.
+    ///
+    /// \param data
+    /// \param length
+    /// \param position
+    ///
+    /// \return Index of the character, or `npos`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 findFirstIn(const char* data, Uint64 length,
+        Uint64 position = 0) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the last member of the set at or before `position`.
+    ///
+    /// \param data
+    /// \param length
+    /// \param position
+    ///
+    /// \return Index of the character, or `npos`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 findLastIn(const char* data, Uint64 length,
+        Uint64 position = npos) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the first non-member at or after `position`.
+    ///
+    /// \param data
+    /// \param length
+    /// \param position
+    ///
+    /// \return Index of the character, or `npos`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 findFirstNotIn(const char* data, Uint64 length,
+        Uint64 position = 0) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the last non-member at or before `position`.
+    ///
+    /// \param data
+    /// \param length
+    /// \param position
+    ///
+    /// \return Index of the character, or `npos`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 findLastNotIn(const char* data, Uint64 length,
+        Uint64 position = npos) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    /// \param length
+    /// \param position
+    /// \param isMember
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 _findFirst(const char* data, Uint64 length, Uint64 position,
+        bool isMember) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    /// \param length
+    /// \param position
+    /// \param isMember
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 _findLast(const char* data, Uint64 length, Uint64 position,
+        bool isMember) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Tell whether 16 bytes can be classified in one step.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline bool _isVectorized(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Membership mask of the 16 bytes starting at `data`.
+    ///
+    /// \param data
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline Uint32 _match16(const char* data) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Membership mask of the 32 bytes starting at `data`.
+    ///
+    /// \param data
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline Uint32 _match32(const char* data) const;
+
+private:
+    Uint64 m_bitmap[4] = {};        //<! One bit per byte value
+    Uint8 m_lowRows[16] = {};       //<! Bit `h` set for byte `h << 4 | n`
+    Uint8 m_highRows[16] = {};      //<! Bit `h` set for byte `h + 8 << 4 | n`
+    alignas(16) char m_members[maxListed][16] = {}; //<! Broadcast members
+    Uint64 m_size = 0;              //<! Number of distinct members
+};
+
+} // namespace ax::container
@@ -42,11 +42,31 @@ namespace ax::container
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Null-terminated and raw byte string primitives.
+///
+/// Every function comes in a scalar, an SSE2 and an AVX2 version; the best
+/// one the processor supports is selected once at startup through CPUID.
+/// Until then, and on other architectures, the scalar versions are used.
+///
+/// Null-terminated scans read whole aligned blocks, or check for page
+/// boundaries, so they never touch a page the string does not reach.
+/// Bytes always compare as unsigned values.
 ///
 ///////////////////////////////////////////////////////////////////////////////
 struct CString
 {
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Instruction sets the functions can be implemented with.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Implementation : Uint8
+    {
+        Scalar,
+        Sse2,
+        Avx2
+    };
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -64,21 +84,82 @@ public:
     /// \param lhs
     /// \param rhs
     ///
-    /// \return
+    /// \return -1, 0 or 1
     ///
     ///////////////////////////////////////////////////////////////////////////
     AXIOM_NODISCARD static int strcmp(const char* lhs, const char* rhs);
 
-private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Compare at most `count` characters.
+    ///
+    /// \param lhs
+    /// \param rhs
+    /// \param count
+    ///
+    /// \return -1, 0 or 1
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static int strncmp(const char* lhs, const char* rhs,
+        Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the first `ch` in the `length` bytes of `data`.
+    ///
+    /// \param data
+    /// \param ch
+    /// \param length
+    ///
+    /// \return The byte found, or nullptr
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static const void* memchr(const void* data, int ch,
+        Uint64 length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the last `ch` in the `length` bytes of `data`.
+    ///
+    /// \param data
+    /// \param ch
+    /// \param length
+    ///
+    /// \return The byte found, or nullptr
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static const void* memrchr(const void* data, int ch,
+        Uint64 length);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param cp
+    /// \param lhs
+    /// \param rhs
+    /// \param length
     ///
-    /// \return
+    /// \return -1, 0 or 1
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static int memcmp(const void* lhs, const void* rhs,
+        Uint64 length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The implementation in use
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Implementation getImplementation(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Switch to another implementation, to compare them.
+    ///
+    /// Not thread-safe: no other thread may use these functions meanwhile.
+    ///
+    /// \param implementation
+    ///
+    /// \return False when the processor does not support it
     ///
     ///////////////////////////////////////////////////////////////////////////
-    AXIOM_NODISCARD static int _strlenCompare(Uint64 longword, const char* cp);
+    static bool setImplementation(Implementation implementation);
 };
 
 } // namespace ax::container
@@ -0,0 +1,1317 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/memory/allocator.hpp>
+#include <axiom/hash/hasher.hpp>
+#include <axiom/container/string.hpp>
+#include <axiom/container/stringView.hpp>
+#include <axiom/utility.hpp>
+#include <type_traits>
+#include <cstring>
+#include <new>
+#if defined(AXIOM_SIMD_SSE2)
+    #include <immintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::container
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::container
+{
+
+// SECTION - Hashing
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Default hash functor of the hash containers, see `ax::hash`.
+///
+///////////////////////////////////////////////////////////////////////////////
+using ax::hash::Hasher;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Default equality functor of the hash containers, comparing a key
+/// with any type it is comparable with.
+///
+/// \tparam T
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct EqualTo
+{
+    template <typename Q>
+    bool operator()(const T& key, const Q& other) const
+    {
+        return (key == other);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct EqualTo<StringView>
+{
+    bool operator()(StringView key, StringView other) const
+    {
+        return (key.length() == other.length()
+            && std::memcmp(key.data(), other.data(), key.length()) == 0);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct EqualTo<String> : EqualTo<StringView> {};
+
+// !SECTION
+
+// SECTION - Hash Group
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Sixteen control bytes of a hash table, matched in one go.
+///
+/// Each slot of a table has a control byte: `empty`, `deleted`, or the low
+/// seven bits of the hash of the key it holds. The matches are returned as
+/// a bit mask, bit `i` standing for the byte `i` of the group.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct HashGroup
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 width = 16;     //<!
+    static constexpr Int8 empty = -128;     //<!
+    static constexpr Int8 deleted = -2;     //<!
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+#if defined(AXIOM_SIMD_SSE2)
+    __m128i m_ctrl; //<!
+#else
+    Int8 m_ctrl[width]; //<!
+#endif
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param ctrl Any address, the group does not need to be aligned
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit HashGroup(const Int8* ctrl)
+    {
+#if defined(AXIOM_SIMD_SSE2)
+        m_ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+        std::memcpy(m_ctrl, ctrl, width);
+#endif
+    }
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param hash Low seven bits of a hash
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint32 match(Int8 hash) const
+    {
+#if defined(AXIOM_SIMD_SSE2)
+        return ((Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_set1_epi8(hash), m_ctrl)));
+#else
+        return (_matchScalar(hash, hash));
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint32 matchEmpty(void) const
+    {
+#if defined(AXIOM_SIMD_SSE2)
+        return ((Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_set1_epi8(empty), m_ctrl)));
+#else
+        return (_matchScalar(empty, empty));
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint32 matchEmptyOrDeleted(void) const
+    {
+#if defined(AXIOM_SIMD_SSE2)
+        return ((Uint32)_mm_movemask_epi8(_mm_cmpgt_epi8(
+            _mm_set1_epi8(-1), m_ctrl)));
+#else
+        return (_matchScalar(empty, deleted));
+#endif
+    }
+
+private:
+#if !defined(AXIOM_SIMD_SSE2)
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param low
+    /// \param high
+    ///
+    /// \return The bytes in the [low, high] range
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint32 _matchScalar(Int8 low, Int8 high) const
+    {
+        Uint32 mask = 0;
+
+        for (Uint32 i = 0; i < width; i++)
+        {
+            mask |= (Uint32)(m_ctrl[i] >= low && m_ctrl[i] <= high) << i;
+        }
+        return (mask);
+    }
+#endif
+};
+
+// !SECTION
+
+// SECTION - Hash Table Stats
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Occupancy and probing figures of a hash table, for tuning hashes
+/// and sizes.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct HashTableStats
+{
+    Uint64 size = 0;                //<!
+    Uint64 capacity = 0;            //<!
+    Uint64 tombstones = 0;          //<! Slots marked deleted
+    float loadFactor = 0.0f;        //<! Full slots over capacity
+    float averageProbeLength = 0.0f;//<! Groups visited to find an entry
+    Uint64 maxProbeLength = 0;      //<!
+};
+
+// !SECTION
+
+// SECTION - Hash Table Iterator
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \tparam Entry Entry type, const for constant iterators
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry>
+class HashTableIterator
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Int8* m_ctrl = nullptr;   //<!
+    const Int8* m_end = nullptr;    //<!
+    Entry* m_entry = nullptr;       //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    HashTableIterator(void) {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build an iterator on the first full slot from `ctrl`.
+    ///
+    /// \param ctrl
+    /// \param end
+    /// \param entry
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    HashTableIterator(const Int8* ctrl, const Int8* end, Entry* entry)
+        : m_ctrl(ctrl), m_end(end), m_entry(entry)
+    {
+        _skipFree();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Allow the conversion to a constant iterator.
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Other, typename = typename std::enable_if<
+        std::is_same<const Other, Entry>::value>::type>
+    HashTableIterator(const HashTableIterator<Other>& other)
+        : m_ctrl(other._ctrl()), m_end(other._end()), m_entry(other.get())
+    {}
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Entry& operator*(void) const
+    {
+        return (*m_entry);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Entry* operator->(void) const
+    {
+        return (m_entry);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    HashTableIterator& operator++(void)
+    {
+        m_ctrl++;
+        m_entry++;
+        _skipFree();
+        return (*this);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator==(const HashTableIterator& other) const
+    {
+        return (m_entry == other.m_entry);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator!=(const HashTableIterator& other) const
+    {
+        return (m_entry != other.m_entry);
+    }
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Entry* get(void) const
+    {
+        return (m_entry);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Int8* _ctrl(void) const
+    {
+        return (m_ctrl);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const Int8* _end(void) const
+    {
+        return (m_end);
+    }
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move forward to the next full slot, a group at a time.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _skipFree(void)
+    {
+        while (m_ctrl < m_end)
+        {
+            const Uint32 full = ~HashGroup(m_ctrl).matchEmptyOrDeleted()
+                & 0xFFFF;
+            if (full != 0)
+            {
+                const Uint32 skip = axu::countTrailingZeros(full);
+                if (m_ctrl + skip < m_end)
+                {
+                    m_ctrl += skip;
+                    m_entry += skip;
+                    return;
+                }
+            }
+            const Uint64 skip = m_end - m_ctrl < (Int64)HashGroup::width
+                ? m_end - m_ctrl : HashGroup::width;
+            m_ctrl += skip;
+            m_entry += skip;
+        }
+    }
+};
+
+// !SECTION
+
+// SECTION - Hash Table
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Open addressing hash table shared by the hash containers.
+///
+/// Entries are stored flat, next to an array of control bytes holding
+/// seven bits of the hash of each entry. A lookup loads sixteen control
+/// bytes at once, compares them all against the hash with SSE2, and only
+/// compares the keys of the matching slots. Groups are probed in triangular
+/// steps until one holding an empty slot is reached. The table grows by
+/// doubling once seven eighths of the slots are used.
+///
+/// \tparam Entry Stored type
+/// \tparam KeyOf Functor extracting the key of an entry
+/// \tparam Hash
+/// \tparam Equal
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+class HashTable
+{
+public:
+    // ANCHOR - Member Data
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Smallest capacity allocated.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 minCapacity = 8;    //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Iterator = HashTableIterator<Entry>;
+    using ConstIterator = HashTableIterator<const Entry>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Stats = HashTableStats;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Insertion
+    {
+        Entry* entry;   //<! The entry found or inserted
+        bool inserted;  //<!
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Int8* m_ctrl = nullptr;                     //<!
+    Entry* m_entries = nullptr;                 //<!
+    Uint64 m_capacity = 0;                      //<! Zero or a power of two
+    Uint64 m_size = 0;                          //<!
+    Uint64 m_growthLeft = 0;                    //<! Empty slots usable
+    memory::Allocator* m_allocator = nullptr;   //<! nullptr for the default
+    Hash m_hash;                                //<!
+    Equal m_equal;                              //<!
+
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param allocator nullptr for the default allocator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit HashTable(memory::Allocator* allocator = nullptr);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy `other` into a table using the default allocator.
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    HashTable(const HashTable& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    HashTable(HashTable&& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~HashTable(void);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    HashTable& operator=(const HashTable& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take the storage of `other` when both tables share the same
+    /// allocator, move the entries otherwise.
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    HashTable& operator=(HashTable&& other);
+
+public:
+    // ANCHOR - Public Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q Key type, or a type that hashes and compares like it
+    ///
+    /// \param key
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD Uint64 hash(const Q& key) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    /// \param hash The value of `hash(key)`
+    ///
+    /// \return The entry, or nullptr
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD Entry* find(const Q& key, Uint64 hash) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the entry of `key`, or build one in place with
+    /// `construct(Entry*)` when there is none.
+    ///
+    /// `key` must not refer to the storage of the table, which may move.
+    ///
+    /// \tparam Q
+    /// \tparam Construct
+    ///
+    /// \param key
+    /// \param hash The value of `hash(key)`
+    /// \param construct
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q, typename Construct>
+    Insertion findOrInsert(const Q& key, Uint64 hash, Construct&& construct);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    /// \param hash The value of `hash(key)`
+    ///
+    /// \return Whether an entry was removed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    bool erase(const Q& key, Uint64 hash);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param entry An entry of the table
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void erase(const Entry* entry);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destroy every entry, keeping the storage.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Make room for `count` entries without any further growth.
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void reserve(Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 capacity(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD memory::Allocator& getAllocator(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Walk the table to measure its occupancy and probe lengths.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Stats getStats(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator begin(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator begin(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator end(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator end(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param entry An entry of the table, or nullptr
+    ///
+    /// \return An iterator on `entry`, or `end()`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator iteratorTo(Entry* entry);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param entry An entry of the table, or nullptr
+    ///
+    /// \return An iterator on `entry`, or `end()`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator iteratorTo(const Entry* entry) const;
+
+private:
+    // ANCHOR - Private Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of entries a capacity holds before growing.
+    ///
+    /// \param capacity
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 _maxLoad(Uint64 capacity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param capacity
+    ///
+    /// \return Bytes of the control array, padded for the entries
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 _ctrlBytes(Uint64 capacity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 _alignment(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Set a control byte and its copy past the end, which lets the
+    /// groups near the end be loaded without wrapping.
+    ///
+    /// \param index
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _setCtrl(Uint64 index, Int8 value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the first empty or deleted slot on the probe sequence.
+    ///
+    /// \param hash
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 _findFree(Uint64 hash) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move every entry to new storage of `capacity` slots, dropping
+    /// the tombstones.
+    ///
+    /// \param capacity
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _rehash(Uint64 capacity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destroy the entries and give the storage back.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _release(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _copy(const HashTable& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _take(HashTable& other);
+};
+
+// !SECTION
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+HashTable<Entry, KeyOf, Hash, Equal>::HashTable(memory::Allocator* allocator)
+    : m_allocator(allocator)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+HashTable<Entry, KeyOf, Hash, Equal>::HashTable(const HashTable& other)
+    : m_hash(other.m_hash)
+    , m_equal(other.m_equal)
+{
+    _copy(other);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+HashTable<Entry, KeyOf, Hash, Equal>::HashTable(HashTable&& other)
+    : m_allocator(other.m_allocator)
+    , m_hash(other.m_hash)
+    , m_equal(other.m_equal)
+{
+    _take(other);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+HashTable<Entry, KeyOf, Hash, Equal>::~HashTable(void)
+{
+    _release();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+HashTable<Entry, KeyOf, Hash, Equal>&
+    HashTable<Entry, KeyOf, Hash, Equal>::operator=(const HashTable& other)
+{
+    if (this != &other)
+    {
+        clear();
+        _copy(other);
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+HashTable<Entry, KeyOf, Hash, Equal>&
+    HashTable<Entry, KeyOf, Hash, Equal>::operator=(HashTable&& other)
+{
+    if (this != &other)
+    {
+        clear();
+        _take(other);
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD Uint64 HashTable<Entry, KeyOf, Hash, Equal>::hash(
+    const Q& key) const
+{
+    return (m_hash(key));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD Entry* HashTable<Entry, KeyOf, Hash, Equal>::find(
+    const Q& key, Uint64 hash) const
+{
+    if (m_size == 0)
+    {
+        return (nullptr);
+    }
+    const Uint64 mask = m_capacity - 1;
+    const Int8 h2 = (Int8)(hash & 0x7F);
+    Uint64 offset = (hash >> 7) & mask;
+
+    for (Uint64 step = HashGroup::width; ; step += HashGroup::width)
+    {
+        const HashGroup group(m_ctrl + offset);
+        for (Uint32 match = group.match(h2); match; match &= match - 1)
+        {
+            const Uint64 index = (offset + axu::countTrailingZeros(match))
+                & mask;
+            if (m_equal(KeyOf::get(m_entries[index]), key))
+            {
+                return (m_entries + index);
+            }
+        }
+        if (group.matchEmpty())
+        {
+            return (nullptr);
+        }
+        offset = (offset + step) & mask;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+template <typename Q, typename Construct>
+typename HashTable<Entry, KeyOf, Hash, Equal>::Insertion
+    HashTable<Entry, KeyOf, Hash, Equal>::findOrInsert(const Q& key,
+    Uint64 hash, Construct&& construct)
+{
+    Entry* entry = find(key, hash);
+
+    if (entry)
+    {
+        return (Insertion{entry, false});
+    }
+    Uint64 index = _findFree(hash);
+    if (m_growthLeft == 0 && (m_capacity == 0
+        || m_ctrl[index] == HashGroup::empty))
+    {
+        const Uint64 capacity = m_capacity == 0 ? minCapacity
+            : m_size * 2 < _maxLoad(m_capacity) ? m_capacity
+            : m_capacity * 2;
+        _rehash(capacity);
+        index = _findFree(hash);
+    }
+    construct(m_entries + index);
+    m_growthLeft -= (m_ctrl[index] == HashGroup::empty);
+    _setCtrl(index, (Int8)(hash & 0x7F));
+    m_size++;
+    return (Insertion{m_entries + index, true});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+template <typename Q>
+bool HashTable<Entry, KeyOf, Hash, Equal>::erase(const Q& key, Uint64 hash)
+{
+    Entry* entry = find(key, hash);
+
+    if (!entry)
+    {
+        return (false);
+    }
+    erase(entry);
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Entry, KeyOf, Hash, Equal>::erase(const Entry* entry)
+{
+    const Uint64 mask = m_capacity - 1;
+    const Uint64 index = entry - m_entries;
+    const Uint32 emptyAfter = HashGroup(m_ctrl + index).matchEmpty();
+    const Uint32 emptyBefore = HashGroup(m_ctrl
+        + ((index - HashGroup::width) & mask)).matchEmpty();
+
+    m_entries[index].~Entry();
+    m_size--;
+    // The slot may only become empty again if no probe ever went past it,
+    // that is if no window of sixteen full or deleted slots contains it.
+    if (emptyAfter && emptyBefore && axu::countTrailingZeros(emptyAfter)
+        + (15 - axu::highestBit(emptyBefore)) < HashGroup::width)
+    {
+        _setCtrl(index, HashGroup::empty);
+        m_growthLeft++;
+        return;
+    }
+    _setCtrl(index, HashGroup::deleted);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Entry, KeyOf, Hash, Equal>::clear(void)
+{
+    if (m_capacity == 0)
+    {
+        return;
+    }
+    if (!std::is_trivially_destructible<Entry>::value)
+    {
+        for (Uint64 i = 0; i < m_capacity; i++)
+        {
+            if (m_ctrl[i] >= 0)
+            {
+                m_entries[i].~Entry();
+            }
+        }
+    }
+    std::memset(m_ctrl, HashGroup::empty, m_capacity + HashGroup::width);
+    m_size = 0;
+    m_growthLeft = _maxLoad(m_capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Entry, KeyOf, Hash, Equal>::reserve(Uint64 count)
+{
+    if (count <= m_size + m_growthLeft)
+    {
+        return;
+    }
+    Uint64 capacity = minCapacity;
+    while (_maxLoad(capacity) < count)
+    {
+        capacity *= 2;
+    }
+    _rehash(capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+AXIOM_NODISCARD Uint64 HashTable<Entry, KeyOf, Hash, Equal>::size(void) const
+{
+    return (m_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+AXIOM_NODISCARD Uint64 HashTable<Entry, KeyOf, Hash, Equal>::capacity(
+    void) const
+{
+    return (m_capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+AXIOM_NODISCARD memory::Allocator&
+    HashTable<Entry, KeyOf, Hash, Equal>::getAllocator(void) const
+{
+    return (m_allocator ? *m_allocator : memory::Allocator::getDefault());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+AXIOM_NODISCARD typename HashTable<Entry, KeyOf, Hash, Equal>::Stats
+    HashTable<Entry, KeyOf, Hash, Equal>::getStats(void) const
+{
+    Stats stats;
+    Uint64 totalProbes = 0;
+
+    stats.size = m_size;
+    stats.capacity = m_capacity;
+    if (m_capacity == 0)
+    {
+        return (stats);
+    }
+    const Uint64 mask = m_capacity - 1;
+    for (Uint64 i = 0; i < m_capacity; i++)
+    {
+        if (m_ctrl[i] == HashGroup::deleted)
+        {
+            stats.tombstones++;
+        }
+        if (m_ctrl[i] < 0)
+        {
+            continue;
+        }
+        const Uint64 hash = m_hash(KeyOf::get(m_entries[i]));
+        Uint64 offset = (hash >> 7) & mask;
+        Uint64 probes = 1;
+        for (Uint64 step = HashGroup::width;
+            ((i - offset) & mask) >= HashGroup::width;
+            step += HashGroup::width)
+        {
+            offset = (offset + step) & mask;
+            probes++;
+        }
+        totalProbes += probes;
+        if (probes > stats.maxProbeLength)
+        {
+            stats.maxProbeLength = probes;
+        }
+    }
+    stats.loadFactor = (float)m_size / (float)m_capacity;
+    if (m_size != 0)
+    {
+        stats.averageProbeLength = (float)totalProbes / (float)m_size;
+    }
+    return (stats);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+AXIOM_NODISCARD typename HashTable<Entry, KeyOf, Hash, Equal>::Iterator
+    HashTable<Entry, KeyOf, Hash, Equal>::begin(void)
+{
+    return (Iterator(m_ctrl, m_ctrl + m_capacity, m_entries));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+AXIOM_NODISCARD typename HashTable<Entry, KeyOf, Hash, Equal>::ConstIterator
+    HashTable<Entry, KeyOf, Hash, Equal>::begin(void) const
+{
+    return (ConstIterator(m_ctrl, m_ctrl + m_capacity, m_entries));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+AXIOM_NODISCARD typename HashTable<Entry, KeyOf, Hash, Equal>::Iterator
+    HashTable<Entry, KeyOf, Hash, Equal>::end(void)
+{
+    return (Iterator(m_ctrl + m_capacity, m_ctrl + m_capacity,
+        m_entries + m_capacity));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+AXIOM_NODISCARD typename HashTable<Entry, KeyOf, Hash, Equal>::ConstIterator
+    HashTable<Entry, KeyOf, Hash, Equal>::end(void) const
+{
+    return (ConstIterator(m_ctrl + m_capacity, m_ctrl + m_capacity,
+        m_entries + m_capacity));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+AXIOM_NODISCARD typename HashTable<Entry, KeyOf, Hash, Equal>::Iterator
+    HashTable<Entry, KeyOf, Hash, Equal>::iteratorTo(Entry* entry)
+{
+    if (!entry)
+    {
+        return (end());
+    }
+    const Uint64 index = entry - m_entries;
+    return (Iterator(m_ctrl + index, m_ctrl + m_capacity, entry));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+AXIOM_NODISCARD typename HashTable<Entry, KeyOf, Hash, Equal>::ConstIterator
+    HashTable<Entry, KeyOf, Hash, Equal>::iteratorTo(const Entry* entry) const
+{
+    if (!entry)
+    {
+        return (end());
+    }
+    const Uint64 index = entry - m_entries;
+    return (ConstIterator(m_ctrl + index, m_ctrl + m_capacity, entry));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+Uint64 HashTable<Entry, KeyOf, Hash, Equal>::_maxLoad(Uint64 capacity)
+{
+    return (capacity - capacity / 8);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+Uint64 HashTable<Entry, KeyOf, Hash, Equal>::_ctrlBytes(Uint64 capacity)
+{
+    const Uint64 bytes = capacity + HashGroup::width;
+
+    return ((bytes + alignof(Entry) - 1) / alignof(Entry) * alignof(Entry));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+constexpr Uint64 HashTable<Entry, KeyOf, Hash, Equal>::_alignment(void)
+{
+    return (alignof(Entry) > 16 ? alignof(Entry) : 16);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Entry, KeyOf, Hash, Equal>::_setCtrl(Uint64 index, Int8 value)
+{
+    m_ctrl[index] = value;
+    for (Uint64 i = index + m_capacity; i < m_capacity + HashGroup::width;
+        i += m_capacity)
+    {
+        m_ctrl[i] = value;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+Uint64 HashTable<Entry, KeyOf, Hash, Equal>::_findFree(Uint64 hash) const
+{
+    if (m_capacity == 0)
+    {
+        return (0);
+    }
+    const Uint64 mask = m_capacity - 1;
+    Uint64 offset = (hash >> 7) & mask;
+
+    for (Uint64 step = HashGroup::width; ; step += HashGroup::width)
+    {
+        const Uint32 free = HashGroup(m_ctrl + offset).matchEmptyOrDeleted();
+        if (free)
+        {
+            return ((offset + axu::countTrailingZeros(free)) & mask);
+        }
+        offset = (offset + step) & mask;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Entry, KeyOf, Hash, Equal>::_rehash(Uint64 capacity)
+{
+    Int8* oldCtrl = m_ctrl;
+    Entry* oldEntries = m_entries;
+    const Uint64 oldCapacity = m_capacity;
+    const Uint64 bytes = _ctrlBytes(capacity) + capacity * sizeof(Entry);
+    char* storage = static_cast<char*>(getAllocator().allocate(bytes,
+        _alignment()));
+
+    m_ctrl = reinterpret_cast<Int8*>(storage);
+    m_entries = reinterpret_cast<Entry*>(storage + _ctrlBytes(capacity));
+    m_capacity = capacity;
+    m_growthLeft = _maxLoad(capacity) - m_size;
+    std::memset(m_ctrl, HashGroup::empty, capacity + HashGroup::width);
+    for (Uint64 i = 0; i < oldCapacity; i++)
+    {
+        if (oldCtrl[i] < 0)
+        {
+            continue;
+        }
+        const Uint64 hash = m_hash(KeyOf::get(oldEntries[i]));
+        const Uint64 index = _findFree(hash);
+        if (axu::is_trivially_relocatable<Entry>::value)
+        {
+            std::memcpy(static_cast<void*>(m_entries + index),
+                oldEntries + i, sizeof(Entry));
+        }
+        else
+        {
+            new (m_entries + index) Entry(axu::move(oldEntries[i]));
+            oldEntries[i].~Entry();
+        }
+        _setCtrl(index, (Int8)(hash & 0x7F));
+    }
+    if (oldCapacity != 0)
+    {
+        getAllocator().deallocate(oldCtrl, _ctrlBytes(oldCapacity)
+            + oldCapacity * sizeof(Entry), _alignment());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Entry, KeyOf, Hash, Equal>::_release(void)
+{
+    if (m_capacity == 0)
+    {
+        return;
+    }
+    clear();
+    getAllocator().deallocate(m_ctrl, _ctrlBytes(m_capacity)
+        + m_capacity * sizeof(Entry), _alignment());
+    m_ctrl = nullptr;
+    m_entries = nullptr;
+    m_capacity = 0;
+    m_growthLeft = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Entry, KeyOf, Hash, Equal>::_copy(const HashTable& other)
+{
+    reserve(other.m_size);
+    for (Uint64 i = 0; i < other.m_capacity; i++)
+    {
+        if (other.m_ctrl[i] < 0)
+        {
+            continue;
+        }
+        const Uint64 hash = m_hash(KeyOf::get(other.m_entries[i]));
+        const Uint64 index = _findFree(hash);
+        new (m_entries + index) Entry(other.m_entries[i]);
+        m_growthLeft--;
+        _setCtrl(index, (Int8)(hash & 0x7F));
+        m_size++;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry, typename KeyOf, typename Hash, typename Equal>
+void HashTable<Entry, KeyOf, Hash, Equal>::_take(HashTable& other)
+{
+    if (m_allocator != other.m_allocator
+        && &getAllocator() != &other.getAllocator())
+    {
+        reserve(other.m_size);
+        for (Entry& entry : other)
+        {
+            const Uint64 hash = m_hash(KeyOf::get(entry));
+            const Uint64 index = _findFree(hash);
+            new (m_entries + index) Entry(axu::move(entry));
+            m_growthLeft--;
+            _setCtrl(index, (Int8)(hash & 0x7F));
+            m_size++;
+        }
+        other.clear();
+        return;
+    }
+    _release();
+    m_ctrl = other.m_ctrl;
+    m_entries = other.m_entries;
+    m_capacity = other.m_capacity;
+    m_size = other.m_size;
+    m_growthLeft = other.m_growthLeft;
+    other.m_ctrl = nullptr;
+    other.m_entries = nullptr;
+    other.m_capacity = 0;
+    other.m_size = 0;
+    other.m_growthLeft = 0;
+}
+
+} // namespace ax::container
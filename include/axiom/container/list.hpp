@@ -29,19 +29,2083 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/memory/allocator.hpp>
+#include <axiom/utility.hpp>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace ax::container
 ///////////////////////////////////////////////////////////////////////////////
 namespace ax::container
 {
 
+// SECTION - List Node
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Links of a circular doubly-linked list, and the operations shared
+/// by `List` and `IntrusiveList`.
+///
+/// Every list owns a sentinel node, linked to its first and last nodes, so
+/// none of the operations below has a special case for the ends.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct ListNode
+{
+    ListNode* prev = nullptr;   //<!
+    ListNode* next = nullptr;   //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Make `node` an empty sentinel, linked to itself.
+    ///
+    /// \param node
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void _reset(ListNode* node)
+    {
+        node->prev = node;
+        node->next = node;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    /// \param node
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void _linkBefore(ListNode* position, ListNode* node)
+    {
+        node->prev = position->prev;
+        node->next = position;
+        position->prev->next = node;
+        position->prev = node;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param node
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void _unlink(ListNode* node)
+    {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        node->prev = nullptr;
+        node->next = nullptr;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move the nodes of [first, last) before `position`.
+    ///
+    /// \param position
+    /// \param first
+    /// \param last
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void _splice(ListNode* position, ListNode* first, ListNode* last)
+    {
+        if (first == last || position == last)
+        {
+            return;
+        }
+        ListNode* tail = last->prev;
+        first->prev->next = last;
+        last->prev = first->prev;
+        first->prev = position->prev;
+        tail->next = position;
+        position->prev->next = first;
+        position->prev = tail;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Point the ends of the list of `from` back to `to`, once the
+    /// sentinel has been copied there.
+    ///
+    /// \param to
+    /// \param from
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void _moveSentinel(ListNode* to, ListNode* from)
+    {
+        if (from->next == from)
+        {
+            _reset(to);
+            return;
+        }
+        to->prev = from->prev;
+        to->next = from->next;
+        to->prev->next = to;
+        to->next->prev = to;
+        _reset(from);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Merge the sorted list of `other` into the sorted list of
+    /// `sentinel`, keeping equal nodes of `sentinel` first.
+    ///
+    /// \tparam Less Ordering of two nodes
+    ///
+    /// \param sentinel
+    /// \param other
+    /// \param less
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Less>
+    static void _merge(ListNode* sentinel, ListNode* other, Less&& less)
+    {
+        ListNode* position = sentinel->next;
+
+        while (other->next != other)
+        {
+            ListNode* node = other->next;
+            while (position != sentinel && !less(node, position))
+            {
+                position = position->next;
+            }
+            if (position == sentinel)
+            {
+                _splice(sentinel, node, other);
+                return;
+            }
+            ListNode* last = node->next;
+            while (last != other && less(last, position))
+            {
+                last = last->next;
+            }
+            _splice(position, node, last);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sort the list of `sentinel` with a stable bottom-up merge sort,
+    /// relinking the nodes without allocating.
+    ///
+    /// \tparam Less Ordering of two nodes
+    ///
+    /// \param sentinel
+    /// \param less
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Less>
+    static void _sort(ListNode* sentinel, Less&& less)
+    {
+        if (sentinel->next == sentinel || sentinel->next->next == sentinel)
+        {
+            return;
+        }
+        // Runs are kept as null-terminated chains of `next` links, the run
+        // of bin `i` holding 2^i nodes, older than the runs of lower bins
+        ListNode* bins[64] = {};
+        Uint32 binCount = 0;
+        ListNode* input = sentinel->next;
+
+        sentinel->prev->next = nullptr;
+        while (input)
+        {
+            ListNode* run = input;
+            input = input->next;
+            run->next = nullptr;
+            Uint32 bin = 0;
+            for (; bin < binCount && bins[bin]; bin++)
+            {
+                run = _mergeRuns(bins[bin], run, less);
+                bins[bin] = nullptr;
+            }
+            bins[bin] = run;
+            binCount += (bin == binCount);
+        }
+        ListNode* sorted = nullptr;
+        for (Uint32 bin = 0; bin < binCount; bin++)
+        {
+            if (bins[bin])
+            {
+                sorted = sorted ? _mergeRuns(bins[bin], sorted, less)
+                    : bins[bin];
+            }
+        }
+        ListNode* prev = sentinel;
+        for (ListNode* node = sorted; node; node = node->next)
+        {
+            prev->next = node;
+            node->prev = prev;
+            prev = node;
+        }
+        prev->next = sentinel;
+        sentinel->prev = prev;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Merge two sorted null-terminated runs, `first` going first on
+    /// equal nodes.
+    ///
+    /// \tparam Less
+    ///
+    /// \param first
+    /// \param second
+    /// \param less
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Less>
+    static ListNode* _mergeRuns(ListNode* first, ListNode* second, Less& less)
+    {
+        ListNode head;
+        ListNode* tail = &head;
+
+        while (first && second)
+        {
+            if (less(second, first))
+            {
+                tail->next = second;
+                second = second->next;
+            }
+            else
+            {
+                tail->next = first;
+                first = first->next;
+            }
+            tail = tail->next;
+        }
+        tail->next = first ? first : second;
+        return (head.next);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Hook to derive from to be stored in an `IntrusiveList`.
+///
+/// An object can be in as many intrusive lists at once as it has hooks,
+/// each one told apart by its tag. A hook unlinks itself when destroyed,
+/// and copying an object does not copy its links.
+///
+/// \tparam Tag Any type, naming the lists the hook is meant for
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename Tag = void>
+class ListHook : private ListNode
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename HookTag>
+    friend class IntrusiveList;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ListHook(void) {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build an unlinked hook.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ListHook(const ListHook&) {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~ListHook(void)
+    {
+        unlink();
+    }
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Keep the links, the object stays in its lists.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ListHook& operator=(const ListHook&)
+    {
+        return (*this);
+    }
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isLinked(void) const
+    {
+        return (next != nullptr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove the object from its list in O(1), without knowing the
+    /// list.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void unlink(void)
+    {
+        if (next != nullptr)
+        {
+            ListNode::_unlink(this);
+        }
+    }
+};
+
+// !SECTION
+
+// SECTION - List Iterator
+
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Bidirectional iterator over the nodes of a list.
+///
+/// \tparam T Value type, const for constant iterators
+/// \tparam Access Functor turning a node into its value
 ///
 ///////////////////////////////////////////////////////////////////////////////
-struct List
+template <typename T, typename Access>
+class ListIterator
 {
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ListNode* m_node = nullptr; //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ListIterator(void) {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param node
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit ListIterator(const ListNode* node)
+        : m_node(const_cast<ListNode*>(node))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Allow the conversion to a constant iterator.
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Other, typename = typename std::enable_if<
+        std::is_same<const Other, T>::value>::type>
+    ListIterator(const ListIterator<Other, Access>& other)
+        : m_node(other.getNode())
+    {}
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    T& operator*(void) const
+    {
+        return (*Access::get(m_node));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    T* operator->(void) const
+    {
+        return (Access::get(m_node));
+    }
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ListIterator& operator++(void)
+    {
+        m_node = m_node->next;
+        return (*this);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ListIterator& operator--(void)
+    {
+        m_node = m_node->prev;
+        return (*this);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator==(const ListIterator& other) const
+    {
+        return (m_node == other.m_node);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator!=(const ListIterator& other) const
+    {
+        return (m_node != other.m_node);
+    }
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ListNode* getNode(void) const
+    {
+        return (m_node);
+    }
 };
 
+// !SECTION
+
+// SECTION - Intrusive List
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Doubly-linked list of objects deriving from `ListHook<Tag>`.
+///
+/// The list never allocates nor owns its objects: they must outlive their
+/// stay in the list, or unlink themselves, which their hook does when they
+/// are destroyed. As objects can leave the list through their hook alone,
+/// the list does not keep a count and `size()` walks it.
+///
+/// \tparam T
+/// \tparam Tag Tag of the hook used by this list
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag = void>
+class IntrusiveList
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Access
+    {
+        static T* get(ListNode* node)
+        {
+            return (static_cast<T*>(static_cast<ListHook<Tag>*>(node)));
+        }
+    };
+
+public:
+    // ANCHOR - Member Data
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Iterator = ListIterator<T, Access>;
+    using ConstIterator = ListIterator<const T, Access>;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ListNode m_sentinel;    //<!
+
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    IntrusiveList(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    IntrusiveList(const IntrusiveList&) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take the objects of `other`.
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    IntrusiveList(IntrusiveList&& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Unlink every object.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~IntrusiveList(void);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    IntrusiveList& operator=(IntrusiveList&& other);
+
+public:
+    // ANCHOR - Public Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD T& front(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD T& back(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator begin(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator begin(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator end(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator end(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param object Unlinked object
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void pushFront(T& object);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param object Unlinked object
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void pushBack(T& object);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void popFront(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void popBack(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    /// \param object Unlinked object
+    ///
+    /// \return An iterator on `object`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Iterator insert(ConstIterator position, T& object);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    ///
+    /// \return An iterator on the next object
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Iterator erase(ConstIterator position);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move every object of `other` before `position`, in O(1).
+    ///
+    /// \param position
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void splice(ConstIterator position, IntrusiveList& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move the objects of [first, last), from any list with the same
+    /// tag, before `position`, in O(1).
+    ///
+    /// \param position
+    /// \param first
+    /// \param last
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void splice(ConstIterator position, ConstIterator first,
+        ConstIterator last);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sort the objects with `operator<`, keeping the order of equal
+    /// ones.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void sort(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sort the objects, keeping the order of equal ones.
+    ///
+    /// \tparam Compare
+    ///
+    /// \param less
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Compare>
+    void sort(Compare less);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move the objects of the sorted list `other` into this sorted
+    /// list.
+    ///
+    /// \tparam Compare
+    ///
+    /// \param other
+    /// \param less
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Compare>
+    void merge(IntrusiveList& other, Compare less);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Unlink every object.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Count the objects, in O(n).
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
+
+private:
+    // ANCHOR - Private Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param object
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static ListNode* _node(T& object);
+};
+
+// !SECTION
+
+// SECTION - List
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Doubly-linked list whose nodes come from slabs owned by the list.
+///
+/// Nodes are carved out of slabs of growing size and recycled through a
+/// free list, so inserting and erasing do not reach the allocator once the
+/// list has grown. Iterating, splicing, merging and sorting only relink
+/// nodes.
+///
+/// Nodes belong to the slabs of their list, so splicing a whole list takes
+/// its slabs and spare nodes along without moving a value, while splicing
+/// part of a list moves the values into nodes of this list. Clearing keeps
+/// only the slabs needed to hold as many values again.
+///
+/// \tparam T
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class List
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Node : ListNode
+    {
+        T value;    //<!
+
+        template <typename... Args>
+        explicit Node(Args&&... args)
+            : value(utility::forward<Args>(args)...)
+        {}
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Header placed at the start of every slab.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Slab
+    {
+        Slab* next;     //<!
+        Uint64 count;   //<! Number of nodes after the header
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Access
+    {
+        static T* get(ListNode* node)
+        {
+            return (&static_cast<Node*>(node)->value);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 slabAlignment = alignof(Node) > alignof(Slab)
+        ? alignof(Node) : alignof(Slab);    //<!
+
+public:
+    // ANCHOR - Member Data
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Nodes in the first slab, each next slab holding twice as many
+    /// up to `maxSlabNodes`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 minSlabNodes = 8;   //<!
+    static constexpr Uint64 maxSlabNodes = 512; //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Iterator = ListIterator<T, Access>;
+    using ConstIterator = ListIterator<const T, Access>;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ListNode m_sentinel;                        //<!
+    Uint64 m_size = 0;                          //<!
+    Slab* m_slabs = nullptr;                    //<! Newest slab first
+    ListNode* m_free = nullptr;                 //<! Released nodes
+    Node* m_bump = nullptr;                     //<! Unused nodes of the
+    Node* m_bumpEnd = nullptr;                  //<! newest slab
+    memory::Allocator* m_allocator = nullptr;   //<! nullptr for the default
+
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    List(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param allocator Allocator of the slabs
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit List(memory::Allocator& allocator);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param values
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    List(std::initializer_list<T> values);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy `other` into a list using the default allocator.
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    List(const List& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    List(List&& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~List(void);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    List& operator=(const List& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take the nodes of `other` when both lists share the same
+    /// allocator, move the values otherwise.
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    List& operator=(List&& other);
+
+public:
+    // ANCHOR - Public Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD T& front(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const T& front(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD T& back(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const T& back(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator begin(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator begin(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator end(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator end(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void pushFront(const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void pushFront(T&& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void pushBack(const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void pushBack(T&& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Args
+    ///
+    /// \param args
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Args>
+    T& emplaceFront(Args&&... args);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Args
+    ///
+    /// \param args
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Args>
+    T& emplaceBack(Args&&... args);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Args
+    ///
+    /// \param position
+    /// \param args
+    ///
+    /// \return An iterator on the new value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Args>
+    Iterator emplace(ConstIterator position, Args&&... args);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    /// \param value
+    ///
+    /// \return An iterator on the new value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Iterator insert(ConstIterator position, const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    /// \param value
+    ///
+    /// \return An iterator on the new value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Iterator insert(ConstIterator position, T&& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    ///
+    /// \return An iterator on the next value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Iterator erase(ConstIterator position);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void popFront(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void popBack(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move every value of `other` before `position`, relinking the
+    /// nodes when both lists share the same allocator.
+    ///
+    /// \param position
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void splice(ConstIterator position, List& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move the values of [first, last) of `other` before `position`.
+    ///
+    /// Within a list the nodes are relinked in O(1), between two lists the
+    /// values are moved into nodes of this list.
+    ///
+    /// \param position
+    /// \param other
+    /// \param first
+    /// \param last
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void splice(ConstIterator position, List& other, ConstIterator first,
+        ConstIterator last);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sort the values with `operator<`, keeping the order of equal
+    /// ones.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void sort(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sort the values, keeping the order of equal ones.
+    ///
+    /// \tparam Compare
+    ///
+    /// \param less
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Compare>
+    void sort(Compare less);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move the values of the sorted list `other` into this sorted
+    /// list.
+    ///
+    /// \tparam Compare
+    ///
+    /// \param other
+    /// \param less
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Compare>
+    void merge(List& other, Compare less);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destroy every value, keeping the newest slabs that can hold
+    /// as many values for later insertions and giving the others back.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD memory::Allocator& getAllocator(void) const;
+
+private:
+    // ANCHOR - Private Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get storage for a node, from the free list or a slab.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void* _acquire(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destroy a node and put it on the free list.
+    ///
+    /// \param node
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _release(ListNode* node);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Allocate a slab and make it the source of new nodes.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _grow(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param count
+    ///
+    /// \return Bytes of a slab of `count` nodes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 _slabBytes(Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param slab
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Node* _slabNodes(Slab* slab);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destroy every value without recycling the nodes, which the
+    /// caller gets back by trimming or freeing the slabs.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _destroyValues(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Keep the newest slabs holding at least `count` nodes, all of
+    /// them free, and give the others back to the allocator.
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _trimSlabs(Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Put nodes on the free list.
+    ///
+    /// \param first
+    /// \param last
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _freeNodes(Node* first, Node* last);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Give every slab back to the allocator.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _freeSlabs(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take the nodes and slabs of `other`, both lists sharing the
+    /// same allocator.
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _take(List& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Add the slabs of `other` to this list along with its spare
+    /// nodes, and empty `other`.
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _adoptSlabs(List& other);
+};
+
+// !SECTION
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+IntrusiveList<T, Tag>::IntrusiveList(void)
+{
+    ListNode::_reset(&m_sentinel);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+IntrusiveList<T, Tag>::IntrusiveList(IntrusiveList&& other)
+{
+    ListNode::_moveSentinel(&m_sentinel, &other.m_sentinel);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+IntrusiveList<T, Tag>::~IntrusiveList(void)
+{
+    clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+IntrusiveList<T, Tag>& IntrusiveList<T, Tag>::operator=(IntrusiveList&& other)
+{
+    if (this != &other)
+    {
+        clear();
+        ListNode::_moveSentinel(&m_sentinel, &other.m_sentinel);
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+AXIOM_NODISCARD T& IntrusiveList<T, Tag>::front(void)
+{
+    return (*Access::get(m_sentinel.next));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+AXIOM_NODISCARD T& IntrusiveList<T, Tag>::back(void)
+{
+    return (*Access::get(m_sentinel.prev));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+AXIOM_NODISCARD typename IntrusiveList<T, Tag>::Iterator
+    IntrusiveList<T, Tag>::begin(void)
+{
+    return (Iterator(m_sentinel.next));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+AXIOM_NODISCARD typename IntrusiveList<T, Tag>::ConstIterator
+    IntrusiveList<T, Tag>::begin(void) const
+{
+    return (ConstIterator(m_sentinel.next));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+AXIOM_NODISCARD typename IntrusiveList<T, Tag>::Iterator
+    IntrusiveList<T, Tag>::end(void)
+{
+    return (Iterator(&m_sentinel));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+AXIOM_NODISCARD typename IntrusiveList<T, Tag>::ConstIterator
+    IntrusiveList<T, Tag>::end(void) const
+{
+    return (ConstIterator(&m_sentinel));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::pushFront(T& object)
+{
+    ListNode::_linkBefore(m_sentinel.next, _node(object));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::pushBack(T& object)
+{
+    ListNode::_linkBefore(&m_sentinel, _node(object));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::popFront(void)
+{
+    ListNode::_unlink(m_sentinel.next);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::popBack(void)
+{
+    ListNode::_unlink(m_sentinel.prev);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::insert(
+    ConstIterator position, T& object)
+{
+    ListNode* node = _node(object);
+
+    ListNode::_linkBefore(position.getNode(), node);
+    return (Iterator(node));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+typename IntrusiveList<T, Tag>::Iterator IntrusiveList<T, Tag>::erase(
+    ConstIterator position)
+{
+    ListNode* next = position.getNode()->next;
+
+    ListNode::_unlink(position.getNode());
+    return (Iterator(next));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::splice(ConstIterator position,
+    IntrusiveList& other)
+{
+    ListNode::_splice(position.getNode(), other.m_sentinel.next,
+        &other.m_sentinel);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::splice(ConstIterator position,
+    ConstIterator first, ConstIterator last)
+{
+    ListNode::_splice(position.getNode(), first.getNode(), last.getNode());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::sort(void)
+{
+    sort([](const T& lhs, const T& rhs) { return (lhs < rhs); });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+template <typename Compare>
+void IntrusiveList<T, Tag>::sort(Compare less)
+{
+    ListNode::_sort(&m_sentinel, [&](ListNode* lhs, ListNode* rhs) {
+        return (less(*Access::get(lhs), *Access::get(rhs)));
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+template <typename Compare>
+void IntrusiveList<T, Tag>::merge(IntrusiveList& other, Compare less)
+{
+    if (this == &other)
+    {
+        return;
+    }
+    ListNode::_merge(&m_sentinel, &other.m_sentinel,
+        [&](ListNode* lhs, ListNode* rhs) {
+            return (less(*Access::get(lhs), *Access::get(rhs)));
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+void IntrusiveList<T, Tag>::clear(void)
+{
+    while (m_sentinel.next != &m_sentinel)
+    {
+        ListNode::_unlink(m_sentinel.next);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+AXIOM_NODISCARD bool IntrusiveList<T, Tag>::isEmpty(void) const
+{
+    return (m_sentinel.next == &m_sentinel);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+AXIOM_NODISCARD Uint64 IntrusiveList<T, Tag>::size(void) const
+{
+    Uint64 count = 0;
+
+    for (const ListNode* node = m_sentinel.next; node != &m_sentinel;
+        node = node->next)
+    {
+        count++;
+    }
+    return (count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Tag>
+ListNode* IntrusiveList<T, Tag>::_node(T& object)
+{
+    return (static_cast<ListHook<Tag>*>(&object));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+List<T>::List(void)
+{
+    ListNode::_reset(&m_sentinel);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+List<T>::List(memory::Allocator& allocator)
+    : m_allocator(&allocator)
+{
+    ListNode::_reset(&m_sentinel);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+List<T>::List(std::initializer_list<T> values)
+{
+    ListNode::_reset(&m_sentinel);
+    for (const T& value : values)
+    {
+        emplaceBack(value);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+List<T>::List(const List& other)
+{
+    ListNode::_reset(&m_sentinel);
+    for (const T& value : other)
+    {
+        emplaceBack(value);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+List<T>::List(List&& other)
+    : m_allocator(other.m_allocator)
+{
+    _take(other);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+List<T>::~List(void)
+{
+    _destroyValues();
+    _freeSlabs();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+List<T>& List<T>::operator=(const List& other)
+{
+    if (this != &other)
+    {
+        clear();
+        for (const T& value : other)
+        {
+            emplaceBack(value);
+        }
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+List<T>& List<T>::operator=(List&& other)
+{
+    if (this == &other)
+    {
+        return (*this);
+    }
+    if (&getAllocator() == &other.getAllocator())
+    {
+        _destroyValues();
+        _freeSlabs();
+        _take(other);
+        return (*this);
+    }
+    clear();
+    for (T& value : other)
+    {
+        emplaceBack(utility::move(value));
+    }
+    other.clear();
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD T& List<T>::front(void)
+{
+    return (*Access::get(m_sentinel.next));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD const T& List<T>::front(void) const
+{
+    return (*Access::get(m_sentinel.next));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD T& List<T>::back(void)
+{
+    return (*Access::get(m_sentinel.prev));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD const T& List<T>::back(void) const
+{
+    return (*Access::get(m_sentinel.prev));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD typename List<T>::Iterator List<T>::begin(void)
+{
+    return (Iterator(m_sentinel.next));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD typename List<T>::ConstIterator List<T>::begin(void) const
+{
+    return (ConstIterator(m_sentinel.next));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD typename List<T>::Iterator List<T>::end(void)
+{
+    return (Iterator(&m_sentinel));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD typename List<T>::ConstIterator List<T>::end(void) const
+{
+    return (ConstIterator(&m_sentinel));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::pushFront(const T& value)
+{
+    emplace(begin(), value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::pushFront(T&& value)
+{
+    emplace(begin(), utility::move(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::pushBack(const T& value)
+{
+    emplace(end(), value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::pushBack(T&& value)
+{
+    emplace(end(), utility::move(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+template <typename... Args>
+T& List<T>::emplaceFront(Args&&... args)
+{
+    return (*emplace(begin(), utility::forward<Args>(args)...));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+template <typename... Args>
+T& List<T>::emplaceBack(Args&&... args)
+{
+    return (*emplace(end(), utility::forward<Args>(args)...));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+template <typename... Args>
+typename List<T>::Iterator List<T>::emplace(ConstIterator position,
+    Args&&... args)
+{
+    void* storage = _acquire();
+    Node* node;
+
+    try
+    {
+        node = new (storage) Node(utility::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        ListNode* free = static_cast<ListNode*>(storage);
+        free->next = m_free;
+        m_free = free;
+        throw;
+    }
+    ListNode::_linkBefore(position.getNode(), node);
+    m_size++;
+    return (Iterator(node));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+typename List<T>::Iterator List<T>::insert(ConstIterator position,
+    const T& value)
+{
+    return (emplace(position, value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+typename List<T>::Iterator List<T>::insert(ConstIterator position,
+    T&& value)
+{
+    return (emplace(position, utility::move(value)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+typename List<T>::Iterator List<T>::erase(ConstIterator position)
+{
+    ListNode* node = position.getNode();
+    ListNode* next = node->next;
+
+    ListNode::_unlink(node);
+    _release(node);
+    m_size--;
+    return (Iterator(next));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::popFront(void)
+{
+    erase(begin());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::popBack(void)
+{
+    erase(ConstIterator(m_sentinel.prev));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::splice(ConstIterator position, List& other)
+{
+    if (this == &other || other.m_size == 0)
+    {
+        return;
+    }
+    if (&getAllocator() != &other.getAllocator())
+    {
+        splice(position, other, other.begin(), other.end());
+        return;
+    }
+    ListNode::_splice(position.getNode(), other.m_sentinel.next,
+        &other.m_sentinel);
+    m_size += other.m_size;
+    other.m_size = 0;
+    _adoptSlabs(other);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::splice(ConstIterator position, List& other,
+    ConstIterator first, ConstIterator last)
+{
+    if (this == &other)
+    {
+        ListNode::_splice(position.getNode(), first.getNode(),
+            last.getNode());
+        return;
+    }
+    while (first != last)
+    {
+        ConstIterator next = first;
+        ++next;
+        emplace(position, utility::move(*const_cast<T*>(&*first)));
+        other.erase(first);
+        first = next;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::sort(void)
+{
+    sort([](const T& lhs, const T& rhs) { return (lhs < rhs); });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+template <typename Compare>
+void List<T>::sort(Compare less)
+{
+    ListNode::_sort(&m_sentinel, [&](ListNode* lhs, ListNode* rhs) {
+        return (less(*Access::get(lhs), *Access::get(rhs)));
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+template <typename Compare>
+void List<T>::merge(List& other, Compare less)
+{
+    if (this == &other || other.m_size == 0)
+    {
+        return;
+    }
+    if (&getAllocator() != &other.getAllocator())
+    {
+        List moved(getAllocator());
+        moved.splice(moved.end(), other);
+        merge(moved, less);
+        return;
+    }
+    ListNode::_merge(&m_sentinel, &other.m_sentinel,
+        [&](ListNode* lhs, ListNode* rhs) {
+            return (less(*Access::get(lhs), *Access::get(rhs)));
+        });
+    m_size += other.m_size;
+    other.m_size = 0;
+    _adoptSlabs(other);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::clear(void)
+{
+    const Uint64 count = m_size;
+
+    _destroyValues();
+    _trimSlabs(count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD Uint64 List<T>::size(void) const
+{
+    return (m_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD bool List<T>::isEmpty(void) const
+{
+    return (m_size == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD memory::Allocator& List<T>::getAllocator(void) const
+{
+    return (m_allocator ? *m_allocator : memory::Allocator::getDefault());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void* List<T>::_acquire(void)
+{
+    if (m_free)
+    {
+        ListNode* node = m_free;
+        m_free = node->next;
+        return (node);
+    }
+    if (m_bump == m_bumpEnd)
+    {
+        _grow();
+    }
+    return (m_bump++);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::_release(ListNode* node)
+{
+    static_cast<Node*>(node)->~Node();
+    ListNode* free = new (static_cast<void*>(node)) ListNode;
+    free->next = m_free;
+    m_free = free;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::_grow(void)
+{
+    Uint64 count = m_slabs ? m_slabs->count * 2 : minSlabNodes;
+
+    count = count < maxSlabNodes ? count : maxSlabNodes;
+    Slab* slab = static_cast<Slab*>(getAllocator().allocate(
+        _slabBytes(count), slabAlignment));
+    slab->next = m_slabs;
+    slab->count = count;
+    m_slabs = slab;
+    m_bump = _slabNodes(slab);
+    m_bumpEnd = m_bump + count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Uint64 List<T>::_slabBytes(Uint64 count)
+{
+    const Uint64 header = (sizeof(Slab) + alignof(Node) - 1) / alignof(Node)
+        * alignof(Node);
+
+    return (header + count * sizeof(Node));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+typename List<T>::Node* List<T>::_slabNodes(Slab* slab)
+{
+    return (reinterpret_cast<Node*>(reinterpret_cast<char*>(slab)
+        + _slabBytes(0)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::_destroyValues(void)
+{
+    ListNode* node = m_sentinel.next;
+
+    while (node != &m_sentinel)
+    {
+        ListNode* next = node->next;
+        static_cast<Node*>(node)->~Node();
+        node = next;
+    }
+    ListNode::_reset(&m_sentinel);
+    m_size = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::_trimSlabs(Uint64 count)
+{
+    Slab* slab = m_slabs;
+
+    m_free = nullptr;
+    m_bump = nullptr;
+    m_bumpEnd = nullptr;
+    if (!slab)
+    {
+        return;
+    }
+    // The newest slab feeds the bump range again, the older ones kept to
+    // reach `count` nodes feed the free list
+    m_bump = _slabNodes(slab);
+    m_bumpEnd = m_bump + slab->count;
+    for (Uint64 capacity = slab->count; capacity < count && slab->next;)
+    {
+        slab = slab->next;
+        capacity += slab->count;
+        _freeNodes(_slabNodes(slab), _slabNodes(slab) + slab->count);
+    }
+    Slab* extra = slab->next;
+    slab->next = nullptr;
+    while (extra)
+    {
+        Slab* next = extra->next;
+        getAllocator().deallocate(extra, _slabBytes(extra->count),
+            slabAlignment);
+        extra = next;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::_freeNodes(Node* first, Node* last)
+{
+    for (; first != last; first++)
+    {
+        ListNode* free = new (static_cast<void*>(first)) ListNode;
+        free->next = m_free;
+        m_free = free;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::_freeSlabs(void)
+{
+    while (m_slabs)
+    {
+        Slab* next = m_slabs->next;
+        getAllocator().deallocate(m_slabs, _slabBytes(m_slabs->count),
+            slabAlignment);
+        m_slabs = next;
+    }
+    m_free = nullptr;
+    m_bump = nullptr;
+    m_bumpEnd = nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::_take(List& other)
+{
+    ListNode::_moveSentinel(&m_sentinel, &other.m_sentinel);
+    m_size = other.m_size;
+    m_slabs = other.m_slabs;
+    m_free = other.m_free;
+    m_bump = other.m_bump;
+    m_bumpEnd = other.m_bumpEnd;
+    other.m_size = 0;
+    other.m_slabs = nullptr;
+    other.m_free = nullptr;
+    other.m_bump = nullptr;
+    other.m_bumpEnd = nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void List<T>::_adoptSlabs(List& other)
+{
+    if (!other.m_slabs)
+    {
+        return;
+    }
+    Slab* last = other.m_slabs;
+    while (last->next)
+    {
+        last = last->next;
+    }
+    last->next = m_slabs ? m_slabs->next : nullptr;
+    if (m_slabs)
+    {
+        // This list keeps its bump range, the spare nodes of `other` join
+        // the free list instead of being lost until the slabs are released
+        m_slabs->next = other.m_slabs;
+        _freeNodes(other.m_bump, other.m_bumpEnd);
+        if (other.m_free)
+        {
+            ListNode* tail = other.m_free;
+            while (tail->next)
+            {
+                tail = tail->next;
+            }
+            tail->next = m_free;
+            m_free = other.m_free;
+        }
+    }
+    else
+    {
+        m_slabs = other.m_slabs;
+        m_free = other.m_free;
+        m_bump = other.m_bump;
+        m_bumpEnd = other.m_bumpEnd;
+    }
+    other.m_slabs = nullptr;
+    other.m_free = nullptr;
+    other.m_bump = nullptr;
+    other.m_bumpEnd = nullptr;
+}
+
 } // namespace ax::container
@@ -29,6 +29,16 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/container/hashTable.hpp>
+#include <axiom/utility.hpp>
+#include <initializer_list>
+#include <new>
+
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace ax::container
 ///////////////////////////////////////////////////////////////////////////////
@@ -36,12 +46,827 @@ namespace ax::container
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Key and value pair stored by a `Map`.
+///
+/// \tparam K
+/// \tparam V
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V>
+struct MapEntry
+{
+    K key;      //<!
+    V value;    //<!
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Hash map with flat storage, built on `HashTable`.
+///
+/// Lookups are templated on the key type, so a `Map<String, V>` is searched
+/// with a `const char*` or a `StringView` without building a `String`. The
+/// hash of a key can be computed once with `hash()` and given back to the
+/// `find`, `contains`, `tryEmplace` and `erase` overloads, which is useful
+/// for keys that are known ahead, such as uniform names.
+///
+/// Pointers and iterators to the entries are invalidated by an insertion.
+///
+/// \tparam K
+/// \tparam V
+/// \tparam Hash
+/// \tparam Equal
 ///
 ///////////////////////////////////////////////////////////////////////////////
-struct Map
+template <typename K, typename V, typename Hash = Hasher<K>,
+    typename Equal = EqualTo<K>>
+class Map
 {
+public:
+    // ANCHOR - Member Data
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Entry = MapEntry<K, V>;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct KeyOf
+    {
+        static const K& get(const Entry& entry)
+        {
+            return (entry.key);
+        }
+    };
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Table = HashTable<Entry, KeyOf, Hash, Equal>;
+    using Iterator = typename Table::Iterator;
+    using ConstIterator = typename Table::ConstIterator;
+    using Stats = typename Table::Stats;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Table m_table;  //<!
+
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Map(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param allocator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Map(memory::Allocator& allocator);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param entries Later duplicates of a key are ignored
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Map(std::initializer_list<Entry> entries);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the value of `key`, inserting a default one if needed.
+    ///
+    /// \tparam Q Any type a `K` can be built from
+    ///
+    /// \param key
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    V& operator[](Q&& key);
+
+public:
+    // ANCHOR - Public Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q Key type, or a type that hashes and compares like it
+    ///
+    /// \param key
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD Uint64 hash(const Q& key) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    ///
+    /// \return An iterator on the entry, or `end()`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD Iterator find(const Q& key);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    ///
+    /// \return An iterator on the entry, or `end()`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD ConstIterator find(const Q& key) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    /// \param hash The value of `hash(key)`
+    ///
+    /// \return An iterator on the entry, or `end()`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD Iterator find(const Q& key, Uint64 hash);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    /// \param hash The value of `hash(key)`
+    ///
+    /// \return An iterator on the entry, or `end()`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD ConstIterator find(const Q& key, Uint64 hash) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    ///
+    /// \return The value of `key`, or nullptr
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD V* get(const Q& key);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    ///
+    /// \return The value of `key`, or nullptr
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD const V* get(const Q& key) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    /// \param hash The value of `hash(key)`
+    ///
+    /// \return The value of `key`, or nullptr
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD V* get(const Q& key, Uint64 hash);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    /// \param hash The value of `hash(key)`
+    ///
+    /// \return The value of `key`, or nullptr
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD const V* get(const Q& key, Uint64 hash) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    ///
+    /// \return
+    ///
+    /// \throw std::exception if there is no such key
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD V& at(const Q& key);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    ///
+    /// \return
+    ///
+    /// \throw std::exception if there is no such key
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD const V& at(const Q& key) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD bool contains(const Q& key) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    /// \param hash The value of `hash(key)`
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD bool contains(const Q& key, Uint64 hash) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Insert a value built from `args` unless `key` is present.
+    ///
+    /// `key` and `args` must not refer to entries of the map.
+    ///
+    /// \tparam Q Any type a `K` can be built from
+    /// \tparam Args
+    ///
+    /// \param key
+    /// \param args
+    ///
+    /// \return The entry, and whether it was inserted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q, typename... Args>
+    typename Table::Insertion tryEmplace(Q&& key, Args&&... args);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q Any type a `K` can be built from
+    /// \tparam Args
+    ///
+    /// \param hash The value of `hash(key)`
+    /// \param key
+    /// \param args
+    ///
+    /// \return The entry, and whether it was inserted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q, typename... Args>
+    typename Table::Insertion tryEmplaceHashed(Uint64 hash, Q&& key,
+        Args&&... args);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Set the value of `key`, inserting it if needed.
+    ///
+    /// \tparam Q Any type a `K` can be built from
+    /// \tparam T
+    ///
+    /// \param key
+    /// \param value
+    ///
+    /// \return The entry, and whether it was inserted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q, typename T>
+    typename Table::Insertion insertOrAssign(Q&& key, T&& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    ///
+    /// \return Whether an entry was removed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    bool erase(const Q& key);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param key
+    /// \param hash The value of `hash(key)`
+    ///
+    /// \return Whether an entry was removed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    bool erase(const Q& key, Uint64 hash);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove the entry under `position`.
+    ///
+    /// \param position
+    ///
+    /// \return An iterator on the next entry
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Iterator erase(ConstIterator position);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove the entry under `position`.
+    ///
+    /// \param position
+    ///
+    /// \return An iterator on the next entry
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Iterator erase(Iterator position);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void reserve(Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 capacity(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD memory::Allocator& getAllocator(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the load factor and probe lengths of the map.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Stats getStats(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator begin(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator begin(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator end(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator end(void) const;
 };
 
 } // namespace ax::container
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::utility
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::utility
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Entries relocate like their key and value.
+///
+/// \tparam K
+/// \tparam V
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V>
+struct is_trivially_relocatable<container::MapEntry<K, V>>
+{
+    static constexpr bool value = is_trivially_relocatable<K>::value
+        && is_trivially_relocatable<V>::value;
+};
+
+} // namespace ax::utility
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::container
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::container
+{
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+Map<K, V, Hash, Equal>::Map(void) {}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+Map<K, V, Hash, Equal>::Map(memory::Allocator& allocator)
+    : m_table(&allocator)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+Map<K, V, Hash, Equal>::Map(std::initializer_list<Entry> entries)
+{
+    m_table.reserve(entries.size());
+    for (const Entry& entry : entries)
+    {
+        tryEmplace(entry.key, entry.value);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+V& Map<K, V, Hash, Equal>::operator[](Q&& key)
+{
+    return (tryEmplace(utility::forward<Q>(key)).entry->value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD Uint64 Map<K, V, Hash, Equal>::hash(const Q& key) const
+{
+    return (m_table.hash(key));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD typename Map<K, V, Hash, Equal>::Iterator
+    Map<K, V, Hash, Equal>::find(const Q& key)
+{
+    return (m_table.iteratorTo(m_table.find(key, m_table.hash(key))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD typename Map<K, V, Hash, Equal>::ConstIterator
+    Map<K, V, Hash, Equal>::find(const Q& key) const
+{
+    const Entry* entry = m_table.find(key, m_table.hash(key));
+
+    return (m_table.iteratorTo(entry));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD typename Map<K, V, Hash, Equal>::Iterator
+    Map<K, V, Hash, Equal>::find(const Q& key, Uint64 hash)
+{
+    return (m_table.iteratorTo(m_table.find(key, hash)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD typename Map<K, V, Hash, Equal>::ConstIterator
+    Map<K, V, Hash, Equal>::find(const Q& key, Uint64 hash) const
+{
+    const Entry* entry = m_table.find(key, hash);
+
+    return (m_table.iteratorTo(entry));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD V* Map<K, V, Hash, Equal>::get(const Q& key)
+{
+    return (get(key, m_table.hash(key)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD const V* Map<K, V, Hash, Equal>::get(const Q& key) const
+{
+    return (get(key, m_table.hash(key)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD V* Map<K, V, Hash, Equal>::get(const Q& key, Uint64 hash)
+{
+    Entry* entry = m_table.find(key, hash);
+
+    return (entry ? &entry->value : nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD const V* Map<K, V, Hash, Equal>::get(const Q& key,
+    Uint64 hash) const
+{
+    const Entry* entry = m_table.find(key, hash);
+
+    return (entry ? &entry->value : nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD V& Map<K, V, Hash, Equal>::at(const Q& key)
+{
+    V* value = get(key);
+
+    CHECK(value != nullptr);
+    return (*value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD const V& Map<K, V, Hash, Equal>::at(const Q& key) const
+{
+    const V* value = get(key);
+
+    CHECK(value != nullptr);
+    return (*value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD bool Map<K, V, Hash, Equal>::contains(const Q& key) const
+{
+    return (m_table.find(key, m_table.hash(key)) != nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD bool Map<K, V, Hash, Equal>::contains(const Q& key,
+    Uint64 hash) const
+{
+    return (m_table.find(key, hash) != nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q, typename... Args>
+typename Map<K, V, Hash, Equal>::Table::Insertion
+    Map<K, V, Hash, Equal>::tryEmplace(Q&& key, Args&&... args)
+{
+    const Uint64 hash = m_table.hash(key);
+
+    return (tryEmplaceHashed(hash, utility::forward<Q>(key),
+        utility::forward<Args>(args)...));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q, typename... Args>
+typename Map<K, V, Hash, Equal>::Table::Insertion
+    Map<K, V, Hash, Equal>::tryEmplaceHashed(Uint64 hash, Q&& key,
+    Args&&... args)
+{
+    return (m_table.findOrInsert(key, hash, [&](Entry* entry)
+    {
+        new (entry) Entry{K(utility::forward<Q>(key)),
+            V(utility::forward<Args>(args)...)};
+    }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q, typename T>
+typename Map<K, V, Hash, Equal>::Table::Insertion
+    Map<K, V, Hash, Equal>::insertOrAssign(Q&& key, T&& value)
+{
+    typename Table::Insertion insertion = tryEmplace(
+        utility::forward<Q>(key), utility::forward<T>(value));
+
+    if (!insertion.inserted)
+    {
+        insertion.entry->value = utility::forward<T>(value);
+    }
+    return (insertion);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+bool Map<K, V, Hash, Equal>::erase(const Q& key)
+{
+    return (m_table.erase(key, m_table.hash(key)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+template <typename Q>
+bool Map<K, V, Hash, Equal>::erase(const Q& key, Uint64 hash)
+{
+    return (m_table.erase(key, hash));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+typename Map<K, V, Hash, Equal>::Iterator
+    Map<K, V, Hash, Equal>::erase(ConstIterator position)
+{
+    Entry* entry = const_cast<Entry*>(position.get());
+    Iterator next = m_table.iteratorTo(entry);
+
+    ++next;
+    m_table.erase(entry);
+    return (next);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+typename Map<K, V, Hash, Equal>::Iterator
+    Map<K, V, Hash, Equal>::erase(Iterator position)
+{
+    return (erase(ConstIterator(position)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+void Map<K, V, Hash, Equal>::clear(void)
+{
+    m_table.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+void Map<K, V, Hash, Equal>::reserve(Uint64 count)
+{
+    m_table.reserve(count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+AXIOM_NODISCARD Uint64 Map<K, V, Hash, Equal>::size(void) const
+{
+    return (m_table.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+AXIOM_NODISCARD Uint64 Map<K, V, Hash, Equal>::capacity(void) const
+{
+    return (m_table.capacity());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+AXIOM_NODISCARD bool Map<K, V, Hash, Equal>::isEmpty(void) const
+{
+    return (m_table.size() == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+AXIOM_NODISCARD memory::Allocator&
+    Map<K, V, Hash, Equal>::getAllocator(void) const
+{
+    return (m_table.getAllocator());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+AXIOM_NODISCARD typename Map<K, V, Hash, Equal>::Stats
+    Map<K, V, Hash, Equal>::getStats(void) const
+{
+    return (m_table.getStats());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+AXIOM_NODISCARD typename Map<K, V, Hash, Equal>::Iterator
+    Map<K, V, Hash, Equal>::begin(void)
+{
+    return (m_table.begin());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+AXIOM_NODISCARD typename Map<K, V, Hash, Equal>::ConstIterator
+    Map<K, V, Hash, Equal>::begin(void) const
+{
+    return (m_table.begin());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+AXIOM_NODISCARD typename Map<K, V, Hash, Equal>::Iterator
+    Map<K, V, Hash, Equal>::end(void)
+{
+    return (m_table.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename K, typename V, typename Hash, typename Equal>
+AXIOM_NODISCARD typename Map<K, V, Hash, Equal>::ConstIterator
+    Map<K, V, Hash, Equal>::end(void) const
+{
+    return (m_table.end());
+}
+
+} // namespace ax::container
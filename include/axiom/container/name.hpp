@@ -0,0 +1,260 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/container/string.hpp>
+#include <axiom/container/stringView.hpp>
+#include <axiom/hash/hash.hpp>
+#include <axiom/hash/hashedString.hpp>
+#include <axiom/hash/hasher.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::container
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::container
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief An interned string, a compact handle to an identifier.
+///
+/// Every distinct string is stored once in a global table and a `Name` only
+/// holds its index, so names compare and hash as integers. Interning an
+/// already known string, and reading the characters of a name, take no
+/// lock; only the first interning of a string does. The default name is the
+/// empty string. Stored strings are never freed.
+///
+/// Names of literals are best interned once, `AXIOM_NAME("u_time")`, or kept
+/// in a static, the literal being hashed at compile time.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Name
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint32 m_id;    //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr Name(void)
+        : m_id(0)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param str
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Name(const char* str);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param str
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Name(StringView str);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param str
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Name(const String& str);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Intern a string whose hash is already known.
+    ///
+    /// \param str
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Name(hash::HashedStringView str);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr bool operator==(Name other) const
+    {
+        return (m_id == other.m_id);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr bool operator!=(Name other) const
+    {
+        return (m_id != other.m_id);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Order of interning, not alphabetical order.
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr bool operator<(Name other) const
+    {
+        return (m_id < other.m_id);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    operator StringView(void) const;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD constexpr Uint32 getId(void) const
+    {
+        return (m_id);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD constexpr bool isEmpty(void) const
+    {
+        return (m_id == 0);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Null-terminated characters, valid until the program exits
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const char* cstr(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 length(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD String toString(void) const;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Look a string up without interning it.
+    ///
+    /// \param str
+    /// \param name Set to the name of `str` when it is interned
+    ///
+    /// \return Whether `str` is interned
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static bool find(StringView str, Name& name);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The number of interned strings, the empty one included
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 getCount(void);
+};
+
+} // namespace ax::container
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::hash
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::hash
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<container::Name>
+{
+    Uint64 operator()(container::Name value) const
+    {
+        return (hashMix(value.getId(), 0x9E3779B97F4A7C15ull));
+    }
+};
+
+} // namespace ax::hash
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Name of a literal, interned the first time the expression runs.
+///
+///////////////////////////////////////////////////////////////////////////////
+#define AXIOM_NAME(literal)                                                   \
+    ([]() -> ::ax::container::Name {                                          \
+        static constexpr ::ax::hash::HashedStringView view(literal);          \
+        static const ::ax::container::Name name(view);                        \
+        return (name);                                                        \
+    }())
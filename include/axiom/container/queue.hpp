@@ -29,19 +29,764 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/memory/allocator.hpp>
+#include <axiom/utility.hpp>
+#include <atomic>
+#include <new>
+
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace ax::container
 ///////////////////////////////////////////////////////////////////////////////
 namespace ax::container
 {
 
+// SECTION - Single Producer Queue
+
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Bounded lock-free queue between one producer thread and one
+/// consumer thread.
+///
+/// The items live in a ring buffer allocated once. Each side owns one index
+/// and keeps a cached copy of the other one, on its own cache line, so the
+/// two threads only share a line when the queue looks full or empty.
+///
+/// \tparam T
 ///
 ///////////////////////////////////////////////////////////////////////////////
-struct Queue
+template <typename T>
+class SpscQueue
 {
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    alignas(AXIOM_CACHE_LINE_SIZE) std::atomic<Uint64> m_tail; //<! Producer
+    Uint64 m_cachedHead = 0;                                   //<!
+    alignas(AXIOM_CACHE_LINE_SIZE) std::atomic<Uint64> m_head; //<! Consumer
+    Uint64 m_cachedTail = 0;                                   //<!
+    alignas(AXIOM_CACHE_LINE_SIZE) T* m_items = nullptr;       //<!
+    Uint64 m_mask = 0;                                         //<!
+    memory::Allocator* m_allocator = nullptr;                  //<!
+
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param capacity Rounded up to a power of two
+    /// \param allocator Allocator of the ring, used on construction and
+    /// destruction only
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit SpscQueue(Uint64 capacity, memory::Allocator& allocator
+        = memory::Allocator::getDefault());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SpscQueue(const SpscQueue&) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destroy the items left and give the ring back.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~SpscQueue(void);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+public:
+    // ANCHOR - Producer Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param item
+    ///
+    /// \return false if the queue is full
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool tryPush(const T& item);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param item
+    ///
+    /// \return false if the queue is full, `item` is left untouched then
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool tryPush(T&& item);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Args
+    ///
+    /// \param args
+    ///
+    /// \return false if the queue is full
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Args>
+    bool tryEmplace(Args&&... args);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Push as many items as there is room for, publishing them all
+    /// at once.
+    ///
+    /// \param items
+    /// \param count
+    ///
+    /// \return The number of items pushed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 pushBatch(const T* items, Uint64 count);
+
+public:
+    // ANCHOR - Consumer Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param item Assigned the oldest item
+    ///
+    /// \return false if the queue is empty
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool tryPop(T& item);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Pop up to `count` items, releasing their slots all at once.
+    ///
+    /// \param items Assigned the oldest items
+    /// \param count
+    ///
+    /// \return The number of items popped
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 popBatch(T* items, Uint64 count);
+
+public:
+    // ANCHOR - Public Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return A snapshot of the number of items, stale if the other side
+    /// is busy
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 capacity(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+private:
+    // ANCHOR - Private Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of free slots, reloading the head if needed.
+    ///
+    /// \param tail
+    /// \param wanted
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 _freeSlots(Uint64 tail, Uint64 wanted);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of full slots, reloading the tail if needed.
+    ///
+    /// \param head
+    /// \param wanted
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 _fullSlots(Uint64 head, Uint64 wanted);
+};
+
+// !SECTION
+
+// SECTION - Multiple Producer Queue
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Bounded lock-free queue between any number of producer and
+/// consumer threads.
+///
+/// Every slot carries a sequence number telling whether it is ready to be
+/// written or read for a given position, so a thread claims a position
+/// with a single compare-and-swap and never waits on a lock. Batches claim
+/// a run of ready slots with one compare-and-swap as well.
+///
+/// \tparam T
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class MpmcQueue
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Slot
+    {
+        std::atomic<Uint64> sequence;               //<!
+        alignas(T) unsigned char storage[sizeof(T)];//<!
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    alignas(AXIOM_CACHE_LINE_SIZE) std::atomic<Uint64> m_tail; //<! Producers
+    alignas(AXIOM_CACHE_LINE_SIZE) std::atomic<Uint64> m_head; //<! Consumers
+    alignas(AXIOM_CACHE_LINE_SIZE) Slot* m_slots = nullptr;    //<!
+    Uint64 m_mask = 0;                                         //<!
+    memory::Allocator* m_allocator = nullptr;                  //<!
+
+public:
+    // ANCHOR - Constructors
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param capacity Rounded up to a power of two
+    /// \param allocator Allocator of the ring, used on construction and
+    /// destruction only
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit MpmcQueue(Uint64 capacity, memory::Allocator& allocator
+        = memory::Allocator::getDefault());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    MpmcQueue(const MpmcQueue&) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destroy the items left and give the ring back.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~MpmcQueue(void);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+public:
+    // ANCHOR - Public Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param item
+    ///
+    /// \return false if the queue is full
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool tryPush(const T& item);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param item
+    ///
+    /// \return false if the queue is full, `item` is left untouched then
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool tryPush(T&& item);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Args
+    ///
+    /// \param args
+    ///
+    /// \return false if the queue is full
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Args>
+    bool tryEmplace(Args&&... args);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Push as many items as there are free slots in a row.
+    ///
+    /// \param items
+    /// \param count
+    ///
+    /// \return The number of items pushed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 pushBatch(const T* items, Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param item Assigned the oldest item
+    ///
+    /// \return false if the queue is empty
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool tryPop(T& item);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Pop up to `count` items, as many as are ready in a row.
+    ///
+    /// \param items Assigned the oldest items
+    /// \param count
+    ///
+    /// \return The number of items popped
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 popBatch(T* items, Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return A snapshot of the number of items, stale if other threads
+    /// are busy
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 capacity(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+private:
+    // ANCHOR - Private Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Claim up to `count` positions whose slots are in the wanted
+    /// state, `offset` being 0 for writing and 1 for reading.
+    ///
+    /// \param index Producer or consumer index
+    /// \param offset
+    /// \param count
+    /// \param first Set to the first position claimed
+    ///
+    /// \return The number of positions claimed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 _claim(std::atomic<Uint64>& index, Uint64 offset, Uint64 count,
+        Uint64& first);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    T* _item(Uint64 position) const;
 };
 
+// !SECTION
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Round a ring capacity up to a power of two.
+///
+/// \param capacity
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint64 queueCapacity(Uint64 capacity)
+{
+    CHECK(capacity != 0 && capacity <= (1ull << 62));
+    return (capacity <= 1 ? 1 : 2ull << utility::highestBit(capacity - 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+SpscQueue<T>::SpscQueue(Uint64 capacity, memory::Allocator& allocator)
+    : m_tail(0)
+    , m_head(0)
+    , m_allocator(&allocator)
+{
+    capacity = queueCapacity(capacity);
+    m_items = allocator.template allocateArray<T>(capacity);
+    m_mask = capacity - 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+SpscQueue<T>::~SpscQueue(void)
+{
+    const Uint64 tail = m_tail.load(std::memory_order_relaxed);
+
+    for (Uint64 i = m_head.load(std::memory_order_relaxed); i != tail; i++)
+    {
+        m_items[i & m_mask].~T();
+    }
+    m_allocator->deallocateArray(m_items, m_mask + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool SpscQueue<T>::tryPush(const T& item)
+{
+    return (tryEmplace(item));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool SpscQueue<T>::tryPush(T&& item)
+{
+    return (tryEmplace(utility::move(item)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+template <typename... Args>
+bool SpscQueue<T>::tryEmplace(Args&&... args)
+{
+    const Uint64 tail = m_tail.load(std::memory_order_relaxed);
+
+    if (_freeSlots(tail, 1) == 0)
+    {
+        return (false);
+    }
+    new (m_items + (tail & m_mask)) T(utility::forward<Args>(args)...);
+    m_tail.store(tail + 1, std::memory_order_release);
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Uint64 SpscQueue<T>::pushBatch(const T* items, Uint64 count)
+{
+    const Uint64 tail = m_tail.load(std::memory_order_relaxed);
+    const Uint64 free = _freeSlots(tail, count);
+
+    count = count < free ? count : free;
+    for (Uint64 i = 0; i < count; i++)
+    {
+        new (m_items + ((tail + i) & m_mask)) T(items[i]);
+    }
+    m_tail.store(tail + count, std::memory_order_release);
+    return (count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool SpscQueue<T>::tryPop(T& item)
+{
+    const Uint64 head = m_head.load(std::memory_order_relaxed);
+
+    if (_fullSlots(head, 1) == 0)
+    {
+        return (false);
+    }
+    T& slot = m_items[head & m_mask];
+    item = utility::move(slot);
+    slot.~T();
+    m_head.store(head + 1, std::memory_order_release);
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Uint64 SpscQueue<T>::popBatch(T* items, Uint64 count)
+{
+    const Uint64 head = m_head.load(std::memory_order_relaxed);
+    const Uint64 full = _fullSlots(head, count);
+
+    count = count < full ? count : full;
+    for (Uint64 i = 0; i < count; i++)
+    {
+        T& slot = m_items[(head + i) & m_mask];
+        items[i] = utility::move(slot);
+        slot.~T();
+    }
+    m_head.store(head + count, std::memory_order_release);
+    return (count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD Uint64 SpscQueue<T>::size(void) const
+{
+    const Uint64 head = m_head.load(std::memory_order_acquire);
+
+    return (m_tail.load(std::memory_order_acquire) - head);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD Uint64 SpscQueue<T>::capacity(void) const
+{
+    return (m_mask + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD bool SpscQueue<T>::isEmpty(void) const
+{
+    return (size() == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Uint64 SpscQueue<T>::_freeSlots(Uint64 tail, Uint64 wanted)
+{
+    Uint64 free = m_mask + 1 - (tail - m_cachedHead);
+
+    if (free < wanted)
+    {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+        free = m_mask + 1 - (tail - m_cachedHead);
+    }
+    return (free);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Uint64 SpscQueue<T>::_fullSlots(Uint64 head, Uint64 wanted)
+{
+    Uint64 full = m_cachedTail - head;
+
+    if (full < wanted)
+    {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+        full = m_cachedTail - head;
+    }
+    return (full);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+MpmcQueue<T>::MpmcQueue(Uint64 capacity, memory::Allocator& allocator)
+    : m_tail(0)
+    , m_head(0)
+    , m_allocator(&allocator)
+{
+    capacity = queueCapacity(capacity);
+    m_slots = allocator.template allocateArray<Slot>(capacity);
+    m_mask = capacity - 1;
+    for (Uint64 i = 0; i < capacity; i++)
+    {
+        new (&m_slots[i].sequence) std::atomic<Uint64>(i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+MpmcQueue<T>::~MpmcQueue(void)
+{
+    const Uint64 tail = m_tail.load(std::memory_order_relaxed);
+
+    for (Uint64 i = m_head.load(std::memory_order_relaxed); i != tail; i++)
+    {
+        _item(i)->~T();
+    }
+    m_allocator->deallocateArray(m_slots, m_mask + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool MpmcQueue<T>::tryPush(const T& item)
+{
+    return (tryEmplace(item));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool MpmcQueue<T>::tryPush(T&& item)
+{
+    return (tryEmplace(utility::move(item)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+template <typename... Args>
+bool MpmcQueue<T>::tryEmplace(Args&&... args)
+{
+    Uint64 position;
+
+    if (_claim(m_tail, 0, 1, position) == 0)
+    {
+        return (false);
+    }
+    new (_item(position)) T(utility::forward<Args>(args)...);
+    m_slots[position & m_mask].sequence.store(position + 1,
+        std::memory_order_release);
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Uint64 MpmcQueue<T>::pushBatch(const T* items, Uint64 count)
+{
+    Uint64 first;
+
+    count = _claim(m_tail, 0, count, first);
+    for (Uint64 i = 0; i < count; i++)
+    {
+        new (_item(first + i)) T(items[i]);
+        m_slots[(first + i) & m_mask].sequence.store(first + i + 1,
+            std::memory_order_release);
+    }
+    return (count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool MpmcQueue<T>::tryPop(T& item)
+{
+    Uint64 position;
+
+    if (_claim(m_head, 1, 1, position) == 0)
+    {
+        return (false);
+    }
+    T* slot = _item(position);
+    item = utility::move(*slot);
+    slot->~T();
+    m_slots[position & m_mask].sequence.store(position + m_mask + 1,
+        std::memory_order_release);
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Uint64 MpmcQueue<T>::popBatch(T* items, Uint64 count)
+{
+    Uint64 first;
+
+    count = _claim(m_head, 1, count, first);
+    for (Uint64 i = 0; i < count; i++)
+    {
+        T* slot = _item(first + i);
+        items[i] = utility::move(*slot);
+        slot->~T();
+        m_slots[(first + i) & m_mask].sequence.store(first + i + m_mask + 1,
+            std::memory_order_release);
+    }
+    return (count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD Uint64 MpmcQueue<T>::size(void) const
+{
+    const Uint64 head = m_head.load(std::memory_order_acquire);
+    const Uint64 tail = m_tail.load(std::memory_order_acquire);
+
+    return (tail > head ? tail - head : 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD Uint64 MpmcQueue<T>::capacity(void) const
+{
+    return (m_mask + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+AXIOM_NODISCARD bool MpmcQueue<T>::isEmpty(void) const
+{
+    return (size() == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+Uint64 MpmcQueue<T>::_claim(std::atomic<Uint64>& index, Uint64 offset,
+    Uint64 count, Uint64& first)
+{
+    first = index.load(std::memory_order_relaxed);
+    if (count == 0)
+    {
+        return (0);
+    }
+    for (;;)
+    {
+        const Uint64 sequence = m_slots[first & m_mask].sequence.load(
+            std::memory_order_acquire);
+        const Int64 lag = (Int64)(sequence - (first + offset));
+        if (lag < 0)
+        {
+            return (0);
+        }
+        if (lag > 0)
+        {
+            first = index.load(std::memory_order_relaxed);
+            continue;
+        }
+        // The slots in a row holding the sequence of their position stay in
+        // that state until the position is taken, so they are claimed whole
+        Uint64 ready = 1;
+        while (ready < count && m_slots[(first + ready) & m_mask].sequence
+            .load(std::memory_order_acquire) == first + ready + offset)
+        {
+            ready++;
+        }
+        if (index.compare_exchange_weak(first, first + ready,
+            std::memory_order_relaxed, std::memory_order_relaxed))
+        {
+            return (ready);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T* MpmcQueue<T>::_item(Uint64 position) const
+{
+    return (reinterpret_cast<T*>(m_slots[position & m_mask].storage));
+}
+
 } // namespace ax::container
@@ -0,0 +1,486 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/container/string.hpp>
+#include <axiom/container/stringView.hpp>
+#include <axiom/memory/allocator.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::container
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::container
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Text kept as a balanced tree of chunks, for large text edited in
+/// place.
+///
+/// Inserting or erasing anywhere costs O(log n) plus the size of the edit,
+/// where a `String` moves everything after the edit. Edits that fit in the
+/// chunk they touch move at most one chunk. Reading a character costs
+/// O(log n), and a contiguous copy of the text is only made on demand by
+/// `toString` or `copyTo`, in O(n).
+///
+/// The chunks are the nodes of a treap ordered by position, whose random
+/// priorities keep it balanced whatever the order of the edits.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Rope
+{
+public:
+    // ANCHOR - Member Data
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Characters in a chunk, a node being 512 bytes.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint32 chunkCapacity = 480;    //<!
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Node
+    {
+        Node* left;                 //<!
+        Node* right;                //<!
+        Uint64 size;                //<! Characters in the subtree
+        Uint32 priority;            //<! Above the ones of the children
+        Uint32 length;              //<! Characters in this chunk
+        char text[chunkCapacity];   //<!
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Node* m_root = nullptr;                     //<!
+    Uint32 m_seed = 0x9E3779B9;                 //<! Of the priorities
+    memory::Allocator* m_allocator = nullptr;   //<! nullptr for the default
+
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Rope(void) = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param allocator Allocator of the chunks
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Rope(memory::Allocator& allocator);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param str
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Rope(StringView str);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Rope(const Rope& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Rope(Rope&& other) noexcept;
+
+    // ANCHOR - Destructor
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~Rope(void);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Rope& operator=(const Rope& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take the chunks of `other` when both ropes share the same
+    /// allocator, copy them otherwise.
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    /// \throw std::exception if the copy fails to allocate
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Rope& operator=(Rope&& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    ///
+    /// \return The character at `position`, in O(log n)
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    char operator[](Uint64 position) const;
+
+public:
+    // ANCHOR - Modification
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position At most `length()`
+    /// \param str
+    ///
+    /// \throw std::exception if `position` is past the end
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void insert(Uint64 position, StringView str);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param str
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void append(StringView str);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position At most `length()`
+    /// \param count Clamped to the end of the text
+    ///
+    /// \throw std::exception if `position` is past the end
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void erase(Uint64 position, Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+public:
+    // ANCHOR - Access
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    ///
+    /// \return
+    ///
+    /// \throw std::exception if `position` is past the end
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD char at(Uint64 position) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 length(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The number of chunks holding the text
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 getChunkCount(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The number of chunks on the longest path from the root
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 getDepth(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD memory::Allocator& getAllocator(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Flatten the text into a string, in O(n).
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD String toString(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position At most `length()`
+    /// \param count Clamped to the end of the text
+    ///
+    /// \return
+    ///
+    /// \throw std::exception if `position` is past the end
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD String substr(Uint64 position, Uint64 count) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write part of the text, without null terminator.
+    ///
+    /// \param buffer At least `count` characters
+    /// \param position At most `length()`
+    /// \param count Clamped to the end of the text
+    ///
+    /// \return The number of characters written
+    ///
+    /// \throw std::exception if `position` is past the end
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 copyTo(char* buffer, Uint64 position, Uint64 count) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Call `function(const char* data, Uint64 length)` on every
+    /// chunk, in order, without flattening.
+    ///
+    /// \tparam Function
+    ///
+    /// \param function
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Function>
+    void forEachChunk(Function&& function) const;
+
+private:
+    // ANCHOR - Private Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    /// \param length At most `chunkCapacity`
+    ///
+    /// \return A chunk with a fresh priority
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Node* _create(const char* data, Uint32 length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param node Freed with its subtree
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _destroy(Node* node);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param node
+    ///
+    /// \return A copy of the subtree, priorities included
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Node* _clone(const Node* node);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Cut a tree in two, a chunk straddling the cut being split.
+    ///
+    /// \param node
+    /// \param position
+    /// \param left Receives the first `position` characters
+    /// \param right Receives the others
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _split(Node* node, Uint64 position, Node*& left, Node*& right);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param left
+    /// \param right
+    ///
+    /// \return The concatenation of both trees
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Node* _merge(Node* left, Node* right);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Concatenate two trees, folding the first chunk of the right
+    /// into the last chunk of the left when both fit in one, so that the
+    /// seams left by `_split` do not pile up undersized chunks.
+    ///
+    /// \param left
+    /// \param right
+    ///
+    /// \return The concatenation of both trees
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Node* _join(Node* left, Node* right);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Walk down to the chunk holding a position, adding `delta` to
+    /// the subtree sizes on the way.
+    ///
+    /// \param position Becomes an offset in the chunk
+    /// \param inclusive Whether the end of a chunk belongs to it, where an
+    /// insertion can append to it
+    /// \param delta Characters added, or removed when negative
+    ///
+    /// \return The chunk, nullptr when the rope is empty
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Node* _descend(Uint64& position, bool inclusive, Int64 delta);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param node
+    ///
+    /// \return The number of chunks on the longest path down the subtree
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 _depth(const Node* node);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param node
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 _size(const Node* node);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param node
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void _update(Node* node);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Call `function(const char* data, Uint64 length)` on the parts
+    /// of the chunks in a range, in order.
+    ///
+    /// \tparam Function
+    ///
+    /// \param node
+    /// \param position In the subtree
+    /// \param count Within the subtree
+    /// \param function
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Function>
+    static void _visit(const Node* node, Uint64 position, Uint64 count,
+        Function& function);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Function>
+void Rope::forEachChunk(Function&& function) const
+{
+    _visit(m_root, 0, _size(m_root), function);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Function>
+void Rope::_visit(const Node* node, Uint64 position, Uint64 count,
+    Function& function)
+{
+    // Recurse on the left only, the depth staying logarithmic
+    while (node != nullptr && count != 0)
+    {
+        const Uint64 leftSize = _size(node->left);
+        if (position < leftSize)
+        {
+            const Uint64 taken = leftSize - position < count
+                ? leftSize - position : count;
+            _visit(node->left, position, taken, function);
+            count -= taken;
+            position = leftSize;
+        }
+        const Uint64 offset = position - leftSize;
+        if (offset < node->length && count != 0)
+        {
+            const Uint64 taken = node->length - offset < count
+                ? node->length - offset : count;
+            function((const char*)node->text + offset, taken);
+            count -= taken;
+            position = leftSize + node->length;
+        }
+        position -= leftSize + node->length;
+        node = node->right;
+    }
+}
+
+} // namespace ax::container
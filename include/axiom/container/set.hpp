@@ -29,6 +29,18 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/container/array.hpp>
+#include <axiom/container/hashTable.hpp>
+#include <axiom/utility.hpp>
+#include <initializer_list>
+#include <algorithm>
+#include <new>
+
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace ax::container
 ///////////////////////////////////////////////////////////////////////////////
@@ -36,12 +48,1256 @@ namespace ax::container
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Default ordering of the sorted containers.
+///
+/// \tparam T
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct Less
+{
+    bool operator()(const T& lhs, const T& rhs) const
+    {
+        return (lhs < rhs);
+    }
+};
+
+// SECTION - Set
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Ordered set stored as a sorted `Array`.
+///
+/// Meant for read-mostly data: lookups are a branchless binary search over
+/// contiguous memory, while a single insertion shifts the items after it.
+/// Many values are better added at once with `insert(values, count)`, which
+/// sorts and removes the duplicates a single time.
+///
+/// \tparam T
+/// \tparam Compare Strict weak ordering of the items
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare = Less<T>>
+class Set
+{
+public:
+    // ANCHOR - Member Data
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using ConstIterator = const T*;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Array<T> m_items;   //<! Sorted, without duplicates
+    Compare m_less;     //<!
+
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Set(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param allocator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Set(memory::Allocator& allocator);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param values Any order, duplicates allowed
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Set(const T* values, Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param values Any order, duplicates allowed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Set(std::initializer_list<T> values);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return The item of rank `index`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const T& operator[](Uint64 index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator==(const Set& other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator!=(const Set& other) const;
+
+public:
+    // ANCHOR - Public Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return Whether `value` was not already present
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool insert(const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return Whether `value` was not already present
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool insert(T&& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Insert many values, sorting and merging them in one pass.
+    ///
+    /// \param values Any order, duplicates allowed
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void insert(const T* values, Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return Whether `value` was present
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool erase(const T& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return An iterator on `value`, or `end()`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator find(const T& value) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool contains(const T& value) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return Index of the first item not ordered before `value`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 lowerBound(const T& value) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return Items of either set
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Set unionWith(const Set& other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return Items of both sets
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Set intersectionWith(const Set& other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return Items of this set missing from `other`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Set differenceWith(const Set& other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param capacity
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void reserve(Uint64 capacity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD memory::Allocator& getAllocator(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The items, sorted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const T* data(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator begin(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator end(void) const;
+
+private:
+    // ANCHOR - Private Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param lhs
+    /// \param rhs
+    ///
+    /// \return Whether both values are equivalent
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool _equivalent(const T& lhs, const T& rhs) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sort the items from `first` on, and merge them with the sorted
+    /// items before it, dropping the duplicates.
+    ///
+    /// \param first
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _mergeFrom(Uint64 first);
+};
+
+// !SECTION
+
+// SECTION - Hash Set
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Unordered set built on `HashTable`, the core of `Map`.
+///
+/// Lookups are templated like the ones of `Map`, and accept a precomputed
+/// hash as well. The items cannot be modified in place, as that would move
+/// them away from the slot their hash leads to.
+///
+/// \tparam T
+/// \tparam Hash
+/// \tparam Equal
 ///
 ///////////////////////////////////////////////////////////////////////////////
-struct Set
+template <typename T, typename Hash = Hasher<T>, typename Equal = EqualTo<T>>
+class HashSet
 {
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct KeyOf
+    {
+        static const T& get(const T& item)
+        {
+            return (item);
+        }
+    };
+
+public:
+    // ANCHOR - Member Data
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Table = HashTable<T, KeyOf, Hash, Equal>;
+    using ConstIterator = typename Table::ConstIterator;
+    using Stats = typename Table::Stats;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Table m_table;  //<!
+
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    HashSet(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param allocator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit HashSet(memory::Allocator& allocator);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param values Duplicates allowed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    HashSet(std::initializer_list<T> values);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator==(const HashSet& other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator!=(const HashSet& other) const;
 
+public:
+    // ANCHOR - Public Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q Key type, or a type that hashes and compares like it
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD Uint64 hash(const Q& value) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q Any type a `T` can be built from
+    ///
+    /// \param value
+    ///
+    /// \return Whether `value` was not already present
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    bool insert(Q&& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q Any type a `T` can be built from
+    ///
+    /// \param value
+    /// \param hash The value of `hash(value)`
+    ///
+    /// \return Whether `value` was not already present
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    bool insertHashed(Q&& value, Uint64 hash);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param values
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void insert(const T* values, Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param value
+    ///
+    /// \return An iterator on the item, or `end()`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD ConstIterator find(const Q& value) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD bool contains(const Q& value) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param value
+    /// \param hash The value of `hash(value)`
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    AXIOM_NODISCARD bool contains(const Q& value, Uint64 hash) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param value
+    ///
+    /// \return Whether `value` was present
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    bool erase(const Q& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Q
+    ///
+    /// \param value
+    /// \param hash The value of `hash(value)`
+    ///
+    /// \return Whether `value` was present
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Q>
+    bool erase(const Q& value, Uint64 hash);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove the item under `position`.
+    ///
+    /// \param position
+    ///
+    /// \return An iterator on the next item
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ConstIterator erase(ConstIterator position);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return Items of either set
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD HashSet unionWith(const HashSet& other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return Items of both sets
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD HashSet intersectionWith(const HashSet& other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return Items of this set missing from `other`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD HashSet differenceWith(const HashSet& other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void reserve(Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 capacity(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD memory::Allocator& getAllocator(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the load factor and probe lengths of the set.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Stats getStats(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator begin(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD ConstIterator end(void) const;
 };
 
+// !SECTION
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+Set<T, Compare>::Set(void) {}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+Set<T, Compare>::Set(memory::Allocator& allocator)
+    : m_items(allocator)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+Set<T, Compare>::Set(const T* values, Uint64 count)
+{
+    insert(values, count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+Set<T, Compare>::Set(std::initializer_list<T> values)
+{
+    insert(values.begin(), values.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+const T& Set<T, Compare>::operator[](Uint64 index) const
+{
+    return (m_items[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+bool Set<T, Compare>::operator==(const Set& other) const
+{
+    if (m_items.size() != other.m_items.size())
+    {
+        return (false);
+    }
+    for (Uint64 i = 0; i < m_items.size(); i++)
+    {
+        if (!_equivalent(m_items[i], other.m_items[i]))
+        {
+            return (false);
+        }
+    }
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+bool Set<T, Compare>::operator!=(const Set& other) const
+{
+    return (!(*this == other));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+bool Set<T, Compare>::insert(const T& value)
+{
+    const Uint64 index = lowerBound(value);
+
+    if (index < m_items.size() && !m_less(value, m_items[index]))
+    {
+        return (false);
+    }
+    m_items.insert(index, value);
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+bool Set<T, Compare>::insert(T&& value)
+{
+    const Uint64 index = lowerBound(value);
+
+    if (index < m_items.size() && !m_less(value, m_items[index]))
+    {
+        return (false);
+    }
+    m_items.insert(index, utility::move(value));
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+void Set<T, Compare>::insert(const T* values, Uint64 count)
+{
+    const Uint64 first = m_items.size();
+
+    m_items.append(values, count);
+    _mergeFrom(first);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+bool Set<T, Compare>::erase(const T& value)
+{
+    const Uint64 index = lowerBound(value);
+
+    if (index == m_items.size() || m_less(value, m_items[index]))
+    {
+        return (false);
+    }
+    m_items.erase(index);
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+AXIOM_NODISCARD typename Set<T, Compare>::ConstIterator
+    Set<T, Compare>::find(const T& value) const
+{
+    const Uint64 index = lowerBound(value);
+
+    if (index == m_items.size() || m_less(value, m_items[index]))
+    {
+        return (end());
+    }
+    return (m_items.data() + index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+AXIOM_NODISCARD bool Set<T, Compare>::contains(const T& value) const
+{
+    return (find(value) != end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+AXIOM_NODISCARD Uint64 Set<T, Compare>::lowerBound(const T& value) const
+{
+    const T* base = m_items.data();
+    Uint64 count = m_items.size();
+
+    if (count == 0)
+    {
+        return (0);
+    }
+    // Halve the range without branching on the comparison, so the loop runs
+    // the same number of times for every value and compiles to a cmov.
+    while (count > 1)
+    {
+        const Uint64 half = count / 2;
+#if defined(__GNUC__) || defined(__clang__)
+        // Both candidates of the next step are fetched while this one waits,
+        // which only pays off once they are cache lines apart.
+        if (half * sizeof(T) >= 256)
+        {
+            __builtin_prefetch(base + half / 2 - 1);
+            __builtin_prefetch(base + half + half / 2 - 1);
+        }
+#endif
+        base += m_less(base[half - 1], value) ? half : 0;
+        count -= half;
+    }
+    return ((base - m_items.data()) + m_less(*base, value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+AXIOM_NODISCARD Set<T, Compare> Set<T, Compare>::unionWith(
+    const Set& other) const
+{
+    Set result(getAllocator());
+    const T* a = begin();
+    const T* b = other.begin();
+
+    result.m_items.reserve(size() + other.size());
+    while (a != end() && b != other.end())
+    {
+        if (m_less(*a, *b))
+        {
+            result.m_items.pushBack(*a++);
+        }
+        else if (m_less(*b, *a))
+        {
+            result.m_items.pushBack(*b++);
+        }
+        else
+        {
+            result.m_items.pushBack(*a++);
+            b++;
+        }
+    }
+    result.m_items.append(a, end() - a);
+    result.m_items.append(b, other.end() - b);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+AXIOM_NODISCARD Set<T, Compare> Set<T, Compare>::intersectionWith(
+    const Set& other) const
+{
+    Set result(getAllocator());
+    const T* a = begin();
+    const T* b = other.begin();
+
+    result.m_items.reserve(size() < other.size() ? size() : other.size());
+    while (a != end() && b != other.end())
+    {
+        if (m_less(*a, *b))
+        {
+            a++;
+        }
+        else if (m_less(*b, *a))
+        {
+            b++;
+        }
+        else
+        {
+            result.m_items.pushBack(*a++);
+            b++;
+        }
+    }
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+AXIOM_NODISCARD Set<T, Compare> Set<T, Compare>::differenceWith(
+    const Set& other) const
+{
+    Set result(getAllocator());
+    const T* a = begin();
+    const T* b = other.begin();
+
+    result.m_items.reserve(size());
+    while (a != end() && b != other.end())
+    {
+        if (m_less(*a, *b))
+        {
+            result.m_items.pushBack(*a++);
+        }
+        else if (m_less(*b, *a))
+        {
+            b++;
+        }
+        else
+        {
+            a++;
+            b++;
+        }
+    }
+    result.m_items.append(a, end() - a);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+void Set<T, Compare>::clear(void)
+{
+    m_items.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+void Set<T, Compare>::reserve(Uint64 capacity)
+{
+    m_items.reserve(capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+AXIOM_NODISCARD Uint64 Set<T, Compare>::size(void) const
+{
+    return (m_items.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+AXIOM_NODISCARD bool Set<T, Compare>::isEmpty(void) const
+{
+    return (m_items.isEmpty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+AXIOM_NODISCARD memory::Allocator& Set<T, Compare>::getAllocator(void) const
+{
+    return (m_items.getAllocator());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+AXIOM_NODISCARD const T* Set<T, Compare>::data(void) const
+{
+    return (m_items.data());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+AXIOM_NODISCARD typename Set<T, Compare>::ConstIterator
+    Set<T, Compare>::begin(void) const
+{
+    return (m_items.begin());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+AXIOM_NODISCARD typename Set<T, Compare>::ConstIterator
+    Set<T, Compare>::end(void) const
+{
+    return (m_items.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+bool Set<T, Compare>::_equivalent(const T& lhs, const T& rhs) const
+{
+    return (!m_less(lhs, rhs) && !m_less(rhs, lhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+void Set<T, Compare>::_mergeFrom(Uint64 first)
+{
+    T* items = m_items.data();
+    const Uint64 count = m_items.size();
+
+    std::sort(items + first, items + count, m_less);
+    if (first == 0)
+    {
+        Uint64 write = 0;
+        for (Uint64 read = 0; read < count; read++)
+        {
+            if (write == 0 || m_less(items[write - 1], items[read]))
+            {
+                if (write != read)
+                {
+                    items[write] = utility::move(items[read]);
+                }
+                write++;
+            }
+        }
+        m_items.erase(write, count - write);
+        return;
+    }
+    Array<T> merged(getAllocator());
+    Uint64 a = 0;
+    Uint64 b = first;
+
+    merged.reserve(count);
+    while (a < first || b < count)
+    {
+        T& next = (b == count || (a < first && !m_less(items[b], items[a])))
+            ? items[a++] : items[b++];
+        if (merged.isEmpty() || m_less(merged.back(), next))
+        {
+            merged.pushBack(utility::move(next));
+        }
+    }
+    m_items = utility::move(merged);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+HashSet<T, Hash, Equal>::HashSet(void) {}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+HashSet<T, Hash, Equal>::HashSet(memory::Allocator& allocator)
+    : m_table(&allocator)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+HashSet<T, Hash, Equal>::HashSet(std::initializer_list<T> values)
+{
+    insert(values.begin(), values.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+bool HashSet<T, Hash, Equal>::operator==(const HashSet& other) const
+{
+    if (size() != other.size())
+    {
+        return (false);
+    }
+    for (const T& item : *this)
+    {
+        if (!other.contains(item))
+        {
+            return (false);
+        }
+    }
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+bool HashSet<T, Hash, Equal>::operator!=(const HashSet& other) const
+{
+    return (!(*this == other));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD Uint64 HashSet<T, Hash, Equal>::hash(const Q& value) const
+{
+    return (m_table.hash(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+template <typename Q>
+bool HashSet<T, Hash, Equal>::insert(Q&& value)
+{
+    const Uint64 hash = m_table.hash(value);
+
+    return (insertHashed(utility::forward<Q>(value), hash));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+template <typename Q>
+bool HashSet<T, Hash, Equal>::insertHashed(Q&& value, Uint64 hash)
+{
+    return (m_table.findOrInsert(value, hash, [&](T* item)
+    {
+        new (item) T(utility::forward<Q>(value));
+    }).inserted);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+void HashSet<T, Hash, Equal>::insert(const T* values, Uint64 count)
+{
+    m_table.reserve(m_table.size() + count);
+    for (Uint64 i = 0; i < count; i++)
+    {
+        insert(values[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD typename HashSet<T, Hash, Equal>::ConstIterator
+    HashSet<T, Hash, Equal>::find(const Q& value) const
+{
+    const T* item = m_table.find(value, m_table.hash(value));
+
+    return (m_table.iteratorTo(item));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD bool HashSet<T, Hash, Equal>::contains(const Q& value) const
+{
+    return (m_table.find(value, m_table.hash(value)) != nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+template <typename Q>
+AXIOM_NODISCARD bool HashSet<T, Hash, Equal>::contains(const Q& value,
+    Uint64 hash) const
+{
+    return (m_table.find(value, hash) != nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+template <typename Q>
+bool HashSet<T, Hash, Equal>::erase(const Q& value)
+{
+    return (m_table.erase(value, m_table.hash(value)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+template <typename Q>
+bool HashSet<T, Hash, Equal>::erase(const Q& value, Uint64 hash)
+{
+    return (m_table.erase(value, hash));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+typename HashSet<T, Hash, Equal>::ConstIterator
+    HashSet<T, Hash, Equal>::erase(ConstIterator position)
+{
+    ConstIterator next = position;
+
+    ++next;
+    m_table.erase(position.get());
+    return (next);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+AXIOM_NODISCARD HashSet<T, Hash, Equal> HashSet<T, Hash, Equal>::unionWith(
+    const HashSet& other) const
+{
+    HashSet result(getAllocator());
+
+    result.reserve(size() + other.size());
+    for (const T& item : *this)
+    {
+        result.insert(item);
+    }
+    for (const T& item : other)
+    {
+        result.insert(item);
+    }
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+AXIOM_NODISCARD HashSet<T, Hash, Equal>
+    HashSet<T, Hash, Equal>::intersectionWith(const HashSet& other) const
+{
+    const HashSet& smaller = size() < other.size() ? *this : other;
+    const HashSet& larger = size() < other.size() ? other : *this;
+    HashSet result(getAllocator());
+
+    result.reserve(smaller.size());
+    for (const T& item : smaller)
+    {
+        if (larger.contains(item))
+        {
+            result.insert(item);
+        }
+    }
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+AXIOM_NODISCARD HashSet<T, Hash, Equal>
+    HashSet<T, Hash, Equal>::differenceWith(const HashSet& other) const
+{
+    HashSet result(getAllocator());
+
+    result.reserve(size());
+    for (const T& item : *this)
+    {
+        if (!other.contains(item))
+        {
+            result.insert(item);
+        }
+    }
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+void HashSet<T, Hash, Equal>::clear(void)
+{
+    m_table.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+void HashSet<T, Hash, Equal>::reserve(Uint64 count)
+{
+    m_table.reserve(count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+AXIOM_NODISCARD Uint64 HashSet<T, Hash, Equal>::size(void) const
+{
+    return (m_table.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+AXIOM_NODISCARD Uint64 HashSet<T, Hash, Equal>::capacity(void) const
+{
+    return (m_table.capacity());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+AXIOM_NODISCARD bool HashSet<T, Hash, Equal>::isEmpty(void) const
+{
+    return (m_table.size() == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+AXIOM_NODISCARD memory::Allocator&
+    HashSet<T, Hash, Equal>::getAllocator(void) const
+{
+    return (m_table.getAllocator());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+AXIOM_NODISCARD typename HashSet<T, Hash, Equal>::Stats
+    HashSet<T, Hash, Equal>::getStats(void) const
+{
+    return (m_table.getStats());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+AXIOM_NODISCARD typename HashSet<T, Hash, Equal>::ConstIterator
+    HashSet<T, Hash, Equal>::begin(void) const
+{
+    return (m_table.begin());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Hash, typename Equal>
+AXIOM_NODISCARD typename HashSet<T, Hash, Equal>::ConstIterator
+    HashSet<T, Hash, Equal>::end(void) const
+{
+    return (m_table.end());
+}
+
 } // namespace ax::container
@@ -34,6 +34,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <axiom/config.hpp>
 #include <axiom/math/types.hpp>
+#include <axiom/container/charSet.hpp>
+#include <axiom/container/stringView.hpp>
+#include <axiom/memory/allocator.hpp>
+#include <axiom/utility.hpp>
 #include <string>
 #include <iostream>
 #include <utility>
@@ -53,6 +57,11 @@
 namespace ax::container
 {
 
+///////////////////////////////////////////////////////////////////////////////
+// Forward declarations
+///////////////////////////////////////////////////////////////////////////////
+class StringBuilder;
+
 // SECTION - String
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -70,15 +79,29 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     static const Uint64 npos = -1;  //<!
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Number of characters stored inline, without any heap
+    /// allocation, before the string spills to a heap buffer.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 localCapacity = 23; //<!
+
 private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sizes strings once and writes its pieces straight into them.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    friend class StringBuilder;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     ///////////////////////////////////////////////////////////////////////////
-    char* m_str = nullptr;          //<!
-    Uint64 m_length = 0;            //<!
-    Uint64 m_capacity = 0;          //<!
-    Uint64 m_increaseBy = 15;       //<!
+    char* m_str = nullptr;                      //<! Heap buffer, or nullptr
+    Uint64 m_length = 0;                        //<!
+    Uint64 m_capacity = localCapacity;          //<!
+    char m_local[localCapacity + 1] = {};       //<! Small string buffer
+    memory::Allocator* m_allocator = nullptr;   //<! nullptr for the default
 
 protected:
     // SECTION - String Iterator
@@ -714,6 +737,21 @@ public:
     using ConstReversePointer = ConstReverseIterator;
     using ReversePointer = ReverseIterator;
 
+    // ANCHOR - Edit
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Replacement of `length` characters at `position` by the first
+    /// `textLength` characters of `text`, applied by `applyEdits`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Edit
+    {
+        Uint64 position;    //<!
+        Uint64 length;      //<!
+        const char* text;   //<!
+        Uint64 textLength;  //<!
+    };
+
 public:
     // ANCHOR - Constructors
 
@@ -724,7 +762,8 @@ public:
     String(void);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Copy `other` into a string using the default allocator, so
+    /// that copies of arena strings do not depend on the arena.
     ///
     /// \param other
     ///
@@ -742,12 +781,13 @@ public:
     String(const String& other, Uint64 position, Uint64 length = npos);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Take the buffer of `other`, along with its allocator. Never
+    /// allocates.
     ///
     /// \param other
     ///
     ///////////////////////////////////////////////////////////////////////////
-    String(String&& other);
+    String(String&& other) noexcept;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -774,6 +814,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     String(const char* other, Uint64 length);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit String(StringView other);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -792,6 +840,25 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     String(const ConstIterator first, const ConstIterator second);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build an empty string whose heap buffers come from
+    /// `allocator`, which must outlive it.
+    ///
+    /// \param allocator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit String(memory::Allocator& allocator);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build a copy of `other` whose heap buffers come from
+    /// `allocator`, which must outlive it.
+    ///
+    /// \param other
+    /// \param allocator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String(StringView other, memory::Allocator& allocator);
+
 public:
     // ANCHOR - Destructor
 
@@ -805,7 +872,8 @@ public:
     // ANCHOR - Operators
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Copy the characters of `other` into the current buffer,
+    /// allocating only when it is too small.
     ///
     /// \param other
     ///
@@ -815,15 +883,49 @@ public:
     String& operator=(const String& other);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Take the buffer of `other` when both strings share the same
+    /// allocator, copy the characters otherwise. The allocator of a string
+    /// never changes after construction.
     ///
     /// \param other
     ///
     /// \return
     ///
+    /// \throw std::exception if the copy fails to allocate
+    ///
     ///////////////////////////////////////////////////////////////////////////
     String& operator=(String&& other);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& operator=(StringView other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& operator=(const std::string& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& operator=(const char* other);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -852,7 +954,67 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    bool operator==(const String& rhs);
+    bool operator==(const String& rhs) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param rhs
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator==(const char* rhs) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param rhs
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator!=(const String& rhs) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param rhs
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator!=(const char* rhs) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param rhs
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator<(const String& rhs) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param rhs
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator<(const char* rhs) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param rhs
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator<=(const String& rhs) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -862,7 +1024,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    bool operator!=(const String& rhs);
+    bool operator<=(const char* rhs) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -872,7 +1034,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    bool operator<(const String& rhs);
+    bool operator>(const String& rhs) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -882,7 +1044,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    bool operator<=(const String& rhs);
+    bool operator>(const char* rhs) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -892,7 +1054,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    bool operator>(const String& rhs);
+    bool operator>=(const String& rhs) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -902,7 +1064,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    bool operator>=(const String& rhs);
+    bool operator>=(const char* rhs) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -910,6 +1072,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     operator std::string(void) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief View of the whole string, valid until it is modified.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    operator StringView(void) const;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -1081,6 +1251,16 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     String& append(const String& str);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param str
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& append(StringView str);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -1147,14 +1327,59 @@ public:
     String& append(const ConstIterator first, const ConstIterator second);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Append a single character, writing it in place while the
+    /// buffer has room and only growing out of line otherwise.
     ///
     /// \param ch
     ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    String& append(char ch);
+    inline String& append(char ch);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append the decimal text of an integer.
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& appendInt(Int64 value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append the decimal text of an unsigned integer.
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& appendUint(Uint64 value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append the shortest text that reads back as the same value.
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    /// \see StringNumber::formatFloat
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& appendFloat(double value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append the shortest text that reads back as the same value.
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    /// \see StringNumber::formatFloat
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& appendFloat(float value);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -1167,6 +1392,17 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     String& insert(Uint64 position, const String& other);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& insert(Uint64 position, StringView other);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -1314,6 +1550,18 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     String& replace(Uint64 position, Uint64 length, const String& other);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param position
+    /// \param length
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& replace(Uint64 position, Uint64 length, StringView other);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -1462,10 +1710,39 @@ public:
         ConstIterator third, ConstIterator four);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Replace every occurrence of `from` by `to`, left to right.
     ///
-    /// \param other
+    /// Works in place when `to` is not longer than `from`, and otherwise
+    /// allocates the final buffer once.
+    ///
+    /// \param from
+    /// \param to
     ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& replaceAll(StringView from, StringView to);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Apply many edits in one pass with a single allocation.
+    ///
+    /// Edits must be sorted by position and must not overlap. Positions
+    /// refer to the string before any edit is applied, so a template can be
+    /// scanned once and every placeholder substituted afterwards.
+    ///
+    /// \param edits
+    /// \param count
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& applyEdits(const Edit* edits, Uint64 count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Exchange the contents of both strings. Strings sharing an
+    /// allocator trade their buffers in place, others copy the characters.
+    ///
+    /// \param other
     ///
     ///////////////////////////////////////////////////////////////////////////
     void swap(String& other);
@@ -1513,6 +1790,17 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     Uint64 find(const String& other, Uint64 position = 0) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 find(StringView other, Uint64 position = 0) const;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -1569,6 +1857,17 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     Uint64 rfind(const String& other, Uint64 position = npos) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 rfind(StringView other, Uint64 position = npos) const;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -1625,6 +1924,17 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     Uint64 findFirstOf(const String& other, Uint64 position = 0) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 findFirstOf(StringView other, Uint64 position = 0) const;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -1674,13 +1984,13 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param other
+    /// \param set
     /// \param position
     ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Uint64 findLastOf(const String& other, Uint64 position = npos) const;
+    Uint64 findFirstOf(const CharSet& set, Uint64 position = 0) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -1691,7 +2001,7 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Uint64 findLastOf(const std::string& other, Uint64 position = npos) const;
+    Uint64 findLastOf(const String& other, Uint64 position = npos) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -1702,52 +2012,96 @@ public:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Uint64 findLastOf(const char* other, Uint64 position = npos) const;
+    Uint64 findLastOf(StringView other, Uint64 position = npos) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param other
     /// \param position
-    /// \param length
     ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Uint64 findLastOf(const char* other, Uint64 position, Uint64 length) const;
+    Uint64 findLastOf(const std::string& other, Uint64 position = npos) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param ch
+    /// \param other
     /// \param position
     ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Uint64 findLastOf(char ch, Uint64 position = npos) const;
+    Uint64 findLastOf(const char* other, Uint64 position = npos) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param other
     /// \param position
+    /// \param length
     ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Uint64 findFirstNotOf(const String& other, Uint64 position = 0) const;
+    Uint64 findLastOf(const char* other, Uint64 position, Uint64 length) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param other
+    /// \param ch
     /// \param position
     ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Uint64 findFirstNotOf(const std::string& other, Uint64 position = 0) const;
+    Uint64 findLastOf(char ch, Uint64 position = npos) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param set
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 findLastOf(const CharSet& set, Uint64 position = npos) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 findFirstNotOf(const String& other, Uint64 position = 0) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 findFirstNotOf(StringView other, Uint64 position = 0) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 findFirstNotOf(const std::string& other, Uint64 position = 0) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -1784,6 +2138,17 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     Uint64 findFirstNotOf(char ch, Uint64 position = 0) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param set
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 findFirstNotOf(const CharSet& set, Uint64 position = 0) const;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -1795,6 +2160,18 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     Uint64 findLastNotOf(const String& other, Uint64 position = npos) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 findLastNotOf(StringView other, Uint64 position = npos)
+        const;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -1842,6 +2219,18 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     Uint64 findLastNotOf(char ch, Uint64 position = npos) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param set
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 findLastNotOf(const CharSet& set, Uint64 position = npos)
+        const;
+
     // ANCHOR - Information
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1855,6 +2244,57 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     String substr(Uint64 position = 0, Uint64 length = npos) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Same as `substr`, without copying the characters.
+    ///
+    /// \param position
+    /// \param length
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringView view(Uint64 position = 0, Uint64 length = npos) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Fields separated by `delimiter`, as views.
+    ///
+    /// \param delimiter
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringSplit split(char delimiter) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param delimiter
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringSplit split(StringView delimiter) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Runs of characters outside `delimiters`, as views.
+    ///
+    /// \param delimiters
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringSplit tokenize(const CharSet& delimiters) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Lexicographic comparison, like `StringView::compare`.
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    int compare(StringView other) const;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -1879,6 +2319,14 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     Uint64 maxSize(void) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the allocator the heap buffers come from.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD memory::Allocator& getAllocator(void) const;
+
     // ANCHOR - Transform
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1950,6 +2398,16 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     String& trim(void);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove the leading and trailing members of `set`.
+    ///
+    /// \param set
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    String& trim(const CharSet& set);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -1963,6 +2421,24 @@ public:
 private:
     // ANCHOR - Private Methods
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the active character buffer, either the inline buffer or
+    /// the heap allocation.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline char* _data(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the active character buffer, either the inline buffer or
+    /// the heap allocation.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline const char* _data(void) const;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -2038,6 +2514,15 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     void _append(const char* other, Uint64 length);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Grow the buffer and append a single character, the slow path
+    /// of `append(char)` once the capacity is exhausted.
+    ///
+    /// \param ch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _appendGrow(char ch);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -2060,58 +2545,71 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \param buffer
-    /// \param other
     /// \param position
     /// \param length
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void _substr(char*& buffer, const char* other, Uint64 position = 0,
-        Uint64 length = npos) const;
+    void _erase(Uint64 position, Uint64 length);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param position
     /// \param length
+    /// \param other
+    /// \param n
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void _erase(Uint64 position, Uint64 length);
+    void _replace(Uint64 position, Uint64 length, const char* other, Uint64 n);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
     /// \param position
     /// \param length
-    /// \param other
     /// \param n
+    /// \param filler
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void _replace(Uint64 position, Uint64 length, const char* other, Uint64 n);
+    void _fill(Uint64 position, Uint64 length, Uint64 n, char filler);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Replace `length` characters at `position` by an uninitialized
+    /// gap of `n` characters, moving the tail in place.
+    ///
+    /// The buffer is only reallocated when the new length exceeds the
+    /// capacity, in which case head and tail are copied once.
     ///
-    /// \param other
-    /// \param length
     /// \param position
+    /// \param length
+    /// \param n
     ///
-    /// \return
+    /// \return Pointer to the gap.
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Uint64 _find(const char* other, Uint64 length, Uint64 position) const;
+    char* _makeGap(Uint64 position, Uint64 length, Uint64 n);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
+    /// \param from
+    /// \param fromLength
+    /// \param to
+    /// \param toLength
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _replaceAll(const char* from, Uint64 fromLength, const char* to,
+        Uint64 toLength);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Tell whether `other` points into the string's own buffer.
+    ///
     /// \param other
-    /// \param length
-    /// \param position
     ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Uint64 _rfind(const char* other, Uint64 length, Uint64 position) const;
+    bool _isInside(const char* other) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -2123,7 +2621,7 @@ private:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    bool _findCompare(const char* other, Uint64 length, Uint64 position) const;
+    Uint64 _find(const char* other, Uint64 length, Uint64 position) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -2131,13 +2629,11 @@ private:
     /// \param other
     /// \param length
     /// \param position
-    /// \param isTrue
     ///
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Uint64 _findFirstOf(const char* other, Uint64 length, Uint64 position,
-        bool isTrue) const;
+    Uint64 _rfind(const char* other, Uint64 length, Uint64 position) const;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -2150,7 +2646,7 @@ private:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    Uint64 _findLastOf(const char* other, Uint64 length, Uint64 position,
+    Uint64 _findFirstOf(const char* other, Uint64 length, Uint64 position,
         bool isTrue) const;
 
     ///////////////////////////////////////////////////////////////////////////
@@ -2164,7 +2660,7 @@ private:
     /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    bool _findOfCompare(const char* other, Uint64 length, Uint64 position,
+    Uint64 _findLastOf(const char* other, Uint64 length, Uint64 position,
         bool isTrue) const;
 
     ///////////////////////////////////////////////////////////////////////////
@@ -2200,34 +2696,31 @@ private:
     void _decreaseCapacity(const Uint64 capacity);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Move the content to a buffer able to hold `capacity`
+    /// characters, falling back to the inline buffer when it is big enough.
     ///
-    /// \param buffer
-    /// \param size
+    /// \param capacity
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void _allocCString(char*& buffer, const Uint64 size) const;
+    void _reallocate(const Uint64 capacity);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Get a heap buffer able to hold `capacity` characters and the
+    /// terminator.
     ///
-    /// \param buffer
-    /// \param size
-    /// \param filler
+    /// \param capacity
+    ///
+    /// \return
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void _allocCString(char*& buffer, const Uint64 size, char filler) const;
+    char* _allocate(Uint64 capacity) const;
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
-    ///
-    /// \param buffer
-    /// \param size
-    /// \param first
+    /// \brief Give the heap buffer back, if any, and go back to the inline
+    /// buffer.
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void _allocCString(char*& buffer, const Uint64 size,
-        const ConstIterator first) const;
+    void _deallocate(void);
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -2249,41 +2742,106 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     void _clearStr(const Uint64 position);
 
+public:
+    // ANCHOR - Static Methods
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
-    /// \tparam F
+    /// \param a
+    /// \param b
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void swap(String& a, String& b);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parse a whole view as an integer, without allocating.
     ///
-    /// \param function
+    /// \param str
+    /// \param value Left untouched on failure
     ///
-    /// \return
+    /// \return Whether `str` is exactly an integer that fits
     ///
     ///////////////////////////////////////////////////////////////////////////
-    template<typename F>
-    String& _transform(F function)
-    {
-        for (Uint64 i = 0; i < m_length; i++)
-        {
-            m_str[i] = function(m_str[i]);
-        }
-        return (*this);
-    }
+    static bool parseInt(StringView str, Int64& value);
 
-public:
-    // ANCHOR - Static Methods
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parse a whole view as an unsigned integer, without allocating.
+    ///
+    /// \param str
+    /// \param value Left untouched on failure
+    ///
+    /// \return Whether `str` is exactly an integer that fits
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static bool parseUint(StringView str, Uint64& value);
 
     ///////////////////////////////////////////////////////////////////////////
-    /// \brief
+    /// \brief Parse a whole view as a floating-point value, without
+    /// allocating.
     ///
-    /// \param a
-    /// \param b
+    /// \param str
+    /// \param value Left untouched on failure
+    ///
+    /// \return Whether `str` is exactly a number
+    ///
+    /// \see StringNumber::parseFloat
     ///
     ///////////////////////////////////////////////////////////////////////////
-    static void swap(String& a, String& b);
+    static bool parseFloat(StringView str, double& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parse a whole view as a floating-point value, without
+    /// allocating.
+    ///
+    /// \param str
+    /// \param value Left untouched on failure
+    ///
+    /// \return Whether `str` is exactly a number
+    ///
+    /// \see StringNumber::parseFloat
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static bool parseFloat(StringView str, float& value);
 };
 
+///////////////////////////////////////////////////////////////////////////////
+inline String& String::append(char ch)
+{
+    if (m_length < m_capacity)
+    {
+        char* data = m_str ? m_str : m_local;
+        data[m_length] = ch;
+        data[++m_length] = '\0';
+    }
+    else
+    {
+        _appendGrow(ch);
+    }
+    return (*this);
+}
+
 } // namespace ax::container
 
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::utility
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::utility
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Strings only point to their own heap buffer, the inline buffer
+/// being addressed through `m_local`, so they relocate with a memcpy.
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct is_trivially_relocatable<container::String>
+{
+    static constexpr bool value = true;
+};
+
+} // namespace ax::utility
+
 ///////////////////////////////////////////////////////////////////////////////
 // Forward ax::container namespace
 ///////////////////////////////////////////////////////////////////////////////
@@ -2333,7 +2891,10 @@ axc::String& operator+=(axc::String& lhs, const char* rhs);
 /// \return
 ///
 ///////////////////////////////////////////////////////////////////////////////
-axc::String& operator+=(axc::String& lhs, char rhs);
+inline axc::String& operator+=(axc::String& lhs, char rhs)
+{
+    return (lhs.append(rhs));
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief
@@ -2412,6 +2973,110 @@ axc::String operator+(const axc::String& lhs, char rhs);
 ///////////////////////////////////////////////////////////////////////////////
 axc::String operator+(char lhs, const axc::String& rhs);
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Append to the buffer of `lhs` and return it, so chained
+/// concatenations allocate only when that buffer has to grow.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(axc::String&& lhs, const axc::String& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Append to the buffer of `lhs` and return it, so chained
+/// concatenations allocate only when that buffer has to grow.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(axc::String&& lhs, axc::String&& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Append to the buffer of `lhs` and return it, so chained
+/// concatenations allocate only when that buffer has to grow.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(axc::String&& lhs, const std::string& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Append to the buffer of `lhs` and return it, so chained
+/// concatenations allocate only when that buffer has to grow.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(axc::String&& lhs, const char* rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Append to the buffer of `lhs` and return it, so chained
+/// concatenations allocate only when that buffer has to grow.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(axc::String&& lhs, char rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Insert in front of the buffer of `rhs` and return it.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(const axc::String& lhs, axc::String&& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Insert in front of the buffer of `rhs` and return it.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(const std::string& lhs, axc::String&& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Insert in front of the buffer of `rhs` and return it.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(const char* lhs, axc::String&& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Insert in front of the buffer of `rhs` and return it.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(char lhs, axc::String&& rhs);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief
 ///
@@ -2421,7 +3086,7 @@ axc::String operator+(char lhs, const axc::String& rhs);
 /// \return
 ///
 ///////////////////////////////////////////////////////////////////////////////
-std::ostream& operator<<(std::ostream& lhs, const axc::String& rhs);
+bool operator==(const char* lhs, const axc::String& rhs);
 
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief
@@ -2432,20 +3097,46 @@ std::ostream& operator<<(std::ostream& lhs, const axc::String& rhs);
 /// \return
 ///
 ///////////////////////////////////////////////////////////////////////////////
-std::ostream& operator>>(std::ostream& lhs, axc::String& rhs);
+bool operator!=(const char* lhs, const axc::String& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const axc::String& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read a word, like `operator>>` on a `std::string`: leading
+/// whitespace is skipped, and at most `width()` characters are read when it
+/// is set.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+std::istream& operator>>(std::istream& lhs, axc::String& rhs);
 
 // ANCHOR - STD Functions
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Read the characters up to `delim`, like `std::getline`. They are
+/// extracted in blocks with `std::istream::getline` rather than one at a
+/// time; prefer `StringReader` to read many lines.
 ///
-/// \param is
-/// \param str
+/// \param is Left untouched when not good, as is `str`
+/// \param str Keeps its capacity
 /// \param delim
 ///
 /// \return
 ///
 ///////////////////////////////////////////////////////////////////////////////
-std::istream& getline(std::istream is, axc::String& str, char delim = '\n');
+std::istream& getline(std::istream& is, axc::String& str, char delim = '\n');
 
 // !SECTION
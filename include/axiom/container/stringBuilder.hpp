@@ -0,0 +1,377 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/container/array.hpp>
+#include <axiom/container/string.hpp>
+#include <axiom/container/stringView.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::container
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::container
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Collects the pieces of a string and builds it with one allocation.
+///
+/// Views are recorded without copying their characters, which must stay
+/// alive until the string is built. Characters, numbers, temporary strings
+/// and views of at most `shortLength` characters are copied into a scratch
+/// buffer of the builder. The length of the result is kept up to date, so
+/// building sizes it once and copies each piece straight into it.
+///
+/// Pieces of a line or so are appended as fast with `String::operator+=`.
+/// The builder pays off once they grow, as included files do, since it
+/// copies each character once where a growing string copies it again at
+/// every reallocation.
+///
+/// \code
+/// axc::StringBuilder builder;
+/// builder.append("#define MAX_LIGHTS ").appendInt(lights).append('\n');
+/// builder.append(source);
+/// axc::String shader = builder.toString();
+/// \endcode
+///
+///////////////////////////////////////////////////////////////////////////////
+class StringBuilder
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Views up to this length are copied rather than recorded.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 shortLength = 16;   //<!
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Characters of a view, or the next `length` characters of the
+    /// scratch buffer when `data` is nullptr.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Piece
+    {
+        const char* data = nullptr; //<!
+        Uint64 length = 0;          //<!
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    SmallArray<Piece, 16> m_pieces;     //<!
+    SmallArray<char, 128> m_scratch;    //<! Copied characters
+    Uint64 m_length = 0;                //<! Of the string to build
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringBuilder(void) = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param pieces Expected number of pieces, reserved up front
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit StringBuilder(Uint64 pieces);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record a view, without copying its characters.
+    ///
+    /// \param str Must outlive the building of the string
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline StringBuilder& append(StringView str);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record a string, without copying its characters.
+    ///
+    /// \param str Must outlive the building of the string
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline StringBuilder& append(const String& str);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy a temporary string into the builder.
+    ///
+    /// \param str
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringBuilder& append(String&& str);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record a null-terminated string, without copying it.
+    ///
+    /// \param str Must outlive the building of the string
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringBuilder& append(const char* str);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param ch
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline StringBuilder& append(char ch);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param length
+    /// \param filler
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringBuilder& append(Uint64 length, char filler);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy characters into the builder, for views that do not live
+    /// long enough.
+    ///
+    /// \param str
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringBuilder& appendCopy(StringView str);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringBuilder& appendInt(Int64 value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringBuilder& appendUint(Uint64 value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    /// \see StringNumber::formatFloat
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringBuilder& appendFloat(double value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    /// \see StringNumber::formatFloat
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringBuilder& appendFloat(float value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Forget every piece, keeping the memory for the next string.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The length of the string to build
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 length(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The number of recorded pieces, consecutive copies sharing one
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 getPieceCount(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The string, allocated once
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD String toString(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append the string to another, growing it at most once.
+    ///
+    /// \param str
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void appendTo(String& str) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Write the string, without null terminator.
+    ///
+    /// \param buffer At least `length()` characters
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void copyTo(char* buffer) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record characters as a piece, or copy them when short.
+    ///
+    /// \param data Must outlive the building of the string
+    /// \param length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void _record(const char* data, Uint64 length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy characters to the scratch buffer.
+    ///
+    /// \param data
+    /// \param length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void _copy(const char* data, Uint64 length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record characters about to be appended to the scratch buffer,
+    /// in the last piece when it is a copy too.
+    ///
+    /// \param length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void _extendCopy(Uint64 length);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+inline StringBuilder& StringBuilder::append(StringView str)
+{
+    _record(str.data(), str.length());
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline StringBuilder& StringBuilder::append(const String& str)
+{
+    _record(str.cstr(), str.length());
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline StringBuilder& StringBuilder::append(char ch)
+{
+    _extendCopy(1);
+    m_scratch.pushBack(ch);
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline void StringBuilder::_record(const char* data, Uint64 length)
+{
+    // Short views cost less copied next to the previous copies than as
+    // pieces of their own
+    if (length <= shortLength)
+    {
+        _copy(data, length);
+    }
+    else
+    {
+        Piece& piece = m_pieces.emplaceBack();
+
+        piece.data = data;
+        piece.length = length;
+        m_length += length;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline void StringBuilder::_copy(const char* data, Uint64 length)
+{
+    if (length != 0)
+    {
+        _extendCopy(length);
+        m_scratch.append(data, length);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline void StringBuilder::_extendCopy(Uint64 length)
+{
+    if (m_pieces.isEmpty() || m_pieces.back().data != nullptr)
+    {
+        m_pieces.emplaceBack();
+    }
+    m_pieces.back().length += length;
+    m_length += length;
+}
+
+} // namespace ax::container
@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::container
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::container
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Conversions between numbers and their decimal text.
+///
+/// Integers are written two digits at a time from a table of digit pairs.
+/// Floating-point values are written with the fewest digits that read back
+/// as the same value (Ryu), in fixed notation when the decimal exponent is
+/// in [-6, 21) and in scientific notation otherwise, as `1e+21`.
+///
+/// Parsing never allocates and reports how many characters it read, zero
+/// meaning that no number starts there. It accepts an optional sign, then
+/// digits with an optional fraction and exponent for floating-point values,
+/// or `inf`, `infinity` and `nan` in any case. Floating-point values are
+/// rounded correctly (Eisel-Lemire, with an exact big integer comparison
+/// when more than 19 digits make the fast path ambiguous).
+///
+///////////////////////////////////////////////////////////////////////////////
+struct StringNumber
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Buffer sizes large enough for any formatted value.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 maxIntLength = 20;      //<!
+    static constexpr Uint64 maxFloatLength = 32;    //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param buffer At least `maxIntLength` characters
+    /// \param value
+    ///
+    /// \return The number of characters written, without null terminator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 formatInt(char* buffer, Int64 value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param buffer At least `maxIntLength` characters
+    /// \param value
+    ///
+    /// \return The number of characters written, without null terminator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 formatUint(char* buffer, Uint64 value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param buffer At least `maxFloatLength` characters
+    /// \param value
+    ///
+    /// \return The number of characters written, without null terminator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 formatFloat(char* buffer, double value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Format with the fewest digits that read back as the same
+    /// `float`, which may be fewer than the `double` of the same value needs.
+    ///
+    /// \param buffer At least `maxFloatLength` characters
+    /// \param value
+    ///
+    /// \return The number of characters written, without null terminator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 formatFloat(char* buffer, float value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    /// \param length
+    /// \param value Left untouched on failure
+    ///
+    /// \return The number of characters read, zero if there is no number or
+    /// it does not fit
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 parseInt(const char* data, Uint64 length, Int64& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    /// \param length
+    /// \param value Left untouched on failure
+    ///
+    /// \return The number of characters read, zero if there is no number or
+    /// it does not fit
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 parseUint(const char* data, Uint64 length, Uint64& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    /// \param length
+    /// \param value Left untouched on failure, an infinity when the number
+    /// is too large
+    ///
+    /// \return The number of characters read, zero if there is no number
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 parseFloat(const char* data, Uint64 length, double& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    /// \param length
+    /// \param value Left untouched on failure, an infinity when the number
+    /// is too large
+    ///
+    /// \return The number of characters read, zero if there is no number
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 parseFloat(const char* data, Uint64 length, float& value);
+};
+
+} // namespace ax::container
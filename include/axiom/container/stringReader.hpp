@@ -0,0 +1,253 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/container/array.hpp>
+#include <axiom/container/string.hpp>
+#include <axiom/container/stringView.hpp>
+#include <cstdio>
+#include <istream>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::container
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::container
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Reads lines and blocks of text from a `FILE*`, a file descriptor
+/// or a `std::istream`.
+///
+/// The source is read in chunks of up to the buffer size, and delimiters
+/// are searched in the buffer with `CString::memchr`. Descriptors and
+/// streams are read without waiting past the first character, so lines
+/// from a pipe, a socket or a terminal come out as they arrive. A `FILE*`
+/// goes through `fread`, which waits for a full chunk or the end of the
+/// input; read interactive input through its descriptor instead.
+/// Lines can be copied into a string, whose capacity is reused from one
+/// line to the next, or returned as views of the buffer.
+///
+/// The source is neither opened nor closed by the reader. Read errors end
+/// the input like the end of the file does, the state of the source telling
+/// them apart.
+///
+/// \code
+/// axc::StringReader reader(file);
+/// axc::StringView line;
+/// while (reader.readLine(line))
+/// {
+///     parse(line);
+/// }
+/// \endcode
+///
+///////////////////////////////////////////////////////////////////////////////
+class StringReader
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 defaultBufferSize = 64 * 1024;  //<!
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Source
+    {
+        File,
+        Descriptor,
+        Stream
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Source m_source;                    //<!
+    std::FILE* m_file = nullptr;        //<!
+    int m_descriptor = -1;              //<!
+    std::istream* m_stream = nullptr;   //<!
+    Array<char> m_buffer;               //<!
+    Uint64 m_begin = 0;                 //<! First unread character
+    Uint64 m_end = 0;                   //<! End of the buffered characters
+    bool m_isExhausted = false;         //<! The source has no more data
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read `file` with `fread` only, so it may be shared with other
+    /// stdio calls between reads. Each read waits for a full chunk, pass
+    /// `fileno(file)` instead to get lines as they arrive.
+    ///
+    /// \param file
+    /// \param bufferSize
+    ///
+    /// \throw std::exception if `file` is nullptr or `bufferSize` is zero
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit StringReader(std::FILE* file,
+        Uint64 bufferSize = defaultBufferSize);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param descriptor An open file descriptor
+    /// \param bufferSize
+    ///
+    /// \throw std::exception if `descriptor` is negative or `bufferSize` is
+    /// zero
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit StringReader(int descriptor,
+        Uint64 bufferSize = defaultBufferSize);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Read through the stream buffer of `stream`. The reader keeps
+    /// what it has read ahead, so the stream should not be read directly
+    /// while the reader is in use.
+    ///
+    /// \param stream
+    /// \param bufferSize
+    ///
+    /// \throw std::exception if `stream` has no stream buffer or
+    /// `bufferSize` is zero
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit StringReader(std::istream& stream,
+        Uint64 bufferSize = defaultBufferSize);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringReader(const StringReader&) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringReader& operator=(const StringReader&) = delete;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Replace the contents of `line` with the characters up to the
+    /// next delimiter, which is consumed but not stored.
+    ///
+    /// \param line Keeps its capacity, so reusing it avoids allocations
+    /// \param delimiter
+    ///
+    /// \return False if the input was already at its end
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool readLine(String& line, char delimiter = '\n');
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Point `line` to the characters up to the next delimiter,
+    /// without copying them. The buffer grows to hold lines longer than it.
+    ///
+    /// \param line Valid until the next read from this reader
+    /// \param delimiter
+    ///
+    /// \return False if the input was already at its end
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool readLine(StringView& line, char delimiter = '\n');
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy up to `length` characters. Large reads bypass the buffer.
+    ///
+    /// \param data
+    /// \param length
+    ///
+    /// \return The number of characters copied, less than `length` only at
+    /// the end of the input
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 read(char* data, Uint64 length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append the rest of the input to `str`.
+    ///
+    /// \param str
+    ///
+    /// \return The number of characters appended
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 readAll(String& str);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether every character has been read. Reads ahead from the
+    /// source when the buffer is empty.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEndOfFile(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 getBufferSize(void) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move the unread characters to the front of the buffer, grow it
+    /// if they fill it, and read from the source after them.
+    ///
+    /// \return The number of characters read, zero at the end of the input
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 _fill(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief One read from the source, waiting for one character at most
+    /// unless the source is a `FILE*`.
+    ///
+    /// \param data
+    /// \param length
+    ///
+    /// \return The number of characters read, zero at the end of the input
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 _readSource(char* data, Uint64 length);
+};
+
+} // namespace ax::container
@@ -0,0 +1,211 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::container
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::container
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Substring search over raw character buffers.
+///
+/// The algorithm is picked from the needle length: single characters use a
+/// vectorized byte scan, longer needles a SIMD filter on their first and last
+/// characters. Long needles switch to the Two-Way algorithm as soon as
+/// candidate verification starts to dominate, which keeps the search linear
+/// on adversarial input in both directions. Every path has a scalar
+/// fallback.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct StringSearch
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Uint64 npos = -1;  //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Needle length from which the search may fall back to the
+    /// Two-Way algorithm.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Uint64 longNeedle = 64;    //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Bytes scanned per first-character hit, as a power of two,
+    /// below which the search leaves memchr for the first/last filter.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Uint64 sparseShift = 6;    //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the first occurrence of `needle` at or after `position`.
+    ///
+    /// \param haystack
+    /// \param length
+    /// \param needle
+    /// \param needleLength
+    /// \param position
+    ///
+    /// \return Index of the occurrence, or `npos`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 find(const char* haystack, Uint64 length,
+        const char* needle, Uint64 needleLength, Uint64 position = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the last occurrence of `needle` starting at or before
+    /// `position`.
+    ///
+    /// \param haystack
+    /// \param length
+    /// \param needle
+    /// \param needleLength
+    /// \param position
+    ///
+    /// \return Index of the occurrence, or `npos`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 rfind(const char* haystack, Uint64 length,
+        const char* needle, Uint64 needleLength, Uint64 position = npos);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the first occurrence of a character.
+    ///
+    /// \param haystack
+    /// \param length
+    /// \param ch
+    ///
+    /// \return Index of the occurrence, or `npos`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 findChar(const char* haystack, Uint64 length,
+        char ch);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the last occurrence of a character.
+    ///
+    /// \param haystack
+    /// \param length
+    /// \param ch
+    ///
+    /// \return Index of the occurrence, or `npos`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 rfindChar(const char* haystack,
+        Uint64 length, char ch);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param haystack
+    /// \param length
+    /// \param needle
+    /// \param needleLength
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 _findFiltered(const char* haystack,
+        Uint64 length, const char* needle, Uint64 needleLength);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param haystack
+    /// \param length
+    /// \param needle
+    /// \param needleLength
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 _rfindFiltered(const char* haystack,
+        Uint64 length, const char* needle, Uint64 needleLength);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param haystack
+    /// \param length
+    /// \param needle
+    /// \param needleLength
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 _findTwoWay(const char* haystack,
+        Uint64 length, const char* needle, Uint64 needleLength);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Resume a search with the Two-Way algorithm at `position`.
+    ///
+    /// \param haystack
+    /// \param length
+    /// \param needle
+    /// \param needleLength
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 _findTwoWayFrom(const char* haystack,
+        Uint64 length, const char* needle, Uint64 needleLength,
+        Uint64 position);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Find the last occurrence with the Two-Way algorithm run from
+    /// the end of the haystack, on the reversed needle.
+    ///
+    /// \param haystack
+    /// \param length
+    /// \param needle
+    /// \param needleLength
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Uint64 _rfindTwoWay(const char* haystack,
+        Uint64 length, const char* needle, Uint64 needleLength);
+};
+
+} // namespace ax::container
@@ -0,0 +1,712 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/container/charSet.hpp>
+#include <string>
+#include <iostream>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::container
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::container
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward declarations
+///////////////////////////////////////////////////////////////////////////////
+class StringSplit;
+
+// SECTION - StringView
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Non-owning, read-only window over a run of characters.
+///
+/// A view is a pointer and a length: it never allocates and never owns its
+/// characters, so it must not outlive the buffer it looks at. Slicing a view
+/// returns another view over the same buffer.
+///
+///////////////////////////////////////////////////////////////////////////////
+class StringView
+{
+public:
+    // ANCHOR - Member Data
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Uint64 npos = -1;  //<!
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const char* m_data = "";        //<! Never nullptr
+    Uint64 m_length = 0;            //<!
+
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringView(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringView(const char* other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    /// \param length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringView(const char* other, Uint64 length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringView(const std::string& other);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const char& operator[](Uint64 index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    operator std::string(void) const;
+
+public:
+    // SECTION - Public Methods
+
+    // ANCHOR - Access
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const char* data(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 length(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const char& at(Uint64 index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const char& front(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const char& back(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const char* begin(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const char* end(void) const;
+
+    // ANCHOR - Slicing
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief View of `length` characters starting at `position`.
+    ///
+    /// \param position
+    /// \param length
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD StringView substr(Uint64 position = 0,
+        Uint64 length = npos) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void removePrefix(Uint64 length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void removeSuffix(Uint64 length);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD StringView trim(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param set
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD StringView trim(const CharSet& set) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Fields separated by `delimiter`, empty fields included.
+    ///
+    /// \param delimiter
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD StringSplit split(char delimiter) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Fields separated by `delimiter`, empty fields included.
+    ///
+    /// \param delimiter Must not be empty.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD StringSplit split(StringView delimiter) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Runs of characters outside `delimiters`, empty tokens skipped.
+    ///
+    /// \param delimiters
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD StringSplit tokenize(const CharSet& delimiters) const;
+
+    // ANCHOR - Comparison
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Lexicographic comparison of unsigned characters.
+    ///
+    /// \param other
+    ///
+    /// \return Negative, zero or positive like `memcmp`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD int compare(StringView other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param prefix
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool startsWith(StringView prefix) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param suffix
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool endsWith(StringView suffix) const;
+
+    // ANCHOR - Search
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 find(StringView other, Uint64 position = 0) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param ch
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 find(char ch, Uint64 position = 0) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 rfind(StringView other, Uint64 position = npos)
+        const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param ch
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 rfind(char ch, Uint64 position = npos) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param set
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 findFirstOf(const CharSet& set,
+        Uint64 position = 0) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param set
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 findLastOf(const CharSet& set,
+        Uint64 position = npos) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param set
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 findFirstNotOf(const CharSet& set,
+        Uint64 position = 0) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param set
+    /// \param position
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 findLastNotOf(const CharSet& set,
+        Uint64 position = npos) const;
+
+    // !SECTION
+};
+
+// !SECTION
+
+// SECTION - StringSplit
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Range over the fields of a view, cut at a delimiter.
+///
+/// Built by `StringView::split` and `StringView::tokenize`. Every field is a
+/// view into the original characters, so iterating never allocates. The
+/// range must outlive its iterators, which a range-based for guarantees.
+///
+///////////////////////////////////////////////////////////////////////////////
+class StringSplit
+{
+public:
+    // SECTION - Iterator
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Iterator
+    {
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        const StringSplit* m_range = nullptr;   //<! nullptr once exhausted
+        StringView m_current;                   //<!
+        StringView m_rest;                      //<!
+        bool m_isLast = false;                  //<! No delimiter left
+
+    public:
+        // ANCHOR - Constructors
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Past-the-end iterator.
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        Iterator(void);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \param range
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        Iterator(const StringSplit* range);
+
+    public:
+        // ANCHOR - Operators
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \return
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        AXIOM_NODISCARD const StringView& operator*(void) const;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \return
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        AXIOM_NODISCARD const StringView* operator->(void) const;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \return
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        Iterator& operator++(void);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \return
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        Iterator operator++(int);
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \param other
+        ///
+        /// \return
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        AXIOM_NODISCARD bool operator==(const Iterator& other) const;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief
+        ///
+        /// \param other
+        ///
+        /// \return
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        AXIOM_NODISCARD bool operator!=(const Iterator& other) const;
+
+    private:
+        // ANCHOR - Private Methods
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Move to the next field, or past the end.
+        ///
+        ///////////////////////////////////////////////////////////////////////
+        void _advance(void);
+    };
+
+    // !SECTION
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringView m_source;        //<!
+    StringView m_delimiter;     //<! Delimiter sequence, unless tokenizing
+    char m_char = '\0';         //<! Storage for a single character delimiter
+    CharSet m_set;              //<! Delimiters when tokenizing
+    bool m_isTokenizer = false; //<!
+
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param source
+    /// \param delimiter
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringSplit(StringView source, char delimiter);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param source
+    /// \param delimiter
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringSplit(StringView source, StringView delimiter);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param source
+    /// \param delimiters
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringSplit(StringView source, const CharSet& delimiters);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringSplit(const StringSplit& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    StringSplit& operator=(const StringSplit& other);
+
+public:
+    // ANCHOR - Public Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator begin(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Iterator end(void) const;
+};
+
+// !SECTION
+
+} // namespace ax::container
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward ax::container namespace
+///////////////////////////////////////////////////////////////////////////////
+namespace axc = ax::container;
+
+// ANCHOR - Operators
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool operator==(const axc::StringView& lhs,
+    const axc::StringView& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool operator!=(const axc::StringView& lhs,
+    const axc::StringView& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool operator<(const axc::StringView& lhs,
+    const axc::StringView& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool operator<=(const axc::StringView& lhs,
+    const axc::StringView& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool operator>(const axc::StringView& lhs,
+    const axc::StringView& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool operator>=(const axc::StringView& lhs,
+    const axc::StringView& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const axc::StringView& rhs);
@@ -29,19 +29,1060 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/utility.hpp>
+#include <algorithm>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace ax::container
 ///////////////////////////////////////////////////////////////////////////////
 namespace ax::container
 {
 
+// SECTION - Union Traits
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Tag selecting the alternative a `Union` is built with.
+///
+/// \tparam T
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct InPlaceType
+{
+    explicit InPlaceType(void) = default;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \tparam T
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+inline constexpr InPlaceType<T> inPlace{};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Position of `T` in `Ts`, the number of types when missing.
+///
+/// \tparam T
+/// \tparam Ts
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename... Ts>
+struct UnionIndex
+{
+    static constexpr Uint64 value = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \tparam T
+/// \tparam First
+/// \tparam Rest
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename First, typename... Rest>
+struct UnionIndex<T, First, Rest...>
+{
+    static constexpr Uint64 value = std::is_same<T, First>::value
+        ? 0 : 1 + UnionIndex<T, Rest...>::value;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Call `visitor` with the alternative at `index` in `data`.
+///
+/// Up to `switchLimit` alternatives, a switch lets the compiler inline the
+/// visitor behind a jump table; larger unions go through a table of one
+/// function per alternative.
+///
+/// \tparam R Result of the visitor
+/// \tparam Visitor
+/// \tparam Data `void` or `const void`
+/// \tparam Ts Alternatives
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename R, typename Visitor, typename Data, typename... Ts>
+struct UnionDispatch
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Function = R (*)(Visitor&, Data*);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam T
+    ///
+    /// \param visitor
+    /// \param data
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static R invoke(Visitor& visitor, Data* data)
+    {
+        using Value = typename std::conditional<std::is_const<Data>::value,
+            const T, T>::type;
+
+        return (static_cast<R>(visitor(*std::launder(
+            static_cast<Value*>(data)))));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Function table[] = {&invoke<Ts>...};
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 switchLimit = 16;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Call the alternative `I`, the cases past the last alternative
+    /// being unreachable.
+    ///
+    /// \tparam I
+    ///
+    /// \param index
+    /// \param visitor
+    /// \param data
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <Uint64 I>
+    static R at(Uint64 index, Visitor& visitor, Data* data)
+    {
+        if constexpr (I < sizeof...(Ts))
+        {
+            (void)index;
+            return (invoke<typename std::tuple_element<I,
+                std::tuple<Ts...>>::type>(visitor, data));
+        }
+        else
+        {
+            (void)visitor;
+            (void)data;
+            (void)index;
+            AXIOM_UNREACHABLE();
+            return (table[0](visitor, data));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    /// \param visitor
+    /// \param data
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static R call(Uint64 index, Visitor& visitor, Data* data)
+    {
+        if constexpr (sizeof...(Ts) <= switchLimit)
+        {
+            switch (index)
+            {
+                case 0: return (at<0>(index, visitor, data));
+                case 1: return (at<1>(index, visitor, data));
+                case 2: return (at<2>(index, visitor, data));
+                case 3: return (at<3>(index, visitor, data));
+                case 4: return (at<4>(index, visitor, data));
+                case 5: return (at<5>(index, visitor, data));
+                case 6: return (at<6>(index, visitor, data));
+                case 7: return (at<7>(index, visitor, data));
+                case 8: return (at<8>(index, visitor, data));
+                case 9: return (at<9>(index, visitor, data));
+                case 10: return (at<10>(index, visitor, data));
+                case 11: return (at<11>(index, visitor, data));
+                case 12: return (at<12>(index, visitor, data));
+                case 13: return (at<13>(index, visitor, data));
+                case 14: return (at<14>(index, visitor, data));
+                case 15: return (at<15>(index, visitor, data));
+                default: break;
+            }
+            AXIOM_UNREACHABLE();
+        }
+        return (table[index](visitor, data));
+    }
+};
+
+// !SECTION
+
+// SECTION - Union Storage
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Storage and lifetime of the alternatives of a `Union`.
+///
+/// This version handles alternatives with non-trivial copies or
+/// destructors, the specialization below leaves every special member to the
+/// compiler so that unions of trivial types stay trivially copyable.
+///
+/// \tparam Trivial Whether every alternative is trivially copyable
+/// \tparam Ts Alternatives
+///
+///////////////////////////////////////////////////////////////////////////////
+template <bool Trivial, typename... Ts>
+class UnionStorage
+{
+public:
+    // ANCHOR - Member Data
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Smallest type able to hold every index and `npos`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Index = typename std::conditional<(sizeof...(Ts) < 255), Uint8,
+        Uint16>::type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Index of a union left without a value by a throwing
+    /// constructor.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Index npos = static_cast<Index>(-1);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 storageSize = std::max({sizeof(Ts)...});
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    alignas(Ts...) unsigned char m_data[storageSize];   //<!
+    Index m_index = npos;                               //<!
+
+protected:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    UnionStorage(void) {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    UnionStorage(const UnionStorage& other)
+    {
+        _construct(other);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    UnionStorage(UnionStorage&& other) noexcept(
+        (std::is_nothrow_move_constructible<Ts>::value && ...))
+    {
+        _construct(utility::move(other));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~UnionStorage(void)
+    {
+        _destroy();
+    }
+
+protected:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Assign in place when both hold the same alternative.
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    UnionStorage& operator=(const UnionStorage& other)
+    {
+        if (this == &other)
+        {
+            return (*this);
+        }
+        if (m_index != npos && m_index == other.m_index)
+        {
+            _visit(other, [this](const auto& value) {
+                using T = typename std::decay<decltype(value)>::type;
+                *std::launder(reinterpret_cast<T*>(m_data)) = value;
+            });
+            return (*this);
+        }
+        _destroy();
+        _construct(other);
+        return (*this);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Assign in place when both hold the same alternative.
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    UnionStorage& operator=(UnionStorage&& other) noexcept(
+        ((std::is_nothrow_move_constructible<Ts>::value
+        && std::is_nothrow_move_assignable<Ts>::value) && ...))
+    {
+        if (this == &other)
+        {
+            return (*this);
+        }
+        if (m_index != npos && m_index == other.m_index)
+        {
+            _visit(other, [this](auto& value) {
+                using T = typename std::decay<decltype(value)>::type;
+                *std::launder(reinterpret_cast<T*>(m_data)) =
+                    utility::move(value);
+            });
+            return (*this);
+        }
+        _destroy();
+        _construct(utility::move(other));
+        return (*this);
+    }
+
+protected:
+    // ANCHOR - Protected Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destroy the value, leaving the storage without one.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _destroy(void)
+    {
+        if (m_index == npos)
+        {
+            return;
+        }
+        _visit(*this, [](auto& value) {
+            using T = typename std::decay<decltype(value)>::type;
+            value.~T();
+        });
+        m_index = npos;
+    }
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _construct(const UnionStorage& other)
+    {
+        if (other.m_index == npos)
+        {
+            return;
+        }
+        _visit(other, [this](const auto& value) {
+            using T = typename std::decay<decltype(value)>::type;
+            new (m_data) T(value);
+        });
+        m_index = other.m_index;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _construct(UnionStorage&& other)
+    {
+        if (other.m_index == npos)
+        {
+            return;
+        }
+        _visit(other, [this](auto& value) {
+            using T = typename std::decay<decltype(value)>::type;
+            new (m_data) T(utility::move(value));
+        });
+        m_index = other.m_index;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam Storage
+    /// \tparam Visitor
+    ///
+    /// \param storage
+    /// \param visitor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Storage, typename Visitor>
+    static void _visit(Storage& storage, Visitor&& visitor)
+    {
+        using Data = typename std::conditional<
+            std::is_const<Storage>::value, const void, void>::type;
+
+        UnionDispatch<void, Visitor, Data, Ts...>::call(storage.m_index,
+            visitor, storage.m_data);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Storage of trivially copyable alternatives, copied as raw bytes.
+///
+/// \tparam Ts Alternatives
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+class UnionStorage<true, Ts...>
+{
+public:
+    // ANCHOR - Member Data
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Smallest type able to hold every index and `npos`.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Index = typename std::conditional<(sizeof...(Ts) < 255), Uint8,
+        Uint16>::type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Index npos = static_cast<Index>(-1);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 storageSize = std::max({sizeof(Ts)...});
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    alignas(Ts...) unsigned char m_data[storageSize];   //<!
+    Index m_index = npos;                               //<!
+
+protected:
+    // ANCHOR - Protected Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _destroy(void)
+    {
+        m_index = npos;
+    }
+};
+
+// !SECTION
+
+// SECTION - Union Special Members
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Empty base deleting the copy constructor of a `Union` when one of
+/// the alternatives cannot be copied, so that traits such as
+/// `std::is_copy_constructible` tell the truth.
+///
+/// \tparam Enabled
+///
+///////////////////////////////////////////////////////////////////////////////
+template <bool Enabled>
+struct UnionCopyConstructor
+{};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct UnionCopyConstructor<false>
+{
+    UnionCopyConstructor(void) = default;
+    UnionCopyConstructor(const UnionCopyConstructor&) = delete;
+    UnionCopyConstructor(UnionCopyConstructor&&) = default;
+    UnionCopyConstructor& operator=(const UnionCopyConstructor&) = default;
+    UnionCopyConstructor& operator=(UnionCopyConstructor&&) = default;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Empty base deleting the move constructor of a `Union` when one of
+/// the alternatives cannot be moved.
+///
+/// \tparam Enabled
+///
+///////////////////////////////////////////////////////////////////////////////
+template <bool Enabled>
+struct UnionMoveConstructor
+{};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct UnionMoveConstructor<false>
+{
+    UnionMoveConstructor(void) = default;
+    UnionMoveConstructor(const UnionMoveConstructor&) = default;
+    UnionMoveConstructor(UnionMoveConstructor&&) = delete;
+    UnionMoveConstructor& operator=(const UnionMoveConstructor&) = default;
+    UnionMoveConstructor& operator=(UnionMoveConstructor&&) = default;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Empty base deleting the copy assignment of a `Union` when one of
+/// the alternatives cannot be copied or copy-assigned.
+///
+/// \tparam Enabled
+///
+///////////////////////////////////////////////////////////////////////////////
+template <bool Enabled>
+struct UnionCopyAssignment
+{};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct UnionCopyAssignment<false>
+{
+    UnionCopyAssignment(void) = default;
+    UnionCopyAssignment(const UnionCopyAssignment&) = default;
+    UnionCopyAssignment(UnionCopyAssignment&&) = default;
+    UnionCopyAssignment& operator=(const UnionCopyAssignment&) = delete;
+    UnionCopyAssignment& operator=(UnionCopyAssignment&&) = default;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Empty base deleting the move assignment of a `Union` when one of
+/// the alternatives cannot be moved or move-assigned.
+///
+/// \tparam Enabled
+///
+///////////////////////////////////////////////////////////////////////////////
+template <bool Enabled>
+struct UnionMoveAssignment
+{};
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief
 ///
 ///////////////////////////////////////////////////////////////////////////////
-struct Union
+template <>
+struct UnionMoveAssignment<false>
 {
+    UnionMoveAssignment(void) = default;
+    UnionMoveAssignment(const UnionMoveAssignment&) = default;
+    UnionMoveAssignment(UnionMoveAssignment&&) = default;
+    UnionMoveAssignment& operator=(const UnionMoveAssignment&) = default;
+    UnionMoveAssignment& operator=(UnionMoveAssignment&&) = delete;
+};
+
+// !SECTION
+
+// SECTION - Union
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Tagged union holding one value of the alternatives `Ts`.
+///
+/// The value lives inside the union, in storage sized and aligned for the
+/// largest alternative, next to a one-byte index. `visit` dispatches on the
+/// index with a jump table, no heap nor virtual call involved. When every
+/// alternative is trivially copyable, so is the union.
+///
+/// A union only lacks a value when the constructor of a new value throws,
+/// see `isValueless`.
+///
+/// \tparam Ts Alternatives, each listed once
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+class Union : private UnionStorage<(std::is_trivially_copyable<Ts>::value
+    && ...), Ts...>,
+    private UnionCopyConstructor<(std::is_copy_constructible<Ts>::value
+    && ...)>,
+    private UnionMoveConstructor<(std::is_move_constructible<Ts>::value
+    && ...)>,
+    private UnionCopyAssignment<((std::is_copy_constructible<Ts>::value
+    && std::is_copy_assignable<Ts>::value) && ...)>,
+    private UnionMoveAssignment<((std::is_move_constructible<Ts>::value
+    && std::is_move_assignable<Ts>::value) && ...)>
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Storage = UnionStorage<(std::is_trivially_copyable<Ts>::value
+        && ...), Ts...>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    using EnableIfAlternative = typename std::enable_if<
+        UnionIndex<typename std::decay<T>::type, Ts...>::value
+        < sizeof...(Ts)>::type;
+
+public:
+    // ANCHOR - Member Data
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Storage::npos;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 alternativeCount = sizeof...(Ts);
 
+public:
+    // ANCHOR - Constructors
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build a default value of the first alternative.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Union(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build the alternative of the type of `value`.
+    ///
+    /// \tparam T One of the alternatives, up to references and const
+    ///
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename = EnableIfAlternative<T>>
+    Union(T&& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Build the alternative `T` from `args`.
+    ///
+    /// \tparam T
+    /// \tparam Args
+    ///
+    /// \param args
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename... Args>
+    explicit Union(InPlaceType<T>, Args&&... args);
+
+public:
+    // ANCHOR - Operators
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Assign `value`, in place when the union already holds its
+    /// type.
+    ///
+    /// \tparam T One of the alternatives, up to references and const
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename = EnableIfAlternative<T>>
+    Union& operator=(T&& value);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Unions are equal when they hold the same alternative, with
+    /// equal values.
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator==(const Union& other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool operator!=(const Union& other) const;
+
+public:
+    // ANCHOR - Public Methods
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Position of `T` in the alternatives.
+    ///
+    /// \tparam T
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static constexpr Uint64 indexOf(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Position of the held alternative, `npos` without a value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 index(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isValueless(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam T
+    ///
+    /// \return Whether the union holds a `T`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    AXIOM_NODISCARD bool is(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam T
+    ///
+    /// \return
+    ///
+    /// \throw std::exception When the union does not hold a `T`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    AXIOM_NODISCARD T& get(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam T
+    ///
+    /// \return
+    ///
+    /// \throw std::exception When the union does not hold a `T`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    AXIOM_NODISCARD const T& get(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam T
+    ///
+    /// \return The value, nullptr when the union does not hold a `T`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    AXIOM_NODISCARD T* getIf(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \tparam T
+    ///
+    /// \return The value, nullptr when the union does not hold a `T`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    AXIOM_NODISCARD const T* getIf(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Replace the value by a `T` built from `args`.
+    ///
+    /// When the constructor throws, the union is left without a value.
+    ///
+    /// \tparam T
+    /// \tparam Args
+    ///
+    /// \param args
+    ///
+    /// \return The new value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename... Args>
+    T& emplace(Args&&... args);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Call `visitor` with the value.
+    ///
+    /// The visitor must accept every alternative and return the same type
+    /// for all of them.
+    ///
+    /// \tparam Visitor
+    ///
+    /// \param visitor
+    ///
+    /// \return What the visitor returned
+    ///
+    /// \throw std::exception When the union has no value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Visitor>
+    decltype(auto) visit(Visitor&& visitor);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Call `visitor` with the value.
+    ///
+    /// \tparam Visitor
+    ///
+    /// \param visitor
+    ///
+    /// \return What the visitor returned
+    ///
+    /// \throw std::exception When the union has no value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Visitor>
+    decltype(auto) visit(Visitor&& visitor) const;
 };
 
+// !SECTION
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+Union<Ts...>::Union(void)
+{
+    emplace<typename std::tuple_element<0, std::tuple<Ts...>>::type>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+template <typename T, typename>
+Union<Ts...>::Union(T&& value)
+{
+    emplace<typename std::decay<T>::type>(utility::forward<T>(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+template <typename T, typename... Args>
+Union<Ts...>::Union(InPlaceType<T>, Args&&... args)
+{
+    emplace<T>(utility::forward<Args>(args)...);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+template <typename T, typename>
+Union<Ts...>& Union<Ts...>::operator=(T&& value)
+{
+    using Value = typename std::decay<T>::type;
+
+    if (is<Value>())
+    {
+        *getIf<Value>() = utility::forward<T>(value);
+    }
+    else
+    {
+        emplace<Value>(utility::forward<T>(value));
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+bool Union<Ts...>::operator==(const Union& other) const
+{
+    if (this->m_index != other.m_index)
+    {
+        return (false);
+    }
+    if (this->m_index == npos)
+    {
+        return (true);
+    }
+    return (visit([&other](const auto& value) -> bool {
+        using T = typename std::decay<decltype(value)>::type;
+        return (value == *other.template getIf<T>());
+    }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+bool Union<Ts...>::operator!=(const Union& other) const
+{
+    return (!(*this == other));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+template <typename T>
+constexpr Uint64 Union<Ts...>::indexOf(void)
+{
+    static_assert(UnionIndex<T, Ts...>::value < sizeof...(Ts),
+        "T is not an alternative of this union");
+    return (UnionIndex<T, Ts...>::value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+AXIOM_NODISCARD Uint64 Union<Ts...>::index(void) const
+{
+    return (this->m_index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+AXIOM_NODISCARD bool Union<Ts...>::isValueless(void) const
+{
+    return (this->m_index == npos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+template <typename T>
+AXIOM_NODISCARD bool Union<Ts...>::is(void) const
+{
+    return (this->m_index == indexOf<T>());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+template <typename T>
+AXIOM_NODISCARD T& Union<Ts...>::get(void)
+{
+    CHECK(is<T>());
+    return (*getIf<T>());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+template <typename T>
+AXIOM_NODISCARD const T& Union<Ts...>::get(void) const
+{
+    CHECK(is<T>());
+    return (*getIf<T>());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+template <typename T>
+AXIOM_NODISCARD T* Union<Ts...>::getIf(void)
+{
+    if (!is<T>())
+    {
+        return (nullptr);
+    }
+    return (std::launder(reinterpret_cast<T*>(this->m_data)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+template <typename T>
+AXIOM_NODISCARD const T* Union<Ts...>::getIf(void) const
+{
+    if (!is<T>())
+    {
+        return (nullptr);
+    }
+    return (std::launder(reinterpret_cast<const T*>(this->m_data)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+template <typename T, typename... Args>
+T& Union<Ts...>::emplace(Args&&... args)
+{
+    constexpr Uint64 index = indexOf<T>();
+
+    this->_destroy();
+    T* value = new (this->m_data) T(utility::forward<Args>(args)...);
+    this->m_index = static_cast<typename Storage::Index>(index);
+    return (*value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+template <typename Visitor>
+decltype(auto) Union<Ts...>::visit(Visitor&& visitor)
+{
+    using First = typename std::tuple_element<0, std::tuple<Ts...>>::type;
+    using Result = decltype(visitor(std::declval<First&>()));
+
+    CHECK(this->m_index != npos);
+    return (UnionDispatch<Result, Visitor, void, Ts...>::call(
+        this->m_index, visitor, this->m_data));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+template <typename Visitor>
+decltype(auto) Union<Ts...>::visit(Visitor&& visitor) const
+{
+    using First = typename std::tuple_element<0, std::tuple<Ts...>>::type;
+    using Result = decltype(visitor(std::declval<const First&>()));
+
+    CHECK(this->m_index != npos);
+    return (UnionDispatch<Result, Visitor, const void, Ts...>::call(
+        this->m_index, visitor, this->m_data));
+}
+
 } // namespace ax::container
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::utility
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::utility
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Unions relocate like their alternatives.
+///
+/// \tparam Ts
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename... Ts>
+struct is_trivially_relocatable<container::Union<Ts...>>
+{
+    static constexpr bool value = (is_trivially_relocatable<Ts>::value
+        && ...);
+};
+
+} // namespace ax::utility
@@ -36,6 +36,8 @@
 #include <axiom/config.hpp>
 #include <axiom/math/types.hpp>
 
+#include <axiom/container/map.hpp>
+#include <axiom/container/name.hpp>
 #include <axiom/container/string.hpp>
 #include <axiom/math/vector2.hpp>
 #include <axiom/math/vector3.hpp>
@@ -71,6 +73,13 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     Uint32 object;              //<!
 
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Locations of the uniforms already looked up.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    axc::Map<axc::Name, int> m_uniforms;    //<!
+
 private:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
@@ -157,6 +166,60 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void setUniform(const axc::String& name, bool x);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name
+    /// \param x
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setUniform(axc::Name name, float x);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name
+    /// \param x
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setUniform(axc::Name name, int x);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name
+    /// \param x
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setUniform(axc::Name name, const axm::Vector2& x);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name
+    /// \param x
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setUniform(axc::Name name, const axm::Vector3& x);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name
+    /// \param x
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setUniform(axc::Name name, const axm::Vector4& x);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param name
+    /// \param x
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setUniform(axc::Name name, bool x);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
     ///
@@ -182,6 +245,16 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     AXIOM_NODISCARD int getUniformLocation(const axc::String& name);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Look the location of a uniform up, once per name.
+    ///
+    /// \param name
+    ///
+    /// \return The location, -1 when the program has no such uniform
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD int getUniformLocation(axc::Name name);
+
 public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief
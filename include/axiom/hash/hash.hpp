@@ -0,0 +1,290 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::hash
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::hash
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief The wyhash algorithm, usable at compile time.
+///
+/// Bytes are read one at a time in little-endian order, so that the hash of a
+/// literal computed at compile time is the one `hashBytes` computes at run
+/// time with unaligned loads.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Wyhash
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 secret0 = 0x2D358DCCAA6C78A5ull;    //<!
+    static constexpr Uint64 secret1 = 0x8BB84B93962EACC9ull;    //<!
+    static constexpr Uint64 secret2 = 0x4B33A62ED433D4A3ull;    //<!
+    static constexpr Uint64 secret3 = 0x4D5A2DA51DE1AA47ull;    //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Fold the 128-bit product of two words into 64 bits.
+    ///
+    /// \param a
+    /// \param b
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static constexpr Uint64 mix(Uint64 a, Uint64 b)
+    {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 product = (unsigned __int128)a * b;
+        return ((Uint64)product ^ (Uint64)(product >> 64));
+#else
+        const Uint64 aLow = a & 0xFFFFFFFFull;
+        const Uint64 aHigh = a >> 32;
+        const Uint64 bLow = b & 0xFFFFFFFFull;
+        const Uint64 bHigh = b >> 32;
+        const Uint64 lowLow = aLow * bLow;
+        const Uint64 lowHigh = aLow * bHigh;
+        const Uint64 highLow = aHigh * bLow;
+        const Uint64 cross = (lowLow >> 32) + (lowHigh & 0xFFFFFFFFull)
+            + (highLow & 0xFFFFFFFFull);
+        const Uint64 low = (cross << 32) | (lowLow & 0xFFFFFFFFull);
+        const Uint64 high = aHigh * bHigh + (lowHigh >> 32)
+            + (highLow >> 32) + (cross >> 32);
+        return (low ^ high);
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    /// \param length
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static constexpr Uint64 hash(const char* data,
+        Uint64 length)
+    {
+        Uint64 seed = secret0;
+        Uint64 a = 0;
+        Uint64 b = 0;
+
+        if (length <= 16)
+        {
+            if (length >= 4)
+            {
+                const Uint64 middle = (length >> 3) << 2;
+                a = (read4(data) << 32) | read4(data + middle);
+                b = (read4(data + length - 4) << 32)
+                    | read4(data + length - 4 - middle);
+            }
+            else if (length > 0)
+            {
+                a = ((Uint64)(Uint8)data[0] << 16)
+                    | ((Uint64)(Uint8)data[length >> 1] << 8)
+                    | (Uint8)data[length - 1];
+            }
+        }
+        else
+        {
+            Uint64 left = length;
+            if (left > 48)
+            {
+                Uint64 seed1 = seed;
+                Uint64 seed2 = seed;
+                do
+                {
+                    seed = mix(read8(data) ^ secret1, read8(data + 8) ^ seed);
+                    seed1 = mix(read8(data + 16) ^ secret2,
+                        read8(data + 24) ^ seed1);
+                    seed2 = mix(read8(data + 32) ^ secret3,
+                        read8(data + 40) ^ seed2);
+                    data += 48;
+                    left -= 48;
+                } while (left > 48);
+                seed ^= seed1 ^ seed2;
+            }
+            while (left > 16)
+            {
+                seed = mix(read8(data) ^ secret1, read8(data + 8) ^ seed);
+                data += 16;
+                left -= 16;
+            }
+            a = read8(data + left - 16);
+            b = read8(data + left - 8);
+        }
+        return (mix(secret1 ^ length, mix(a ^ secret1, b ^ seed)));
+    }
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 read4(const char* data)
+    {
+        return ((Uint64)(Uint8)data[0]
+            | ((Uint64)(Uint8)data[1] << 8)
+            | ((Uint64)(Uint8)data[2] << 16)
+            | ((Uint64)(Uint8)data[3] << 24));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 read8(const char* data)
+    {
+        return (read4(data) | (read4(data + 4) << 32));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Fold the 128-bit product of two words into 64 bits.
+///
+/// \param a
+/// \param b
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD constexpr Uint64 hashMix(Uint64 a, Uint64 b)
+{
+    return (Wyhash::mix(a, b));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Hash a span of bytes, wyhash style.
+///
+/// \param data
+/// \param length
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 hashBytes(const void* data, Uint64 length);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Hash a string at compile time, as `hashBytes` would.
+///
+/// \param data
+/// \param length
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD constexpr Uint64 hashString(const char* data, Uint64 length)
+{
+    return (Wyhash::hash(data, length));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Hash a null-terminated string at compile time.
+///
+/// \param data
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD constexpr Uint64 hashString(const char* data)
+{
+    Uint64 length = 0;
+
+    while (data[length] != '\0')
+    {
+        length++;
+    }
+    return (Wyhash::hash(data, length));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Combine the hash of a value into the hash of the values before it.
+///
+/// The result depends on the order of the values, so that (a, b) and (b, a)
+/// do not collide.
+///
+/// \param seed
+/// \param value
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD constexpr Uint64 hashCombine(Uint64 seed, Uint64 value)
+{
+    return (Wyhash::mix(seed ^ Wyhash::secret0, value ^ Wyhash::secret1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Literal suffix hashing a string at compile time,
+/// `"player"_hash`.
+///
+///////////////////////////////////////////////////////////////////////////////
+namespace literals
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param data
+/// \param length
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+constexpr Uint64 operator""_hash(const char* data, std::size_t length)
+{
+    return (Wyhash::hash(data, length));
+}
+
+} // namespace literals
+
+} // namespace ax::hash
@@ -0,0 +1,518 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/hash/hash.hpp>
+#include <axiom/hash/hasher.hpp>
+#include <axiom/container/string.hpp>
+#include <axiom/container/stringView.hpp>
+#include <axiom/utility.hpp>
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::hash
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::hash
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief A view of a string along with its hash.
+///
+/// Built from a literal, the hash is computed at compile time:
+/// `constexpr HashedStringView key("u_modelMatrix");`. The view does not own
+/// the characters, which must outlive it.
+///
+///////////////////////////////////////////////////////////////////////////////
+class HashedStringView
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const char* m_data;     //<!
+    Uint64 m_length;        //<!
+    Uint64 m_hash;          //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr HashedStringView(void)
+        : m_data("")
+        , m_length(0)
+        , m_hash(hashString("", 0))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param str Null-terminated string
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr HashedStringView(const char* str)
+        : m_data(str)
+        , m_length(_length(str))
+        , m_hash(hashString(str, m_length))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param str
+    /// \param length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr HashedStringView(const char* str, Uint64 length)
+        : m_data(str)
+        , m_length(length)
+        , m_hash(hashString(str, length))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param str
+    /// \param length
+    /// \param hash Hash of the `length` characters of `str`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr HashedStringView(const char* str, Uint64 length, Uint64 hash)
+        : m_data(str)
+        , m_length(length)
+        , m_hash(hash)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Hash a view at run time.
+    ///
+    /// \param view
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit HashedStringView(container::StringView view)
+        : m_data(view.data())
+        , m_length(view.length())
+        , m_hash(hashBytes(view.data(), view.length()))
+    {}
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    operator container::StringView(void) const
+    {
+        return (container::StringView(m_data, m_length));
+    }
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD constexpr const char* data(void) const
+    {
+        return (m_data);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD constexpr Uint64 length(void) const
+    {
+        return (m_length);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD constexpr Uint64 getHash(void) const
+    {
+        return (m_hash);
+    }
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param str
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 _length(const char* str)
+    {
+        Uint64 length = 0;
+
+        while (str[length] != '\0')
+        {
+            length++;
+        }
+        return (length);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief A string that computes its hash once, when it is built.
+///
+/// The string cannot be modified, so the hash stays valid. Used as the key
+/// of a `Map` or `HashSet`, rehashing the table and comparing two different
+/// keys never touch the characters.
+///
+///////////////////////////////////////////////////////////////////////////////
+class HashedString
+{
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    container::String m_string;     //<!
+    Uint64 m_hash;                  //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    HashedString(void)
+        : m_string()
+        , m_hash(hashString("", 0))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param str
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    HashedString(const char* str)
+        : m_string(str)
+        , m_hash(hashBytes(m_string.cstr(), m_string.length()))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param view
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit HashedString(container::StringView view)
+        : m_string(view)
+        , m_hash(hashBytes(view.data(), view.length()))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Keep the hash that was already computed.
+    ///
+    /// \param view
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    HashedString(HashedStringView view)
+        : m_string(container::StringView(view))
+        , m_hash(view.getHash())
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param str
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit HashedString(container::String str)
+        : m_string(utility::move(str))
+        , m_hash(hashBytes(m_string.cstr(), m_string.length()))
+    {}
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    operator container::StringView(void) const
+    {
+        return (container::StringView(m_string.cstr(), m_string.length()));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    operator HashedStringView(void) const
+    {
+        return (HashedStringView(m_string.cstr(), m_string.length(),
+            m_hash));
+    }
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const container::String& getString(void) const
+    {
+        return (m_string);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const char* data(void) const
+    {
+        return (m_string.cstr());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 length(void) const
+    {
+        return (m_string.length());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const
+    {
+        return (m_string.length() == 0);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 getHash(void) const
+    {
+        return (m_hash);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Hasher of the hashed strings, returning the stored hash.
+///
+/// It also accepts a `StringView` or a C string, hashed on the spot, so that
+/// lookups do not build a `HashedString`.
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<HashedStringView>
+{
+    Uint64 operator()(HashedStringView value) const
+    {
+        return (value.getHash());
+    }
+
+    Uint64 operator()(const HashedString& value) const
+    {
+        return (value.getHash());
+    }
+
+    Uint64 operator()(container::StringView value) const
+    {
+        return (hashBytes(value.data(), value.length()));
+    }
+
+    Uint64 operator()(const char* value) const
+    {
+        return (operator()(container::StringView(value)));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<HashedString> : Hasher<HashedStringView> {};
+
+} // namespace ax::hash
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward ax::hash namespace
+///////////////////////////////////////////////////////////////////////////////
+namespace axh = ax::hash;
+
+// ANCHOR - Operators
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Compare two hashed strings, their hashes first.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator==(axh::HashedStringView lhs,
+    axh::HashedStringView rhs)
+{
+    return (lhs.getHash() == rhs.getHash() && lhs.length() == rhs.length()
+        && std::memcmp(lhs.data(), rhs.data(), lhs.length()) == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator==(const axh::HashedString& lhs,
+    const axh::HashedString& rhs)
+{
+    return (axh::HashedStringView(lhs) == axh::HashedStringView(rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator==(const axh::HashedString& lhs,
+    axh::HashedStringView rhs)
+{
+    return (axh::HashedStringView(lhs) == rhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator==(axh::HashedStringView lhs,
+    const axh::HashedString& rhs)
+{
+    return (lhs == axh::HashedStringView(rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Compare the characters, without hashing `rhs`.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator==(const axh::HashedString& lhs,
+    axc::StringView rhs)
+{
+    return (lhs.length() == rhs.length()
+        && std::memcmp(lhs.data(), rhs.data(), rhs.length()) == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator==(const axh::HashedString& lhs,
+    const char* rhs)
+{
+    return (lhs == axc::StringView(rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator!=(axh::HashedStringView lhs,
+    axh::HashedStringView rhs)
+{
+    return (!(lhs == rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator!=(const axh::HashedString& lhs,
+    const axh::HashedString& rhs)
+{
+    return (!(lhs == rhs));
+}
@@ -0,0 +1,289 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/hash/hash.hpp>
+#include <axiom/container/string.hpp>
+#include <axiom/container/stringView.hpp>
+#include <axiom/math/color.hpp>
+#include <axiom/math/linearColor.hpp>
+#include <axiom/math/quaternion.hpp>
+#include <axiom/math/rotator.hpp>
+#include <axiom/math/vector2.hpp>
+#include <axiom/math/vector3.hpp>
+#include <axiom/math/vector4.hpp>
+#include <type_traits>
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::hash
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::hash
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Default hash functor of the hash containers.
+///
+/// Integers, enums and pointers are mixed with a single multiplication.
+/// Strings hash their characters, and the `String` hasher also accepts a
+/// `StringView` or a C string so that lookups do not build a `String`.
+/// Floating-point values hash their bits, with both zeros hashing alike, and
+/// math types hash their components two by two.
+///
+/// \tparam T
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Enable = void>
+struct Hasher;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \tparam T
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct Hasher<T, typename std::enable_if<std::is_integral<T>::value
+    || std::is_enum<T>::value>::type>
+{
+    Uint64 operator()(T value) const
+    {
+        return (hashMix((Uint64)value, 0x9E3779B97F4A7C15ull));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \tparam T
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct Hasher<T*>
+{
+    Uint64 operator()(const T* value) const
+    {
+        return (hashMix((Uint64)value, 0x9E3779B97F4A7C15ull));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<float>
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Bits of a float, -0 giving the bits of +0.
+    ///
+    /// \param value
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 bits(float value)
+    {
+        Uint32 bits = 0;
+
+        if (value != 0.0f)
+        {
+            std::memcpy(&bits, &value, sizeof(bits));
+        }
+        return (bits);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Bits of two floats, packed in a word.
+    ///
+    /// \param low
+    /// \param high
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static Uint64 bits(float low, float high)
+    {
+        return (bits(low) | (bits(high) << 32));
+    }
+
+    Uint64 operator()(float value) const
+    {
+        return (hashMix(bits(value), 0x9E3779B97F4A7C15ull));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<double>
+{
+    Uint64 operator()(double value) const
+    {
+        Uint64 bits = 0;
+
+        if (value != 0.0)
+        {
+            std::memcpy(&bits, &value, sizeof(bits));
+        }
+        return (hashMix(bits, 0x9E3779B97F4A7C15ull));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<container::StringView>
+{
+    Uint64 operator()(container::StringView value) const
+    {
+        return (hashBytes(value.data(), value.length()));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<container::String> : Hasher<container::StringView> {};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<math::Vector2>
+{
+    Uint64 operator()(const math::Vector2& value) const
+    {
+        return (hashMix(Hasher<float>::bits(value.x, value.y)
+            ^ Wyhash::secret0, Wyhash::secret1));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<math::Vector3>
+{
+    Uint64 operator()(const math::Vector3& value) const
+    {
+        return (hashMix(Hasher<float>::bits(value.x, value.y)
+            ^ Wyhash::secret0, Hasher<float>::bits(value.z)
+            ^ Wyhash::secret1));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<math::Vector4>
+{
+    Uint64 operator()(const math::Vector4& value) const
+    {
+        return (hashMix(Hasher<float>::bits(value.x, value.y)
+            ^ Wyhash::secret0, Hasher<float>::bits(value.z, value.w)
+            ^ Wyhash::secret1));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<math::Quaternion>
+{
+    Uint64 operator()(const math::Quaternion& value) const
+    {
+        return (hashMix(Hasher<float>::bits(value.x, value.y)
+            ^ Wyhash::secret0, Hasher<float>::bits(value.z, value.w)
+            ^ Wyhash::secret1));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<math::Rotator>
+{
+    Uint64 operator()(const math::Rotator& value) const
+    {
+        return (hashMix(Hasher<float>::bits(value.pitch, value.yaw)
+            ^ Wyhash::secret0, Hasher<float>::bits(value.roll)
+            ^ Wyhash::secret1));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<math::LinearColor>
+{
+    Uint64 operator()(const math::LinearColor& value) const
+    {
+        return (hashMix(Hasher<float>::bits(value.r, value.g)
+            ^ Wyhash::secret0, Hasher<float>::bits(value.b, value.a)
+            ^ Wyhash::secret1));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+template <>
+struct Hasher<math::Color>
+{
+    Uint64 operator()(const math::Color& value) const
+    {
+        return (hashMix(value.bits, 0x9E3779B97F4A7C15ull));
+    }
+};
+
+} // namespace ax::hash
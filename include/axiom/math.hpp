@@ -33,6 +33,7 @@
 // Headers
 ///////////////////////////////////////////////////////////////////////////////
 #include <axiom/math/axis.hpp>
+#include <axiom/math/batch.hpp>
 #include <axiom/math/bounds.hpp>
 #include <axiom/math/color.hpp>
 #include <axiom/math/defines.hpp>
@@ -42,10 +43,15 @@
 #include <axiom/math/matrix.hpp>
 #include <axiom/math/quaternion.hpp>
 #include <axiom/math/rotator.hpp>
+#include <axiom/math/simd.hpp>
 #include <axiom/math/transform.hpp>
+#include <axiom/math/transformHierarchy.hpp>
 #include <axiom/math/utilities.hpp>
 #include <axiom/math/vector2.hpp>
+#include <axiom/math/vector2Batch.hpp>
 #include <axiom/math/vector3.hpp>
+#include <axiom/math/vector3A.hpp>
+#include <axiom/math/vector3Batch.hpp>
 #include <axiom/math/vector4.hpp>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,194 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::math
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::math
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Bulk kernels over vectors stored as structure of arrays: one float
+/// array per component, `dimension` of them (2 or 3).
+///
+/// The kernels handle 4, 8 or 16 vectors per instruction: with
+/// `simd::Float4` registers (SSE2 or NEON), AVX2 or AVX-512. The widest set
+/// the processor supports is selected when the program starts, the kernels
+/// being compiled for it whatever the flags of the build. The vectors left
+/// over at the end of the arrays go through the scalar kernels.
+///
+/// Vector2Batch and Vector3Batch own their arrays and call these kernels.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Batch
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Instruction sets the kernels can be implemented with.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Implementation : Uint8
+    {
+        Scalar,
+        Float4,
+        Avx2,
+        Avx512
+    };
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief `data[i] = data[i] * scale + offset`
+    ///
+    /// \param data
+    /// \param count
+    /// \param scale
+    /// \param offset
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void scaleOffset(float* data, Uint64 count, float scale,
+        float offset);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief `data[i] += other[i] * factor`
+    ///
+    /// \param data
+    /// \param other
+    /// \param count
+    /// \param factor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void multiplyAdd(float* data, const float* other, Uint64 count,
+        float factor);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    /// \param count At least one
+    /// \param min
+    /// \param max
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void bounds(const float* data, Uint64 count, float& min,
+        float& max);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param components
+    /// \param dimension
+    /// \param count
+    /// \param out `count` lengths
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void length(const float* const* components, Uint32 dimension,
+        Uint64 count, float* out);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param components
+    /// \param dimension
+    /// \param count
+    /// \param point `dimension` coordinates
+    /// \param out `count` distances
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void distance(const float* const* components, Uint32 dimension,
+        Uint64 count, const float* point, float* out);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param lhs
+    /// \param rhs
+    /// \param dimension
+    /// \param count
+    /// \param out `count` dot products
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void dot(const float* const* lhs, const float* const* rhs,
+        Uint32 dimension, Uint64 count, float* out);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Normalize the vectors in place. Those whose squared length is
+    /// at most `tolerance` become zero vectors.
+    ///
+    /// \param components
+    /// \param dimension
+    /// \param count
+    /// \param tolerance
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void normalize(float* const* components, Uint32 dimension,
+        Uint64 count, float tolerance);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Apply an affine transform in place.
+    ///
+    /// \param components
+    /// \param dimension
+    /// \param count
+    /// \param matrix `dimension` rows of `dimension + 1` floats: the
+    /// coefficients of the row, then its translation
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void transform(float* const* components, Uint32 dimension,
+        Uint64 count, const float* matrix);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The implementation in use
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Implementation getImplementation(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Switch to another implementation, to compare them.
+    ///
+    /// Not thread-safe: no other thread may use the kernels meanwhile.
+    ///
+    /// \param implementation
+    ///
+    /// \return False when the processor does not support it
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static bool setImplementation(Implementation implementation);
+};
+
+} // namespace ax::math
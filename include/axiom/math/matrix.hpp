@@ -29,6 +29,15 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/simd.hpp>
+#include <axiom/math/vector3.hpp>
+#include <axiom/math/vector4.hpp>
+#include <iostream>
+
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace ax::math
 ///////////////////////////////////////////////////////////////////////////////
@@ -36,12 +45,440 @@ namespace ax::math
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief 4x4 matrix of floats, stored column after column as OpenGL
+/// expects it, so `getData()` goes straight to `glUniformMatrix4fv`.
+///
+/// Vectors are columns, multiplied on the right: `a * b` applies `b`, then
+/// `a`. Each column is one `simd::Float4`, so a product of matrices costs
+/// sixteen multiplications and twelve additions of registers.
 ///
 ///////////////////////////////////////////////////////////////////////////////
-struct Matrix
+struct alignas(16) Matrix
 {
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    union
+    {
+        float m[4][4];              //<! m[column][row]
+        simd::Float4 columns[4];    //<!
+    };
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Matrix identity;   //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The identity matrix.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Matrix(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param x First column
+    /// \param y Second column
+    /// \param z Third column
+    /// \param w Fourth column, the translation of an affine transform
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Matrix(const Vector4& x, const Vector4& y, const Vector4& z,
+        const Vector4& w);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param x
+    /// \param y
+    /// \param z
+    /// \param w
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Matrix(simd::Float4 x, simd::Float4 y, simd::Float4 z, simd::Float4 w);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data Sixteen floats, column after column
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Matrix(const float* data);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param row
+    /// \param column
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float& operator()(Int32 row, Int32 column);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param row
+    /// \param column
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const float& operator()(Int32 row, Int32 column) const;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Sixteen floats, column after column
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const float* getData(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Vector4 getColumn(Int32 index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    /// \param column
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setColumn(Int32 index, const Vector4& column);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Matrix getTransposed(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float getDeterminant(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Invert any matrix, through its cofactors.
+    ///
+    /// \return The inverse, or the identity if the matrix is singular
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Matrix getInverse(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Invert an affine transform, whose last row is (0, 0, 0, 1),
+    /// with three cross products instead of the sixteen cofactors.
+    ///
+    /// \return The inverse, or the identity if the matrix is singular
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Matrix getInverseAffine(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Transform a position: rotated, scaled and translated.
+    ///
+    /// \param point
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Vector3 transformPoint(const Vector3& point) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Transform a direction: rotated and scaled, not translated.
+    ///
+    /// \param vector
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Vector3 transformVector(const Vector3& vector) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Transform positions in bulk, keeping the columns in registers.
+    ///
+    /// \param points
+    /// \param out May be `points`, to transform them in place
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void transformPoints(const Vector3* points, Vector3* out, Uint64 count)
+        const;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param translation
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Matrix makeTranslation(const Vector3& translation);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param scale
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Matrix makeScale(const Vector3& scale);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief View matrix of an eye looking at a target, right-handed like
+    /// `gluLookAt`.
+    ///
+    /// \param eye
+    /// \param target
+    /// \param up
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Matrix lookAt(const Vector3& eye,
+        const Vector3& target, const Vector3& up);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Perspective projection like `gluPerspective`, mapping the depth
+    /// between the planes to [-1, 1].
+    ///
+    /// \param fovY Vertical field of view, in radians
+    /// \param aspect Width over height
+    /// \param zNear
+    /// \param zFar
+    ///
+    /// \return
+    ///
+    /// \throw std::exception if `zNear` equals `zFar` or `aspect` is zero
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Matrix perspective(float fovY, float aspect,
+        float zNear, float zFar);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Orthographic projection like `glOrtho`.
+    ///
+    /// \param left
+    /// \param right
+    /// \param bottom
+    /// \param top
+    /// \param zNear
+    /// \param zFar
+    ///
+    /// \return
+    ///
+    /// \throw std::exception if the volume is empty along an axis
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Matrix orthographic(float left, float right,
+        float bottom, float top, float zNear, float zFar);
 };
 
+///////////////////////////////////////////////////////////////////////////////
+inline Matrix::Matrix(void)
+    : columns{simd::set(1.f, 0.f, 0.f, 0.f), simd::set(0.f, 1.f, 0.f, 0.f),
+        simd::set(0.f, 0.f, 1.f, 0.f), simd::set(0.f, 0.f, 0.f, 1.f)}
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Matrix::Matrix(const Vector4& x, const Vector4& y, const Vector4& z,
+    const Vector4& w)
+    : columns{x.packed, y.packed, z.packed, w.packed}
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Matrix::Matrix(simd::Float4 x, simd::Float4 y, simd::Float4 z,
+    simd::Float4 w)
+    : columns{x, y, z, w}
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Matrix::Matrix(const float* data)
+    : columns{simd::loadUnaligned(data), simd::loadUnaligned(data + 4),
+        simd::loadUnaligned(data + 8), simd::loadUnaligned(data + 12)}
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float& Matrix::operator()(Int32 row, Int32 column)
+{
+    return (m[column][row]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline const float& Matrix::operator()(Int32 row, Int32 column) const
+{
+    return (m[column][row]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline const float* Matrix::getData(void) const
+{
+    return (&m[0][0]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector4 Matrix::getColumn(Int32 index) const
+{
+    return (Vector4(columns[index]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline void Matrix::setColumn(Int32 index, const Vector4& column)
+{
+    columns[index] = column.packed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3 Matrix::transformPoint(const Vector3& point) const
+{
+    alignas(16) float result[4];
+    simd::store(result, simd::add(
+        simd::add(simd::multiply(columns[0], simd::splat(point.x)),
+            simd::multiply(columns[1], simd::splat(point.y))),
+        simd::add(simd::multiply(columns[2], simd::splat(point.z)),
+            columns[3])));
+    return (Vector3(result[0], result[1], result[2]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3 Matrix::transformVector(const Vector3& vector) const
+{
+    alignas(16) float result[4];
+    simd::store(result, simd::add(
+        simd::add(simd::multiply(columns[0], simd::splat(vector.x)),
+            simd::multiply(columns[1], simd::splat(vector.y))),
+        simd::multiply(columns[2], simd::splat(vector.z))));
+    return (Vector3(result[0], result[1], result[2]));
+}
+
 } // namespace ax::math
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward ax::math namespace
+///////////////////////////////////////////////////////////////////////////////
+namespace axm = ax::math;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return The vector transformed by the matrix
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator*(const axm::Matrix& lhs,
+    const axm::Vector4& rhs)
+{
+    return (axm::Vector4(axm::simd::add(
+        axm::simd::add(
+            axm::simd::multiply(lhs.columns[0], axm::simd::splat(rhs.x)),
+            axm::simd::multiply(lhs.columns[1], axm::simd::splat(rhs.y))),
+        axm::simd::add(
+            axm::simd::multiply(lhs.columns[2], axm::simd::splat(rhs.z)),
+            axm::simd::multiply(lhs.columns[3], axm::simd::splat(rhs.w))))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return The transform applying `rhs`, then `lhs`
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Matrix operator*(const axm::Matrix& lhs,
+    const axm::Matrix& rhs)
+{
+    axm::simd::Float4 columns[4];
+    for (int i = 0; i < 4; i++)
+    {
+        columns[i] = (lhs * axm::Vector4(rhs.columns[i])).packed;
+    }
+    return (axm::Matrix(columns[0], columns[1], columns[2], columns[3]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Matrix& operator*=(axm::Matrix& lhs, const axm::Matrix& rhs)
+{
+    lhs = lhs * rhs;
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator==(const axm::Matrix& lhs,
+    const axm::Matrix& rhs)
+{
+    Uint32 mask = 0xF;
+    for (int i = 0; i < 4; i++)
+    {
+        mask &= axm::simd::equalMask(lhs.columns[i], rhs.columns[i]);
+    }
+    return (mask == 0xF);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator!=(const axm::Matrix& lhs,
+    const axm::Matrix& rhs)
+{
+    return (!(lhs == rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Write the matrix row after row.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const axm::Matrix& rhs);
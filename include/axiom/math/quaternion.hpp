@@ -29,6 +29,14 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/simd.hpp>
+#include <axiom/math/vector3.hpp>
+#include <iostream>
+
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace ax::math
 ///////////////////////////////////////////////////////////////////////////////
@@ -36,10 +44,20 @@ namespace ax::math
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Structure predefinition
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Matrix;
+struct Rotator;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Rotation stored as a unit quaternion, `w` being the real part,
+/// in one `simd::Float4`.
+///
+/// Products follow the matrices: `a * b` rotates by `b`, then by `a`.
 ///
 ///////////////////////////////////////////////////////////////////////////////
-struct Quaternion
+struct alignas(16) Quaternion
 {
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -56,6 +74,7 @@ public:
             float w;    //<!
         };
         float xyzw[4];  //<!
+        simd::Float4 packed;    //<! The four components in one register
     };
 
 public:
@@ -63,6 +82,13 @@ public:
     /// \brief
     ///
     ///////////////////////////////////////////////////////////////////////////
+    static const Quaternion identity;   //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The identity rotation.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
     Quaternion(void);
 
     ///////////////////////////////////////////////////////////////////////////
@@ -75,6 +101,323 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     Quaternion(float x, float y, float z, float w);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param packed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Quaternion(simd::Float4 packed);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Rotation around an axis, counter-clockwise when the axis points
+    /// toward the viewer.
+    ///
+    /// \param axis Unit axis
+    /// \param angle Angle in radians
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Quaternion(const Vector3& axis, float angle);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Rotation applying the roll, the pitch, then the yaw.
+    ///
+    /// \param rotator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Quaternion(const Rotator& rotator);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Rotation of the upper 3x3 part of a matrix, whose columns must
+    /// be orthonormal.
+    ///
+    /// \param matrix
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Quaternion(const Matrix& matrix);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float squaredSize(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param tolerance Squared size under which the quaternion is too small
+    ///
+    /// \return The unit quaternion, or the identity if it is too small
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Quaternion getNormalized(float tolerance = SMALL_NUMBER)
+        const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The quaternion with a negated vector part, which is the
+    /// inverse of a unit quaternion
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Quaternion getConjugate(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The inverse of any quaternion, or the identity if it is zero
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Quaternion getInverse(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param vector
+    ///
+    /// \return The vector rotated by the unit quaternion
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Vector3 rotateVector(const Vector3& vector) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param vector
+    ///
+    /// \return The vector rotated by the inverse of the unit quaternion
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Vector3 unrotateVector(const Vector3& vector) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Rotate vectors in bulk, four at a time.
+    ///
+    /// \param vectors
+    /// \param out May be `vectors`, to rotate them in place
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void rotateVectors(const Vector3* vectors, Vector3* out, Uint64 count)
+        const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The Euler angles of the rotation, in degrees. At a pitch of
+    /// 90 degrees either way, the roll is zero and the yaw takes the whole
+    /// turn around the vertical axis
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Rotator getRotator(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The rotation matrix of the unit quaternion
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Matrix getMatrix(void) const;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Normalized linear interpolation, along the shortest path. The
+    /// speed is not constant, but the cost is two dot products.
+    ///
+    /// \param from
+    /// \param to
+    /// \param alpha
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Quaternion nlerp(const Quaternion& from,
+        const Quaternion& to, float alpha);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Spherical linear interpolation, along the shortest path at a
+    /// constant angular speed. Falls back to `nlerp` when both rotations are
+    /// too close for the sine to be divided by.
+    ///
+    /// \param from
+    /// \param to
+    /// \param alpha
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Quaternion slerp(const Quaternion& from,
+        const Quaternion& to, float alpha);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief `nlerp` every pair of two poses, four quaternions at a time
+    /// with one register per component.
+    ///
+    /// \param from
+    /// \param to
+    /// \param out May be `from` or `to`, to blend them in place
+    /// \param count
+    /// \param alpha
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void blend(const Quaternion* from, const Quaternion* to,
+        Quaternion* out, Uint64 count, float alpha);
 };
 
+///////////////////////////////////////////////////////////////////////////////
+inline Quaternion::Quaternion(void)
+    : packed(simd::set(0.f, 0.f, 0.f, 1.f))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Quaternion::Quaternion(float x, float y, float z, float w)
+    : packed(simd::set(x, y, z, w))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Quaternion::Quaternion(simd::Float4 packed)
+    : packed(packed)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float Quaternion::squaredSize(void) const
+{
+    return (simd::getX(simd::dot4(packed, packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Quaternion Quaternion::getConjugate(void) const
+{
+    return (Quaternion(simd::multiply(packed,
+        simd::set(-1.f, -1.f, -1.f, 1.f))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3 Quaternion::rotateVector(const Vector3& vector) const
+{
+    // v + w * t + q x t, with t = 2 * q x v and q the vector part, which is
+    // cheaper than the two products q * v * q'
+    simd::Float4 v = simd::set(vector.x, vector.y, vector.z, 0.f);
+    simd::Float4 t = simd::cross3(packed, v);
+    t = simd::add(t, t);
+    alignas(16) float result[4];
+    simd::store(result, simd::add(
+        simd::add(v, simd::multiply(simd::splat(w), t)),
+        simd::cross3(packed, t)));
+    return (Vector3(result[0], result[1], result[2]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3 Quaternion::unrotateVector(const Vector3& vector) const
+{
+    return (getConjugate().rotateVector(vector));
+}
+
 } // namespace ax::math
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward ax::math namespace
+///////////////////////////////////////////////////////////////////////////////
+namespace axm = ax::math;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return The rotation by `rhs`, then by `lhs`
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Quaternion operator*(const axm::Quaternion& lhs,
+    const axm::Quaternion& rhs)
+{
+    // Each lane of lhs.w * rhs + lhs.x * rhs.wzyx + lhs.y * rhs.zwxy
+    // + lhs.z * rhs.yxwz, with the signs of the Hamilton product
+    const axm::simd::Float4 wzyx = axm::simd::set(rhs.w, rhs.z, rhs.y,
+        rhs.x);
+    const axm::simd::Float4 zwxy = axm::simd::set(rhs.z, rhs.w, rhs.x,
+        rhs.y);
+    const axm::simd::Float4 yxwz = axm::simd::set(rhs.y, rhs.x, rhs.w,
+        rhs.z);
+
+    return (axm::Quaternion(axm::simd::add(
+        axm::simd::add(
+            axm::simd::multiply(axm::simd::splat(lhs.w), rhs.packed),
+            axm::simd::multiply(axm::simd::multiply(axm::simd::splat(lhs.x),
+                wzyx), axm::simd::set(1.f, -1.f, 1.f, -1.f))),
+        axm::simd::add(
+            axm::simd::multiply(axm::simd::multiply(axm::simd::splat(lhs.y),
+                zwxy), axm::simd::set(1.f, 1.f, -1.f, -1.f)),
+            axm::simd::multiply(axm::simd::multiply(axm::simd::splat(lhs.z),
+                yxwz), axm::simd::set(-1.f, 1.f, 1.f, -1.f))))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Quaternion& operator*=(axm::Quaternion& lhs,
+    const axm::Quaternion& rhs)
+{
+    lhs = lhs * rhs;
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator==(const axm::Quaternion& lhs,
+    const axm::Quaternion& rhs)
+{
+    return (axm::simd::equalMask(lhs.packed, rhs.packed) == 0xF);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator!=(const axm::Quaternion& lhs,
+    const axm::Quaternion& rhs)
+{
+    return (!(lhs == rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const axm::Quaternion& rhs);
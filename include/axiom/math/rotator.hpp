@@ -36,7 +36,8 @@ namespace ax::math
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Euler angles in degrees: the pitch turns around the Y axis, the
+/// yaw around the Z axis and the roll around the X axis.
 ///
 ///////////////////////////////////////////////////////////////////////////////
 struct Rotator
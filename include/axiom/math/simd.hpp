@@ -0,0 +1,714 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <cmath>
+#include <cstring>
+#if defined(AXIOM_SIMD_SSE2)
+    #include <immintrin.h>
+#elif defined(AXIOM_SIMD_NEON)
+    #include <arm_neon.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::math::simd
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::math::simd
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Four floats in one SIMD register: an `__m128` with SSE2, a
+/// `float32x4_t` with NEON, and an aligned array otherwise.
+///
+/// The functions below are the kernels the vector, matrix and quaternion
+/// types are built on. Each one maps to a few instructions and is inlined,
+/// so chains of them stay in registers.
+///
+///////////////////////////////////////////////////////////////////////////////
+#if defined(AXIOM_SIMD_SSE2)
+using Float4 = __m128;
+#elif defined(AXIOM_SIMD_NEON)
+using Float4 = float32x4_t;
+#else
+struct alignas(16) Float4
+{
+    float lane[4];  //<!
+};
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param data Four floats aligned on 16 bytes
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 load(const float* data)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_load_ps(data));
+#elif defined(AXIOM_SIMD_NEON)
+    return (vld1q_f32(data));
+#else
+    return (Float4{{data[0], data[1], data[2], data[3]}});
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param data Four floats, with any alignment
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 loadUnaligned(const float* data)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_loadu_ps(data));
+#else
+    return (load(data));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param data Four floats aligned on 16 bytes
+/// \param value
+///
+///////////////////////////////////////////////////////////////////////////////
+inline void store(float* data, Float4 value)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    _mm_store_ps(data, value);
+#elif defined(AXIOM_SIMD_NEON)
+    vst1q_f32(data, value);
+#else
+    data[0] = value.lane[0];
+    data[1] = value.lane[1];
+    data[2] = value.lane[2];
+    data[3] = value.lane[3];
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param data Four floats, with any alignment
+/// \param value
+///
+///////////////////////////////////////////////////////////////////////////////
+inline void storeUnaligned(float* data, Float4 value)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    _mm_storeu_ps(data, value);
+#else
+    store(data, value);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Load four vectors of three floats, stored one after the other,
+/// as a register of their x, one of their y and one of their z.
+///
+/// \param data Twelve floats, with any alignment
+/// \param x
+/// \param y
+/// \param z
+///
+///////////////////////////////////////////////////////////////////////////////
+inline void loadInterleaved3(const float* data, Float4& x, Float4& y,
+    Float4& z)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+    const __m128 a = _mm_loadu_ps(data);
+    const __m128 b = _mm_loadu_ps(data + 4);
+    const __m128 c = _mm_loadu_ps(data + 8);
+    const __m128 yz = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+    const __m128 xy = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+    x = _mm_shuffle_ps(a, xy, _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+    z = _mm_shuffle_ps(yz, c, _MM_SHUFFLE(3, 0, 3, 1));
+#elif defined(AXIOM_SIMD_NEON)
+    const float32x4x3_t lanes = vld3q_f32(data);
+    x = lanes.val[0];
+    y = lanes.val[1];
+    z = lanes.val[2];
+#else
+    for (int i = 0; i < 4; i++)
+    {
+        x.lane[i] = data[i * 3];
+        y.lane[i] = data[i * 3 + 1];
+        z.lane[i] = data[i * 3 + 2];
+    }
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Store the x, y and z registers as four vectors of three floats,
+/// the reverse of `loadInterleaved3`.
+///
+/// \param data Twelve floats, with any alignment
+/// \param x
+/// \param y
+/// \param z
+///
+///////////////////////////////////////////////////////////////////////////////
+inline void storeInterleaved3(float* data, Float4 x, Float4 y, Float4 z)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    // x0 x1 y0 y1, z0 z2 x1 x3, y0 y1 z0 z1, x2 x3 y2 y3, y3 y3 z3 z3
+    const __m128 xy01 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m128 zx = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+    const __m128 yz01 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m128 xy23 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m128 yz3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+    _mm_storeu_ps(data, _mm_shuffle_ps(xy01, zx, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(data + 4,
+        _mm_shuffle_ps(yz01, xy23, _MM_SHUFFLE(2, 0, 3, 1)));
+    _mm_storeu_ps(data + 8,
+        _mm_shuffle_ps(zx, yz3, _MM_SHUFFLE(2, 0, 3, 1)));
+#elif defined(AXIOM_SIMD_NEON)
+    float32x4x3_t lanes;
+    lanes.val[0] = x;
+    lanes.val[1] = y;
+    lanes.val[2] = z;
+    vst3q_f32(data, lanes);
+#else
+    for (int i = 0; i < 4; i++)
+    {
+        data[i * 3] = x.lane[i];
+        data[i * 3 + 1] = y.lane[i];
+        data[i * 3 + 2] = z.lane[i];
+    }
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param x
+/// \param y
+/// \param z
+/// \param w
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 set(float x, float y, float z, float w)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_setr_ps(x, y, z, w));
+#elif defined(AXIOM_SIMD_NEON)
+    const float data[4] = {x, y, z, w};
+    return (vld1q_f32(data));
+#else
+    return (Float4{{x, y, z, w}});
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param f
+///
+/// \return `f` in every lane
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 splat(float f)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_set1_ps(f));
+#elif defined(AXIOM_SIMD_NEON)
+    return (vdupq_n_f32(f));
+#else
+    return (Float4{{f, f, f, f}});
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 zero(void)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_setzero_ps());
+#else
+    return (splat(0.f));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param value
+///
+/// \return The first lane
+///
+///////////////////////////////////////////////////////////////////////////////
+inline float getX(Float4 value)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_cvtss_f32(value));
+#elif defined(AXIOM_SIMD_NEON)
+    return (vgetq_lane_f32(value, 0));
+#else
+    return (value.lane[0]);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 add(Float4 lhs, Float4 rhs)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_add_ps(lhs, rhs));
+#elif defined(AXIOM_SIMD_NEON)
+    return (vaddq_f32(lhs, rhs));
+#else
+    return (Float4{{lhs.lane[0] + rhs.lane[0], lhs.lane[1] + rhs.lane[1],
+        lhs.lane[2] + rhs.lane[2], lhs.lane[3] + rhs.lane[3]}});
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 subtract(Float4 lhs, Float4 rhs)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_sub_ps(lhs, rhs));
+#elif defined(AXIOM_SIMD_NEON)
+    return (vsubq_f32(lhs, rhs));
+#else
+    return (Float4{{lhs.lane[0] - rhs.lane[0], lhs.lane[1] - rhs.lane[1],
+        lhs.lane[2] - rhs.lane[2], lhs.lane[3] - rhs.lane[3]}});
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 multiply(Float4 lhs, Float4 rhs)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_mul_ps(lhs, rhs));
+#elif defined(AXIOM_SIMD_NEON)
+    return (vmulq_f32(lhs, rhs));
+#else
+    return (Float4{{lhs.lane[0] * rhs.lane[0], lhs.lane[1] * rhs.lane[1],
+        lhs.lane[2] * rhs.lane[2], lhs.lane[3] * rhs.lane[3]}});
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 divide(Float4 lhs, Float4 rhs)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_div_ps(lhs, rhs));
+#elif defined(AXIOM_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    return (vdivq_f32(lhs, rhs));
+#elif defined(AXIOM_SIMD_NEON)
+    // ARMv7 has no division, refine the reciprocal estimate twice
+    float32x4_t inverse = vrecpeq_f32(rhs);
+    inverse = vmulq_f32(vrecpsq_f32(rhs, inverse), inverse);
+    inverse = vmulq_f32(vrecpsq_f32(rhs, inverse), inverse);
+    return (vmulq_f32(lhs, inverse));
+#else
+    return (Float4{{lhs.lane[0] / rhs.lane[0], lhs.lane[1] / rhs.lane[1],
+        lhs.lane[2] / rhs.lane[2], lhs.lane[3] / rhs.lane[3]}});
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param value
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 negate(Float4 value)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_xor_ps(value, _mm_set1_ps(-0.f)));
+#elif defined(AXIOM_SIMD_NEON)
+    return (vnegq_f32(value));
+#else
+    return (Float4{{-value.lane[0], -value.lane[1], -value.lane[2],
+        -value.lane[3]}});
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 min(Float4 lhs, Float4 rhs)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_min_ps(lhs, rhs));
+#elif defined(AXIOM_SIMD_NEON)
+    return (vminq_f32(lhs, rhs));
+#else
+    Float4 result;
+    for (int i = 0; i < 4; i++)
+    {
+        result.lane[i] = (lhs.lane[i] < rhs.lane[i]) ? lhs.lane[i]
+            : rhs.lane[i];
+    }
+    return (result);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 max(Float4 lhs, Float4 rhs)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_max_ps(lhs, rhs));
+#elif defined(AXIOM_SIMD_NEON)
+    return (vmaxq_f32(lhs, rhs));
+#else
+    Float4 result;
+    for (int i = 0; i < 4; i++)
+    {
+        result.lane[i] = (lhs.lane[i] > rhs.lane[i]) ? lhs.lane[i]
+            : rhs.lane[i];
+    }
+    return (result);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param value
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 sqrt(Float4 value)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_sqrt_ps(value));
+#elif defined(AXIOM_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    return (vsqrtq_f32(value));
+#else
+    alignas(16) float lane[4];
+    store(lane, value);
+    return (set(std::sqrt(lane[0]), std::sqrt(lane[1]), std::sqrt(lane[2]),
+        std::sqrt(lane[3])));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+/// \param alpha
+///
+/// \return `lhs + (rhs - lhs) * alpha`
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 lerp(Float4 lhs, Float4 rhs, Float4 alpha)
+{
+    return (add(lhs, multiply(subtract(rhs, lhs), alpha)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return The sum of the products of all four lanes, in every lane
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 dot4(Float4 lhs, Float4 rhs)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    __m128 product = _mm_mul_ps(lhs, rhs);
+    __m128 sum = _mm_add_ps(product, _mm_shuffle_ps(product, product,
+        _MM_SHUFFLE(2, 3, 0, 1)));
+    return (_mm_add_ps(sum, _mm_shuffle_ps(sum, sum,
+        _MM_SHUFFLE(1, 0, 3, 2))));
+#elif defined(AXIOM_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    return (vdupq_n_f32(vaddvq_f32(vmulq_f32(lhs, rhs))));
+#elif defined(AXIOM_SIMD_NEON)
+    float32x4_t product = vmulq_f32(lhs, rhs);
+    float32x2_t sum = vadd_f32(vget_low_f32(product),
+        vget_high_f32(product));
+    sum = vpadd_f32(sum, sum);
+    return (vcombine_f32(sum, sum));
+#else
+    return (splat(lhs.lane[0] * rhs.lane[0] + lhs.lane[1] * rhs.lane[1]
+        + lhs.lane[2] * rhs.lane[2] + lhs.lane[3] * rhs.lane[3]));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return The sum of the products of the first three lanes, in every lane
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 dot3(Float4 lhs, Float4 rhs)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    __m128 product = _mm_mul_ps(lhs, rhs);
+    __m128 sum = _mm_add_ss(product, _mm_shuffle_ps(product, product,
+        _MM_SHUFFLE(1, 1, 1, 1)));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(product, product,
+        _MM_SHUFFLE(2, 2, 2, 2)));
+    return (_mm_shuffle_ps(sum, sum, _MM_SHUFFLE(0, 0, 0, 0)));
+#elif defined(AXIOM_SIMD_NEON)
+    // Zero the fourth product, not a fourth input: 0 * NaN is still NaN
+    const float32x4_t product = vsetq_lane_f32(0.f, vmulq_f32(lhs, rhs), 3);
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return (vdupq_n_f32(vaddvq_f32(product)));
+#else
+    float32x2_t sum = vadd_f32(vget_low_f32(product), vget_high_f32(product));
+    sum = vpadd_f32(sum, sum);
+    return (vcombine_f32(sum, sum));
+#endif
+#else
+    return (splat(lhs.lane[0] * rhs.lane[0] + lhs.lane[1] * rhs.lane[1]
+        + lhs.lane[2] * rhs.lane[2]));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return The cross product of the first three lanes, with a zero fourth
+/// lane when both fourth lanes are finite
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 cross3(Float4 lhs, Float4 rhs)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    // (lhs * rhs.yzx - lhs.yzx * rhs).yzx saves one shuffle over the
+    // textbook lhs.yzx * rhs.zxy - lhs.zxy * rhs.yzx
+    __m128 lhsYzx = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 rhsYzx = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 result = _mm_sub_ps(_mm_mul_ps(lhs, rhsYzx),
+        _mm_mul_ps(lhsYzx, rhs));
+    return (_mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 0, 2, 1)));
+#else
+    alignas(16) float a[4];
+    alignas(16) float b[4];
+    store(a, lhs);
+    store(b, rhs);
+    return (set(a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+        a[0] * b[1] - a[1] * b[0], 0.f));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return A mask with every bit of a lane set where `lhs > rhs`, for
+/// `select`
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 greater(Float4 lhs, Float4 rhs)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_cmpgt_ps(lhs, rhs));
+#elif defined(AXIOM_SIMD_NEON)
+    return (vreinterpretq_f32_u32(vcgtq_f32(lhs, rhs)));
+#else
+    const Uint32 ones = 0xFFFFFFFFu;
+    Float4 mask = {{0.f, 0.f, 0.f, 0.f}};
+    for (int i = 0; i < 4; i++)
+    {
+        if (lhs.lane[i] > rhs.lane[i])
+        {
+            std::memcpy(&mask.lane[i], &ones, sizeof(ones));
+        }
+    }
+    return (mask);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param mask A mask from a comparison
+/// \param ifTrue
+/// \param ifFalse
+///
+/// \return The lanes of `ifTrue` where the mask is set, of `ifFalse`
+/// elsewhere
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Float4 select(Float4 mask, Float4 ifTrue, Float4 ifFalse)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (_mm_or_ps(_mm_and_ps(mask, ifTrue),
+        _mm_andnot_ps(mask, ifFalse)));
+#elif defined(AXIOM_SIMD_NEON)
+    return (vbslq_f32(vreinterpretq_u32_f32(mask), ifTrue, ifFalse));
+#else
+    Float4 result;
+    for (int i = 0; i < 4; i++)
+    {
+        Uint32 bits;
+        std::memcpy(&bits, &mask.lane[i], sizeof(bits));
+        result.lane[i] = bits ? ifTrue.lane[i] : ifFalse.lane[i];
+    }
+    return (result);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Transpose four registers seen as the rows of a 4x4 matrix, to
+/// turn four structures of four floats into four registers of one member.
+///
+/// \param a
+/// \param b
+/// \param c
+/// \param d
+///
+///////////////////////////////////////////////////////////////////////////////
+inline void transpose(Float4& a, Float4& b, Float4& c, Float4& d)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    _MM_TRANSPOSE4_PS(a, b, c, d);
+#elif defined(AXIOM_SIMD_NEON)
+    const float32x4x2_t ab = vtrnq_f32(a, b);
+    const float32x4x2_t cd = vtrnq_f32(c, d);
+    a = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+    b = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+    c = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+    d = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+#else
+    Float4* rows[4] = {&a, &b, &c, &d};
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = i + 1; j < 4; j++)
+        {
+            float swap = rows[i]->lane[j];
+            rows[i]->lane[j] = rows[j]->lane[i];
+            rows[j]->lane[i] = swap;
+        }
+    }
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return One bit per lane, set where the lanes are equal
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint32 equalMask(Float4 lhs, Float4 rhs)
+{
+#if defined(AXIOM_SIMD_SSE2)
+    return (static_cast<Uint32>(_mm_movemask_ps(_mm_cmpeq_ps(lhs, rhs))));
+#elif defined(AXIOM_SIMD_NEON)
+    const uint32x4_t equal = vceqq_f32(lhs, rhs);
+    return ((vgetq_lane_u32(equal, 0) & 1u) | (vgetq_lane_u32(equal, 1) & 2u)
+        | (vgetq_lane_u32(equal, 2) & 4u) | (vgetq_lane_u32(equal, 3) & 8u));
+#else
+    Uint32 mask = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        mask |= (lhs.lane[i] == rhs.lane[i]) ? (1u << i) : 0u;
+    }
+    return (mask);
+#endif
+}
+
+} // namespace ax::math::simd
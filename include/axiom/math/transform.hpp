@@ -29,6 +29,15 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/matrix.hpp>
+#include <axiom/math/quaternion.hpp>
+#include <axiom/math/vector3.hpp>
+#include <iostream>
+
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace ax::math
 ///////////////////////////////////////////////////////////////////////////////
@@ -36,12 +45,136 @@ namespace ax::math
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Translation, rotation and scale, applied to a point in the
+/// reverse order: scaled, rotated, then translated.
+///
+/// Compositions and inverses stay exact while the scales are uniform. A
+/// non-uniform scale under a rotation makes a shear that a Transform cannot
+/// hold, so chains of those go through `getMatrix()` instead.
 ///
 ///////////////////////////////////////////////////////////////////////////////
 struct Transform
 {
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Quaternion rotation;    //<!
+    Vector3 translation;    //<!
+    Vector3 scale;          //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static const Transform identity;    //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The identity transform.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Transform(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param translation
+    /// \param rotation
+    /// \param scale
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Transform(const Vector3& translation, const Quaternion& rotation,
+        const Vector3& scale = Vector3(1.f));
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The matrix of the transform, equal to T * R * S
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Matrix getMatrix(void) const;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The inverse transform, with a zero scale where the scale
+    /// is too small to be inverted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Transform getInverse(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param point
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Vector3 transformPoint(const Vector3& point) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Transform a direction: rotated and scaled, not translated.
+    ///
+    /// \param vector
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Vector3 transformVector(const Vector3& vector) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Undo `transformPoint`, exactly whatever the scale.
+    ///
+    /// \param point
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Vector3 inverseTransformPoint(const Vector3& point) const;
 };
 
 } // namespace ax::math
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward ax::math namespace
+///////////////////////////////////////////////////////////////////////////////
+namespace axm = ax::math;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return The transform applying `rhs`, then `lhs`
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD axm::Transform operator*(const axm::Transform& lhs,
+    const axm::Transform& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+axm::Transform& operator*=(axm::Transform& lhs, const axm::Transform& rhs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const axm::Transform& rhs);
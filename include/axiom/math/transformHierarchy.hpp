@@ -0,0 +1,218 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/container/array.hpp>
+#include <axiom/math/matrix.hpp>
+#include <axiom/math/transform.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/memory/allocator.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::math
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::math
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Tree of transforms stored flat, each node after its parent, with
+/// the world matrices cached.
+///
+/// Changing a local transform only flags the node. `update()` then walks
+/// the arrays once, from the first flagged node on: a node is recomputed if
+/// it is flagged or if its parent was, so only the changed subtrees pay for
+/// a matrix product, and the parent world matrix is always already there.
+///
+/// \code
+/// axm::TransformHierarchy skeleton;
+/// Uint32 hips = skeleton.add(hipsLocal);
+/// Uint32 spine = skeleton.add(spineLocal, hips);
+/// skeleton.setLocal(spine, animated);
+/// skeleton.update();
+/// upload(skeleton.getWorldMatrices(), skeleton.size());
+/// \endcode
+///
+///////////////////////////////////////////////////////////////////////////////
+class TransformHierarchy
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parent of the roots.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint32 noParent = 0xFFFFFFFFu; //<!
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    container::Array<Transform> m_locals;   //<!
+    container::Array<Matrix> m_worlds;      //<! As of the last update
+    container::Array<Uint32> m_parents;     //<! Each below its child index
+    container::Array<Uint8> m_dirty;        //<! Local changed since update
+    Uint64 m_firstDirty = 0;                //<! The size when none is
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    TransformHierarchy(void) = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param allocator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit TransformHierarchy(memory::Allocator& allocator);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return Whether a local transform changed since the last update
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isDirty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param capacity
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void reserve(Uint64 capacity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Append a node, flagged until the next update.
+    ///
+    /// \param local
+    /// \param parent An existing node, or `noParent` for a root
+    ///
+    /// \return The index of the node
+    ///
+    /// \throw std::exception if `parent` is not a node yet
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint32 add(const Transform& local, Uint32 parent = noParent);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return The parent node, or `noParent`
+    ///
+    /// \throw std::exception if `index` is out of range
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint32 getParent(Uint32 index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return The transform relative to the parent
+    ///
+    /// \throw std::exception if `index` is out of range
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const Transform& getLocal(Uint32 index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Change a local transform and flag the node.
+    ///
+    /// \param index
+    /// \param local
+    ///
+    /// \throw std::exception if `index` is out of range
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void setLocal(Uint32 index, const Transform& local);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return The world matrix as of the last update
+    ///
+    /// \throw std::exception if `index` is out of range
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const Matrix& getWorld(Uint32 index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return The world matrices of every node as of the last update, in
+    /// node order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const Matrix* getWorldMatrices(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Recompute the world matrices of the flagged nodes and of
+    /// everything under them, then clear the flags.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void update(void);
+};
+
+} // namespace ax::math
@@ -0,0 +1,373 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <axiom/math/defines.hpp>
+#include <axiom/math/vector2.hpp>
+#include <axiom/memory/allocator.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::math
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::math
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Vectors stored as structure of arrays, for bulk math.
+///
+/// The x and y components live in two arrays of one block, each one aligned
+/// on 64 bytes, so the kernels of Batch load 4, 8 or 16 vectors per
+/// instruction where an array of Vector2 would need shuffles.
+///
+/// \code
+/// axm::Vector2Batch positions;
+/// positions.resize(count);
+/// positions.multiplyAdd(velocities, deltaTime);
+/// positions.getDistances(camera, distances);
+/// \endcode
+///
+///////////////////////////////////////////////////////////////////////////////
+class Vector2Batch
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The capacity is a multiple of it, keeping every array aligned.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 granularity = 16;   //<!
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    float* m_data = nullptr;                    //<! x, then y array
+    Uint64 m_size = 0;                          //<!
+    Uint64 m_capacity = 0;                      //<! Of each array
+    memory::Allocator* m_allocator = nullptr;   //<! nullptr for the default
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vector2Batch(void) = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param allocator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Vector2Batch(memory::Allocator& allocator);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param size Number of zero vectors
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Vector2Batch(Uint64 size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vector2Batch(const Vector2Batch& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other Left empty
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vector2Batch(Vector2Batch&& other) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~Vector2Batch(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vector2Batch& operator=(const Vector2Batch& other);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Take the block of `other` when both batches share the same
+    /// allocator, copy the vectors otherwise.
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vector2Batch& operator=(Vector2Batch&& other);
+
+public:
+    // ANCHOR - Storage
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 size(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 capacity(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool isEmpty(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD memory::Allocator& getAllocator(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param capacity
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void reserve(Uint64 capacity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param size New vectors are zero
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void resize(Uint64 size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Remove every vector, keeping the memory.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void clear(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param vector
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void pushBack(const Vector2& vector);
+
+    // ANCHOR - Access
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    /// \param vector
+    ///
+    /// \throw std::exception if `index` is out of bounds
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void set(Uint64 index, const Vector2& vector);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    ///
+    /// \return
+    ///
+    /// \throw std::exception if `index` is out of bounds
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Vector2 get(Uint64 index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return `size()` x components, aligned on 64 bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float* getX(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const float* getX(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return `size()` y components, aligned on 64 bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float* getY(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const float* getY(void) const;
+
+    // ANCHOR - Kernels
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Translate every vector.
+    ///
+    /// \param offset
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void add(const Vector2& offset);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param factor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void scale(float factor);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief `this[i] += other[i] * factor`, as integrating velocities.
+    ///
+    /// \param other
+    /// \param factor
+    ///
+    /// \throw std::exception if the sizes differ
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void multiplyAdd(const Vector2Batch& other, float factor);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief `this[i] = xAxis * x + yAxis * y + translation`
+    ///
+    /// \param xAxis
+    /// \param yAxis
+    /// \param translation
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void transform(const Vector2& xAxis, const Vector2& yAxis,
+        const Vector2& translation);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Normalize every vector, setting the ones too small to zero.
+    ///
+    /// \param tolerance Minimum squared length
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void normalize(float tolerance = SMALL_NUMBER);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param out `size()` lengths
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void getLengths(float* out) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    /// \param out `size()` dot products
+    ///
+    /// \throw std::exception if the sizes differ
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void getDots(const Vector2Batch& other, float* out) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param point
+    /// \param out `size()` distances
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void getDistances(const Vector2& point, float* out) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param min Per component minimum
+    /// \param max Per component maximum
+    ///
+    /// \throw std::exception if the batch is empty
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void getBounds(Vector2& min, Vector2& max) const;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move the vectors to a block of the given capacity.
+    ///
+    /// \param capacity A multiple of `granularity`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _reallocate(Uint64 capacity);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Give the block back, leaving the members dangling.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _deallocate(void);
+};
+
+} // namespace ax::math
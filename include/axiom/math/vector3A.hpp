@@ -0,0 +1,785 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/defines.hpp>
+#include <axiom/math/simd.hpp>
+#include <axiom/math/vector3.hpp>
+#include <iostream>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::math
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::math
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief A Vector3 padded to 16 bytes and aligned on them, so that it
+/// loads in one SIMD register. Arithmetic is defined inline on top of
+/// `simd::Float4`.
+///
+/// The fourth lane is padding: its value is unspecified and ignored by
+/// the comparisons, dot and cross products. Convert from and to Vector3 to
+/// store vectors tightly packed.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct alignas(16) Vector3A
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    union
+    {
+        struct
+        {
+            float x;        //<!
+            float y;        //<!
+            float z;        //<!
+            float padding;  //<!
+        };
+        float xyz[3];           //<!
+        simd::Float4 packed;    //<! The components and padding in one register
+    };
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vector3A(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param f
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vector3A(float f);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param x
+    /// \param y
+    /// \param z
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vector3A(float x, float y, float z);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param vector
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Vector3A(const Vector3& vector);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param packed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Vector3A(simd::Float4 packed);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets specific component of the vector.
+    ///
+    /// \param index The index of vector component.
+    ///
+    /// \return Reference to the component.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float& operator[](Int32 index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets specific component of the vector.
+    ///
+    /// \param index The index of vector component.
+    ///
+    /// \return Copy of the component.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const float& operator[](Int32 index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Vector3 toVector3(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float dot(const Vector3A& other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float length(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float squaredLength(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param tolerance Squared length under which the vector is too small
+    /// to normalize
+    ///
+    /// \return The normalized vector, or the zero vector if it is too small
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Vector3A getSafeNormal(float tolerance = SMALL_NUMBER)
+        const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Normalize the vector in place, unless it is too small.
+    ///
+    /// \param tolerance Squared length under which the vector is too small
+    /// to normalize
+    ///
+    /// \return Whether the vector was normalized
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool normalize(float tolerance = SMALL_NUMBER);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param a
+    /// \param b
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Vector3A min(const Vector3A& a, const Vector3A& b);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param a
+    /// \param b
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Vector3A max(const Vector3A& a, const Vector3A& b);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param a
+    /// \param b
+    /// \param alpha
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Vector3A lerp(const Vector3A& a,
+        const Vector3A& b, float alpha);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param a
+    /// \param b
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static float dotProduct(const Vector3A& a,
+        const Vector3A& b);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param a
+    /// \param b
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Vector3A crossProduct(const Vector3A& a,
+        const Vector3A& b);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3A::Vector3A(void)
+    : packed(simd::zero())
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3A::Vector3A(float f)
+    : packed(simd::splat(f))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3A::Vector3A(float x, float y, float z)
+    : packed(simd::set(x, y, z, 0.f))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3A::Vector3A(const Vector3& vector)
+    : packed(simd::set(vector.x, vector.y, vector.z, 0.f))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3A::Vector3A(simd::Float4 packed)
+    : packed(packed)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float& Vector3A::operator[](Int32 index)
+{
+    CHECK(index >= 0 && index <= 2);
+    return (xyz[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline const float& Vector3A::operator[](Int32 index) const
+{
+    CHECK(index >= 0 && index <= 2);
+    return (xyz[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3 Vector3A::toVector3(void) const
+{
+    return (Vector3(x, y, z));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float Vector3A::dot(const Vector3A& other) const
+{
+    return (simd::getX(simd::dot3(packed, other.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float Vector3A::length(void) const
+{
+    return (simd::getX(simd::sqrt(simd::dot3(packed, packed))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float Vector3A::squaredLength(void) const
+{
+    return (simd::getX(simd::dot3(packed, packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3A Vector3A::getSafeNormal(float tolerance) const
+{
+    const simd::Float4 squared = simd::dot3(packed, packed);
+
+    if (simd::getX(squared) <= tolerance)
+    {
+        return (Vector3A());
+    }
+    return (Vector3A(simd::divide(packed, simd::sqrt(squared))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline bool Vector3A::normalize(float tolerance)
+{
+    const simd::Float4 squared = simd::dot3(packed, packed);
+
+    if (simd::getX(squared) <= tolerance)
+    {
+        return (false);
+    }
+    packed = simd::divide(packed, simd::sqrt(squared));
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3A Vector3A::min(const Vector3A& a, const Vector3A& b)
+{
+    return (Vector3A(simd::min(a.packed, b.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3A Vector3A::max(const Vector3A& a, const Vector3A& b)
+{
+    return (Vector3A(simd::max(a.packed, b.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3A Vector3A::lerp(const Vector3A& a, const Vector3A& b,
+    float alpha)
+{
+    return (Vector3A(simd::lerp(a.packed, b.packed, simd::splat(alpha))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float Vector3A::dotProduct(const Vector3A& a, const Vector3A& b)
+{
+    return (a.dot(b));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector3A Vector3A::crossProduct(const Vector3A& a, const Vector3A& b)
+{
+    return (Vector3A(simd::cross3(a.packed, b.packed)));
+}
+
+} // namespace ax::math
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward ax::math namespace
+///////////////////////////////////////////////////////////////////////////////
+namespace axm = ax::math;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator+(const axm::Vector3A& lhs)
+{
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator-(const axm::Vector3A& lhs)
+{
+    return (axm::Vector3A(axm::simd::negate(lhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator+(const axm::Vector3A& lhs,
+    const axm::Vector3A& rhs)
+{
+    return (axm::Vector3A(axm::simd::add(lhs.packed, rhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator+(const axm::Vector3A& lhs,
+    float rhs)
+{
+    return (axm::Vector3A(axm::simd::add(lhs.packed, axm::simd::splat(rhs))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator+(float lhs,
+    const axm::Vector3A& rhs)
+{
+    return (rhs + lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator-(const axm::Vector3A& lhs,
+    const axm::Vector3A& rhs)
+{
+    return (axm::Vector3A(axm::simd::subtract(lhs.packed, rhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator-(const axm::Vector3A& lhs,
+    float rhs)
+{
+    return (axm::Vector3A(axm::simd::subtract(lhs.packed,
+        axm::simd::splat(rhs))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator-(float lhs,
+    const axm::Vector3A& rhs)
+{
+    return (axm::Vector3A(axm::simd::subtract(axm::simd::splat(lhs),
+        rhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator*(const axm::Vector3A& lhs,
+    const axm::Vector3A& rhs)
+{
+    return (axm::Vector3A(axm::simd::multiply(lhs.packed, rhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator*(const axm::Vector3A& lhs,
+    float rhs)
+{
+    return (axm::Vector3A(axm::simd::multiply(lhs.packed,
+        axm::simd::splat(rhs))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator*(float lhs,
+    const axm::Vector3A& rhs)
+{
+    return (rhs * lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator/(const axm::Vector3A& lhs,
+    const axm::Vector3A& rhs)
+{
+    return (axm::Vector3A(axm::simd::divide(lhs.packed, rhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator/(const axm::Vector3A& lhs,
+    float rhs)
+{
+    CHECK(rhs != 0.f);
+    return (axm::Vector3A(axm::simd::divide(lhs.packed,
+        axm::simd::splat(rhs))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator/(float lhs,
+    const axm::Vector3A& rhs)
+{
+    return (axm::Vector3A(axm::simd::divide(axm::simd::splat(lhs),
+        rhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector3A& operator+=(axm::Vector3A& lhs, const axm::Vector3A& rhs)
+{
+    lhs.packed = axm::simd::add(lhs.packed, rhs.packed);
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector3A& operator+=(axm::Vector3A& lhs, float rhs)
+{
+    lhs.packed = axm::simd::add(lhs.packed, axm::simd::splat(rhs));
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector3A& operator-=(axm::Vector3A& lhs, const axm::Vector3A& rhs)
+{
+    lhs.packed = axm::simd::subtract(lhs.packed, rhs.packed);
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector3A& operator-=(axm::Vector3A& lhs, float rhs)
+{
+    lhs.packed = axm::simd::subtract(lhs.packed, axm::simd::splat(rhs));
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector3A& operator*=(axm::Vector3A& lhs, const axm::Vector3A& rhs)
+{
+    lhs.packed = axm::simd::multiply(lhs.packed, rhs.packed);
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector3A& operator*=(axm::Vector3A& lhs, float rhs)
+{
+    lhs.packed = axm::simd::multiply(lhs.packed, axm::simd::splat(rhs));
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector3A& operator/=(axm::Vector3A& lhs, const axm::Vector3A& rhs)
+{
+    lhs.packed = axm::simd::divide(lhs.packed, rhs.packed);
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector3A& operator/=(axm::Vector3A& lhs, float rhs)
+{
+    CHECK(rhs != 0.f);
+    lhs.packed = axm::simd::divide(lhs.packed, axm::simd::splat(rhs));
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator==(const axm::Vector3A& lhs,
+    const axm::Vector3A& rhs)
+{
+    return ((axm::simd::equalMask(lhs.packed, rhs.packed) & 0x7) == 0x7);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator!=(const axm::Vector3A& lhs,
+    const axm::Vector3A& rhs)
+{
+    return (!(lhs == rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector3A operator^(const axm::Vector3A& lhs,
+    const axm::Vector3A& rhs)
+{
+    return (axm::Vector3A::crossProduct(lhs, rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline float operator|(const axm::Vector3A& lhs,
+    const axm::Vector3A& rhs)
+{
+    return (lhs.dot(rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const axm::Vector3A& rhs);
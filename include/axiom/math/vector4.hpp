@@ -29,6 +29,14 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/defines.hpp>
+#include <axiom/math/simd.hpp>
+#include <iostream>
+
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace ax::math
 ///////////////////////////////////////////////////////////////////////////////
@@ -36,10 +44,17 @@ namespace ax::math
 {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Structure predefinition
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Vector3;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Four floats aligned on 16 bytes, so that they load in one SIMD
+/// register. Arithmetic is defined inline on top of `simd::Float4`.
 ///
 ///////////////////////////////////////////////////////////////////////////////
-struct Vector4
+struct alignas(16) Vector4
 {
 public:
     ///////////////////////////////////////////////////////////////////////////
@@ -56,6 +71,7 @@ public:
             float w;        //<!
         };
         float xyzw[4];      //<!
+        simd::Float4 packed;    //<! The four components in one register
     };
 
 public:
@@ -95,6 +111,669 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     Vector4(float x, float y, float z, float w);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param vector
+    /// \param w
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Vector4(const Vector3& vector, float w = 0.f);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param packed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit Vector4(simd::Float4 packed);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets specific component of the vector.
+    ///
+    /// \param index The index of vector component.
+    ///
+    /// \return Reference to the component.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float& operator[](Int32 index);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets specific component of the vector.
+    ///
+    /// \param index The index of vector component.
+    ///
+    /// \return Copy of the component.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD const float& operator[](Int32 index) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Dot product of the four components.
+    ///
+    /// \param other
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float dot(const Vector4& other) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float length(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD float squaredLength(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param tolerance Squared length under which the vector is too small
+    /// to normalize
+    ///
+    /// \return The normalized vector, or the zero vector if it is too small
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Vector4 getSafeNormal(float tolerance = SMALL_NUMBER)
+        const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Normalize the vector in place, unless it is too small.
+    ///
+    /// \param tolerance Squared length under which the vector is too small
+    /// to normalize
+    ///
+    /// \return Whether the vector was normalized
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    bool normalize(float tolerance = SMALL_NUMBER);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param a
+    /// \param b
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Vector4 min(const Vector4& a, const Vector4& b);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param a
+    /// \param b
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Vector4 max(const Vector4& a, const Vector4& b);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param a
+    /// \param b
+    /// \param alpha
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Vector4 lerp(const Vector4& a, const Vector4& b,
+        float alpha);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param a
+    /// \param b
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static float dotProduct(const Vector4& a,
+        const Vector4& b);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Cross product of the `xyz` components.
+    ///
+    /// \param a
+    /// \param b
+    ///
+    /// \return A vector with a zero `w`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Vector4 crossProduct(const Vector4& a,
+        const Vector4& b);
 };
 
+///////////////////////////////////////////////////////////////////////////////
+inline Vector4::Vector4(void)
+    : packed(simd::zero())
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector4::Vector4(float f)
+    : packed(simd::splat(f))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector4::Vector4(float x, float y, float z, float w)
+    : packed(simd::set(x, y, z, w))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector4::Vector4(simd::Float4 packed)
+    : packed(packed)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float& Vector4::operator[](Int32 index)
+{
+    CHECK(index >= 0 && index <= 3);
+    return (xyzw[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline const float& Vector4::operator[](Int32 index) const
+{
+    CHECK(index >= 0 && index <= 3);
+    return (xyzw[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float Vector4::dot(const Vector4& other) const
+{
+    return (simd::getX(simd::dot4(packed, other.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float Vector4::length(void) const
+{
+    return (simd::getX(simd::sqrt(simd::dot4(packed, packed))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float Vector4::squaredLength(void) const
+{
+    return (simd::getX(simd::dot4(packed, packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector4 Vector4::getSafeNormal(float tolerance) const
+{
+    const simd::Float4 squared = simd::dot4(packed, packed);
+
+    if (simd::getX(squared) <= tolerance)
+    {
+        return (Vector4());
+    }
+    return (Vector4(simd::divide(packed, simd::sqrt(squared))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline bool Vector4::normalize(float tolerance)
+{
+    const simd::Float4 squared = simd::dot4(packed, packed);
+
+    if (simd::getX(squared) <= tolerance)
+    {
+        return (false);
+    }
+    packed = simd::divide(packed, simd::sqrt(squared));
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector4 Vector4::min(const Vector4& a, const Vector4& b)
+{
+    return (Vector4(simd::min(a.packed, b.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector4 Vector4::max(const Vector4& a, const Vector4& b)
+{
+    return (Vector4(simd::max(a.packed, b.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector4 Vector4::lerp(const Vector4& a, const Vector4& b, float alpha)
+{
+    return (Vector4(simd::lerp(a.packed, b.packed, simd::splat(alpha))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline float Vector4::dotProduct(const Vector4& a, const Vector4& b)
+{
+    return (a.dot(b));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Vector4 Vector4::crossProduct(const Vector4& a, const Vector4& b)
+{
+    return (Vector4(simd::cross3(a.packed, b.packed)));
+}
+
 } // namespace ax::math
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward ax::math namespace
+///////////////////////////////////////////////////////////////////////////////
+namespace axm = ax::math;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator+(const axm::Vector4& lhs)
+{
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator-(const axm::Vector4& lhs)
+{
+    return (axm::Vector4(axm::simd::negate(lhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator+(const axm::Vector4& lhs,
+    const axm::Vector4& rhs)
+{
+    return (axm::Vector4(axm::simd::add(lhs.packed, rhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator+(const axm::Vector4& lhs,
+    float rhs)
+{
+    return (axm::Vector4(axm::simd::add(lhs.packed, axm::simd::splat(rhs))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator+(float lhs,
+    const axm::Vector4& rhs)
+{
+    return (rhs + lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator-(const axm::Vector4& lhs,
+    const axm::Vector4& rhs)
+{
+    return (axm::Vector4(axm::simd::subtract(lhs.packed, rhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator-(const axm::Vector4& lhs,
+    float rhs)
+{
+    return (axm::Vector4(axm::simd::subtract(lhs.packed,
+        axm::simd::splat(rhs))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator-(float lhs,
+    const axm::Vector4& rhs)
+{
+    return (axm::Vector4(axm::simd::subtract(axm::simd::splat(lhs),
+        rhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator*(const axm::Vector4& lhs,
+    const axm::Vector4& rhs)
+{
+    return (axm::Vector4(axm::simd::multiply(lhs.packed, rhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator*(const axm::Vector4& lhs,
+    float rhs)
+{
+    return (axm::Vector4(axm::simd::multiply(lhs.packed,
+        axm::simd::splat(rhs))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator*(float lhs,
+    const axm::Vector4& rhs)
+{
+    return (rhs * lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator/(const axm::Vector4& lhs,
+    const axm::Vector4& rhs)
+{
+    return (axm::Vector4(axm::simd::divide(lhs.packed, rhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator/(const axm::Vector4& lhs,
+    float rhs)
+{
+    CHECK(rhs != 0.f);
+    return (axm::Vector4(axm::simd::divide(lhs.packed,
+        axm::simd::splat(rhs))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator/(float lhs,
+    const axm::Vector4& rhs)
+{
+    return (axm::Vector4(axm::simd::divide(axm::simd::splat(lhs),
+        rhs.packed)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector4& operator+=(axm::Vector4& lhs, const axm::Vector4& rhs)
+{
+    lhs.packed = axm::simd::add(lhs.packed, rhs.packed);
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector4& operator+=(axm::Vector4& lhs, float rhs)
+{
+    lhs.packed = axm::simd::add(lhs.packed, axm::simd::splat(rhs));
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector4& operator-=(axm::Vector4& lhs, const axm::Vector4& rhs)
+{
+    lhs.packed = axm::simd::subtract(lhs.packed, rhs.packed);
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector4& operator-=(axm::Vector4& lhs, float rhs)
+{
+    lhs.packed = axm::simd::subtract(lhs.packed, axm::simd::splat(rhs));
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector4& operator*=(axm::Vector4& lhs, const axm::Vector4& rhs)
+{
+    lhs.packed = axm::simd::multiply(lhs.packed, rhs.packed);
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector4& operator*=(axm::Vector4& lhs, float rhs)
+{
+    lhs.packed = axm::simd::multiply(lhs.packed, axm::simd::splat(rhs));
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector4& operator/=(axm::Vector4& lhs, const axm::Vector4& rhs)
+{
+    lhs.packed = axm::simd::divide(lhs.packed, rhs.packed);
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline axm::Vector4& operator/=(axm::Vector4& lhs, float rhs)
+{
+    CHECK(rhs != 0.f);
+    lhs.packed = axm::simd::divide(lhs.packed, axm::simd::splat(rhs));
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator==(const axm::Vector4& lhs,
+    const axm::Vector4& rhs)
+{
+    return (axm::simd::equalMask(lhs.packed, rhs.packed) == 0xF);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline bool operator!=(const axm::Vector4& lhs,
+    const axm::Vector4& rhs)
+{
+    return (!(lhs == rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Cross product of the `xyz` components.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline axm::Vector4 operator^(const axm::Vector4& lhs,
+    const axm::Vector4& rhs)
+{
+    return (axm::Vector4::crossProduct(lhs, rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Dot product of the four components.
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD inline float operator|(const axm::Vector4& lhs,
+    const axm::Vector4& rhs)
+{
+    return (lhs.dot(rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param lhs
+/// \param rhs
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const axm::Vector4& rhs);
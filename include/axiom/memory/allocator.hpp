@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/config.hpp>
+#include <axiom/math/types.hpp>
+#include <atomic>
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::memory
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::memory
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Interface through which the containers obtain their memory.
+///
+/// Containers keep a pointer to the allocator they were built with and give
+/// every block back with the size it was requested with, so that sized
+/// allocators such as pools do not need any per-block header. The public
+/// entry points keep the allocation counters up to date and forward to the
+/// `_allocate` and `_deallocate` hooks implemented by each allocator.
+///
+/// The counters are atomic, so blocks may be given back from another thread
+/// than the one that allocated them. The default allocator is shared by the
+/// whole process; the other allocators belong to one thread at a time.
+///
+///////////////////////////////////////////////////////////////////////////////
+class Allocator
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Alignment used when none is requested, suitable for any
+    /// scalar type.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 defaultAlignment = alignof(std::max_align_t);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Snapshot of the allocation counters.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Stats
+    {
+        Uint64 allocations = 0;     //<! Number of successful allocations
+        Uint64 deallocations = 0;   //<! Number of blocks given back
+        Uint64 bytesAllocated = 0;  //<! Total bytes ever requested
+        Uint64 bytesInUse = 0;      //<! Bytes requested and not released
+        Uint64 peakBytesInUse = 0;  //<! Highest value of `bytesInUse`
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Counters behind `getStats`, updated with relaxed atomics.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<Uint64> m_allocations{0};       //<!
+    std::atomic<Uint64> m_deallocations{0};     //<!
+    std::atomic<Uint64> m_bytesAllocated{0};    //<!
+    std::atomic<Uint64> m_bytesInUse{0};        //<!
+    std::atomic<Uint64> m_peakBytesInUse{0};    //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Allocator(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Allocator(const Allocator&) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual ~Allocator(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Allocator& operator=(const Allocator&) = delete;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Allocator used by containers built without an explicit one.
+    ///
+    /// It is never destroyed, so containers in static storage and blocks
+    /// handed between threads stay valid until the process exits.
+    ///
+    /// \return The `SystemAllocator` shared by every thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD static Allocator& getDefault(void);
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Allocate `size` bytes aligned on `alignment`.
+    ///
+    /// \param size Number of bytes, may be zero
+    /// \param alignment Power of two
+    ///
+    /// \return The block, never nullptr
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD void* allocate(Uint64 size,
+        Uint64 alignment = defaultAlignment);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Give back a block obtained from `allocate`.
+    ///
+    /// \param pointer The block, nullptr is ignored
+    /// \param size The size it was allocated with
+    /// \param alignment The alignment it was allocated with
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void deallocate(void* pointer, Uint64 size,
+        Uint64 alignment = defaultAlignment);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Allocate uninitialized storage for `count` objects.
+    ///
+    /// \tparam T
+    ///
+    /// \param count
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    AXIOM_NODISCARD T* allocateArray(Uint64 count)
+    {
+        return (static_cast<T*>(allocate(count * sizeof(T), alignof(T))));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Give back storage obtained from `allocateArray`.
+    ///
+    /// \tparam T
+    ///
+    /// \param pointer
+    /// \param count
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    void deallocateArray(T* pointer, Uint64 count)
+    {
+        deallocate(pointer, count * sizeof(T), alignof(T));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Stats getStats(void) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reset every counter except `bytesInUse`, which still describes
+    /// the live blocks.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void resetStats(void);
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param size
+    /// \param alignment
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void* _allocate(Uint64 size, Uint64 alignment) = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param pointer
+    /// \param size
+    /// \param alignment
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void _deallocate(void* pointer, Uint64 size,
+        Uint64 alignment) = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Record that every live block was released at once, for
+    /// allocators that can drop all of their memory in one step.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _releaseAll(void);
+};
+
+} // namespace ax::memory
@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/memory/allocator.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::memory
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::memory
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Monotonic bump allocator, meant for memory that lives for one
+/// frame or one parse.
+///
+/// Blocks are carved out of chunks obtained from an upstream allocator,
+/// each new chunk twice as large as the previous one. Deallocation only
+/// gives memory back when the block is the last one allocated; everything
+/// else is reclaimed by `reset`, which rewinds to the first chunk in O(1)
+/// and keeps the chunks for the next cycle. Containers using the arena must
+/// not be touched after a reset, not even destroyed.
+///
+///////////////////////////////////////////////////////////////////////////////
+class ArenaAllocator : public Allocator
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 defaultChunkSize = 64 * 1024;   //<!
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Header placed at the start of every chunk.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        Chunk* next;    //<!
+        Uint64 size;    //<! Usable bytes after the header
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Allocator* m_upstream;      //<!
+    Uint64 m_chunkSize;         //<! Size of the next chunk to allocate
+    Chunk* m_head = nullptr;    //<! First chunk, where `reset` rewinds to
+    Chunk* m_chunk = nullptr;   //<! Chunk being filled
+    char* m_cursor = nullptr;   //<! Next free byte of `m_chunk`
+    char* m_end = nullptr;      //<! End of `m_chunk`
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param chunkSize Size of the first chunk, allocated lazily
+    /// \param upstream Allocator the chunks are obtained from
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit ArenaAllocator(Uint64 chunkSize = defaultChunkSize,
+        Allocator& upstream = Allocator::getDefault());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~ArenaAllocator(void) override;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop every allocation at once, keeping the chunks.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void reset(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop every allocation and give the chunks back upstream.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void release(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the number of bytes reserved from the upstream allocator.
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 getCapacity(void) const;
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param size
+    /// \param alignment
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void* _allocate(Uint64 size, Uint64 alignment) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param pointer
+    /// \param size
+    /// \param alignment
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _deallocate(void* pointer, Uint64 size, Uint64 alignment) override;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Make `chunk` the chunk being filled.
+    ///
+    /// \param chunk
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _enter(Chunk* chunk);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move to a chunk able to hold the block, reusing the chunks
+    /// kept by `reset` before asking upstream for a new one.
+    ///
+    /// \param size
+    /// \param alignment
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void* _allocateSlow(Uint64 size, Uint64 alignment);
+};
+
+} // namespace ax::memory
@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/memory/allocator.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::memory
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::memory
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Allocator of fixed-size blocks, meant for node based containers.
+///
+/// Blocks are carved out of chunks obtained from an upstream allocator and
+/// recycled through an intrusive free list, so both operations are O(1).
+/// Requests larger than the block size, or more aligned than the blocks,
+/// are forwarded upstream. Like the arena, `reset` drops every block at
+/// once and keeps the chunks.
+///
+///////////////////////////////////////////////////////////////////////////////
+class PoolAllocator : public Allocator
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 defaultBlocksPerChunk = 64; //<!
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Header placed at the start of every chunk.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        Chunk* next;    //<!
+        Uint64 size;    //<! Usable bytes after the header
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Link stored inside a released block.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct FreeBlock
+    {
+        FreeBlock* next;    //<!
+    };
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Allocator* m_upstream;          //<!
+    Uint64 m_blockSize;             //<!
+    Uint64 m_blockAlignment;        //<!
+    Uint64 m_blocksPerChunk;        //<!
+    Chunk* m_head = nullptr;        //<!
+    Chunk* m_chunk = nullptr;       //<! Chunk being carved
+    char* m_cursor = nullptr;       //<! Next never used block of `m_chunk`
+    char* m_end = nullptr;          //<!
+    FreeBlock* m_free = nullptr;    //<! Released blocks
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param blockSize Size of the blocks, rounded up to hold a pointer
+    /// \param blocksPerChunk Number of blocks reserved at once
+    /// \param upstream Allocator the chunks are obtained from
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit PoolAllocator(Uint64 blockSize,
+        Uint64 blocksPerChunk = defaultBlocksPerChunk,
+        Allocator& upstream = Allocator::getDefault());
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~PoolAllocator(void) override;
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop every block at once, keeping the chunks.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void reset(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Drop every block and give the chunks back upstream.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void release(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD Uint64 getBlockSize(void) const;
+
+protected:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param size
+    /// \param alignment
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void* _allocate(Uint64 size, Uint64 alignment) override;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param pointer
+    /// \param size
+    /// \param alignment
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _deallocate(void* pointer, Uint64 size, Uint64 alignment) override;
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Check whether a request is served by the pool or upstream.
+    ///
+    /// \param size
+    /// \param alignment
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AXIOM_NODISCARD bool _isPooled(Uint64 size, Uint64 alignment) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move to the next kept chunk, or a new one, once the current
+    /// chunk is fully carved.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void _nextChunk(void);
+};
+
+} // namespace ax::memory
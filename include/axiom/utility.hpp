@@ -32,6 +32,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 // Headers
 ///////////////////////////////////////////////////////////////////////////////
+#include <axiom/math/types.hpp>
+#include <type_traits>
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 // Namespace ax::utility
@@ -91,6 +96,148 @@ typename remove_reference<T>::type&& move(T&& arg) noexcept
     return (static_cast<typename remove_reference<T>::type&&>(arg));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \tparam T
+///
+/// \param arg
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T&& forward(typename remove_reference<T>::type& arg) noexcept
+{
+    return (static_cast<T&&>(arg));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \tparam T
+///
+/// \param arg
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T&& forward(typename remove_reference<T>::type&& arg) noexcept
+{
+    return (static_cast<T&&>(arg));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Exchange two values through a temporary, by moves.
+///
+/// \tparam T
+///
+/// \param a
+/// \param b
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void swap(T& a, T& b)
+{
+    T temp = move(a);
+    a = move(b);
+    b = move(temp);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Whether a `T` can be moved to another address with a plain
+/// memcpy, the source being left without running its destructor.
+///
+/// True for trivially copyable types. Types that only hold pointers to
+/// their own heap data, and never to themselves, can opt in by
+/// specializing this trait.
+///
+/// \tparam T
+///
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct is_trivially_relocatable
+{
+    static constexpr bool value = std::is_trivially_copyable<T>::value;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Count the number of zero bits below the lowest set bit.
+///
+/// \param mask Non-zero value.
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint32 countTrailingZeros(Uint32 mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return ((Uint32)index);
+#else
+    return ((Uint32)__builtin_ctz(mask));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Count the number of zero bits below the lowest set bit.
+///
+/// \param mask Non-zero value.
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint32 countTrailingZeros(Uint64 mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return ((Uint32)index);
+#else
+    return ((Uint32)__builtin_ctzll(mask));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Get the index of the highest set bit.
+///
+/// \param mask Non-zero value.
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint32 highestBit(Uint32 mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, mask);
+    return ((Uint32)index);
+#else
+    return (31u - (Uint32)__builtin_clz(mask));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Get the index of the highest set bit.
+///
+/// \param mask Non-zero value.
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint32 highestBit(Uint64 mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, mask);
+    return ((Uint32)index);
+#else
+    return (63u - (Uint32)__builtin_clzll(mask));
+#endif
+}
+
 } // namespace ax::utility
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,10 @@
 // Headers
 ///////////////////////////////////////////////////////////////////////////////
 #include <axiom/container/char.hpp>
+#include <axiom/utility.hpp>
+#if defined(AXIOM_SIMD_SSE2) || defined(AXIOM_SIMD_AVX2)
+    #include <immintrin.h>
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 // Forward Char from ax::container
@@ -35,103 +39,211 @@
 using ax::container::Char;
 
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD bool Char::isAlNum(char ch)
-{
-    return (isAlpha(ch) || isDigit(ch));
-}
-
+// Private SIMD helpers
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD bool Char::isAlpha(char ch)
+namespace
 {
-    return (
-        (ch >= 'a' && ch <= 'z') ||
-        (ch >= 'A' && ch <= 'Z')
-    );
-}
 
-///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD bool Char::isCntrl(char ch)
-{
-    return (
-        (ch >= 0 && ch <= 31) ||
-        ch == 127
-    );
-}
+#if defined(AXIOM_SIMD_SSE2)
 
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD bool Char::isDigit(char ch)
+inline __m128i inRange(__m128i block, char low, char high)
 {
-    return (ch >= '0' && ch <= '9');
-}
+    // Moving the range to start at -128 lets a signed comparison test it
+    __m128i shifted = _mm_add_epi8(block, _mm_set1_epi8((char)(0x80 - low)));
 
-///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD bool Char::isGraph(char ch)
-{
-    return (isPrint(ch) && !isSpace(ch));
+    return (_mm_cmplt_epi8(shifted,
+        _mm_set1_epi8((char)(0x80 + (high - low + 1)))));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD bool Char::isLower(char ch)
+inline __m128i matchClasses(__m128i block, Uint8 mask)
 {
-    return (ch >= 'a' && ch <= 'z');
+    __m128i lower = inRange(block, 'a', 'z');
+    __m128i upper = inRange(block, 'A', 'Z');
+    __m128i digit = inRange(block, '0', '9');
+    __m128i result = _mm_setzero_si128();
+
+    if (mask & Char::Lower)
+    {
+        result = _mm_or_si128(result, lower);
+    }
+    if (mask & Char::Upper)
+    {
+        result = _mm_or_si128(result, upper);
+    }
+    if (mask & (Char::Digit | Char::XDigit))
+    {
+        result = _mm_or_si128(result, digit);
+    }
+    if (mask & Char::XDigit)
+    {
+        result = _mm_or_si128(result, _mm_or_si128(
+            inRange(block, 'a', 'f'), inRange(block, 'A', 'F')));
+    }
+    if (mask & Char::Space)
+    {
+        result = _mm_or_si128(result, _mm_or_si128(
+            inRange(block, '\t', '\r'),
+            _mm_cmpeq_epi8(block, _mm_set1_epi8(' '))));
+    }
+    if (mask & Char::Punct)
+    {
+        __m128i alnum = _mm_or_si128(_mm_or_si128(lower, upper), digit);
+        result = _mm_or_si128(result,
+            _mm_andnot_si128(alnum, inRange(block, '!', '~')));
+    }
+    if (mask & Char::Cntrl)
+    {
+        result = _mm_or_si128(result, _mm_or_si128(
+            inRange(block, 0, 31),
+            _mm_cmpeq_epi8(block, _mm_set1_epi8(127))));
+    }
+    if (mask & Char::Print)
+    {
+        result = _mm_or_si128(result, inRange(block, ' ', '~'));
+    }
+    return (result);
 }
 
+#endif
+
+#if defined(AXIOM_SIMD_AVX2)
+
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD bool Char::isPrint(char ch)
+inline __m256i inRange(__m256i block, char low, char high)
 {
-    return (ch >= 32 && ch <= 126);
+    __m256i shifted = _mm256_add_epi8(block,
+        _mm256_set1_epi8((char)(0x80 - low)));
+
+    return (_mm256_cmpgt_epi8(
+        _mm256_set1_epi8((char)(0x80 + (high - low + 1))), shifted));
 }
 
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD bool Char::isPunct(char ch)
+void convertCase(char* data, Uint64 length, char low, char high)
 {
-    return (
-        ch == '!' ||
-        (ch >= '"' && ch <= '&') ||
-        (ch >= '(' && ch <= '/') ||
-        (ch >= ':' && ch <= '?') ||
-        (ch >= '[' && ch <= '`') ||
-        (ch >= '{' && ch <= '~')
-    );
+    Uint64 i = 0;
+
+    // Letters of [low, high] flip their case bit, 0x20
+#if defined(AXIOM_SIMD_AVX2)
+    const __m256i flip32 = _mm256_set1_epi8(0x20);
+    for (; i + 32 <= length; i += 32)
+    {
+        __m256i* block = (__m256i*)(data + i);
+        __m256i value = _mm256_loadu_si256(block);
+        _mm256_storeu_si256(block, _mm256_xor_si256(value,
+            _mm256_and_si256(inRange(value, low, high), flip32)));
+    }
+#endif
+#if defined(AXIOM_SIMD_SSE2)
+    const __m128i flip16 = _mm_set1_epi8(0x20);
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i* block = (__m128i*)(data + i);
+        __m128i value = _mm_loadu_si128(block);
+        _mm_storeu_si128(block, _mm_xor_si128(value,
+            _mm_and_si128(inRange(value, low, high), flip16)));
+    }
+#endif
+    for (; i < length; i++)
+    {
+        if (data[i] >= low && data[i] <= high)
+        {
+            data[i] ^= 0x20;
+        }
+    }
 }
 
+} // namespace
+
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD bool Char::isSpace(char ch)
+void Char::toLowerCase(char* data, Uint64 length)
 {
-    return (
-        ch == '\t' ||
-        ch == '\n' ||
-        ch == '\v' ||
-        ch == '\f' ||
-        ch == '\r' ||
-        ch == ' '
-    );
+    convertCase(data, length, 'A', 'Z');
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD bool Char::isUpper(char ch)
+void Char::toUpperCase(char* data, Uint64 length)
 {
-    return (ch >= 'A' && ch <= 'Z');
+    convertCase(data, length, 'a', 'z');
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD bool Char::isXDigit(char ch)
+AXIOM_NODISCARD Uint64 Char::count(const char* data, Uint64 length,
+    Uint8 mask)
 {
-    return (
-        (ch >= '0' && ch <= '9') ||
-        (ch >= 'a' && ch <= 'f') ||
-        (ch >= 'A' && ch <= 'F')
-    );
+    Uint64 total = 0;
+    Uint64 i = 0;
+
+#if defined(AXIOM_SIMD_SSE2)
+    // Matches count down from zero in each byte lane, summed up before any
+    // lane can wrap
+    while (i + 16 <= length)
+    {
+        __m128i lanes = _mm_setzero_si128();
+        for (int block = 0; block < 255 && i + 16 <= length; block++)
+        {
+            lanes = _mm_sub_epi8(lanes, matchClasses(
+                _mm_loadu_si128((const __m128i*)(data + i)), mask));
+            i += 16;
+        }
+        __m128i sums = _mm_sad_epu8(lanes, _mm_setzero_si128());
+        total += (Uint64)_mm_cvtsi128_si32(sums) +
+            (Uint64)_mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+    }
+#endif
+    for (; i < length; i++)
+    {
+        total += is(data[i], mask);
+    }
+    return (total);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD char Char::toLower(char ch)
+AXIOM_NODISCARD Uint64 Char::span(const char* data, Uint64 length,
+    Uint8 mask)
 {
-    return (isLower(ch) ? (ch + 32) : ch);
+    Uint64 i = 0;
+
+#if defined(AXIOM_SIMD_SSE2)
+    for (; i + 16 <= length; i += 16)
+    {
+        Uint32 matches = (Uint32)_mm_movemask_epi8(matchClasses(
+            _mm_loadu_si128((const __m128i*)(data + i)), mask));
+        if (matches != 0xFFFF)
+        {
+            return (i + axu::countTrailingZeros(~matches));
+        }
+    }
+#endif
+    for (; i < length && is(data[i], mask); i++)
+    {
+    }
+    return (i);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD char Char::toUpper(char ch)
+AXIOM_NODISCARD Uint64 Char::spanNot(const char* data, Uint64 length,
+    Uint8 mask)
 {
-    return (isUpper(ch) ? (ch - 32) : ch);
+    Uint64 i = 0;
+
+#if defined(AXIOM_SIMD_SSE2)
+    for (; i + 16 <= length; i += 16)
+    {
+        Uint32 matches = (Uint32)_mm_movemask_epi8(matchClasses(
+            _mm_loadu_si128((const __m128i*)(data + i)), mask));
+        if (matches != 0)
+        {
+            return (i + axu::countTrailingZeros(matches));
+        }
+    }
+#endif
+    for (; i < length && !is(data[i], mask); i++)
+    {
+    }
+    return (i);
 }
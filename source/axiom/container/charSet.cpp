@@ -0,0 +1,333 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/container/charSet.hpp>
+#include <axiom/container/cstring.hpp>
+#include <axiom/utility.hpp>
+#include <cstring>
+#if defined(AXIOM_SIMD_SSE2) || defined(AXIOM_SIMD_AVX2)
+    #include <immintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward CharSet and CString from ax::container
+///////////////////////////////////////////////////////////////////////////////
+using ax::container::CharSet;
+using ax::container::CString;
+
+///////////////////////////////////////////////////////////////////////////////
+CharSet::CharSet(void) {}
+
+///////////////////////////////////////////////////////////////////////////////
+CharSet::CharSet(const char* chars)
+{
+    insert(chars, CString::strlen(chars));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+CharSet::CharSet(const char* chars, Uint64 length)
+{
+    insert(chars, length);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const CharSet& CharSet::whitespace(void)
+{
+    static const CharSet set(" \t\n\v\f\r");
+
+    return (set);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CharSet::insert(char ch)
+{
+    Uint8 byte = (Uint8)ch;
+
+    if (contains(ch))
+    {
+        return;
+    }
+    m_bitmap[byte >> 6] |= (Uint64)1 << (byte & 63);
+    if (byte < 0x80)
+    {
+        m_lowRows[byte & 0x0F] |= (Uint8)(1 << (byte >> 4));
+    }
+    else
+    {
+        m_highRows[byte & 0x0F] |= (Uint8)(1 << ((byte >> 4) - 8));
+    }
+    for (Uint64 i = m_size; i < maxListed; i++)
+    {
+        std::memset(m_members[i], ch, sizeof(m_members[i]));
+    }
+    m_size++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CharSet::insert(const char* chars, Uint64 length)
+{
+    for (Uint64 i = 0; i < length; i++)
+    {
+        insert(chars[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool CharSet::contains(char ch) const
+{
+    Uint8 byte = (Uint8)ch;
+
+    return ((m_bitmap[byte >> 6] >> (byte & 63)) & 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 CharSet::size(void) const
+{
+    return (m_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 CharSet::findFirstIn(const char* data, Uint64 length,
+    Uint64 position) const
+{
+    return (_findFirst(data, length, position, true));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 CharSet::findLastIn(const char* data, Uint64 length,
+    Uint64 position) const
+{
+    return (_findLast(data, length, position, true));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 CharSet::findFirstNotIn(const char* data,
+    Uint64 length, Uint64 position) const
+{
+    return (_findFirst(data, length, position, false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 CharSet::findLastNotIn(const char* data,
+    Uint64 length, Uint64 position) const
+{
+    return (_findLast(data, length, position, false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline bool CharSet::_isVectorized(void) const
+{
+#if defined(AXIOM_SIMD_SSSE3)
+    return (true);
+#else
+    return (m_size > 0 && m_size <= maxListed);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Uint32 CharSet::_match16(const char* data) const
+{
+#if defined(AXIOM_SIMD_SSSE3)
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+        1, 2, 4, 8, 16, 32, 64, -128);
+    __m128i bytes = _mm_loadu_si128((const __m128i*)data);
+    __m128i low = _mm_and_si128(bytes, nibble);
+    __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble);
+    __m128i lowRows = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i*)m_lowRows), low);
+    __m128i highRows = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i*)m_highRows), low);
+    __m128i isHigh = _mm_cmpgt_epi8(high, _mm_set1_epi8(7));
+    __m128i rows = _mm_or_si128(_mm_andnot_si128(isHigh, lowRows),
+        _mm_and_si128(isHigh, highRows));
+    __m128i bit = _mm_shuffle_epi8(bits, high);
+
+    return ((Uint32)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_and_si128(rows, bit), bit)));
+#elif defined(AXIOM_SIMD_SSE2)
+    const __m128i* members = (const __m128i*)m_members;
+    __m128i bytes = _mm_loadu_si128((const __m128i*)data);
+    __m128i hits = _mm_or_si128(
+        _mm_or_si128(
+            _mm_or_si128(
+                _mm_cmpeq_epi8(bytes, _mm_load_si128(members + 0)),
+                _mm_cmpeq_epi8(bytes, _mm_load_si128(members + 1))),
+            _mm_or_si128(
+                _mm_cmpeq_epi8(bytes, _mm_load_si128(members + 2)),
+                _mm_cmpeq_epi8(bytes, _mm_load_si128(members + 3)))),
+        _mm_or_si128(
+            _mm_or_si128(
+                _mm_cmpeq_epi8(bytes, _mm_load_si128(members + 4)),
+                _mm_cmpeq_epi8(bytes, _mm_load_si128(members + 5))),
+            _mm_or_si128(
+                _mm_cmpeq_epi8(bytes, _mm_load_si128(members + 6)),
+                _mm_cmpeq_epi8(bytes, _mm_load_si128(members + 7)))));
+
+    return ((Uint32)_mm_movemask_epi8(hits));
+#else
+    Uint32 mask = 0;
+
+    for (Uint32 i = 0; i < 16; i++)
+    {
+        mask |= (Uint32)contains(data[i]) << i;
+    }
+    return (mask);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Uint32 CharSet::_match32(const char* data) const
+{
+#if defined(AXIOM_SIMD_AVX2)
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+        1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+        1, 2, 4, 8, 16, 32, 64, -128);
+    __m256i bytes = _mm256_loadu_si256((const __m256i*)data);
+    __m256i low = _mm256_and_si256(bytes, nibble);
+    __m256i high = _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibble);
+    __m256i lowRows = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i*)m_lowRows)), low);
+    __m256i highRows = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i*)m_highRows)), low);
+    __m256i isHigh = _mm256_cmpgt_epi8(high, _mm256_set1_epi8(7));
+    __m256i rows = _mm256_blendv_epi8(lowRows, highRows, isHigh);
+    __m256i bit = _mm256_shuffle_epi8(bits, high);
+
+    return ((Uint32)_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(_mm256_and_si256(rows, bit), bit)));
+#else
+    return (_match16(data) | (_match16(data + 16) << 16));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 CharSet::_findFirst(const char* data, Uint64 length, Uint64 position,
+    bool isMember) const
+{
+    Uint64 i = position;
+
+    if (position >= length)
+    {
+        return (npos);
+    }
+    for (Uint64 end = i + scalarPrefix; i < end && i < length; i++)
+    {
+        if (contains(data[i]) == isMember)
+        {
+            return (i);
+        }
+    }
+#if defined(AXIOM_SIMD_AVX2) || defined(AXIOM_SIMD_SSE2)
+    const Uint32 flip = isMember ? 0 : 0xFFFFFFFF;
+#endif
+#if defined(AXIOM_SIMD_AVX2)
+    for (; i + 32 <= length; i += 32)
+    {
+        Uint32 mask = _match32(data + i) ^ flip;
+        if (mask)
+        {
+            return (i + axu::countTrailingZeros(mask));
+        }
+    }
+#endif
+#if defined(AXIOM_SIMD_SSE2)
+    if (_isVectorized())
+    {
+        for (; i + 16 <= length; i += 16)
+        {
+            Uint32 mask = (_match16(data + i) ^ flip) & 0xFFFF;
+            if (mask)
+            {
+                return (i + axu::countTrailingZeros(mask));
+            }
+        }
+    }
+#endif
+    for (; i < length; i++)
+    {
+        if (contains(data[i]) == isMember)
+        {
+            return (i);
+        }
+    }
+    return (npos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 CharSet::_findLast(const char* data, Uint64 length, Uint64 position,
+    bool isMember) const
+{
+    Uint64 end = position < length ? position + 1 : length;
+
+    for (Uint64 stop = end > scalarPrefix ? end - scalarPrefix : 0;
+        end > stop; end--)
+    {
+        if (contains(data[end - 1]) == isMember)
+        {
+            return (end - 1);
+        }
+    }
+#if defined(AXIOM_SIMD_AVX2) || defined(AXIOM_SIMD_SSE2)
+    const Uint32 flip = isMember ? 0 : 0xFFFFFFFF;
+#endif
+#if defined(AXIOM_SIMD_AVX2)
+    for (; end >= 32; end -= 32)
+    {
+        Uint32 mask = _match32(data + end - 32) ^ flip;
+        if (mask)
+        {
+            return (end - 32 + axu::highestBit(mask));
+        }
+    }
+#endif
+#if defined(AXIOM_SIMD_SSE2)
+    if (_isVectorized())
+    {
+        for (; end >= 16; end -= 16)
+        {
+            Uint32 mask = (_match16(data + end - 16) ^ flip) & 0xFFFF;
+            if (mask)
+            {
+                return (end - 16 + axu::highestBit(mask));
+            }
+        }
+    }
+#endif
+    while (end > 0)
+    {
+        end--;
+        if (contains(data[end]) == isMember)
+        {
+            return (end);
+        }
+    }
+    return (npos);
+}
@@ -28,6 +28,9 @@
 // Headers
 ///////////////////////////////////////////////////////////////////////////////
 #include <axiom/container/cstring.hpp>
+#include <axiom/utility.hpp>
+#include <cstring>
+#include "../detail/cpu.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Forward CString from ax::container
@@ -35,77 +38,903 @@
 using ax::container::CString;
 
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD int CString::_strlenCompare(Uint64 longword, const char* cp)
+// Private kernels and dispatch table
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+///////////////////////////////////////////////////////////////////////////////
+struct Kernels
+{
+    Uint64 (*strlen)(const char*);
+    int (*strcmp)(const char*, const char*);
+    int (*strncmp)(const char*, const char*, Uint64);
+    const void* (*memchr)(const void*, int, Uint64);
+    const void* (*memrchr)(const void*, int, Uint64);
+    int (*memcmp)(const void*, const void*, Uint64);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+inline int order(unsigned char lhs, unsigned char rhs)
+{
+    return (lhs == rhs ? 0 : (lhs < rhs ? -1 : 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 strlenScalar(const char* str)
 {
-    int max = 4;
+    const Uint64 lomagic = 0x0101010101010101ULL;
+    const Uint64 himagic = 0x8080808080808080ULL;
+    const char* ptr = str;
 
-    if (sizeof(longword) > 4)
+    for (; ((Uint64)ptr & (sizeof(Uint64) - 1)) != 0; ++ptr)
     {
-        max = 8;
+        if (*ptr == '\0')
+        {
+            return (ptr - str);
+        }
     }
-    for (int i = 0; i < max; i++)
+    for (;; ptr += sizeof(Uint64))
     {
-        if (cp[i] == 0)
+        Uint64 word;
+        std::memcpy(&word, ptr, sizeof(word));
+        Uint64 zeros = (word - lomagic) & ~word & himagic;
+        if (zeros == 0)
+        {
+            continue;
+        }
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        // Borrows only flag bytes above a zero byte, so the lowest flag is
+        // exact and no byte needs to be scanned again
+        return (ptr - str + axu::countTrailingZeros(zeros) / 8);
+#else
+        for (Uint64 i = 0;; i++)
         {
-            return (i);
+            if (ptr[i] == '\0')
+            {
+                return (ptr - str + i);
+            }
         }
+#endif
     }
-    return (-1);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD Uint64 CString::strlen(const char* str)
+int strcmpScalar(const char* lhs, const char* rhs)
 {
-    const char* ptr;
-    const Uint64* longwordPtr;
-    Uint64 longword, himagic, lomagic;
+    for (Uint64 i = 0;; i++)
+    {
+        if (lhs[i] != rhs[i])
+        {
+            return (order(lhs[i], rhs[i]));
+        }
+        if (lhs[i] == '\0')
+        {
+            return (0);
+        }
+    }
+}
 
-    for (ptr = str; ((Uint64)ptr & (sizeof(longword) - 1)) != 0; ++ptr)
+///////////////////////////////////////////////////////////////////////////////
+int strncmpScalar(const char* lhs, const char* rhs, Uint64 count)
+{
+    for (Uint64 i = 0; i < count; i++)
     {
-        if (*ptr == '\0')
+        if (lhs[i] != rhs[i])
         {
-            return (ptr - str);
+            return (order(lhs[i], rhs[i]));
+        }
+        if (lhs[i] == '\0')
+        {
+            return (0);
+        }
+    }
+    return (0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const void* memchrScalar(const void* data, int ch, Uint64 length)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+    for (Uint64 i = 0; i < length; i++)
+    {
+        if (bytes[i] == (unsigned char)ch)
+        {
+            return (bytes + i);
+        }
+    }
+    return (nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const void* memrchrScalar(const void* data, int ch, Uint64 length)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+    while (length > 0)
+    {
+        if (bytes[--length] == (unsigned char)ch)
+        {
+            return (bytes + length);
+        }
+    }
+    return (nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int memcmpScalar(const void* lhs, const void* rhs, Uint64 length)
+{
+    const unsigned char* a = static_cast<const unsigned char*>(lhs);
+    const unsigned char* b = static_cast<const unsigned char*>(rhs);
+
+    for (Uint64 i = 0; i < length; i++)
+    {
+        if (a[i] != b[i])
+        {
+            return (order(a[i], b[i]));
+        }
+    }
+    return (0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr Kernels scalarKernels = {&strlenScalar, &strcmpScalar,
+    &strncmpScalar, &memchrScalar, &memrchrScalar, &memcmpScalar};
+
+#if defined(AXIOM_CPU_X86)
+
+///////////////////////////////////////////////////////////////////////////////
+inline bool nearPageEnd(const char* ptr, Uint64 width)
+{
+    return (((Uint64)ptr & 4095) > 4096 - width);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Uint64 pageLeft(const char* lhs, const char* rhs)
+{
+    Uint64 left = 4096 - ((Uint64)lhs & 4095);
+    Uint64 right = 4096 - ((Uint64)rhs & 4095);
+
+    return (left < right ? left : right);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline Uint64 movemask64(Uint32 a, Uint32 b, Uint32 c, Uint32 d)
+{
+    return ((Uint64)a | ((Uint64)b << 16) | ((Uint64)c << 32) |
+        ((Uint64)d << 48));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int memcmpSmall(const unsigned char* a, const unsigned char* b, Uint64 length)
+{
+    // Two overlapping words cover 8 to 15 bytes, the lowest differing bit
+    // giving the first differing byte on little-endian x86
+    if (length >= 8)
+    {
+        Uint64 x, y;
+        std::memcpy(&x, a, 8);
+        std::memcpy(&y, b, 8);
+        Uint64 offset = 0;
+        if (x == y)
+        {
+            offset = length - 8;
+            std::memcpy(&x, a + offset, 8);
+            std::memcpy(&y, b + offset, 8);
+            if (x == y)
+            {
+                return (0);
+            }
         }
+        Uint64 index = offset + axu::countTrailingZeros(x ^ y) / 8;
+        return (order(a[index], b[index]));
     }
+    if (length >= 4)
+    {
+        Uint32 x, y;
+        std::memcpy(&x, a, 4);
+        std::memcpy(&y, b, 4);
+        Uint64 offset = 0;
+        if (x == y)
+        {
+            offset = length - 4;
+            std::memcpy(&x, a + offset, 4);
+            std::memcpy(&y, b + offset, 4);
+            if (x == y)
+            {
+                return (0);
+            }
+        }
+        Uint64 index = offset + axu::countTrailingZeros(x ^ y) / 8;
+        return (order(a[index], b[index]));
+    }
+    for (Uint64 i = 0; i < length; i++)
+    {
+        if (a[i] != b[i])
+        {
+            return (order(a[i], b[i]));
+        }
+    }
+    return (0);
+}
 
-    longwordPtr = (Uint64*)ptr;
-    himagic = 0x80808080L;
-    lomagic = 0x01010101L;
+// SECTION - SSE2 kernels
 
-    if (sizeof(longword) > 4)
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("sse2") Uint64 strlenSse2(const char* str)
+{
+    const __m128i zero = _mm_setzero_si128();
+    Uint64 offset = (Uint64)str & 15;
+    const __m128i* block = (const __m128i*)(str - offset);
+
+    // Aligned loads never cross a page, the bytes before `str` are masked
+    Uint32 mask = (Uint32)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_load_si128(block), zero)) >> offset;
+    if (mask)
     {
-        himagic = ((himagic << 16) << 16) | himagic;
-        lomagic = ((lomagic << 16) << 16) | lomagic;
+        return (axu::countTrailingZeros(mask));
     }
-    for (;;)
+    for (block++; ((Uint64)block & 63) != 0; block++)
     {
-        longword = *longwordPtr++;
-        if (((longword - lomagic) & ~longword & himagic) == 0)
+        mask = (Uint32)_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_load_si128(block), zero));
+        if (mask)
         {
+            return ((const char*)block - str + axu::countTrailingZeros(mask));
+        }
+    }
+    for (;; block += 4)
+    {
+        __m128i a = _mm_load_si128(block);
+        __m128i b = _mm_load_si128(block + 1);
+        __m128i c = _mm_load_si128(block + 2);
+        __m128i d = _mm_load_si128(block + 3);
+        __m128i low = _mm_min_epu8(_mm_min_epu8(a, b), _mm_min_epu8(c, d));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(low, zero)))
+        {
+            Uint64 mask64 = movemask64(
+                (Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(a, zero)),
+                (Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(b, zero)),
+                (Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(c, zero)),
+                (Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(d, zero)));
+            return ((const char*)block - str +
+                axu::countTrailingZeros(mask64));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("sse2") Uint32 strcmpMaskSse2(const char* lhs, const char* rhs)
+{
+    __m128i a = _mm_loadu_si128((const __m128i*)lhs);
+    __m128i b = _mm_loadu_si128((const __m128i*)rhs);
+
+    // Equal bytes keep their value, different ones become zero, so a single
+    // comparison finds both the first difference and the terminator
+    __m128i kept = _mm_min_epu8(a, _mm_cmpeq_epi8(a, b));
+    return ((Uint32)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(kept, _mm_setzero_si128())));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("sse2") int strncmpSse2(const char* lhs, const char* rhs,
+    Uint64 count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    Uint64 i = 0;
+
+    while (count - i >= 16)
+    {
+        // Four blocks at once while far from a page end, the block holding
+        // the difference or the terminator is then found one at a time
+        if (count - i >= 64 && !nearPageEnd(lhs + i, 64) &&
+            !nearPageEnd(rhs + i, 64))
+        {
+            const __m128i* a = (const __m128i*)(lhs + i);
+            const __m128i* b = (const __m128i*)(rhs + i);
+            __m128i kept[4];
+            for (int j = 0; j < 4; j++)
+            {
+                __m128i x = _mm_loadu_si128(a + j);
+                kept[j] = _mm_min_epu8(x, _mm_cmpeq_epi8(x,
+                    _mm_loadu_si128(b + j)));
+            }
+            __m128i low = _mm_min_epu8(_mm_min_epu8(kept[0], kept[1]),
+                _mm_min_epu8(kept[2], kept[3]));
+            if (!_mm_movemask_epi8(_mm_cmpeq_epi8(low, zero)))
+            {
+                i += 64;
+                continue;
+            }
+        }
+        if (nearPageEnd(lhs + i, 16) || nearPageEnd(rhs + i, 16))
+        {
+            // One byte at a time up to the page end, the next loads then
+            // start on the new page
+            for (Uint64 end = i + pageLeft(lhs + i, rhs + i); i < end; i++)
+            {
+                if (lhs[i] != rhs[i] || lhs[i] == '\0')
+                {
+                    return (order(lhs[i], rhs[i]));
+                }
+            }
             continue;
         }
-        const char* cp = (const char*)(longwordPtr - 1);
-        int result = _strlenCompare(longword, cp);
-        if (result != -1)
+        Uint32 mask = strcmpMaskSse2(lhs + i, rhs + i);
+        if (mask)
         {
-            return (cp - str + result);
+            i += axu::countTrailingZeros(mask);
+            return (order(lhs[i], rhs[i]));
         }
+        i += 16;
     }
+    return (strncmpScalar(lhs + i, rhs + i, count - i));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-AXIOM_NODISCARD int CString::strcmp(const char* lhs, const char* rhs)
+AXIOM_TARGET("sse2") int strcmpSse2(const char* lhs, const char* rhs)
 {
-    CHECK(lhs && rhs);
-    for (Uint64 i = 0;; i++)
+    return (strncmpSse2(lhs, rhs, (Uint64)-1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("sse2") const void* memchrSse2(const void* data, int ch,
+    Uint64 length)
+{
+    const char* bytes = static_cast<const char*>(data);
+    const __m128i pattern = _mm_set1_epi8((char)ch);
+    Uint64 i = 0;
+
+    for (; i + 64 <= length; i += 64)
     {
-        if (lhs[i] != rhs[i])
+        const __m128i* block = (const __m128i*)(bytes + i);
+        __m128i a = _mm_cmpeq_epi8(_mm_loadu_si128(block), pattern);
+        __m128i b = _mm_cmpeq_epi8(_mm_loadu_si128(block + 1), pattern);
+        __m128i c = _mm_cmpeq_epi8(_mm_loadu_si128(block + 2), pattern);
+        __m128i d = _mm_cmpeq_epi8(_mm_loadu_si128(block + 3), pattern);
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b),
+            _mm_or_si128(c, d))))
         {
-            return (lhs[i] < rhs[i] ? -1 : 1);
+            Uint64 mask = movemask64((Uint32)_mm_movemask_epi8(a),
+                (Uint32)_mm_movemask_epi8(b), (Uint32)_mm_movemask_epi8(c),
+                (Uint32)_mm_movemask_epi8(d));
+            return (bytes + i + axu::countTrailingZeros(mask));
         }
-        if (lhs[i] == '\0')
+    }
+    for (; i + 16 <= length; i += 16)
+    {
+        Uint32 mask = (Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_loadu_si128((const __m128i*)(bytes + i)), pattern));
+        if (mask)
+        {
+            return (bytes + i + axu::countTrailingZeros(mask));
+        }
+    }
+    if (i == length)
+    {
+        return (nullptr);
+    }
+    if (length < 16)
+    {
+        return (memchrScalar(bytes, ch, length));
+    }
+    // The last block overlaps bytes already scanned, which did not match
+    i = length - 16;
+    Uint32 mask = (Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(
+        _mm_loadu_si128((const __m128i*)(bytes + i)), pattern));
+    return (mask ? bytes + i + axu::countTrailingZeros(mask) : nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("sse2") const void* memrchrSse2(const void* data, int ch,
+    Uint64 length)
+{
+    const char* bytes = static_cast<const char*>(data);
+    const __m128i pattern = _mm_set1_epi8((char)ch);
+    Uint64 end = length;
+
+    for (; end >= 64; end -= 64)
+    {
+        const __m128i* block = (const __m128i*)(bytes + end - 64);
+        __m128i a = _mm_cmpeq_epi8(_mm_loadu_si128(block), pattern);
+        __m128i b = _mm_cmpeq_epi8(_mm_loadu_si128(block + 1), pattern);
+        __m128i c = _mm_cmpeq_epi8(_mm_loadu_si128(block + 2), pattern);
+        __m128i d = _mm_cmpeq_epi8(_mm_loadu_si128(block + 3), pattern);
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b),
+            _mm_or_si128(c, d))))
+        {
+            Uint64 mask = movemask64((Uint32)_mm_movemask_epi8(a),
+                (Uint32)_mm_movemask_epi8(b), (Uint32)_mm_movemask_epi8(c),
+                (Uint32)_mm_movemask_epi8(d));
+            return (bytes + end - 64 + axu::highestBit(mask));
+        }
+    }
+    for (; end >= 16; end -= 16)
+    {
+        Uint32 mask = (Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_loadu_si128((const __m128i*)(bytes + end - 16)), pattern));
+        if (mask)
+        {
+            return (bytes + end - 16 + axu::highestBit(mask));
+        }
+    }
+    if (end == 0)
+    {
+        return (nullptr);
+    }
+    if (length < 16)
+    {
+        return (memrchrScalar(bytes, ch, length));
+    }
+    Uint32 mask = (Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(
+        _mm_loadu_si128((const __m128i*)bytes), pattern));
+    return (mask ? bytes + axu::highestBit(mask) : nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("sse2") int memcmpSse2(const void* lhs, const void* rhs,
+    Uint64 length)
+{
+    const unsigned char* a = static_cast<const unsigned char*>(lhs);
+    const unsigned char* b = static_cast<const unsigned char*>(rhs);
+    Uint64 i = 0;
+
+    if (length < 16)
+    {
+        return (memcmpSmall(a, b, length));
+    }
+    for (; i + 64 <= length; i += 64)
+    {
+        const __m128i* x = (const __m128i*)(a + i);
+        const __m128i* y = (const __m128i*)(b + i);
+        __m128i equal = _mm_and_si128(
+            _mm_and_si128(
+                _mm_cmpeq_epi8(_mm_loadu_si128(x), _mm_loadu_si128(y)),
+                _mm_cmpeq_epi8(_mm_loadu_si128(x + 1),
+                    _mm_loadu_si128(y + 1))),
+            _mm_and_si128(
+                _mm_cmpeq_epi8(_mm_loadu_si128(x + 2),
+                    _mm_loadu_si128(y + 2)),
+                _mm_cmpeq_epi8(_mm_loadu_si128(x + 3),
+                    _mm_loadu_si128(y + 3))));
+        if (_mm_movemask_epi8(equal) != 0xFFFF)
+        {
+            break;
+        }
+    }
+    for (;; i += 16)
+    {
+        if (i + 16 > length)
+        {
+            if (i == length)
+            {
+                return (0);
+            }
+            i = length - 16;
+        }
+        Uint32 equal = (Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_loadu_si128((const __m128i*)(a + i)),
+            _mm_loadu_si128((const __m128i*)(b + i))));
+        if (equal != 0xFFFF)
+        {
+            i += axu::countTrailingZeros(~equal);
+            return (order(a[i], b[i]));
+        }
+        if (i + 16 == length)
         {
             return (0);
         }
     }
 }
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr Kernels sse2Kernels = {&strlenSse2, &strcmpSse2, &strncmpSse2,
+    &memchrSse2, &memrchrSse2, &memcmpSse2};
+
+// !SECTION
+
+// SECTION - AVX2 kernels
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") Uint64 strlenAvx2(const char* str)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    Uint64 offset = (Uint64)str & 31;
+    const __m256i* block = (const __m256i*)(str - offset);
+
+    Uint32 mask = (Uint32)_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(_mm256_load_si256(block), zero)) >> offset;
+    if (mask)
+    {
+        return (axu::countTrailingZeros(mask));
+    }
+    for (block++; ((Uint64)block & 127) != 0; block++)
+    {
+        mask = (Uint32)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_load_si256(block), zero));
+        if (mask)
+        {
+            return ((const char*)block - str + axu::countTrailingZeros(mask));
+        }
+    }
+    for (;; block += 4)
+    {
+        __m256i a = _mm256_load_si256(block);
+        __m256i b = _mm256_load_si256(block + 1);
+        __m256i c = _mm256_load_si256(block + 2);
+        __m256i d = _mm256_load_si256(block + 3);
+        __m256i low = _mm256_min_epu8(_mm256_min_epu8(a, b),
+            _mm256_min_epu8(c, d));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, zero)))
+        {
+            for (;; block++)
+            {
+                mask = (Uint32)_mm256_movemask_epi8(
+                    _mm256_cmpeq_epi8(_mm256_load_si256(block), zero));
+                if (mask)
+                {
+                    return ((const char*)block - str +
+                        axu::countTrailingZeros(mask));
+                }
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") int strncmpAvx2(const char* lhs, const char* rhs,
+    Uint64 count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    Uint64 i = 0;
+
+    while (count - i >= 32)
+    {
+        if (count - i >= 128 && !nearPageEnd(lhs + i, 128) &&
+            !nearPageEnd(rhs + i, 128))
+        {
+            const __m256i* a = (const __m256i*)(lhs + i);
+            const __m256i* b = (const __m256i*)(rhs + i);
+            __m256i kept[4];
+            for (int j = 0; j < 4; j++)
+            {
+                __m256i x = _mm256_loadu_si256(a + j);
+                kept[j] = _mm256_min_epu8(x, _mm256_cmpeq_epi8(x,
+                    _mm256_loadu_si256(b + j)));
+            }
+            __m256i low = _mm256_min_epu8(_mm256_min_epu8(kept[0], kept[1]),
+                _mm256_min_epu8(kept[2], kept[3]));
+            if (!_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, zero)))
+            {
+                i += 128;
+                continue;
+            }
+        }
+        if (nearPageEnd(lhs + i, 32) || nearPageEnd(rhs + i, 32))
+        {
+            if (pageLeft(lhs + i, rhs + i) >= 16)
+            {
+                Uint32 mask = strcmpMaskSse2(lhs + i, rhs + i);
+                if (mask)
+                {
+                    i += axu::countTrailingZeros(mask);
+                    return (order(lhs[i], rhs[i]));
+                }
+                i += 16;
+                continue;
+            }
+            for (Uint64 end = i + pageLeft(lhs + i, rhs + i); i < end; i++)
+            {
+                if (lhs[i] != rhs[i] || lhs[i] == '\0')
+                {
+                    return (order(lhs[i], rhs[i]));
+                }
+            }
+            continue;
+        }
+        __m256i a = _mm256_loadu_si256((const __m256i*)(lhs + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(rhs + i));
+        __m256i kept = _mm256_min_epu8(a, _mm256_cmpeq_epi8(a, b));
+        Uint32 mask = (Uint32)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(kept, zero));
+        if (mask)
+        {
+            i += axu::countTrailingZeros(mask);
+            return (order(lhs[i], rhs[i]));
+        }
+        i += 32;
+    }
+    return (strncmpSse2(lhs + i, rhs + i, count - i));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") int strcmpAvx2(const char* lhs, const char* rhs)
+{
+    return (strncmpAvx2(lhs, rhs, (Uint64)-1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") const void* memchrAvx2(const void* data, int ch,
+    Uint64 length)
+{
+    const char* bytes = static_cast<const char*>(data);
+    const __m256i pattern = _mm256_set1_epi8((char)ch);
+    Uint64 i = 0;
+
+    if (length < 32)
+    {
+        return (memchrSse2(data, ch, length));
+    }
+    for (; i + 128 <= length; i += 128)
+    {
+        const __m256i* block = (const __m256i*)(bytes + i);
+        __m256i a = _mm256_cmpeq_epi8(_mm256_loadu_si256(block), pattern);
+        __m256i b = _mm256_cmpeq_epi8(_mm256_loadu_si256(block + 1),
+            pattern);
+        __m256i c = _mm256_cmpeq_epi8(_mm256_loadu_si256(block + 2),
+            pattern);
+        __m256i d = _mm256_cmpeq_epi8(_mm256_loadu_si256(block + 3),
+            pattern);
+        if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(a, b),
+            _mm256_or_si256(c, d))))
+        {
+            Uint64 low = (Uint64)(Uint32)_mm256_movemask_epi8(a) |
+                ((Uint64)(Uint32)_mm256_movemask_epi8(b) << 32);
+            if (low)
+            {
+                return (bytes + i + axu::countTrailingZeros(low));
+            }
+            Uint64 high = (Uint64)(Uint32)_mm256_movemask_epi8(c) |
+                ((Uint64)(Uint32)_mm256_movemask_epi8(d) << 32);
+            return (bytes + i + 64 + axu::countTrailingZeros(high));
+        }
+    }
+    for (; i + 32 <= length; i += 32)
+    {
+        Uint32 mask = (Uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            _mm256_loadu_si256((const __m256i*)(bytes + i)), pattern));
+        if (mask)
+        {
+            return (bytes + i + axu::countTrailingZeros(mask));
+        }
+    }
+    if (i == length)
+    {
+        return (nullptr);
+    }
+    i = length - 32;
+    Uint32 mask = (Uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+        _mm256_loadu_si256((const __m256i*)(bytes + i)), pattern));
+    return (mask ? bytes + i + axu::countTrailingZeros(mask) : nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") const void* memrchrAvx2(const void* data, int ch,
+    Uint64 length)
+{
+    const char* bytes = static_cast<const char*>(data);
+    const __m256i pattern = _mm256_set1_epi8((char)ch);
+    Uint64 end = length;
+
+    if (length < 32)
+    {
+        return (memrchrSse2(data, ch, length));
+    }
+    for (; end >= 128; end -= 128)
+    {
+        const __m256i* block = (const __m256i*)(bytes + end - 128);
+        __m256i a = _mm256_cmpeq_epi8(_mm256_loadu_si256(block), pattern);
+        __m256i b = _mm256_cmpeq_epi8(_mm256_loadu_si256(block + 1),
+            pattern);
+        __m256i c = _mm256_cmpeq_epi8(_mm256_loadu_si256(block + 2),
+            pattern);
+        __m256i d = _mm256_cmpeq_epi8(_mm256_loadu_si256(block + 3),
+            pattern);
+        if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(a, b),
+            _mm256_or_si256(c, d))))
+        {
+            Uint64 high = (Uint64)(Uint32)_mm256_movemask_epi8(c) |
+                ((Uint64)(Uint32)_mm256_movemask_epi8(d) << 32);
+            if (high)
+            {
+                return (bytes + end - 64 + axu::highestBit(high));
+            }
+            Uint64 low = (Uint64)(Uint32)_mm256_movemask_epi8(a) |
+                ((Uint64)(Uint32)_mm256_movemask_epi8(b) << 32);
+            return (bytes + end - 128 + axu::highestBit(low));
+        }
+    }
+    for (; end >= 32; end -= 32)
+    {
+        Uint32 mask = (Uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            _mm256_loadu_si256((const __m256i*)(bytes + end - 32)),
+            pattern));
+        if (mask)
+        {
+            return (bytes + end - 32 + axu::highestBit(mask));
+        }
+    }
+    if (end == 0)
+    {
+        return (nullptr);
+    }
+    Uint32 mask = (Uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+        _mm256_loadu_si256((const __m256i*)bytes), pattern));
+    return (mask ? bytes + axu::highestBit(mask) : nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") int memcmpAvx2(const void* lhs, const void* rhs,
+    Uint64 length)
+{
+    const unsigned char* a = static_cast<const unsigned char*>(lhs);
+    const unsigned char* b = static_cast<const unsigned char*>(rhs);
+    Uint64 i = 0;
+
+    if (length < 32)
+    {
+        return (memcmpSse2(lhs, rhs, length));
+    }
+    for (; i + 128 <= length; i += 128)
+    {
+        const __m256i* x = (const __m256i*)(a + i);
+        const __m256i* y = (const __m256i*)(b + i);
+        __m256i equal = _mm256_and_si256(
+            _mm256_and_si256(
+                _mm256_cmpeq_epi8(_mm256_loadu_si256(x),
+                    _mm256_loadu_si256(y)),
+                _mm256_cmpeq_epi8(_mm256_loadu_si256(x + 1),
+                    _mm256_loadu_si256(y + 1))),
+            _mm256_and_si256(
+                _mm256_cmpeq_epi8(_mm256_loadu_si256(x + 2),
+                    _mm256_loadu_si256(y + 2)),
+                _mm256_cmpeq_epi8(_mm256_loadu_si256(x + 3),
+                    _mm256_loadu_si256(y + 3))));
+        if ((Uint32)_mm256_movemask_epi8(equal) != 0xFFFFFFFF)
+        {
+            break;
+        }
+    }
+    for (;; i += 32)
+    {
+        if (i + 32 > length)
+        {
+            if (i == length)
+            {
+                return (0);
+            }
+            i = length - 32;
+        }
+        Uint32 equal = (Uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            _mm256_loadu_si256((const __m256i*)(a + i)),
+            _mm256_loadu_si256((const __m256i*)(b + i))));
+        if (equal != 0xFFFFFFFF)
+        {
+            i += axu::countTrailingZeros(~equal);
+            return (order(a[i], b[i]));
+        }
+        if (i + 32 == length)
+        {
+            return (0);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr Kernels avx2Kernels = {&strlenAvx2, &strcmpAvx2, &strncmpAvx2,
+    &memchrAvx2, &memrchrAvx2, &memcmpAvx2};
+
+// !SECTION
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+bool isSupported(CString::Implementation implementation)
+{
+    if (implementation == CString::Implementation::Scalar)
+    {
+        return (true);
+    }
+    if (implementation == CString::Implementation::Sse2)
+    {
+        return (ax::detail::hasSse2());
+    }
+    return (ax::detail::hasAvx2());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Constant-initialized, so calls made before the selection below, from other
+// static initializers, safely use the scalar kernels
+Kernels kernels = scalarKernels;
+CString::Implementation current = CString::Implementation::Scalar;
+
+///////////////////////////////////////////////////////////////////////////////
+CString::Implementation selectBest(void)
+{
+    if (CString::setImplementation(CString::Implementation::Avx2))
+    {
+        return (current);
+    }
+    CString::setImplementation(CString::Implementation::Sse2);
+    return (current);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const CString::Implementation selected = selectBest();
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 CString::strlen(const char* str)
+{
+    return (kernels.strlen(str));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD int CString::strcmp(const char* lhs, const char* rhs)
+{
+    CHECK(lhs && rhs);
+    return (kernels.strcmp(lhs, rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD int CString::strncmp(const char* lhs, const char* rhs,
+    Uint64 count)
+{
+    CHECK(count == 0 || (lhs && rhs));
+    return (count ? kernels.strncmp(lhs, rhs, count) : 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const void* CString::memchr(const void* data, int ch,
+    Uint64 length)
+{
+    return (kernels.memchr(data, ch, length));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const void* CString::memrchr(const void* data, int ch,
+    Uint64 length)
+{
+    return (kernels.memrchr(data, ch, length));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD int CString::memcmp(const void* lhs, const void* rhs,
+    Uint64 length)
+{
+    return (length ? kernels.memcmp(lhs, rhs, length) : 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD CString::Implementation CString::getImplementation(void)
+{
+    return (current);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool CString::setImplementation(Implementation implementation)
+{
+    if (!isSupported(implementation))
+    {
+        return (false);
+    }
+    switch (implementation)
+    {
+#if defined(AXIOM_CPU_X86)
+        case Implementation::Avx2:
+            kernels = avx2Kernels;
+            break;
+        case Implementation::Sse2:
+            kernels = sse2Kernels;
+            break;
+#endif
+        default:
+            kernels = scalarKernels;
+            break;
+    }
+    current = implementation;
+    return (true);
+}
@@ -0,0 +1,427 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/container/name.hpp>
+#include <axiom/memory/allocator.hpp>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Name from ax::container
+///////////////////////////////////////////////////////////////////////////////
+using ax::container::Name;
+using ax::container::String;
+using ax::container::StringView;
+
+///////////////////////////////////////////////////////////////////////////////
+// Anonymous namespace
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief An interned string, followed by its null-terminated characters.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct NameEntry
+{
+    Uint64 hash;    //<!
+    Uint64 length;  //<!
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const char* data(void) const
+    {
+        return (reinterpret_cast<const char*>(this + 1));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Open-addressing index from a string to its id.
+///
+/// A slot holds the high half of the hash and the id, zero when empty. The
+/// index is replaced when it grows, the previous ones staying readable by
+/// the threads that may still probe them.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct NameIndex
+{
+    NameIndex* previous;            //<!
+    Uint64 mask;                    //<!
+    std::atomic<Uint64>* slots;     //<!
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief The global table of interned strings.
+///
+/// Entries are published with release stores and looked up with acquire
+/// loads, so a string already interned is found without taking the mutex.
+/// Only the first interning of a string locks, and checks again under the
+/// lock before storing it.
+///
+///////////////////////////////////////////////////////////////////////////////
+class NameTable
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint64 pageBits = 12;                  //<!
+    static constexpr Uint64 pageSize = 1ull << pageBits;    //<!
+    static constexpr Uint64 maxPages = 4096;                //<!
+    static constexpr Uint64 blockSize = 64 * 1024;          //<!
+    static constexpr Uint64 minSlots = 1024;                //<!
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    std::atomic<NameEntry**> m_pages[maxPages];     //<!
+    std::atomic<NameIndex*> m_index;                //<!
+    std::atomic<Uint64> m_count;                    //<!
+    std::mutex m_mutex;                             //<!
+    char* m_block;                                  //<!
+    Uint64 m_blockLeft;                             //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    NameTable(void)
+        : m_pages()
+        , m_index(nullptr)
+        , m_count(1)
+        , m_mutex()
+        , m_block(nullptr)
+        , m_blockLeft(0)
+    {}
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param id An id returned by `intern`, other than zero
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    const NameEntry* getEntry(Uint64 id) const
+    {
+        const NameEntry* const* entries =
+            m_pages[id >> pageBits].load(std::memory_order_acquire);
+        return (entries[id & (pageSize - 1)]);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Look a string up, without locking.
+    ///
+    /// \param data
+    /// \param length
+    /// \param hash
+    ///
+    /// \return Its id, zero when it is not interned
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint32 find(const char* data, Uint64 length, Uint64 hash) const
+    {
+        const NameIndex* index = m_index.load(std::memory_order_acquire);
+
+        if (index == nullptr)
+        {
+            return (0);
+        }
+        const Uint64 tag = hash & 0xFFFFFFFF00000000ull;
+        for (Uint64 i = hash & index->mask;; i = (i + 1) & index->mask)
+        {
+            Uint64 slot = index->slots[i].load(std::memory_order_acquire);
+            if (slot == 0)
+            {
+                return (0);
+            }
+            if ((slot & 0xFFFFFFFF00000000ull) != tag)
+            {
+                continue;
+            }
+            const Uint32 id = (Uint32)slot;
+            const NameEntry* entry = getEntry(id);
+            if (entry->length == length
+                && std::memcmp(entry->data(), data, length) == 0)
+            {
+                return (id);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param data
+    /// \param length
+    /// \param hash
+    ///
+    /// \return The id of the string, stored if it was not yet
+    ///
+    /// \throw std::exception If the table is full
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint32 intern(const char* data, Uint64 length, Uint64 hash)
+    {
+        if (length == 0)
+        {
+            return (0);
+        }
+        Uint32 id = find(data, length, hash);
+        if (id != 0)
+        {
+            return (id);
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        id = find(data, length, hash);
+        if (id != 0)
+        {
+            return (id);
+        }
+        const Uint64 count = m_count.load(std::memory_order_relaxed);
+        CHECK(count < maxPages * pageSize && count <= 0xFFFFFFFFull);
+
+        std::atomic<NameEntry**>& page = m_pages[count >> pageBits];
+        NameEntry** entries = page.load(std::memory_order_relaxed);
+        if (entries == nullptr)
+        {
+            entries = ax::memory::Allocator::getDefault()
+                .allocateArray<NameEntry*>(pageSize);
+            page.store(entries, std::memory_order_release);
+        }
+        entries[count & (pageSize - 1)] = _store(data, length, hash);
+
+        NameIndex* index = m_index.load(std::memory_order_relaxed);
+        if (index == nullptr || (count + 1) * 2 > index->mask + 1)
+        {
+            index = _grow(index, count);
+        }
+        _insert(index, hash, count);
+        m_count.store(count + 1, std::memory_order_release);
+        return ((Uint32)count);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    Uint64 getCount(void) const
+    {
+        return (m_count.load(std::memory_order_acquire));
+    }
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy a string into the current block of characters.
+    ///
+    /// \param data
+    /// \param length
+    /// \param hash
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    NameEntry* _store(const char* data, Uint64 length, Uint64 hash)
+    {
+        const Uint64 alignment = alignof(NameEntry);
+        const Uint64 size = (sizeof(NameEntry) + length + 1 + alignment - 1)
+            & ~(alignment - 1);
+
+        if (size > m_blockLeft)
+        {
+            const Uint64 blockBytes = size > blockSize ? size : blockSize;
+            m_block = static_cast<char*>(ax::memory::Allocator::getDefault()
+                .allocate(blockBytes, alignment));
+            m_blockLeft = blockBytes;
+        }
+        NameEntry* entry = new (m_block) NameEntry{hash, length};
+        char* characters = reinterpret_cast<char*>(entry + 1);
+        std::memcpy(characters, data, length);
+        characters[length] = '\0';
+        m_block += size;
+        m_blockLeft -= size;
+        return (entry);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Publish a larger index holding the ids below `count`.
+    ///
+    /// \param index
+    /// \param count
+    ///
+    /// \return
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    NameIndex* _grow(NameIndex* index, Uint64 count)
+    {
+        ax::memory::Allocator& allocator = ax::memory::Allocator::getDefault();
+        const Uint64 slots = index == nullptr ? minSlots
+            : (index->mask + 1) * 2;
+
+        NameIndex* grown = allocator.allocateArray<NameIndex>(1);
+        grown->previous = index;
+        grown->mask = slots - 1;
+        grown->slots = allocator.allocateArray<std::atomic<Uint64>>(slots);
+        for (Uint64 i = 0; i < slots; i++)
+        {
+            new (&grown->slots[i]) std::atomic<Uint64>(0);
+        }
+        for (Uint64 id = 1; id < count; id++)
+        {
+            _insert(grown, getEntry(id)->hash, id);
+        }
+        m_index.store(grown, std::memory_order_release);
+        return (grown);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param index
+    /// \param hash
+    /// \param id
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void _insert(NameIndex* index, Uint64 hash, Uint64 id)
+    {
+        Uint64 i = hash & index->mask;
+
+        while (index->slots[i].load(std::memory_order_relaxed) != 0)
+        {
+            i = (i + 1) & index->mask;
+        }
+        index->slots[i].store((hash & 0xFFFFFFFF00000000ull) | id,
+            std::memory_order_release);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief The table, built on first use so that names can be interned from
+/// static initializers of any translation unit.
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+NameTable& getTable(void)
+{
+    static NameTable table;
+
+    return (table);
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+Name::Name(const char* str)
+    : Name(StringView(str))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Name::Name(StringView str)
+    : m_id(getTable().intern(str.data(), str.length(),
+        hash::hashBytes(str.data(), str.length())))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Name::Name(const String& str)
+    : Name(StringView(str))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Name::Name(hash::HashedStringView str)
+    : m_id(getTable().intern(str.data(), str.length(), str.getHash()))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Name::operator StringView(void) const
+{
+    if (m_id == 0)
+    {
+        return (StringView("", 0));
+    }
+    const NameEntry* entry = getTable().getEntry(m_id);
+    return (StringView(entry->data(), entry->length));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const char* Name::cstr(void) const
+{
+    return (m_id == 0 ? "" : getTable().getEntry(m_id)->data());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 Name::length(void) const
+{
+    return (m_id == 0 ? 0 : getTable().getEntry(m_id)->length);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD String Name::toString(void) const
+{
+    return (String(StringView(*this)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Name::find(StringView str, Name& name)
+{
+    if (str.length() == 0)
+    {
+        name = Name();
+        return (true);
+    }
+    const Uint32 id = getTable().find(str.data(), str.length(),
+        hash::hashBytes(str.data(), str.length()));
+    if (id == 0)
+    {
+        return (false);
+    }
+    name.m_id = id;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 Name::getCount(void)
+{
+    return (getTable().getCount());
+}
@@ -0,0 +1,499 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/container/rope.hpp>
+#include <axiom/utility.hpp>
+#include <cstddef>
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Rope from ax::container
+///////////////////////////////////////////////////////////////////////////////
+using ax::container::Rope;
+using ax::container::String;
+using ax::container::StringView;
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Allocator from ax::memory
+///////////////////////////////////////////////////////////////////////////////
+using ax::memory::Allocator;
+
+///////////////////////////////////////////////////////////////////////////////
+Rope::Rope(Allocator& allocator)
+    : m_allocator(&allocator)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Rope::Rope(StringView str)
+{
+    append(str);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Rope::Rope(const Rope& other)
+    : m_seed(other.m_seed)
+    , m_allocator(other.m_allocator)
+{
+    m_root = _clone(other.m_root);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Rope::Rope(Rope&& other) noexcept
+    : m_root(other.m_root)
+    , m_seed(other.m_seed)
+    , m_allocator(other.m_allocator)
+{
+    other.m_root = nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Rope::~Rope(void)
+{
+    _destroy(m_root);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Rope& Rope::operator=(const Rope& other)
+{
+    if (this != &other)
+    {
+        Node* root = _clone(other.m_root);
+        _destroy(m_root);
+        m_root = root;
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Rope& Rope::operator=(Rope&& other)
+{
+    if (this != &other)
+    {
+        if (&getAllocator() == &other.getAllocator())
+        {
+            _destroy(m_root);
+            m_root = other.m_root;
+            other.m_root = nullptr;
+        }
+        else
+        {
+            // Chunks must go back to the allocator they came from
+            Node* root = _clone(other.m_root);
+            _destroy(m_root);
+            m_root = root;
+        }
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+char Rope::operator[](Uint64 position) const
+{
+    return (at(position));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Rope::insert(Uint64 position, StringView str)
+{
+    CHECK(position <= length());
+    const char* data = str.data();
+    const Uint64 count = str.length();
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    // In place when the chunk at the position has room for the text
+    Uint64 offset = position;
+    Node* node = _descend(offset, true, 0);
+    if (node != nullptr && node->length + count <= chunkCapacity)
+    {
+        offset = position;
+        _descend(offset, true, (Int64)count);
+        std::memmove(node->text + offset + count, node->text + offset,
+            node->length - offset);
+        std::memcpy(node->text + offset, data, count);
+        node->length += (Uint32)count;
+        return;
+    }
+
+    Node* left;
+    Node* right;
+    Node* middle = nullptr;
+    _split(m_root, position, left, right);
+    for (Uint64 done = 0; done < count; done += chunkCapacity)
+    {
+        const Uint64 chunk = count - done < chunkCapacity ? count - done
+            : chunkCapacity;
+        middle = _merge(middle, _create(data + done, (Uint32)chunk));
+    }
+    m_root = _join(_join(left, middle), right);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Rope::append(StringView str)
+{
+    insert(length(), str);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Rope::erase(Uint64 position, Uint64 count)
+{
+    const Uint64 size = length();
+
+    CHECK(position <= size);
+    if (count > size - position)
+    {
+        count = size - position;
+    }
+    if (count == 0)
+    {
+        return;
+    }
+
+    // In place when the range lies in one chunk and leaves it non-empty
+    Uint64 offset = position;
+    Node* node = _descend(offset, false, 0);
+    if (offset + count <= node->length && count < node->length)
+    {
+        offset = position;
+        _descend(offset, false, -(Int64)count);
+        std::memmove(node->text + offset, node->text + offset + count,
+            node->length - offset - count);
+        node->length -= (Uint32)count;
+        return;
+    }
+
+    Node* left;
+    Node* middle;
+    Node* right;
+    _split(m_root, position, left, right);
+    _split(right, count, middle, right);
+    _destroy(middle);
+    m_root = _join(left, right);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Rope::clear(void)
+{
+    _destroy(m_root);
+    m_root = nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD char Rope::at(Uint64 position) const
+{
+    CHECK(position < length());
+    const Node* node = m_root;
+
+    while (true)
+    {
+        const Uint64 leftSize = _size(node->left);
+        if (position < leftSize)
+        {
+            node = node->left;
+        }
+        else if (position < leftSize + node->length)
+        {
+            return (node->text[position - leftSize]);
+        }
+        else
+        {
+            position -= leftSize + node->length;
+            node = node->right;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 Rope::length(void) const
+{
+    return (_size(m_root));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool Rope::isEmpty(void) const
+{
+    return (m_root == nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 Rope::getChunkCount(void) const
+{
+    Uint64 count = 0;
+
+    forEachChunk([&count](const char*, Uint64) {
+        count++;
+    });
+    return (count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 Rope::getDepth(void) const
+{
+    return (_depth(m_root));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Allocator& Rope::getAllocator(void) const
+{
+    return (m_allocator ? *m_allocator : Allocator::getDefault());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD String Rope::toString(void) const
+{
+    return (substr(0, length()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD String Rope::substr(Uint64 position, Uint64 count) const
+{
+    const Uint64 size = length();
+    String result;
+
+    CHECK(position <= size);
+    if (count > size - position)
+    {
+        count = size - position;
+    }
+    result.reserve(count);
+    auto append = [&result](const char* data, Uint64 length) {
+        result.append(data, length);
+    };
+    _visit(m_root, position, count, append);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 Rope::copyTo(char* buffer, Uint64 position, Uint64 count) const
+{
+    const Uint64 size = length();
+
+    CHECK(position <= size);
+    if (count > size - position)
+    {
+        count = size - position;
+    }
+    auto copy = [&buffer](const char* data, Uint64 length) {
+        std::memcpy(buffer, data, length);
+        buffer += length;
+    };
+    _visit(m_root, position, count, copy);
+    return (count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Rope::Node* Rope::_create(const char* data, Uint32 length)
+{
+    Node* node = static_cast<Node*>(getAllocator().allocate(sizeof(Node),
+        alignof(Node)));
+
+    // Xorshift, enough to keep the treap balanced on any edit order
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+    node->left = nullptr;
+    node->right = nullptr;
+    node->size = length;
+    node->priority = m_seed;
+    node->length = length;
+    std::memcpy(node->text, data, length);
+    return (node);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Rope::_destroy(Node* node)
+{
+    while (node != nullptr)
+    {
+        Node* right = node->right;
+        _destroy(node->left);
+        getAllocator().deallocate(node, sizeof(Node), alignof(Node));
+        node = right;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Rope::Node* Rope::_clone(const Node* node)
+{
+    if (node == nullptr)
+    {
+        return (nullptr);
+    }
+    Node* copy = static_cast<Node*>(getAllocator().allocate(sizeof(Node),
+        alignof(Node)));
+    std::memcpy(copy, node, offsetof(Node, text) + node->length);
+    copy->left = _clone(node->left);
+    copy->right = _clone(node->right);
+    return (copy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Rope::_split(Node* node, Uint64 position, Node*& left, Node*& right)
+{
+    if (node == nullptr)
+    {
+        left = nullptr;
+        right = nullptr;
+        return;
+    }
+    const Uint64 leftSize = _size(node->left);
+    if (position <= leftSize)
+    {
+        _split(node->left, position, left, node->left);
+        _update(node);
+        right = node;
+    }
+    else if (position >= leftSize + node->length)
+    {
+        _split(node->right, position - leftSize - node->length,
+            node->right, right);
+        _update(node);
+        left = node;
+    }
+    else
+    {
+        // The end of the chunk moves to a new chunk, first of the right
+        const Uint32 offset = (Uint32)(position - leftSize);
+        Node* tail = _create(node->text + offset, node->length - offset);
+        node->length = offset;
+        right = _merge(tail, node->right);
+        node->right = nullptr;
+        _update(node);
+        left = node;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Rope::Node* Rope::_merge(Node* left, Node* right)
+{
+    if (left == nullptr)
+    {
+        return (right);
+    }
+    if (right == nullptr)
+    {
+        return (left);
+    }
+    if (left->priority > right->priority)
+    {
+        left->right = _merge(left->right, right);
+        _update(left);
+        return (left);
+    }
+    right->left = _merge(left, right->left);
+    _update(right);
+    return (right);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Rope::Node* Rope::_join(Node* left, Node* right)
+{
+    Node* last = left;
+    Node* first = right;
+
+    while (last != nullptr && last->right != nullptr)
+    {
+        last = last->right;
+    }
+    while (first != nullptr && first->left != nullptr)
+    {
+        first = first->left;
+    }
+    if (last != nullptr && first != nullptr &&
+        last->length + first->length <= chunkCapacity)
+    {
+        // Cut on a chunk boundary, so the head is the first chunk alone
+        const Uint32 count = first->length;
+        Node* head;
+        _split(right, count, head, right);
+        std::memcpy(last->text + last->length, head->text, count);
+        last->length += count;
+        for (Node* node = left; node != nullptr; node = node->right)
+        {
+            node->size += count;
+        }
+        _destroy(head);
+    }
+    return (_merge(left, right));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Rope::Node* Rope::_descend(Uint64& position, bool inclusive, Int64 delta)
+{
+    Node* node = m_root;
+
+    while (node != nullptr)
+    {
+        node->size += (Uint64)delta;
+        const Uint64 leftSize = _size(node->left);
+        const Uint64 end = leftSize + node->length;
+        if (position < leftSize)
+        {
+            node = node->left;
+        }
+        else if (position < end || (inclusive && position == end))
+        {
+            position -= leftSize;
+            return (node);
+        }
+        else
+        {
+            position -= end;
+            node = node->right;
+        }
+    }
+    return (nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 Rope::_depth(const Node* node)
+{
+    if (node == nullptr)
+    {
+        return (0);
+    }
+    const Uint64 left = _depth(node->left);
+    const Uint64 right = _depth(node->right);
+    return ((left > right ? left : right) + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 Rope::_size(const Node* node)
+{
+    return (node ? node->size : 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Rope::_update(Node* node)
+{
+    node->size = _size(node->left) + node->length + _size(node->right);
+}
@@ -30,14 +30,30 @@
 #include <axiom/container/string.hpp>
 #include <axiom/container/cstring.hpp>
 #include <axiom/container/char.hpp>
+#include <axiom/container/stringSearch.hpp>
+#include <axiom/container/charSet.hpp>
+#include <axiom/container/stringView.hpp>
+#include <axiom/container/stringNumber.hpp>
 #include <axiom/utility.hpp>
+#include <locale>
 
 ///////////////////////////////////////////////////////////////////////////////
-// Forward String, CString and Char from ax::container
+// Forward String, CString, Char, StringSearch, CharSet, StringView and
+// StringSplit from ax::container
 ///////////////////////////////////////////////////////////////////////////////
 using ax::container::String;
 using ax::container::CString;
 using ax::container::Char;
+using ax::container::StringSearch;
+using ax::container::CharSet;
+using ax::container::StringView;
+using ax::container::StringSplit;
+using ax::container::StringNumber;
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Allocator from ax::memory
+///////////////////////////////////////////////////////////////////////////////
+using ax::memory::Allocator;
 
 ///////////////////////////////////////////////////////////////////////////////
 // Forward Iterators from ax::container::String
@@ -444,28 +460,35 @@ ReverseIterator ReverseIterator::operator--(int)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-String::String(void)
-{
-    _setCapacity(0);
-    _setLength(0);
-}
+String::String(void) {}
 
 ///////////////////////////////////////////////////////////////////////////////
 String::String(const String& other)
 {
-    _append(other.m_str, other.m_length);
+    _append(other._data(), other.m_length);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 String::String(const String& other, Uint64 position, Uint64 length)
 {
-    append(other.m_str, position, length);
+    append(other, position, length);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-String::String(String&& other)
+String::String(String&& other) noexcept
+    : m_str(other.m_str)
+    , m_length(other.m_length)
+    , m_capacity(other.m_capacity)
+    , m_allocator(other.m_allocator)
 {
-    *this = axu::move(other);
+    if (!m_str)
+    {
+        std::memcpy(m_local, other.m_local, m_length + 1);
+    }
+    other.m_str = nullptr;
+    other.m_length = 0;
+    other.m_capacity = localCapacity;
+    other.m_local[0] = '\0';
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -483,7 +506,13 @@ String::String(const char* other)
 ///////////////////////////////////////////////////////////////////////////////
 String::String(const char* other, Uint64 length)
 {
-    append(other, 0, length);
+    _append(other, length);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+String::String(StringView other)
+{
+    _append(other.data(), other.length());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -498,94 +527,197 @@ String::String(const ConstIterator first, const ConstIterator second)
     append(first, second);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+String::String(Allocator& allocator)
+    : m_allocator(&allocator)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+String::String(StringView other, Allocator& allocator)
+    : m_allocator(&allocator)
+{
+    _append(other.data(), other.length());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 String::~String(void)
 {
-    SAFE_DELETE_ARRAY(m_str);
+    _deallocate();
     m_length = 0;
     m_capacity = 0;
-    m_increaseBy = 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 String& String::operator=(const String& other)
 {
-    if (this != &other)
+    if (this == &other)
     {
-        _setLength(0);
-        _append(other.m_str, other.m_length);
+        return (*this);
+    }
+    if (other.m_length > m_capacity)
+    {
+        char* buffer = _allocate(other.m_length);
+
+        _deallocate();
+        m_str = buffer;
+        m_capacity = other.m_length;
     }
+    std::memcpy(_data(), other._data(), other.m_length + 1);
+    m_length = other.m_length;
     return (*this);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 String& String::operator=(String&& other)
 {
-    if (this != &other)
+    if (this == &other)
+    {
+        return (*this);
+    }
+    if (m_allocator != other.m_allocator
+        && &getAllocator() != &other.getAllocator())
+    {
+        _setLength(0);
+        _append(other._data(), other.m_length);
+    }
+    else
     {
-        SAFE_DELETE_ARRAY(m_str);
+        _deallocate();
         m_str = other.m_str;
         m_length = other.m_length;
         m_capacity = other.m_capacity;
+        if (!m_str)
+        {
+            std::memcpy(m_local, other.m_local, m_length + 1);
+        }
         other.m_str = nullptr;
         other.m_length = 0;
-        other.m_capacity = 0;
+        other.m_capacity = localCapacity;
+        other.m_local[0] = '\0';
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+String& String::operator=(StringView other)
+{
+    if (!_isInside(other.data()))
+    {
+        _setLength(0);
+        _append(other.data(), other.length());
+        return (*this);
     }
+    _erase(other.end() - _data(), npos);
+    _erase(0, other.data() - _data());
     return (*this);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+String& String::operator=(const std::string& other)
+{
+    return (operator=(StringView(other)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+String& String::operator=(const char* other)
+{
+    return (operator=(StringView(other)));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 const char& String::operator[](Uint64 index) const
 {
-    return (*(m_str + index));
+    return (*(_data() + index));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 char& String::operator[](Uint64 index)
 {
-    return (*(m_str + index));
+    return (*(_data() + index));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool String::operator==(const String& rhs)
+bool String::operator==(const String& rhs) const
 {
     return (_compare(rhs) == 0);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool String::operator!=(const String& rhs)
+bool String::operator==(const char* rhs) const
+{
+    return (compare(rhs) == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool String::operator!=(const String& rhs) const
 {
     return (_compare(rhs) != 0);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool String::operator<(const String& rhs)
+bool String::operator!=(const char* rhs) const
+{
+    return (compare(rhs) != 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool String::operator<(const String& rhs) const
 {
     return (_compare(rhs) < 0);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool String::operator<=(const String& rhs)
+bool String::operator<(const char* rhs) const
+{
+    return (compare(rhs) < 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool String::operator<=(const String& rhs) const
 {
     return (_compare(rhs) <= 0);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool String::operator>(const String& rhs)
+bool String::operator<=(const char* rhs) const
+{
+    return (compare(rhs) <= 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool String::operator>(const String& rhs) const
 {
     return (_compare(rhs) > 0);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool String::operator>=(const String& rhs)
+bool String::operator>(const char* rhs) const
+{
+    return (compare(rhs) > 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool String::operator>=(const String& rhs) const
 {
     return (_compare(rhs) >= 0);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+bool String::operator>=(const char* rhs) const
+{
+    return (compare(rhs) >= 0);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 String::operator std::string(void) const
 {
-    return (std::string(cstr()));
+    return (std::string(_data(), m_length));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+String::operator StringView(void) const
+{
+    return (StringView(_data(), m_length));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -707,18 +839,22 @@ char& String::back(void)
 ///////////////////////////////////////////////////////////////////////////////
 String& String::append(const String& str)
 {
-    _append(str.m_str, str.m_length);
+    _append(str._data(), str.m_length);
     return (*this);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-String& String::append(const String& str, Uint64 subPos, Uint64 subLen)
+String& String::append(StringView str)
 {
-    char* buffer = nullptr;
+    _append(str.data(), str.length());
+    return (*this);
+}
 
+///////////////////////////////////////////////////////////////////////////////
+String& String::append(const String& str, Uint64 subPos, Uint64 subLen)
+{
     subLen = _getLength(str, subPos, subLen);
-    _substr(buffer, str.m_str, subPos, subLen);
-    _append(buffer, subLen);
+    _append(str._data() + subPos, subLen);
     return (*this);
 }
 
@@ -739,51 +875,72 @@ String& String::append(const char* str)
 ///////////////////////////////////////////////////////////////////////////////
 String& String::append(const char* str, Uint64 length)
 {
-    char* buffer = nullptr;
-
-    _substr(buffer, str, 0, length);
-    _append(buffer, length);
-    SAFE_DELETE(buffer);
+    _append(str, length);
     return (*this);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 String& String::append(Uint64 length, char filler)
 {
-    char* buffer = nullptr;
-
-    _allocCString(buffer, length, filler);
-    _append(buffer, length);
-    SAFE_DELETE(buffer);
+    _fill(m_length, 0, length, filler);
     return (*this);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 String& String::append(const ConstIterator first, const ConstIterator second)
 {
-    const Uint64 length = _getLength(first, second);
+    _append(first.current.first + first.current.pos,
+        _getLength(first, second));
+    return (*this);
+}
 
-    if (length != 0)
-    {
-        char* buffer = nullptr;
-        _allocCString(buffer, length, first);
-        _append(buffer, length);
-        SAFE_DELETE(buffer);
-    }
+///////////////////////////////////////////////////////////////////////////////
+String& String::appendInt(Int64 value)
+{
+    char buffer[StringNumber::maxIntLength];
+
+    _append(buffer, StringNumber::formatInt(buffer, value));
     return (*this);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-String& String::append(char ch)
+String& String::appendUint(Uint64 value)
 {
-    _append(&ch, 1);
+    char buffer[StringNumber::maxIntLength];
+
+    _append(buffer, StringNumber::formatUint(buffer, value));
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+String& String::appendFloat(double value)
+{
+    char buffer[StringNumber::maxFloatLength];
+
+    _append(buffer, StringNumber::formatFloat(buffer, value));
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+String& String::appendFloat(float value)
+{
+    char buffer[StringNumber::maxFloatLength];
+
+    _append(buffer, StringNumber::formatFloat(buffer, value));
     return (*this);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 String& String::insert(Uint64 position, const String& other)
 {
-    _insertstr(position, other.m_str, other.m_length);
+    _insertstr(position, other._data(), other.m_length);
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+String& String::insert(Uint64 position, StringView other)
+{
+    _insertstr(position, other.data(), other.length());
     return (*this);
 }
 
@@ -791,12 +948,8 @@ String& String::insert(Uint64 position, const String& other)
 String& String::insert(Uint64 position, const String& other, Uint64 subPos,
     Uint64 subLen)
 {
-    char* buffer = nullptr;
-
     subLen = _getLength(other, subPos, subLen);
-    _substr(buffer, other.m_str, subPos, subLen);
-    _insertstr(position, buffer, subLen);
-    SAFE_DELETE(buffer);
+    _insertstr(position, other._data() + subPos, subLen);
     return (*this);
 }
 
@@ -817,11 +970,7 @@ String& String::insert(Uint64 position, const char* other)
 ///////////////////////////////////////////////////////////////////////////////
 String& String::insert(Uint64 position, const char* other, Uint64 length)
 {
-    char* buffer = nullptr;
-
-    _substr(buffer, other, 0, length);
-    _insertstr(position, buffer, length);
-    SAFE_DELETE(buffer);
+    _insertstr(position, other, length);
     return (*this);
 }
 
@@ -835,22 +984,16 @@ String& String::insert(Uint64 position, char character)
 ///////////////////////////////////////////////////////////////////////////////
 String& String::insert(Uint64 position, Uint64 length, char filler)
 {
-    char* buffer = nullptr;
-
-    _allocCString(buffer, length, filler);
-    _insertstr(position, buffer, length);
-    SAFE_DELETE(buffer);
+    CHECK(position <= m_length);
+    _fill(position, 0, length, filler);
     return (*this);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void String::insert(Iterator pointer, Uint64 length, char filler)
 {
-    char* buffer = nullptr;
-
-    _allocCString(buffer, length, filler);
-    _insertstr(pointer.current.pos, buffer, length);
-    SAFE_DELETE(buffer);
+    CHECK(pointer.current.pos <= m_length);
+    _fill(pointer.current.pos, 0, length, filler);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -864,16 +1007,8 @@ Iterator String::insert(Iterator pointer, char character)
 void String::insert(Iterator pointer, const ConstIterator first,
     const ConstIterator second)
 {
-    const Uint64 length = _getLength(first, second);
-
-    if (length == 0)
-    {
-        return;
-    }
-    char* buffer = nullptr;
-    _allocCString(buffer, length, first);
-    _insertstr(pointer.current.pos, buffer, length);
-    SAFE_DELETE(buffer);
+    _insertstr(pointer.current.pos, first.current.first + first.current.pos,
+        _getLength(first, second));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -900,7 +1035,14 @@ Iterator String::erase(ConstIterator first, ConstIterator second)
 ///////////////////////////////////////////////////////////////////////////////
 String& String::replace(Uint64 position, Uint64 length, const String& other)
 {
-    _replace(position, length, other.m_str, other.m_length);
+    _replace(position, length, other._data(), other.m_length);
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+String& String::replace(Uint64 position, Uint64 length, StringView other)
+{
+    _replace(position, length, other.data(), other.length());
     return (*this);
 }
 
@@ -908,7 +1050,7 @@ String& String::replace(Uint64 position, Uint64 length, const String& other)
 String& String::replace(ConstIterator first, ConstIterator second,
     const String& other)
 {
-    replace(first.current.pos, _getLength(first, second), other.m_str,
+    replace(first.current.pos, _getLength(first, second), other._data(),
         other.m_length);
     return (*this);
 }
@@ -917,12 +1059,8 @@ String& String::replace(ConstIterator first, ConstIterator second,
 String& String::replace(Uint64 position, Uint64 length, const String& other,
     Uint64 subPos, Uint64 subLen)
 {
-    char* buffer = nullptr;
-
     subLen = _getLength(other, subPos, subLen);
-    _substr(buffer, other.m_str, subPos, subLen);
-    _replace(position, length, buffer, CString::strlen(buffer));
-    SAFE_DELETE(buffer);
+    _replace(position, length, other._data() + subPos, subLen);
     return (*this);
 }
 
@@ -978,11 +1116,7 @@ String& String::replace(ConstIterator first, ConstIterator second,
 ///////////////////////////////////////////////////////////////////////////////
 String& String::replace(Uint64 poisition, Uint64 length, Uint64 n, char filler)
 {
-    char* buffer = nullptr;
-
-    _allocCString(buffer, n, filler);
-    _replace(poisition, length, buffer, n);
-    SAFE_DELETE(buffer);
+    _fill(poisition, _getLength(*this, poisition, length), n, filler);
     return (*this);
 }
 
@@ -990,11 +1124,7 @@ String& String::replace(Uint64 poisition, Uint64 length, Uint64 n, char filler)
 String& String::replace(ConstIterator first, ConstIterator second,
     Uint64 length, char filler)
 {
-    char* buffer = nullptr;
-
-    _allocCString(buffer, length, filler);
-    _replace(first.current.pos, _getLength(first, second), buffer, length);
-    SAFE_DELETE(buffer);
+    _fill(first.current.pos, _getLength(first, second), length, filler);
     return (*this);
 }
 
@@ -1002,21 +1132,76 @@ String& String::replace(ConstIterator first, ConstIterator second,
 String& String::replace(ConstIterator first, ConstIterator second,
     ConstIterator third, ConstIterator four)
 {
-    const Uint64 length = _getLength(third, four);
-    char* buffer = nullptr;
+    _replace(first.current.pos, _getLength(first, second),
+        third.current.first + third.current.pos, _getLength(third, four));
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+String& String::replaceAll(StringView from, StringView to)
+{
+    _replaceAll(from.data(), from.length(), to.data(), to.length());
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+String& String::applyEdits(const Edit* edits, Uint64 count)
+{
+    Uint64 length = m_length;
+    Uint64 end = 0;
+
+    for (Uint64 i = 0; i < count; i++)
+    {
+        CHECK(edits[i].position >= end);
+        end = edits[i].position + edits[i].length;
+        CHECK(end <= m_length);
+        length = length - edits[i].length + edits[i].textLength;
+    }
+    if (count == 0)
+    {
+        return (*this);
+    }
 
-    _allocCString(buffer, length, third);
-    _replace(first.current.pos, _getLength(first, second), buffer, length);
-    SAFE_DELETE(buffer);
+    const char* data = _data();
+    String result(getAllocator());
+    Uint64 position = 0;
+
+    result.reserve(length);
+    for (Uint64 i = 0; i < count; i++)
+    {
+        result._append(data + position, edits[i].position - position);
+        result._append(edits[i].text, edits[i].textLength);
+        position = edits[i].position + edits[i].length;
+    }
+    result._append(data + position, m_length - position);
+    *this = axu::move(result);
     return (*this);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void String::swap(String& other)
 {
-    String temp = axu::move(*this);
-    *this = axu::move(other);
-    other = axu::move(temp);
+    if (this == &other)
+    {
+        return;
+    }
+    if (m_allocator != other.m_allocator
+        && &getAllocator() != &other.getAllocator())
+    {
+        String temp(*this);
+        *this = other;
+        other = temp;
+        return;
+    }
+    char local[localCapacity + 1];
+
+    std::memcpy(local, m_local, sizeof(local));
+    std::memcpy(m_local, other.m_local, sizeof(local));
+    std::memcpy(other.m_local, local, sizeof(local));
+    axu::swap(m_str, other.m_str);
+    axu::swap(m_length, other.m_length);
+    axu::swap(m_capacity, other.m_capacity);
+    axu::swap(m_allocator, other.m_allocator);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1029,7 +1214,7 @@ String& String::popBack(void)
 ///////////////////////////////////////////////////////////////////////////////
 const char* String::cstr(void) const
 {
-    return (m_str);
+    return (_data());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1047,7 +1232,13 @@ Uint64 String::copy(char* str, Uint64 length, Uint64 position) const
 ///////////////////////////////////////////////////////////////////////////////
 Uint64 String::find(const String& other, Uint64 position) const
 {
-    return (_find(other.m_str, other.m_length, position));
+    return (_find(other._data(), other.m_length, position));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 String::find(StringView other, Uint64 position) const
+{
+    return (_find(other.data(), other.length(), position));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1077,7 +1268,13 @@ Uint64 String::find(char ch, Uint64 position) const
 ///////////////////////////////////////////////////////////////////////////////
 Uint64 String::rfind(const String& other, Uint64 position) const
 {
-    return (_rfind(other.m_str, other.m_length, position));
+    return (_rfind(other._data(), other.m_length, position));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 String::rfind(StringView other, Uint64 position) const
+{
+    return (_rfind(other.data(), other.length(), position));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1107,7 +1304,13 @@ Uint64 String::rfind(char ch, Uint64 position) const
 ///////////////////////////////////////////////////////////////////////////////
 Uint64 String::findFirstOf(const String& other, Uint64 position) const
 {
-    return (_findFirstOf(other.m_str, other.m_length, position, true));
+    return (_findFirstOf(other._data(), other.m_length, position, true));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 String::findFirstOf(StringView other, Uint64 position) const
+{
+    return (_findFirstOf(other.data(), other.length(), position, true));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1135,10 +1338,22 @@ Uint64 String::findFirstOf(char ch, Uint64 position) const
     return (_findFirstOf(&ch, 1, position, true));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Uint64 String::findFirstOf(const CharSet& set, Uint64 position) const
+{
+    return (set.findFirstIn(_data(), m_length, position));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 Uint64 String::findLastOf(const String& other, Uint64 position) const
 {
-    return (_findLastOf(other.m_str, other.m_length, position, true));
+    return (_findLastOf(other._data(), other.m_length, position, true));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 String::findLastOf(StringView other, Uint64 position) const
+{
+    return (_findLastOf(other.data(), other.length(), position, true));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1166,10 +1381,22 @@ Uint64 String::findLastOf(char ch, Uint64 position) const
     return (_findLastOf(&ch, 1, position, true));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Uint64 String::findLastOf(const CharSet& set, Uint64 position) const
+{
+    return (set.findLastIn(_data(), m_length, position));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 Uint64 String::findFirstNotOf(const String& other, Uint64 position) const
 {
-    return (_findFirstOf(other.m_str, other.m_length, position, false));
+    return (_findFirstOf(other._data(), other.m_length, position, false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 String::findFirstNotOf(StringView other, Uint64 position) const
+{
+    return (_findFirstOf(other.data(), other.length(), position, false));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1197,10 +1424,22 @@ Uint64 String::findFirstNotOf(char ch, Uint64 position) const
     return (_findFirstOf(&ch, 1, position, false));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Uint64 String::findFirstNotOf(const CharSet& set, Uint64 position) const
+{
+    return (set.findFirstNotIn(_data(), m_length, position));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 Uint64 String::findLastNotOf(const String& other, Uint64 position) const
 {
-    return (_findLastOf(other.m_str, other.m_length, position, false));
+    return (_findLastOf(other._data(), other.m_length, position, false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 String::findLastNotOf(StringView other, Uint64 position) const
+{
+    return (_findLastOf(other.data(), other.length(), position, false));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1228,16 +1467,48 @@ Uint64 String::findLastNotOf(char ch, Uint64 position) const
     return (_findLastOf(&ch, 1, position, false));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Uint64 String::findLastNotOf(const CharSet& set, Uint64 position) const
+{
+    return (set.findLastNotIn(_data(), m_length, position));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 String String::substr(Uint64 position, Uint64 length) const
 {
-    char* buffer = nullptr;
+    length = _getLength(*this, position, length);
+    return (String(_data() + position, length));
+}
 
+///////////////////////////////////////////////////////////////////////////////
+StringView String::view(Uint64 position, Uint64 length) const
+{
     length = _getLength(*this, position, length);
-    _substr(buffer, m_str, position, length);
-    String toReturn(buffer);
-    SAFE_DELETE(buffer);
-    return (toReturn);
+    return (StringView(_data() + position, length));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringSplit String::split(char delimiter) const
+{
+    return (StringSplit(*this, delimiter));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringSplit String::split(StringView delimiter) const
+{
+    return (StringSplit(*this, delimiter));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringSplit String::tokenize(const CharSet& delimiters) const
+{
+    return (StringSplit(*this, delimiters));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int String::compare(StringView other) const
+{
+    return (StringView(*this).compare(other));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1258,19 +1529,16 @@ Uint64 String::maxSize(void) const
     return (npos - 1);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Allocator& String::getAllocator(void) const
+{
+    return (m_allocator ? *m_allocator : Allocator::getDefault());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void String::resize(Uint64 size)
 {
-    if (m_length == size)
-    {
-        return;
-    }
-    if (m_length < size)
-    {
-        _setLength(size);
-        return;
-    }
-    _clearStr(size);
+    resize(size, '\0');
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1284,7 +1552,7 @@ void String::resize(Uint64 size, char filler)
     {
         Uint64 position = m_length;
         _setLength(size);
-        _fillStr(m_str, m_length, position, filler);
+        _fillStr(_data(), m_length, position, filler);
         return;
     }
     _clearStr(size);
@@ -1329,37 +1597,42 @@ void String::shrinkToFit(void)
 ///////////////////////////////////////////////////////////////////////////////
 String& String::toLowerCase(void)
 {
-    return (_transform(Char::toLower));
+    Char::toLowerCase(_data(), m_length);
+    return (*this);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 String& String::toUpperCase(void)
 {
-    return (_transform(Char::toUpper));
+    Char::toUpperCase(_data(), m_length);
+    return (*this);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 String& String::trim(void)
 {
-    Uint64 start = 0;
-    Uint64 end = m_length - 1;
+    return (trim(CharSet::whitespace()));
+}
 
-    for (; start < m_length && Char::isSpace(m_str[start]); start++);
-    for (; end && Char::isSpace(m_str[end]); end--);
+///////////////////////////////////////////////////////////////////////////////
+String& String::trim(const CharSet& set)
+{
+    char* data = _data();
+    Uint64 start = set.findFirstNotIn(data, m_length);
 
-    if (start > 0 && end < m_length - 1)
+    if (start == npos)
     {
-        Uint64 newSize = end - start + 1;
-        char* newStr = new char[newSize + 1];
-        for (Uint64 i = 0; i < newSize; i++)
-        {
-            newStr[i] = m_str[start + i];
-        }
-        newStr[newSize] = '\0';
-        SAFE_DELETE_ARRAY(m_str);
-        m_str = newStr;
-        m_length = newSize;
+        _clearStr(0);
+        return (*this);
     }
+
+    Uint64 end = set.findLastNotIn(data, m_length) + 1;
+
+    if (start > 0)
+    {
+        std::memmove(data, data + start, end - start);
+    }
+    _clearStr(end - start);
     return (*this);
 }
 
@@ -1369,33 +1642,48 @@ bool String::isEmpty(void) const
     return (m_length == 0);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+inline char* String::_data(void)
+{
+    return (m_str ? m_str : m_local);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline const char* String::_data(void) const
+{
+    return (m_str ? m_str : m_local);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 inline String::StringIterator String::_ibegin(void) const
 {
-    return (StringIterator(m_str, &m_length, 0));
+    return (StringIterator(const_cast<char*>(_data()), &m_length,
+        0));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 inline String::StringIterator String::_rbegin(void) const
 {
-    return (StringIterator(m_str, &m_length, m_length - 1));
+    return (StringIterator(const_cast<char*>(_data()), &m_length,
+        m_length - 1));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 inline String::StringIterator String::_end(void) const
 {
-    return (StringIterator(m_str, &m_length, m_length));
+    return (StringIterator(const_cast<char*>(_data()), &m_length,
+        m_length));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 Uint64 String::_getLength(const String& str, Uint64 position, Uint64 length)
     const
 {
-    if (length == npos)
+    CHECK(position <= str.m_length);
+    if (length > str.m_length - position)
     {
-        length = m_length - position;
+        length = str.m_length - position;
     }
-    CHECK(position + length <= str.m_length);
     return (length);
 }
 
@@ -1411,15 +1699,7 @@ Uint64 String::_getLength(const ConstIterator first,
 ///////////////////////////////////////////////////////////////////////////////
 int String::_compare(const String& other) const
 {
-    if (m_length < other.m_length)
-    {
-        return (1);
-    }
-    if (m_length > other.m_length)
-    {
-        return (-1);
-    }
-    return (CString::strcmp(m_str, other.m_str));
+    return (compare(other));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1435,14 +1715,23 @@ void String::_append(const char* other, Uint64 length)
     {
         return;
     }
-    _increaseCapacity(m_length + length);
-    Uint64 i = 0;
-    for (; i < length; i++)
+    if (m_length + length > m_capacity && _isInside(other))
     {
-        operator[](m_length + i) = other[i];
+        Uint64 offset = other - _data();
+        _increaseCapacity(m_length + length);
+        other = _data() + offset;
     }
-    operator[](m_length + i) = '\0';
-    _setLength(m_length + length);
+    _increaseCapacity(m_length + length);
+    char* data = _data();
+    std::memcpy(data + m_length, other, length);
+    m_length += length;
+    data[m_length] = '\0';
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void String::_appendGrow(char ch)
+{
+    _append(&ch, 1);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1457,180 +1746,187 @@ void String::_insertstr(Uint64 position, const char* other)
 ///////////////////////////////////////////////////////////////////////////////
 void String::_insertstr(Uint64 position, const char* other, Uint64 length)
 {
-    if (position == m_length)
-    {
-        return (_append(other, length));
-    }
     CHECK(position <= m_length);
-    if (length == 0)
-    {
-        return;
-    }
-    _increaseCapacity(m_length + length);
-    if (m_str)
-    {
-        char* buffer = nullptr;
-        _substr(buffer, m_str, position, m_length);
-        _clearStr(position);
-        _append(other, length);
-        _append(buffer, CString::strlen(buffer));
-        SAFE_DELETE(buffer);
-    }
-    else
-    {
-        _append(other, length);
-    }
+    _replace(position, 0, other, length);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void String::_substr(char*& buffer, const char* other, Uint64 position,
-    Uint64 length) const
+void String::_erase(Uint64 position, Uint64 length)
 {
-    CHECK(other != nullptr);
-    _allocCString(buffer, length);
-    for (Uint64 i = 0; i < m_length; i++)
+    length = _getLength(*this, position, length);
+    if (length == 0)
     {
-        buffer[i] = other[position + i];
+        return;
     }
+    char* data = _data();
+    std::memmove(data + position, data + position + length,
+        m_length - position - length + 1);
+    m_length -= length;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void String::_erase(Uint64 position, Uint64 length)
+void String::_replace(Uint64 position, Uint64 length, const char* other,
+    Uint64 n)
 {
     length = _getLength(*this, position, length);
-    for (Uint64 i = position + length; i < m_length; i++)
+    CHECK(other != nullptr || n == 0);
+    if (n != 0 && _isInside(other))
     {
-        operator[](i - length) = operator[](i);
+        String copy(other, n);
+        _replace(position, length, copy._data(), n);
+        return;
+    }
+    char* gap = _makeGap(position, length, n);
+    if (n != 0)
+    {
+        std::memcpy(gap, other, n);
     }
-    _clearStr(m_length - length);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void String::_replace(Uint64 position, Uint64 length, const char* other,
-    Uint64 n)
+void String::_fill(Uint64 position, Uint64 length, Uint64 n, char filler)
 {
-    char* buffer = nullptr;
-    char* rbuffer = nullptr;
+    char* gap = _makeGap(position, length, n);
 
-    length = _getLength(*this, position, length);
-    _substr(buffer, m_str, position + length, m_length);
-    _clearStr(position);
-    _substr(rbuffer, other, 0, n);
-    _append(rbuffer);
-    _append(buffer);
-    SAFE_DELETE(buffer);
-    SAFE_DELETE(rbuffer);
+    std::memset(gap, filler, n);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-Uint64 String::_find(const char* other, Uint64 length, Uint64 position) const
+char* String::_makeGap(Uint64 position, Uint64 length, Uint64 n)
 {
-    Uint64 toReturn = npos;
+    const Uint64 tail = m_length - position - length;
+    const Uint64 newLength = m_length - length + n;
+    char* data = _data();
 
-    if (position == npos)
-    {
-        position = m_length - 1;
-    }
-    for (; position <= m_length; position++)
+    if (newLength > m_capacity)
     {
-        if (operator[](position) == *other &&
-            _findCompare(other, length, position))
+        Uint64 capacity = m_capacity * 2;
+        if (capacity < newLength)
         {
-            toReturn = position;
-            break;
+            capacity = newLength;
         }
+        char* buffer = _allocate(capacity);
+        std::memcpy(buffer, data, position);
+        std::memcpy(buffer + position + n, data + position + length, tail);
+        _deallocate();
+        m_str = buffer;
+        m_capacity = capacity;
+        data = buffer;
     }
-    return (toReturn);
+    else if (length != n)
+    {
+        std::memmove(data + position + n, data + position + length, tail);
+    }
+    m_length = newLength;
+    data[m_length] = '\0';
+    return (data + position);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-Uint64 String::_rfind(const char* other, Uint64 length, Uint64 position) const
+void String::_replaceAll(const char* from, Uint64 fromLength, const char* to,
+    Uint64 toLength)
 {
-    Uint64 toReturn = npos;
+    CHECK(fromLength != 0);
+    if (_isInside(from) || _isInside(to))
+    {
+        String fromCopy(from, fromLength);
+        String toCopy(to, toLength);
+        _replaceAll(fromCopy._data(), fromLength, toCopy._data(), toLength);
+        return;
+    }
 
-    if (position == npos || position + length > m_length + 1)
+    char* data = _data();
+    Uint64 read = StringSearch::find(data, m_length, from, fromLength);
+
+    if (read == npos)
     {
-        position = m_length - length + 1;
+        return;
     }
-    for (Int64 i = (Int64)position; 0 <= i; i--)
+    if (toLength <= fromLength)
     {
-        if (operator[](i) == *other && _findCompare(other, length, i))
+        Uint64 write = read;
+        while (read != npos)
         {
-            toReturn = i;
-            break;
+            Uint64 next = StringSearch::find(data, m_length, from, fromLength,
+                read + fromLength);
+            Uint64 stop = (next == npos ? m_length : next);
+            std::memcpy(data + write, to, toLength);
+            write += toLength;
+            std::memmove(data + write, data + read + fromLength,
+                stop - read - fromLength);
+            write += stop - read - fromLength;
+            read = next;
         }
+        _clearStr(write);
+        return;
     }
-    return (toReturn);
+
+    Uint64 count = 0;
+    for (Uint64 i = read; i != npos; count++)
+    {
+        i = StringSearch::find(data, m_length, from, fromLength,
+            i + fromLength);
+    }
+
+    String result(getAllocator());
+    Uint64 position = 0;
+
+    result.reserve(m_length + count * (toLength - fromLength));
+    while (read != npos)
+    {
+        result._append(data + position, read - position);
+        result._append(to, toLength);
+        position = read + fromLength;
+        read = StringSearch::find(data, m_length, from, fromLength, position);
+    }
+    result._append(data + position, m_length - position);
+    *this = axu::move(result);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool String::_findCompare(const char* other, Uint64 length, Uint64 position)
-    const
+bool String::_isInside(const char* other) const
 {
-    for (Uint64 i = 1; i < length; i++)
-    {
-        if (operator[](position + i) != *(other + i))
-        {
-            return (false);
-        }
-    }
-    return (true);
+    const char* data = _data();
+
+    return (other >= data && other <= data + m_length);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-Uint64 String::_findFirstOf(const char* other, Uint64 length, Uint64 position,
-    bool isTrue) const
+Uint64 String::_find(const char* other, Uint64 length, Uint64 position) const
 {
-    Uint64 toReturn = npos;
+    return (StringSearch::find(_data(), m_length, other, length, position));
+}
 
-    if (position == npos)
-    {
-        position = m_length - 1;
-    }
-    for (; position < m_length; position++)
-    {
-        if (_findOfCompare(other, length, position, isTrue))
-        {
-            toReturn = position;
-            break;
-        }
-    }
-    return (toReturn);
+///////////////////////////////////////////////////////////////////////////////
+Uint64 String::_rfind(const char* other, Uint64 length, Uint64 position) const
+{
+    return (StringSearch::rfind(_data(), m_length, other, length, position));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-Uint64 String::_findLastOf(const char* other, Uint64 length, Uint64 position,
+Uint64 String::_findFirstOf(const char* other, Uint64 length, Uint64 position,
     bool isTrue) const
 {
-    Uint64 toReturn = npos;
+    CharSet set(other, length);
 
-    if (position == npos)
+    if (isTrue)
     {
-        position = m_length - 1;
+        return (set.findFirstIn(_data(), m_length, position));
     }
-    for (Int64 i = (Int64)position; 0 <= i; i--)
-    {
-        if (_findOfCompare(other, length, i, isTrue))
-        {
-            toReturn = i;
-            break;
-        }
-    }
-    return (toReturn);
+    return (set.findFirstNotIn(_data(), m_length, position));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-bool String::_findOfCompare(const char* other, Uint64 length, Uint64 position,
+Uint64 String::_findLastOf(const char* other, Uint64 length, Uint64 position,
     bool isTrue) const
 {
-    for (Uint64 i = 0; i < length; i++)
+    CharSet set(other, length);
+
+    if (isTrue)
     {
-        if (operator[](position) == *(other + i))
-        {
-            return (isTrue);
-        }
+        return (set.findLastIn(_data(), m_length, position));
     }
-    return (false);
+    return (set.findLastNotIn(_data(), m_length, position));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1639,95 +1935,82 @@ void String::_setLength(const Uint64 length)
     if (m_length > length)
     {
         _clearStr(length);
+        return;
     }
-    else if (m_capacity < length)
-    {
-        _increaseCapacity(length);
-    }
+    _increaseCapacity(length);
     m_length = length;
+    _data()[m_length] = '\0';
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void String::_setCapacity(const Uint64 capacity)
 {
-    if (m_capacity == capacity && m_str)
-    {
-        return;
-    }
-    if (capacity < m_length)
+    if (capacity < m_length || capacity == m_capacity)
     {
         return;
     }
-    m_capacity = capacity;
-
-    char* buffer = m_str;
-    m_str = nullptr;
-    _allocCString(m_str, m_capacity);
-    if (buffer)
-    {
-        for (Uint64 i = 0; i < m_length; i++)
-        {
-            operator[](i) = buffer[i];
-        }
-        operator[](m_length) = '\0';
-    }
-    SAFE_DELETE(buffer);
+    _reallocate(capacity);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void String::_increaseCapacity(const Uint64 capacity)
 {
-    if (m_capacity > capacity && m_str)
+    if (m_capacity >= capacity)
     {
         return;
     }
-    Uint64 n = m_capacity;
-    while (n <= capacity)
+    Uint64 n = m_capacity * 2;
+    if (n < capacity)
     {
-        n += m_increaseBy;
+        n = capacity;
     }
-    m_increaseBy++;
-    _setCapacity(n);
+    _reallocate(n);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void String::_decreaseCapacity(const Uint64 capacity)
 {
-    if (m_capacity < capacity)
+    if (m_capacity <= capacity || capacity < m_length)
     {
         return;
     }
-    if (m_increaseBy > 15)
-    {
-        m_increaseBy--;
-    }
-    _setCapacity(capacity);
+    _reallocate(capacity);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void String::_allocCString(char*& buffer, const Uint64 size) const
+void String::_reallocate(const Uint64 capacity)
 {
-    CHECK(!buffer);
-    buffer = new char[size + 1]();
+    if (capacity <= localCapacity)
+    {
+        if (m_str)
+        {
+            std::memcpy(m_local, m_str, m_length + 1);
+            _deallocate();
+        }
+        return;
+    }
+    char* buffer = _allocate(capacity);
+    std::memcpy(buffer, _data(), m_length + 1);
+    _deallocate();
+    m_str = buffer;
+    m_capacity = capacity;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void String::_allocCString(char*& buffer, const Uint64 size, char filler) const
+char* String::_allocate(Uint64 capacity) const
 {
-    _allocCString(buffer, size);
-    _fillStr(buffer, size, 0, filler);
+    return (getAllocator().allocateArray<char>(capacity + 1));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void String::_allocCString(char*& buffer, const Uint64 size,
-    const ConstIterator first) const
+void String::_deallocate(void)
 {
-    _allocCString(buffer, size);
-    ConstIterator begin = first;
-    for (Uint64 i = 0; i < size; i++)
+    if (m_str)
     {
-        buffer[i] = *begin++;
+        getAllocator().deallocateArray(m_str, m_capacity + 1);
+        m_str = nullptr;
     }
+    m_capacity = localCapacity;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1746,7 +2029,7 @@ void String::_fillStr(char* other, const Uint64 length, Uint64 position,
 ///////////////////////////////////////////////////////////////////////////////
 void String::_clearStr(const Uint64 position)
 {
-    _fillStr(m_str, m_length, position, '\0');
+    _data()[position] = '\0';
     m_length = position;
 }
 
@@ -1755,3 +2038,317 @@ void String::swap(String& a, String& b)
 {
     a.swap(b);
 }
+
+///////////////////////////////////////////////////////////////////////////////
+bool String::parseInt(StringView str, Int64& value)
+{
+    Int64 result;
+
+    if (str.isEmpty()
+        || StringNumber::parseInt(str.data(), str.length(), result)
+        != str.length())
+    {
+        return (false);
+    }
+    value = result;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool String::parseUint(StringView str, Uint64& value)
+{
+    Uint64 result;
+
+    if (str.isEmpty()
+        || StringNumber::parseUint(str.data(), str.length(), result)
+        != str.length())
+    {
+        return (false);
+    }
+    value = result;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool String::parseFloat(StringView str, double& value)
+{
+    double result;
+
+    if (str.isEmpty()
+        || StringNumber::parseFloat(str.data(), str.length(), result)
+        != str.length())
+    {
+        return (false);
+    }
+    value = result;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool String::parseFloat(StringView str, float& value)
+{
+    float result;
+
+    if (str.isEmpty()
+        || StringNumber::parseFloat(str.data(), str.length(), result)
+        != str.length())
+    {
+        return (false);
+    }
+    value = result;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String& operator+=(axc::String& lhs, const axc::String& rhs)
+{
+    return (lhs.append(rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String& operator+=(axc::String& lhs, const std::string& rhs)
+{
+    return (lhs.append(rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String& operator+=(axc::String& lhs, const char* rhs)
+{
+    return (lhs.append(rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(const axc::String& lhs, const axc::String& rhs)
+{
+    axc::String result;
+
+    result.reserve(lhs.length() + rhs.length());
+    result.append(lhs).append(rhs);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(const axc::String& lhs, const std::string& rhs)
+{
+    axc::String result;
+
+    result.reserve(lhs.length() + rhs.size());
+    result.append(lhs).append(rhs);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(const std::string& lhs, const axc::String& rhs)
+{
+    axc::String result;
+
+    result.reserve(lhs.size() + rhs.length());
+    result.append(lhs).append(rhs);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(const axc::String& lhs, const char* rhs)
+{
+    axc::String result;
+
+    result.reserve(lhs.length() + std::strlen(rhs));
+    result.append(lhs).append(rhs);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(const char* lhs, const axc::String& rhs)
+{
+    axc::String result;
+
+    result.reserve(std::strlen(lhs) + rhs.length());
+    result.append(lhs).append(rhs);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(const axc::String& lhs, char rhs)
+{
+    axc::String result;
+
+    result.reserve(lhs.length() + 1);
+    result.append(lhs).append(rhs);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(char lhs, const axc::String& rhs)
+{
+    axc::String result;
+
+    result.reserve(1 + rhs.length());
+    result.append(lhs).append(rhs);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(axc::String&& lhs, const axc::String& rhs)
+{
+    return (axu::move(lhs.append(rhs)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(axc::String&& lhs, axc::String&& rhs)
+{
+    return (axu::move(lhs.append(rhs)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(axc::String&& lhs, const std::string& rhs)
+{
+    return (axu::move(lhs.append(rhs)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(axc::String&& lhs, const char* rhs)
+{
+    return (axu::move(lhs.append(rhs)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(axc::String&& lhs, char rhs)
+{
+    return (axu::move(lhs.append(rhs)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(const axc::String& lhs, axc::String&& rhs)
+{
+    return (axu::move(rhs.insert(0, lhs)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(const std::string& lhs, axc::String&& rhs)
+{
+    return (axu::move(rhs.insert(0, lhs)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(const char* lhs, axc::String&& rhs)
+{
+    return (axu::move(rhs.insert(0, lhs)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+axc::String operator+(char lhs, axc::String&& rhs)
+{
+    return (axu::move(rhs.insert(0, lhs)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool operator==(const char* lhs, const axc::String& rhs)
+{
+    return (rhs == lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool operator!=(const char* lhs, const axc::String& rhs)
+{
+    return (rhs != lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const axc::String& rhs)
+{
+    return (lhs.write(rhs.cstr(), rhs.length()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::istream& operator>>(std::istream& lhs, axc::String& rhs)
+{
+    using Traits = std::istream::traits_type;
+    std::istream::sentry sentry(lhs);
+    std::ios_base::iostate state = std::ios_base::goodbit;
+
+    if (!sentry)
+    {
+        return (lhs);
+    }
+    const std::ctype<char>& ctype =
+        std::use_facet<std::ctype<char>>(lhs.getloc());
+    std::streambuf* buffer = lhs.rdbuf();
+    const Uint64 limit = (lhs.width() > 0)
+        ? static_cast<Uint64>(lhs.width()) : axc::String::npos;
+    char chunk[256];
+    Uint64 size = 0;
+    Uint64 count = 0;
+
+    // Characters are staged in a local chunk, so the string grows once per
+    // chunk instead of once per character
+    rhs.clear();
+    for (Traits::int_type ch = buffer->sgetc(); count < limit; count++)
+    {
+        if (Traits::eq_int_type(ch, Traits::eof()))
+        {
+            state |= std::ios_base::eofbit;
+            break;
+        }
+        if (ctype.is(std::ctype_base::space, Traits::to_char_type(ch)))
+        {
+            break;
+        }
+        chunk[size++] = Traits::to_char_type(ch);
+        if (size == sizeof(chunk))
+        {
+            rhs.append(chunk, size);
+            size = 0;
+        }
+        ch = buffer->snextc();
+    }
+    rhs.append(chunk, size);
+    lhs.width(0);
+    if (count == 0)
+    {
+        state |= std::ios_base::failbit;
+    }
+    lhs.setstate(state);
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::istream& getline(std::istream& is, axc::String& str, char delim)
+{
+    std::istream::sentry sentry(is, true);
+    char chunk[512];
+    bool isExtracted = false;
+
+    // A stream that already failed keeps its state and the string its value,
+    // the failbit cleared below only ever comes from a full chunk
+    if (!sentry)
+    {
+        return (is);
+    }
+    str.clear();
+    for (;;)
+    {
+        is.getline(chunk, sizeof(chunk), delim);
+        const Uint64 count = static_cast<Uint64>(is.gcount());
+
+        if (!is.fail())
+        {
+            // The delimiter counts as extracted but is not stored, unless
+            // the line ended with the input
+            str.append(chunk, is.eof() ? count : count - 1);
+            break;
+        }
+        if (is.bad() || is.eof())
+        {
+            if (isExtracted)
+            {
+                is.clear(is.rdstate() & ~std::ios_base::failbit);
+            }
+            break;
+        }
+        // The chunk is full and the line goes on
+        str.append(chunk, count);
+        isExtracted = true;
+        is.clear(is.rdstate() & ~std::ios_base::failbit);
+    }
+    return (is);
+}
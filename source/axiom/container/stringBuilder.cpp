@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/container/stringBuilder.hpp>
+#include <axiom/container/cstring.hpp>
+#include <axiom/container/stringNumber.hpp>
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward StringBuilder from ax::container
+///////////////////////////////////////////////////////////////////////////////
+using ax::container::StringBuilder;
+using ax::container::CString;
+using ax::container::StringNumber;
+using ax::container::StringView;
+using ax::container::String;
+
+///////////////////////////////////////////////////////////////////////////////
+StringBuilder::StringBuilder(Uint64 pieces)
+{
+    m_pieces.reserve(pieces);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringBuilder& StringBuilder::append(String&& str)
+{
+    return (appendCopy(StringView(str.cstr(), str.length())));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringBuilder& StringBuilder::append(const char* str)
+{
+    if (str != nullptr)
+    {
+        _record(str, CString::strlen(str));
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringBuilder& StringBuilder::append(Uint64 length, char filler)
+{
+    if (length != 0)
+    {
+        _extendCopy(length);
+        m_scratch.resize(m_scratch.size() + length, filler);
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringBuilder& StringBuilder::appendCopy(StringView str)
+{
+    _copy(str.data(), str.length());
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringBuilder& StringBuilder::appendInt(Int64 value)
+{
+    char buffer[StringNumber::maxIntLength];
+
+    _copy(buffer, StringNumber::formatInt(buffer, value));
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringBuilder& StringBuilder::appendUint(Uint64 value)
+{
+    char buffer[StringNumber::maxIntLength];
+
+    _copy(buffer, StringNumber::formatUint(buffer, value));
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringBuilder& StringBuilder::appendFloat(double value)
+{
+    char buffer[StringNumber::maxFloatLength];
+
+    _copy(buffer, StringNumber::formatFloat(buffer, value));
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringBuilder& StringBuilder::appendFloat(float value)
+{
+    char buffer[StringNumber::maxFloatLength];
+
+    _copy(buffer, StringNumber::formatFloat(buffer, value));
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StringBuilder::clear(void)
+{
+    m_pieces.clear();
+    m_scratch.clear();
+    m_length = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringBuilder::length(void) const
+{
+    return (m_length);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool StringBuilder::isEmpty(void) const
+{
+    return (m_length == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringBuilder::getPieceCount(void) const
+{
+    return (m_pieces.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD String StringBuilder::toString(void) const
+{
+    String result;
+
+    appendTo(result);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StringBuilder::appendTo(String& str) const
+{
+    const Uint64 position = str.m_length;
+
+    // Sized without filling, as every character is about to be written
+    if (m_length != 0)
+    {
+        str._setLength(position + m_length);
+        copyTo((str.m_str ? str.m_str : str.m_local) + position);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StringBuilder::copyTo(char* buffer) const
+{
+    const char* scratch = m_scratch.data();
+
+    for (const Piece& piece : m_pieces)
+    {
+        const bool isCopy = piece.data == nullptr;
+
+        std::memcpy(buffer, isCopy ? scratch : piece.data, piece.length);
+        scratch += isCopy ? piece.length : 0;
+        buffer += piece.length;
+    }
+}
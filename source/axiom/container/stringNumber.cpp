@@ -0,0 +1,2790 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/container/stringNumber.hpp>
+#include <axiom/utility.hpp>
+#include <cfloat>
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward StringNumber from ax::container
+///////////////////////////////////////////////////////////////////////////////
+using ax::container::StringNumber;
+
+///////////////////////////////////////////////////////////////////////////////
+// Anonymous namespace
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+// SECTION - Arithmetic
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Uint128
+{
+    Uint64 low;     //<!
+    Uint64 high;    //<!
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Full 128-bit product of two words.
+///
+/// \param a
+/// \param b
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint128 multiply(Uint64 a, Uint64 b)
+{
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 product = (unsigned __int128)a * b;
+    return (Uint128{(Uint64)product, (Uint64)(product >> 64)});
+#else
+    const Uint64 lowLow = (a & 0xFFFFFFFFull) * (b & 0xFFFFFFFFull);
+    const Uint64 lowHigh = (a & 0xFFFFFFFFull) * (b >> 32);
+    const Uint64 highLow = (a >> 32) * (b & 0xFFFFFFFFull);
+    const Uint64 highHigh = (a >> 32) * (b >> 32);
+    const Uint64 cross = (lowLow >> 32) + (lowHigh & 0xFFFFFFFFull)
+        + (highLow & 0xFFFFFFFFull);
+    return (Uint128{(cross << 32) | (lowLow & 0xFFFFFFFFull),
+        highHigh + (lowHigh >> 32) + (highLow >> 32) + (cross >> 32)});
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Powers of ten that fit in a word.
+///
+///////////////////////////////////////////////////////////////////////////////
+const Uint64 powersOfTen[20] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull,
+    10000000ull, 100000000ull, 1000000000ull, 10000000000ull,
+    100000000000ull, 1000000000000ull, 10000000000000ull,
+    100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+    100000000000000000ull, 1000000000000000000ull,
+    10000000000000000000ull
+};
+
+// !SECTION
+
+// SECTION - Integer Formatting
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief The hundred two-digit numbers, "00" to "99".
+///
+///////////////////////////////////////////////////////////////////////////////
+const char digitPairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param value
+///
+/// \return The number of decimal digits of `value`, one for zero
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint32 countDigits(Uint64 value)
+{
+    if (value == 0)
+    {
+        return (1);
+    }
+    // 1233 / 4096 is slightly above log10(2)
+    const Uint32 guess = ((ax::utility::highestBit(value) + 1) * 1233) >> 12;
+    return (guess + (value >= powersOfTen[guess] ? 1 : 0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Write the digits of a value backwards, two at a time.
+///
+/// \param end One past the last digit
+/// \param value
+///
+///////////////////////////////////////////////////////////////////////////////
+inline void writeDigits(char* end, Uint64 value)
+{
+    while (value >= 100)
+    {
+        const Uint64 quotient = value / 100;
+        const Uint32 pair = (Uint32)(value - quotient * 100);
+        end -= 2;
+        std::memcpy(end, digitPairs + pair * 2, 2);
+        value = quotient;
+    }
+    if (value >= 10)
+    {
+        std::memcpy(end - 2, digitPairs + value * 2, 2);
+    }
+    else
+    {
+        end[-1] = (char)('0' + value);
+    }
+}
+
+// !SECTION
+
+// SECTION - Shortest Floating-Point Formatting
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Ryu table of floor(2^(bits(5^i) + 124) / 5^i) + 1, as {low, high}.
+///
+///////////////////////////////////////////////////////////////////////////////
+const Uint64 pow5InvSplit[342][2] = {
+    {0x0000000000000001ull, 0x2000000000000000ull},
+    {0x999999999999999Aull, 0x1999999999999999ull},
+    {0x47AE147AE147AE15ull, 0x147AE147AE147AE1ull},
+    {0x6C8B4395810624DEull, 0x10624DD2F1A9FBE7ull},
+    {0x7A786C226809D496ull, 0x1A36E2EB1C432CA5ull},
+    {0x61F9F01B866E43ABull, 0x14F8B588E368F084ull},
+    {0xB4C7F34938583622ull, 0x10C6F7A0B5ED8D36ull},
+    {0x87A6520EC08D236Aull, 0x1AD7F29ABCAF4857ull},
+    {0x9FB841A566D74F88ull, 0x15798EE2308C39DFull},
+    {0xE62D01511F12A607ull, 0x112E0BE826D694B2ull},
+    {0xD6AE6881CB5109A4ull, 0x1B7CDFD9D7BDBAB7ull},
+    {0xDEF1ED34A2A73AEAull, 0x15FD7FE17964955Full},
+    {0x7F27F0F6E885C8BBull, 0x119799812DEA1119ull},
+    {0x650CB4BE40D60DF8ull, 0x1C25C268497681C2ull},
+    {0xEA70909833DE7193ull, 0x16849B86A12B9B01ull},
+    {0x21F3A6E0297EC143ull, 0x1203AF9EE756159Bull},
+    {0x6985D7CD0F313537ull, 0x1CD2B297D889BC2Bull},
+    {0x2137DFD73F5A90F9ull, 0x170EF54646D49689ull},
+    {0xE75FE645CC4873FAull, 0x12725DD1D243ABA0ull},
+    {0xA5663D3C7A0D865Dull, 0x1D83C94FB6D2AC34ull},
+    {0x511E976394D79EB1ull, 0x179CA10C9242235Dull},
+    {0xDA7EDF82DD794BC1ull, 0x12E3B40A0E9B4F7Dull},
+    {0x2A6498D1625BAC68ull, 0x1E392010175EE596ull},
+    {0xEEB6E0A781E2F053ull, 0x182DB34012B25144ull},
+    {0x58924D52CE4F26A9ull, 0x1357C299A88EA76Aull},
+    {0x27507BB7B07EA441ull, 0x1EF2D0F5DA7DD8AAull},
+    {0x52A6C95FC0655034ull, 0x18C240C4AECB13BBull},
+    {0x0EEBD44C99EAA690ull, 0x13CE9A36F23C0FC9ull},
+    {0xB17953ADC3110A80ull, 0x1FB0F6BE50601941ull},
+    {0xC12DDC8B02740867ull, 0x195A5EFEA6B34767ull},
+    {0x3424B06F3529A052ull, 0x14484BFEEBC29F86ull},
+    {0x901D59F290EE19DBull, 0x1039D66589687F9Eull},
+    {0x4CFBC31DB4B0295Full, 0x19F623D5A8A73297ull},
+    {0x3D9635B15D59BAB2ull, 0x14C4E977BA1F5BACull},
+    {0x97AB5E277DE16228ull, 0x109D8792FB4C4956ull},
+    {0xF2ABC9D8C9689D0Dull, 0x1A95A5B7F87A0EF0ull},
+    {0x5BBCA17A3ABA173Eull, 0x154484932D2E725Aull},
+    {0xAFCA1AC82EFB45CBull, 0x11039D428A8B8EAEull},
+    {0xB2DCF7A6B1920945ull, 0x1B38FB9DAA78E44Aull},
+    {0xF57D92EBC141A104ull, 0x15C72FB1552D836Eull},
+    {0xC46475896767B403ull, 0x116C262777579C58ull},
+    {0x6D6D88DBD8A5ECD2ull, 0x1BE03D0BF225C6F4ull},
+    {0x8ABE071646EB23DBull, 0x164CFDA3281E38C3ull},
+    {0x6EFE6C11D255B649ull, 0x11D7314F534B609Cull},
+    {0xB197134FB6EF8A0Eull, 0x1C8B821885456760ull},
+    {0x27AC0F72F8BFA1A5ull, 0x16D601AD376AB91Aull},
+    {0xB95672C260994E1Eull, 0x1244CE242C5560E1ull},
+    {0xF5571E03CDC21695ull, 0x1D3AE36D13BBCE35ull},
+    {0x2AAC18030B01ABABull, 0x17624F8A762FD82Bull},
+    {0xBBBCE0026F348956ull, 0x12B50C6EC4F31355ull},
+    {0x92C7CCD0B1EDA889ull, 0x1DEE7A4AD4B81EEFull},
+    {0xDBD30A408E57BA07ull, 0x17F1FB6F10934BF2ull},
+    {0x7CA8D50071DFC806ull, 0x1327FC58DA0F6FF5ull},
+    {0xFAA7BB33E9660CD6ull, 0x1EA6608E29B24CBBull},
+    {0x9552FC298784D711ull, 0x18851A0B548EA3C9ull},
+    {0xAAA8C9BAD2D0AC0Eull, 0x139DAE6F76D88307ull},
+    {0xDDDADC5E1E1AACE3ull, 0x1F62B0B257C0D1A5ull},
+    {0x7E48B04B4B488A4Full, 0x191BC08EAC9A4151ull},
+    {0xCB6D59D5D5D3A1D9ull, 0x141633A556E1CDDAull},
+    {0x3C577B1177DC817Bull, 0x1011C2EAABE7D7E2ull},
+    {0xC6F25E825960CF2Aull, 0x19B604AAACA62636ull},
+    {0x6BF518684780A5BBull, 0x14919D5556EB51C5ull},
+    {0x232A79ED06008496ull, 0x10747DDDDF22A7D1ull},
+    {0xD1DD8FE1A3340756ull, 0x1A53FC9631D10C81ull},
+    {0xA7E4731AE8F66C45ull, 0x150FFD44F4A73D34ull},
+    {0x531D28E253F8569Eull, 0x10D9976A5D52975Dull},
+    {0xEB61DB03B98D5762ull, 0x1AF5BF109550F22Eull},
+    {0xBC4E48CFC7A445E8ull, 0x159165A6DDDA5B58ull},
+    {0x6371D3D96C836B20ull, 0x11411E1F17E1E2ADull},
+    {0x9F1C8628AD9F11CDull, 0x1B9B6364F3030448ull},
+    {0xE5B06B53BE18DB0Bull, 0x1615E91D8F359D06ull},
+    {0xEAF3890FCB4715A2ull, 0x11AB20E472914A6Bull},
+    {0x44B8DB4C7871BC37ull, 0x1C45016D841BAA46ull},
+    {0x03C715D6C6C1635Full, 0x169D9ABE03495505ull},
+    {0x3638DE456BCDE919ull, 0x1217AEFE69077737ull},
+    {0x56C163A2461641C1ull, 0x1CF2B1970E725858ull},
+    {0xDF011C81D1AB67CEull, 0x17288E1271F51379ull},
+    {0x7F3416CE4155ECA5ull, 0x1286D80EC190DC61ull},
+    {0x6520247D3556476Eull, 0x1DA48CE468E7C702ull},
+    {0xEA801D30F7783925ull, 0x17B6D71D20B96C01ull},
+    {0xBB99B0F3F92CFA84ull, 0x12F8AC174D612334ull},
+    {0x5F5C4E532847F739ull, 0x1E5AACF215683854ull},
+    {0x7F7D0B75B9D32C2Eull, 0x18488A5B44536043ull},
+    {0x9930D5F7C7DC2358ull, 0x136D3B7C36A919CFull},
+    {0x8EB4898C72F9D226ull, 0x1F152BF9F10E8FB2ull},
+    {0x722A07A38F2E41B8ull, 0x18DDBCC7F40BA628ull},
+    {0xC1BB394FA5BE9AFAull, 0x13E497065CD61E86ull},
+    {0x9C5EC2190930F7F6ull, 0x1FD424D6FAF030D7ull},
+    {0x49E56814075A5FF8ull, 0x197683DF2F268D79ull},
+    {0x6E51201005E1E660ull, 0x145ECFE5BF520AC7ull},
+    {0xF1DA800CD181851Aull, 0x104BD984990E6F05ull},
+    {0x4FC400148268D4F5ull, 0x1A12F5A0F4E3E4D6ull},
+    {0xD96999AA01ED772Bull, 0x14DBF7B3F71CB711ull},
+    {0xADEE1488018AC5BCull, 0x10AFF95CC5B09274ull},
+    {0x497CEDA668DE092Cull, 0x1AB328946F80EA54ull},
+    {0x3ACA57B853E4D424ull, 0x155C2076BF9A5510ull},
+    {0x623B7960431D7683ull, 0x1116805EFFAEAA73ull},
+    {0x9D2BF566D1C8BD9Eull, 0x1B5733CB32B110B8ull},
+    {0x7DBCC452416D647Full, 0x15DF5CA28EF40D60ull},
+    {0xCAFD69DB678AB6CCull, 0x117F7D4ED8C33DE6ull},
+    {0xAB2F0FC572778ADFull, 0x1BFF2EE48E052FD7ull},
+    {0x88F273045B92D580ull, 0x1665BF1D3E6A8CACull},
+    {0xD3F528D049424466ull, 0x11EAFF4A98553D56ull},
+    {0xB988414D4203A0A3ull, 0x1CAB3210F3BB9557ull},
+    {0x6139CDD76802E6E9ull, 0x16EF5B40C2FC7779ull},
+    {0xE761717920025254ull, 0x125915CD68C9F92Dull},
+    {0xA568B58E999D5086ull, 0x1D5B561574765B7Cull},
+    {0x5120913EE14AA6D2ull, 0x177C44DDF6C515FDull},
+    {0xA74D40FF1AA21F0Eull, 0x12C9D0B1923744CAull},
+    {0x0BAECE64F769CB4Aull, 0x1E0FB44F50586E11ull},
+    {0x3C8BD850C5EE3C3Bull, 0x180C903F7379F1A7ull},
+    {0xCA0979DA37F1C9C9ull, 0x133D4032C2C7F485ull},
+    {0xA9A8C2F6BFE942DBull, 0x1EC866B79E0CBA6Full},
+    {0x2153CF2BCCBA9BE3ull, 0x18A0522C7E709526ull},
+    {0x1AA9728970954982ull, 0x13B374F06526DDB8ull},
+    {0xF775840F1A88759Dull, 0x1F8587E7083E2F8Cull},
+    {0x5F9136727BA05E17ull, 0x19379FEC0698260Aull},
+    {0x1940F85B9619E4DFull, 0x142C7FF0054684D5ull},
+    {0xE100C6AFAB47EA4Cull, 0x1023998CD1053710ull},
+    {0xCE67A44C453FDD47ull, 0x19D28F47B4D524E7ull},
+    {0xD852E9D69DCCB106ull, 0x14A8729FC3DDB71Full},
+    {0x79DBEE454B0A2738ull, 0x1086C219697E2C19ull},
+    {0x295FE3A211A9D859ull, 0x1A71368F0F30468Full},
+    {0xBAB31C81A7BB137Aull, 0x15275ED8D8F36BA5ull},
+    {0x6228E39AEC95A92Full, 0x10EC4BE0AD8F8951ull},
+    {0x9D0E38F7E0EF7517ull, 0x1B13AC9AAF4C0EE8ull},
+    {0xB0D82D931A592A79ull, 0x15A956E225D67253ull},
+    {0x8D79BE0F4847552Eull, 0x11544581B7DEC1DCull},
+    {0x158F967EDA0BBB7Cull, 0x1BBA08CF8C979C94ull},
+    {0x77A611FF14D62F97ull, 0x162E6D72D6DFB076ull},
+    {0xF951A7FF43DE8C79ull, 0x11BEBDF578B2F391ull},
+    {0xC21C3FFED2FDAD8Eull, 0x1C6463225AB7EC1Cull},
+    {0x01B0333242648AD8ull, 0x16B6B5B5155FF017ull},
+    {0x0159C28E9B83A246ull, 0x122BC490DDE659ACull},
+    {0xCEF604175F3903A3ull, 0x1D12D41AFCA3C2ACull},
+    {0x725E69AC4C2D9C83ull, 0x17424348CA1C9BBDull},
+    {0xF5185489D68AE39Cull, 0x129B69070816E2FDull},
+    {0xEE8D540FBDAB05C6ull, 0x1DC574D80CF16B2Full},
+    {0xBED77672FE226B05ull, 0x17D12A4670C1228Cull},
+    {0xFF12C528CB4EBC04ull, 0x130DBB6B8D674ED6ull},
+    {0xCB513B74787DF9A0ull, 0x1E7C5F127BD87E24ull},
+    {0x090DC929F9FE614Dull, 0x18637F41FCAD31B7ull},
+    {0xA0D7D42194CB810Aull, 0x1382CC34CA2427C5ull},
+    {0x67BFB9CF5478CE77ull, 0x1F37AD21436D0C6Full},
+    {0x1FCC94A5DD2D71F9ull, 0x18F9574DCF8A7059ull},
+    {0x7FD6DD517DBDF4C7ull, 0x13FAAC3E3FA1F37Aull},
+    {0xFFBE2EE8C92FEE0Bull, 0x1FF779FD329CB8C3ull},
+    {0x6631BF20A0F324D6ull, 0x1992C7FDC216FA36ull},
+    {0xB827CC1A1A5C1D78ull, 0x14756CCB01ABFB5Eull},
+    {0x935309AE7B7CE460ull, 0x105DF0A267BCC918ull},
+    {0x1EEB42B0C594A099ull, 0x1A2FE76A3F9474F4ull},
+    {0xE58902270476E6E1ull, 0x14F31F8832DD2A5Cull},
+    {0xB7A0CE859D2BEBE7ull, 0x10C27FA028B0EEB0ull},
+    {0x59014A6F61DFDFD8ull, 0x1AD0CC33744E4AB4ull},
+    {0xE0CDD525E7E64CADull, 0x1573D68F903EA229ull},
+    {0x4D7177518651D6F1ull, 0x11297872D9CBB4EEull},
+    {0x7BE8BEE8D6E957E8ull, 0x1B758D848FAC54B0ull},
+    {0xFCBA3253DF211320ull, 0x15F7A46A0C89DD59ull},
+    {0x63C8284318E74280ull, 0x1192E9EE706E4AAEull},
+    {0x060D0D3827D86A66ull, 0x1C1E43171A4A1117ull},
+    {0x6B3DA42CECAD21EBull, 0x167E9C127B6E7412ull},
+    {0x88FE1CF0BD574E56ull, 0x11FEE341FC585CDBull},
+    {0x419694B462254A23ull, 0x1CCB0536608D615Full},
+    {0x67ABAA29E81DD4E9ull, 0x1708D0F84D3DE77Full},
+    {0xB95621BB2017DD87ull, 0x126D73F9D764B932ull},
+    {0xC223692B668C95A5ull, 0x1D7BECC2F23AC1EAull},
+    {0xCE82BA891ED6DE1Dull, 0x179657025B6234BBull},
+    {0xA53562074BDF1818ull, 0x12DEAC01E2B4F6FCull},
+    {0x3B889CD87964F359ull, 0x1E3113363787F194ull},
+    {0xFC6D4A46C783F5E1ull, 0x18274291C6065ADCull},
+    {0x30576E9F06032B1Aull, 0x13529BA7D19EAF17ull},
+    {0x1A257DCB3CD1DE90ull, 0x1EEA92A61C311825ull},
+    {0x481DFE3C30A7E540ull, 0x18BBA884E35A79B7ull},
+    {0xD34B31C9C0865100ull, 0x13C9539D82AEC7C5ull},
+    {0x5211E942CDA3B4CDull, 0x1FA885C8D117A609ull},
+    {0x74DB21023E1C90A4ull, 0x19539E3A40DFB807ull},
+    {0xF715B401CB4A0D50ull, 0x1442E4FB67196005ull},
+    {0xF8DE299B09080AA7ull, 0x103583FC527AB337ull},
+    {0x8E304291A80CDDD7ull, 0x19EF3993B72AB859ull},
+    {0x3E8D020E200A4B13ull, 0x14BF6142F8EEF9E1ull},
+    {0x653D9B3E80083C0Full, 0x10991A9BFA58C7E7ull},
+    {0x6EC8F864000D2CE4ull, 0x1A8E90F9908E0CA5ull},
+    {0x8BD3F9E999A423EAull, 0x153EDA614071A3B7ull},
+    {0x3CA994BAE1501CBBull, 0x10FF151A99F482F9ull},
+    {0xC775BAC49BB3612Bull, 0x1B31BB5DC320D18Eull},
+    {0xD2C4956A16291A89ull, 0x15C162B168E70E0Bull},
+    {0xDBD0778811BA7BA1ull, 0x11678227871F3E6Full},
+    {0x2C80BF401C5D929Bull, 0x1BD8D03F3E9863E6ull},
+    {0xBD33CC3349E47549ull, 0x16470CFF6546B651ull},
+    {0xCA8FD68F6E505DD4ull, 0x11D270CC51055EA7ull},
+    {0x4419574BE3B3C953ull, 0x1C83E7AD4E6EFDD9ull},
+    {0x0347790982F63AA9ull, 0x16CFEC8AA52597E1ull},
+    {0xCF6C60D468C4FBBAull, 0x123FF06EEA847980ull},
+    {0xE57A34870E07F92Aull, 0x1D331A4B10D3F59Aull},
+    {0x512E906C0B399422ull, 0x175C1508DA432AE2ull},
+    {0xDA8BA6BCD5C7A9B5ull, 0x12B010D3E1CF5581ull},
+    {0x90DF712E22D90F87ull, 0x1DE6815302E5559Cull},
+    {0xDA4C5A8B4F140C6Cull, 0x17EB9AA8CF1DDE16ull},
+    {0xAEA37BA2A5A9A38Aull, 0x1322E220A5B17E78ull},
+    {0x7DD25F6AA2A905A9ull, 0x1E9E369AA2B59727ull},
+    {0x97DB7F888220D154ull, 0x187E92154EF7AC1Full},
+    {0x797C6606CE80A777ull, 0x139874DDD8C6234Cull},
+    {0x8F2D700AE4010BF1ull, 0x1F5A549627A36BADull},
+    {0x0C2459A25000D65Aull, 0x191510781FB5EFBEull},
+    {0x701D1481D99A4515ull, 0x1410D9F9B2F7F2FEull},
+    {0xC017439B147B6A77ull, 0x100D7B2E28C65BFEull},
+    {0xCCF205C4ED9243F2ull, 0x19AF2B7D0E0A2CCAull},
+    {0x0A5B37D0BE0E9CC2ull, 0x148C22CA71A1BD6Full},
+    {0x0848F973CB3EE3CEull, 0x10701BD527B4978Cull},
+    {0xDA0E5BEC78649FB0ull, 0x1A4CF9550C5425ACull},
+    {0x7B3EAFF060507FC0ull, 0x150A6110D6A9B7BDull},
+    {0x95CBBFF380406633ull, 0x10D51A73DEEE2C97ull},
+    {0xEFAC665266CD7052ull, 0x1AEE90B964B04758ull},
+    {0x2623850EB8A459DBull, 0x158BA6FAB6F36C47ull},
+    {0x1E82D0D893B6AE49ull, 0x113C85955F29236Cull},
+    {0xFD9E1AF41F8AB075ull, 0x1B9408EEFEA838ACull},
+    {0x97B1AF29B2D559F7ull, 0x16100725988693BDull},
+    {0xAC8E25BAF5777B2Cull, 0x11A66C1E139EDC97ull},
+    {0x7A7D092B2258C513ull, 0x1C3D79C9B8FE2DBFull},
+    {0x61FDA0EF4EAD6A76ull, 0x169794A160CB57CCull},
+    {0xE7FE1A590BBDEEC5ull, 0x1212DD4DE7091309ull},
+    {0xA6635D5B45FCB13Aull, 0x1CEAFBAFD80E84DCull},
+    {0x851C4AAF6B308DC8ull, 0x172262F3133ED0B0ull},
+    {0xD0E36EF2BC26D7D4ull, 0x1281E8C275CBDA26ull},
+    {0xB49F17EAC6A48C86ull, 0x1D9CA79D894629D7ull},
+    {0x2A18DFEF0550706Bull, 0x17B08617A104EE46ull},
+    {0x54E0B3259DD9F389ull, 0x12F39E794D9D8B6Bull},
+    {0x87CDEB6F62F65274ull, 0x1E5297287C2F4578ull},
+    {0xD30B22BF825EA85Dull, 0x18421286C9BF6AC6ull},
+    {0x0F3C1BCC684BB9E4ull, 0x13680ED23AFF889Full},
+    {0x18602C7A4079296Dull, 0x1F0CE4839198DA98ull},
+    {0x46B356C833942124ull, 0x18D71D360E13E213ull},
+    {0x388F78A029434DB6ull, 0x13DF4A91A4DCB4DCull},
+    {0x5A7F2766A86BAF8Aull, 0x1FCBAA82A1612160ull},
+    {0x153285EBB9EFBFA2ull, 0x196FBB9BB44DB44Dull},
+    {0xAA8ED189618C994Eull, 0x145962E2F6A4903Dull},
+    {0xEED8A7A11AD6E10Cull, 0x1047824F2BB6D9CAull},
+    {0x7E27729B5E249B45ull, 0x1A0C03B1DF8AF611ull},
+    {0xFE85F549181D4904ull, 0x14D6695B193BF80Dull},
+    {0xCB9E5DD4134AA0D0ull, 0x10AB877C142FF9A4ull},
+    {0xDF63C9535211014Dull, 0x1AAC0BF9B9E65C3Aull},
+    {0x191CA10F74DA6771ull, 0x15566FFAFB1EB02Full},
+    {0xADB080D92A4852C1ull, 0x1111F32F2F4BC025ull},
+    {0x15E7348EAA0D5134ull, 0x1B4FEB7EB212CD09ull},
+    {0xAB1F5D3EEE710DC4ull, 0x15D98932280F0A6Dull},
+    {0xBC1917658B8DA49Dull, 0x117AD428200C0857ull},
+    {0x2CF4F23C127C3A94ull, 0x1BF7B9D9CCE00D59ull},
+    {0xF0C3F4FCDB969543ull, 0x165FC7E170B33DE0ull},
+    {0x5A365D9716121103ull, 0x11E6398126F5CB1Aull},
+    {0x9056FC24F01CE804ull, 0x1CA38F350B22DE90ull},
+    {0xD9DF301D8CE3ECD0ull, 0x16E93F5DA2824BA6ull},
+    {0xE17F59B13D8323DAull, 0x125432B14ECEA2EBull},
+    {0x68CBC2B52F38395Cull, 0x1D53844EE47DD179ull},
+    {0x53D6355DBF602DE3ull, 0x177603725064A794ull},
+    {0xA9782AB165E68B1Cull, 0x12C4CF8EA6B6EC76ull},
+    {0x0F26AAB56FD744FAull, 0x1E07B27DD78B13F1ull},
+    {0x3F52222ABFDF6A62ull, 0x18062864AC6F4327ull},
+    {0x65DB4E88997F884Eull, 0x1338205089F29C1Full},
+    {0x6FC54A7428CC0D4Aull, 0x1EC033B40FEA9365ull},
+    {0x596AA1F68709A43Bull, 0x1899C2F673220F84ull},
+    {0xADEEE7F86C07B696ull, 0x13AE3591F5B4D936ull},
+    {0x497E3FF3E00C5756ull, 0x1F7D228322BAF524ull},
+    {0xD464FFF64CD6AC45ull, 0x1930E868E89590E9ull},
+    {0x4383FFF83D7889D1ull, 0x14272053ED4473EEull},
+    {0xCF9CCCC69793A174ull, 0x101F4D0FF1038FF1ull},
+    {0x7F6147A425B90252ull, 0x19CBAE7FE805B31Cull},
+    {0xCC4DD2E9B7C7350Full, 0x14A2F1FFECD15C16ull},
+    {0x3D0B0F215FD290D9ull, 0x10825B3323DAB012ull},
+    {0x61AB4B689950E7C1ull, 0x1A6A2B85062AB350ull},
+    {0x4E22A2BA1440B967ull, 0x1521BC6A6B555C40ull},
+    {0x0B4EE894DD009453ull, 0x10E7C9EEBC4449CDull},
+    {0x1217DA87C800ED51ull, 0x1B0C764AC6D3A948ull},
+    {0xDB46486CA000BDDAull, 0x15A391D56BDC876Cull},
+    {0x490506BD4CCD64AFull, 0x114FA7DDEFE39F8Aull},
+    {0xA8080AC87AE23AB1ull, 0x1BB2A62FE638FF43ull},
+    {0x5339A239FBE82EF4ull, 0x162884F31E93FF69ull},
+    {0x75C7B4FB2FECF25Dull, 0x11BA03F5B20FFF87ull},
+    {0x22D92191E647EA2Eull, 0x1C5CD322B67FFF3Full},
+    {0xB57A8141850654F2ull, 0x16B0A8E891FFFF65ull},
+    {0xC4620101373843F5ull, 0x1226ED86DB3332B7ull},
+    {0x3A366801F1F39FEEull, 0x1D0B15A491EB8459ull},
+    {0xFB5EB99B27F6198Bull, 0x173C115074BC69E0ull},
+    {0x2F7EFAE2865E7AD6ull, 0x129674405D6387E7ull},
+    {0xE597F7D0D6FD9156ull, 0x1DBD86CD6238D971ull},
+    {0x8479930D78CADAABull, 0x17CAD23DE82D7AC1ull},
+    {0xD06142712D6F1556ull, 0x1308A831868AC89Aull},
+    {0x4D686A4EAF182222ull, 0x1E74404F3DAADA91ull},
+    {0xA453883EF279B4E8ull, 0x185D003F6488AEDAull},
+    {0xE9DC6CFF28615D87ull, 0x137D99CC506D58AEull},
+    {0xA960AE650D6895A4ull, 0x1F2F5C7A1A488DE4ull},
+    {0xBAB3BEB73DED4483ull, 0x18F2B061AEA07183ull},
+    {0x2EF6322C318A9D36ull, 0x13F559E7BEE6C136ull},
+    {0xE4BD1D13827761F0ull, 0x1FEEF63F97D79B89ull},
+    {0x83CA7DA9352C4E5Aull, 0x198BF832DFDFAFA1ull},
+    {0x9CA1FE20F756A515ull, 0x146FF9C24CB2F2E7ull},
+    {0x4A1B31B3F9121DAAull, 0x1059949B708F28B9ull},
+    {0x435EB5ECC1B695DDull, 0x1A28EDC580E50DF5ull},
+    {0x35E55E57015EDE4Aull, 0x14ED8B04671DA4C4ull},
+    {0xC4B77EAC0118B1D5ull, 0x10BE08D0527E1D69ull},
+    {0xA12597799B5AB622ull, 0x1AC9A7B3B7302F0Full},
+    {0x4DB7AC6149155E81ull, 0x156E1FC2F8F358D9ull},
+    {0xD7C6238107444B9Bull, 0x1124E63593F5E0ADull},
+    {0x593D059B3ED3AC2Bull, 0x1B6E3D2286563449ull},
+    {0xE0FD9E15CBDC89BCull, 0x15F1CA820511C36Dull},
+    {0xB3FE18116FE3A163ull, 0x118E3B9B37416924ull},
+    {0x866359B57FD29BD1ull, 0x1C16C5C525357507ull},
+    {0xD1E91491330EE30Eull, 0x16789E3750F790D2ull},
+    {0x74BA76DA8F3F1C0Bull, 0x11FA182C40C60D75ull},
+    {0xEDF72490E531C678ull, 0x1CC359E067A348BBull},
+    {0x8B2C1D40B75B052Dull, 0x1702AE4D1FB5D3C9ull},
+    {0x6F567DCD5F7C0424ull, 0x12688B70E62B0FD4ull},
+    {0x7EF0C94898C66D06ull, 0x1D74124E3D11B2EDull},
+    {0x98C0A106E09EBD9Full, 0x17900EA4FDA7C257ull},
+    {0x470080D24D4BCAE6ull, 0x12D9A550CAEC9B79ull},
+    {0xD800CE1D487944A2ull, 0x1E29088144ADC58Eull},
+    {0x1333D8176D2DD082ull, 0x1820D39A9D57D13Full},
+    {0xA8F646792424A6CEull, 0x134D76154AACA765ull},
+    {0x74BD3D8EA03AA47Dull, 0x1EE25688777AA56Full},
+    {0x5D64313EE6955064ull, 0x18B51206C5FBB78Cull},
+    {0x4AB68DCBEBAAA6B7ull, 0x13C40E6BD1962C70ull},
+    {0x1124161312AAA457ull, 0x1FA01712E8F0471Aull},
+    {0xDA8344DC0EEEE9DFull, 0x194CDF4253F36C14ull},
+    {0xE2029D7CD8BF2180ull, 0x143D7F6843292343ull},
+    {0x4E687DFD7A328133ull, 0x103132B9CF541C36ull},
+    {0x4A40C9959050CEB8ull, 0x19E851294BB9C6BDull},
+    {0x0833D477A6A70BC6ull, 0x14B9DA876FC7D231ull},
+    {0xA02976C61EEC096Bull, 0x1094AED2BFD30E8Dull},
+    {0x004257A364ACDBDFull, 0x1A877E1DFFB81749ull},
+    {0xCD01DFB5EA23E319ull, 0x153931B1996012A0ull},
+    {0x70CE4C91881CB5AEull, 0x10FA8E27ADE6754Dull},
+    {0x1AE3ADB5A69455E2ull, 0x1B2A7D0C4970BBAFull},
+    {0x7BE957C4854377E8ull, 0x15BB973D078D62F2ull},
+    {0xC987796A0435F987ull, 0x1162DF64060AB58Eull},
+    {0x75A58F1006BCC271ull, 0x1BD1656CD67788E4ull},
+    {0xF7B7A5A66BCA3527ull, 0x16411DF0AB92D3E9ull},
+    {0x5FC61E1EBCA1C41Full, 0x11CDB18D560F0FEEull},
+    {0xFFA363646102D365ull, 0x1C7C4F4889B1B316ull},
+    {0x32E91C504D9BDC51ull, 0x16C9D906D48E28DFull},
+    {0x8F20E37371497D0Eull, 0x123B140576D820B2ull},
+    {0x7E9B0585820F2E7Cull, 0x1D2B533BF159CDEAull},
+    {0xCBAF379E01A5BECAull, 0x1755DC2FF447D7EEull},
+    {0x0958F94B348498A1ull, 0x12AB168CC36CACBFull},
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Ryu table of the top 125 bits of 5^i, as {low, high}.
+///
+///////////////////////////////////////////////////////////////////////////////
+const Uint64 pow5Split[326][2] = {
+    {0x0000000000000000ull, 0x1000000000000000ull},
+    {0x0000000000000000ull, 0x1400000000000000ull},
+    {0x0000000000000000ull, 0x1900000000000000ull},
+    {0x0000000000000000ull, 0x1F40000000000000ull},
+    {0x0000000000000000ull, 0x1388000000000000ull},
+    {0x0000000000000000ull, 0x186A000000000000ull},
+    {0x0000000000000000ull, 0x1E84800000000000ull},
+    {0x0000000000000000ull, 0x1312D00000000000ull},
+    {0x0000000000000000ull, 0x17D7840000000000ull},
+    {0x0000000000000000ull, 0x1DCD650000000000ull},
+    {0x0000000000000000ull, 0x12A05F2000000000ull},
+    {0x0000000000000000ull, 0x174876E800000000ull},
+    {0x0000000000000000ull, 0x1D1A94A200000000ull},
+    {0x0000000000000000ull, 0x12309CE540000000ull},
+    {0x0000000000000000ull, 0x16BCC41E90000000ull},
+    {0x0000000000000000ull, 0x1C6BF52634000000ull},
+    {0x0000000000000000ull, 0x11C37937E0800000ull},
+    {0x0000000000000000ull, 0x16345785D8A00000ull},
+    {0x0000000000000000ull, 0x1BC16D674EC80000ull},
+    {0x0000000000000000ull, 0x1158E460913D0000ull},
+    {0x0000000000000000ull, 0x15AF1D78B58C4000ull},
+    {0x0000000000000000ull, 0x1B1AE4D6E2EF5000ull},
+    {0x0000000000000000ull, 0x10F0CF064DD59200ull},
+    {0x0000000000000000ull, 0x152D02C7E14AF680ull},
+    {0x0000000000000000ull, 0x1A784379D99DB420ull},
+    {0x0000000000000000ull, 0x108B2A2C28029094ull},
+    {0x0000000000000000ull, 0x14ADF4B7320334B9ull},
+    {0x4000000000000000ull, 0x19D971E4FE8401E7ull},
+    {0x8800000000000000ull, 0x1027E72F1F128130ull},
+    {0xAA00000000000000ull, 0x1431E0FAE6D7217Cull},
+    {0xD480000000000000ull, 0x193E5939A08CE9DBull},
+    {0xC9A0000000000000ull, 0x1F8DEF8808B02452ull},
+    {0xBE04000000000000ull, 0x13B8B5B5056E16B3ull},
+    {0xAD85000000000000ull, 0x18A6E32246C99C60ull},
+    {0xD8E6400000000000ull, 0x1ED09BEAD87C0378ull},
+    {0x878FE80000000000ull, 0x13426172C74D822Bull},
+    {0x6973E20000000000ull, 0x1812F9CF7920E2B6ull},
+    {0x03D0DA8000000000ull, 0x1E17B84357691B64ull},
+    {0x8262889000000000ull, 0x12CED32A16A1B11Eull},
+    {0x22FB2AB400000000ull, 0x178287F49C4A1D66ull},
+    {0xABB9F56100000000ull, 0x1D6329F1C35CA4BFull},
+    {0xCB54395CA0000000ull, 0x125DFA371A19E6F7ull},
+    {0xBE2947B3C8000000ull, 0x16F578C4E0A060B5ull},
+    {0x2DB399A0BA000000ull, 0x1CB2D6F618C878E3ull},
+    {0xFC90400474400000ull, 0x11EFC659CF7D4B8Dull},
+    {0x7BB4500591500000ull, 0x166BB7F0435C9E71ull},
+    {0xDAA16406F5A40000ull, 0x1C06A5EC5433C60Dull},
+    {0xA8A4DE8459868000ull, 0x118427B3B4A05BC8ull},
+    {0xD2CE16256FE82000ull, 0x15E531A0A1C872BAull},
+    {0x87819BAECBE22800ull, 0x1B5E7E08CA3A8F69ull},
+    {0xF4B1014D3F6D5900ull, 0x111B0EC57E6499A1ull},
+    {0x71DD41A08F48AF40ull, 0x1561D276DDFDC00Aull},
+    {0x0E549208B31ADB10ull, 0x1ABA4714957D300Dull},
+    {0x28F4DB456FF0C8EAull, 0x10B46C6CDD6E3E08ull},
+    {0x33321216CBECFB24ull, 0x14E1878814C9CD8Aull},
+    {0xBFFE969C7EE839EDull, 0x1A19E96A19FC40ECull},
+    {0xF7FF1E21CF512434ull, 0x105031E2503DA893ull},
+    {0xF5FEE5AA43256D41ull, 0x14643E5AE44D12B8ull},
+    {0x337E9F14D3EEC892ull, 0x197D4DF19D605767ull},
+    {0x005E46DA08EA7AB6ull, 0x1FDCA16E04B86D41ull},
+    {0xA03AEC4845928CB2ull, 0x13E9E4E4C2F34448ull},
+    {0xC849A75A56F72FDEull, 0x18E45E1DF3B0155Aull},
+    {0x7A5C1130ECB4FBD6ull, 0x1F1D75A5709C1AB1ull},
+    {0xEC798ABE93F11D65ull, 0x13726987666190AEull},
+    {0xA797ED6E38ED64BFull, 0x184F03E93FF9F4DAull},
+    {0x517DE8C9C728BDEFull, 0x1E62C4E38FF87211ull},
+    {0xD2EEB17E1C7976B5ull, 0x12FDBB0E39FB474Aull},
+    {0x87AA5DDDA397D462ull, 0x17BD29D1C87A191Dull},
+    {0xE994F5550C7DC97Bull, 0x1DAC74463A989F64ull},
+    {0x11FD195527CE9DEDull, 0x128BC8ABE49F639Full},
+    {0xD67C5FAA71C24568ull, 0x172EBAD6DDC73C86ull},
+    {0x8C1B77950E32D6C2ull, 0x1CFA698C95390BA8ull},
+    {0x57912ABD28DFC639ull, 0x121C81F7DD43A749ull},
+    {0xAD75756C7317B7C8ull, 0x16A3A275D494911Bull},
+    {0x98D2D2C78FDDA5BAull, 0x1C4C8B1349B9B562ull},
+    {0x9F83C3BCB9EA8794ull, 0x11AFD6EC0E14115Dull},
+    {0x0764B4ABE8652979ull, 0x161BCCA7119915B5ull},
+    {0x493DE1D6E27E73D7ull, 0x1BA2BFD0D5FF5B22ull},
+    {0x6DC6AD264D8F0866ull, 0x1145B7E285BF98F5ull},
+    {0xC938586FE0F2CA80ull, 0x159725DB272F7F32ull},
+    {0x7B866E8BD92F7D20ull, 0x1AFCEF51F0FB5EFFull},
+    {0xAD34051767BDAE34ull, 0x10DE1593369D1B5Full},
+    {0x9881065D41AD19C1ull, 0x15159AF804446237ull},
+    {0x7EA147F492186032ull, 0x1A5B01B605557AC5ull},
+    {0x6F24CCF8DB4F3C1Full, 0x1078E111C3556CBBull},
+    {0x4AEE003712230B27ull, 0x14971956342AC7EAull},
+    {0xDDA98044D6ABCDF0ull, 0x19BCDFABC13579E4ull},
+    {0x0A89F02B062B60B6ull, 0x10160BCB58C16C2Full},
+    {0xCD2C6C35C7B638E4ull, 0x141B8EBE2EF1C73Aull},
+    {0x8077874339A3C71Dull, 0x1922726DBAAE3909ull},
+    {0xE0956914080CB8E4ull, 0x1F6B0F092959C74Bull},
+    {0x6C5D61AC8507F38Eull, 0x13A2E965B9D81C8Full},
+    {0x4774BA17A649F072ull, 0x188BA3BF284E23B3ull},
+    {0x1951E89D8FDC6C8Full, 0x1EAE8CAEF261ACA0ull},
+    {0x0FD3316279E9C3D9ull, 0x132D17ED577D0BE4ull},
+    {0x13C7FDBB186434CFull, 0x17F85DE8AD5C4EDDull},
+    {0x58B9FD29DE7D4203ull, 0x1DF67562D8B36294ull},
+    {0xB7743E3A2B0E4942ull, 0x12BA095DC7701D9Cull},
+    {0xE5514DC8B5D1DB92ull, 0x17688BB5394C2503ull},
+    {0xDEA5A13AE3465277ull, 0x1D42AEA2879F2E44ull},
+    {0x0B2784C4CE0BF38Aull, 0x1249AD2594C37CEBull},
+    {0xCDF165F6018EF06Dull, 0x16DC186EF9F45C25ull},
+    {0x416DBF7381F2AC88ull, 0x1C931E8AB871732Full},
+    {0x88E497A83137ABD5ull, 0x11DBF316B346E7FDull},
+    {0xEB1DBD923D8596CAull, 0x1652EFDC6018A1FCull},
+    {0x25E52CF6CCE6FC7Dull, 0x1BE7ABD3781ECA7Cull},
+    {0x97AF3C1A40105DCEull, 0x1170CB642B133E8Dull},
+    {0xFD9B0B20D0147542ull, 0x15CCFE3D35D80E30ull},
+    {0x3D01CDE904199292ull, 0x1B403DCC834E11BDull},
+    {0x462120B1A28FFB9Bull, 0x1108269FD210CB16ull},
+    {0xD7A968DE0B33FA82ull, 0x154A3047C694FDDBull},
+    {0xCD93C3158E00F923ull, 0x1A9CBC59B83A3D52ull},
+    {0xC07C59ED78C09BB6ull, 0x10A1F5B813246653ull},
+    {0xB09B7068D6F0C2A3ull, 0x14CA732617ED7FE8ull},
+    {0xDCC24C830CACF34Cull, 0x19FD0FEF9DE8DFE2ull},
+    {0xC9F96FD1E7EC180Full, 0x103E29F5C2B18BEDull},
+    {0x3C77CBC661E71E13ull, 0x144DB473335DEEE9ull},
+    {0x8B95BEB7FA60E598ull, 0x1961219000356AA3ull},
+    {0x6E7B2E65F8F91EFEull, 0x1FB969F40042C54Cull},
+    {0xC50CFCFFBB9BB35Full, 0x13D3E2388029BB4Full},
+    {0xB6503C3FAA82A037ull, 0x18C8DAC6A0342A23ull},
+    {0xA3E44B4F95234844ull, 0x1EFB1178484134ACull},
+    {0xE66EAF11BD360D2Bull, 0x135CEAEB2D28C0EBull},
+    {0xE00A5AD62C839075ull, 0x183425A5F872F126ull},
+    {0x980CF18BB7A47493ull, 0x1E412F0F768FAD70ull},
+    {0x5F0816F752C6C8DCull, 0x12E8BD69AA19CC66ull},
+    {0xF6CA1CB527787B13ull, 0x17A2ECC414A03F7Full},
+    {0xF47CA3E2715699D7ull, 0x1D8BA7F519C84F5Full},
+    {0xF8CDE66D86D62026ull, 0x127748F9301D319Bull},
+    {0xF7016008E88BA830ull, 0x17151B377C247E02ull},
+    {0xB4C1B80B22AE923Cull, 0x1CDA62055B2D9D83ull},
+    {0x50F91306F5AD1B65ull, 0x12087D4358FC8272ull},
+    {0xE53757C8B318623Full, 0x168A9C942F3BA30Eull},
+    {0x9E852DBADFDE7ACFull, 0x1C2D43B93B0A8BD2ull},
+    {0xA3133C94CBEB0CC1ull, 0x119C4A53C4E69763ull},
+    {0x8BD80BB9FEE5CFF1ull, 0x16035CE8B6203D3Cull},
+    {0xAECE0EA87E9F43EEull, 0x1B843422E3A84C8Bull},
+    {0x4D40C9294F238A75ull, 0x1132A095CE492FD7ull},
+    {0x2090FB73A2EC6D12ull, 0x157F48BB41DB7BCDull},
+    {0x68B53A508BA78856ull, 0x1ADF1AEA12525AC0ull},
+    {0x417144725748B536ull, 0x10CB70D24B7378B8ull},
+    {0x51CD958EED1AE283ull, 0x14FE4D06DE5056E6ull},
+    {0xE640FAF2A8619B24ull, 0x1A3DE04895E46C9Full},
+    {0xEFE89CD7A93D00F7ull, 0x1066AC2D5DAEC3E3ull},
+    {0xEBE2C40D938C4134ull, 0x14805738B51A74DCull},
+    {0x26DB7510F86F5181ull, 0x19A06D06E2611214ull},
+    {0x9849292A9B4592F1ull, 0x100444244D7CAB4Cull},
+    {0xBE5B73754216F7ADull, 0x1405552D60DBD61Full},
+    {0xADF25052929CB598ull, 0x1906AA78B912CBA7ull},
+    {0x996EE4673743E2FFull, 0x1F485516E7577E91ull},
+    {0xFFE54EC0828A6DDFull, 0x138D352E5096AF1Aull},
+    {0xBFDEA270A32D0957ull, 0x18708279E4BC5AE1ull},
+    {0x2FD64B0CCBF84BADull, 0x1E8CA3185DEB719Aull},
+    {0x5DE5EEE7FF7B2F4Cull, 0x1317E5EF3AB32700ull},
+    {0x755F6AA1FF59FB1Full, 0x17DDDF6B095FF0C0ull},
+    {0x92B7454A7F3079E7ull, 0x1DD55745CBB7ECF0ull},
+    {0x5BB28B4E8F7E4C30ull, 0x12A5568B9F52F416ull},
+    {0xF29F2E22335DDF3Cull, 0x174EAC2E8727B11Bull},
+    {0xEF46F9AAC035570Bull, 0x1D22573A28F19D62ull},
+    {0xD58C5C0AB8215667ull, 0x123576845997025Dull},
+    {0x4AEF730D6629AC01ull, 0x16C2D4256FFCC2F5ull},
+    {0x9DAB4FD0BFB41701ull, 0x1C73892ECBFBF3B2ull},
+    {0xA28B11E277D08E60ull, 0x11C835BD3F7D784Full},
+    {0x8B2DD65B15C4B1F9ull, 0x163A432C8F5CD663ull},
+    {0x6DF94BF1DB35DE77ull, 0x1BC8D3F7B3340BFCull},
+    {0xC4BBCF772901AB0Aull, 0x115D847AD000877Dull},
+    {0x35EAC354F34215CDull, 0x15B4E5998400A95Dull},
+    {0x8365742A30129B40ull, 0x1B221EFFE500D3B4ull},
+    {0xD21F689A5E0BA108ull, 0x10F5535FEF208450ull},
+    {0x06A742C0F58E894Aull, 0x1532A837EAE8A565ull},
+    {0x4851137132F22B9Dull, 0x1A7F5245E5A2CEBEull},
+    {0xED32AC26BFD75B42ull, 0x108F936BAF85C136ull},
+    {0xA87F57306FCD3212ull, 0x14B378469B673184ull},
+    {0xD29F2CFC8BC07E97ull, 0x19E056584240FDE5ull},
+    {0xA3A37C1DD7584F1Eull, 0x102C35F729689EAFull},
+    {0x8C8C5B254D2E62E6ull, 0x14374374F3C2C65Bull},
+    {0x6FAF71EEA079FB9Full, 0x1945145230B377F2ull},
+    {0x0B9B4E6A48987A87ull, 0x1F965966BCE055EFull},
+    {0x674111026D5F4C94ull, 0x13BDF7E0360C35B5ull},
+    {0xC111554308B71FBAull, 0x18AD75D8438F4322ull},
+    {0x7155AA93CAE4E7A8ull, 0x1ED8D34E547313EBull},
+    {0x26D58A9C5ECF10C9ull, 0x13478410F4C7EC73ull},
+    {0xF08AED437682D4FBull, 0x1819651531F9E78Full},
+    {0xECADA89454238A3Aull, 0x1E1FBE5A7E786173ull},
+    {0x73EC895CB4963664ull, 0x12D3D6F88F0B3CE8ull},
+    {0x90E7ABB3E1BBC3FDull, 0x1788CCB6B2CE0C22ull},
+    {0x352196A0DA2AB4FDull, 0x1D6AFFE45F818F2Bull},
+    {0x0134FE24885AB11Eull, 0x1262DFEEBBB0F97Bull},
+    {0xC1823DADAA715D65ull, 0x16FB97EA6A9D37D9ull},
+    {0x31E2CD19150DB4BFull, 0x1CBA7DE5054485D0ull},
+    {0x1F2DC02FAD2890F7ull, 0x11F48EAF234AD3A2ull},
+    {0xA6F9303B9872B535ull, 0x1671B25AEC1D888Aull},
+    {0x50B77C4A7E8F6282ull, 0x1C0E1EF1A724EAADull},
+    {0x5272ADAE8F199D91ull, 0x1188D357087712ACull},
+    {0x670F591A32E004F6ull, 0x15EB082CCA94D757ull},
+    {0x40D32F60BF980633ull, 0x1B65CA37FD3A0D2Dull},
+    {0x4883FD9C77BF03E0ull, 0x111F9E62FE44483Cull},
+    {0x5AA4FD0395AEC4D8ull, 0x156785FBBDD55A4Bull},
+    {0x314E3C447B1A760Eull, 0x1AC1677AAD4AB0DEull},
+    {0xDED0E5AACCF089C9ull, 0x10B8E0ACAC4EAE8Aull},
+    {0x96851F15802CAC3Bull, 0x14E718D7D7625A2Dull},
+    {0xFC2666DAE037D74Aull, 0x1A20DF0DCD3AF0B8ull},
+    {0x9D980048CC22E68Eull, 0x10548B68A044D673ull},
+    {0x84FE005AFF2BA032ull, 0x1469AE42C8560C10ull},
+    {0xA63D8071BEF6883Eull, 0x198419D37A6B8F14ull},
+    {0xCFCCE08E2EB42A4Eull, 0x1FE52048590672D9ull},
+    {0x21E00C58DD309A70ull, 0x13EF342D37A407C8ull},
+    {0x2A580F6F147CC10Dull, 0x18EB0138858D09BAull},
+    {0xB4EE134AD99BF150ull, 0x1F25C186A6F04C28ull},
+    {0x7114CC0EC80176D2ull, 0x137798F428562F99ull},
+    {0xCD59FF127A01D486ull, 0x18557F31326BBB7Full},
+    {0xC0B07ED7188249A8ull, 0x1E6ADEFD7F06AA5Full},
+    {0xD86E4F466F516E09ull, 0x1302CB5E6F642A7Bull},
+    {0xCE89E3180B25C98Bull, 0x17C37E360B3D351Aull},
+    {0x822C5BDE0DEF3BEEull, 0x1DB45DC38E0C8261ull},
+    {0xF15BB96AC8B58575ull, 0x1290BA9A38C7D17Cull},
+    {0x2DB2A7C57AE2E6D2ull, 0x1734E940C6F9C5DCull},
+    {0x391F51B6D99BA086ull, 0x1D022390F8B83753ull},
+    {0x03B3931248014454ull, 0x1221563A9B732294ull},
+    {0x04A077D6DA019569ull, 0x16A9ABC9424FEB39ull},
+    {0x45C895CC9081FAC3ull, 0x1C5416BB92E3E607ull},
+    {0x8B9D5D9FDA513CBAull, 0x11B48E353BCE6FC4ull},
+    {0xAE84B507D0E58BE8ull, 0x1621B1C28AC20BB5ull},
+    {0x1A25E249C51EEEE3ull, 0x1BAA1E332D728EA3ull},
+    {0xF057AD6E1B33554Dull, 0x114A52DFFC679925ull},
+    {0x6C6D98C9A2002AA1ull, 0x159CE797FB817F6Full},
+    {0x4788FEFC0A803549ull, 0x1B04217DFA61DF4Bull},
+    {0x0CB59F5D8690214Eull, 0x10E294EEBC7D2B8Full},
+    {0xCFE30734E83429A1ull, 0x151B3A2A6B9C7672ull},
+    {0x83DBC9022241340Aull, 0x1A6208B50683940Full},
+    {0xB2695DA15568C086ull, 0x107D457124123C89ull},
+    {0x1F03B509AAC2F0A7ull, 0x149C96CD6D16CBACull},
+    {0x26C4A24C1573ACD1ull, 0x19C3BC80C85C7E97ull},
+    {0x783AE56F8D684C03ull, 0x101A55D07D39CF1Eull},
+    {0x16499ECB70C25F03ull, 0x1420EB449C8842E6ull},
+    {0x9BDC067E4CF2F6C4ull, 0x19292615C3AA539Full},
+    {0x82D3081DE02FB476ull, 0x1F736F9B3494E887ull},
+    {0xB1C3E512AC1DD0C9ull, 0x13A825C100DD1154ull},
+    {0xDE34DE57572544FCull, 0x18922F31411455A9ull},
+    {0x55C215ED2CEE963Bull, 0x1EB6BAFD91596B14ull},
+    {0xB5994DB43C151DE5ull, 0x133234DE7AD7E2ECull},
+    {0xE2FFA1214B1A655Eull, 0x17FEC216198DDBA7ull},
+    {0xDBBF89699DE0FEB6ull, 0x1DFE729B9FF15291ull},
+    {0x2957B5E202AC9F31ull, 0x12BF07A143F6D39Bull},
+    {0xF3ADA35A8357C6FEull, 0x176EC98994F48881ull},
+    {0x70990C31242DB8BDull, 0x1D4A7BEBFA31AAA2ull},
+    {0x865FA79EB69C9376ull, 0x124E8D737C5F0AA5ull},
+    {0xE7F791866443B854ull, 0x16E230D05B76CD4Eull},
+    {0xA1F575E7FD54A669ull, 0x1C9ABD04725480A2ull},
+    {0xA53969B0FE54E801ull, 0x11E0B622C774D065ull},
+    {0x0E87C41D3DEA2202ull, 0x1658E3AB7952047Full},
+    {0xD229B5248D64AA82ull, 0x1BEF1C9657A6859Eull},
+    {0x435A1136D85EEA91ull, 0x117571DDF6C81383ull},
+    {0x143095848E76A536ull, 0x15D2CE55747A1864ull},
+    {0x193CBAE5B2144E83ull, 0x1B4781EAD1989E7Dull},
+    {0x2FC5F4CF8F4CB112ull, 0x110CB132C2FF630Eull},
+    {0xBBB77203731FDD56ull, 0x154FDD7F73BF3BD1ull},
+    {0x2AA54E844FE7D4ACull, 0x1AA3D4DF50AF0AC6ull},
+    {0xDAA75112B1F0E4EBull, 0x10A6650B926D66BBull},
+    {0xD15125575E6D1E26ull, 0x14CFFE4E7708C06Aull},
+    {0x85A56EAD360865B0ull, 0x1A03FDE214CAF085ull},
+    {0x7387652C41C53F8Eull, 0x10427EAD4CFED653ull},
+    {0x50693E7752368F71ull, 0x14531E58A03E8BE8ull},
+    {0x64838E1526C4334Eull, 0x1967E5EEC84E2EE2ull},
+    {0xFDA4719A70754022ull, 0x1FC1DF6A7A61BA9Aull},
+    {0xDE86C70086494815ull, 0x13D92BA28C7D14A0ull},
+    {0x162878C0A7DB9A1Aull, 0x18CF768B2F9C59C9ull},
+    {0x5BB296F0D1D280A1ull, 0x1F03542DFB83703Bull},
+    {0x194F9E5683239064ull, 0x1362149CBD322625ull},
+    {0x5FA385EC23EC747Eull, 0x183A99C3EC7EAFAEull},
+    {0xF78C67672CE7919Dull, 0x1E494034E79E5B99ull},
+    {0x3AB7C0A07C10BB02ull, 0x12EDC82110C2F940ull},
+    {0x4965B0C89B14E9C3ull, 0x17A93A2954F3B790ull},
+    {0x5BBF1CFAC1DA2433ull, 0x1D9388B3AA30A574ull},
+    {0xB957721CB92856A0ull, 0x127C35704A5E6768ull},
+    {0xE7AD4EA3E7726C48ull, 0x171B42CC5CF60142ull},
+    {0xA198A24CE14F075Aull, 0x1CE2137F74338193ull},
+    {0x44FF65700CD16498ull, 0x120D4C2FA8A030FCull},
+    {0x563F3ECC1005BDBEull, 0x16909F3B92C83D3Bull},
+    {0x2BCF0E7F14072D2Eull, 0x1C34C70A777A4C8Aull},
+    {0x5B61690F6C847C3Dull, 0x11A0FC668AAC6FD6ull},
+    {0xF239C35347A59B4Cull, 0x16093B802D578BCBull},
+    {0xEEC83428198F021Full, 0x1B8B8A6038AD6EBEull},
+    {0x553D20990FF96153ull, 0x1137367C236C6537ull},
+    {0x2A8C68BF53F7B9A8ull, 0x1585041B2C477E85ull},
+    {0x752F82EF28F5A812ull, 0x1AE64521F7595E26ull},
+    {0x093DB1D57999890Bull, 0x10CFEB353A97DAD8ull},
+    {0x0B8D1E4AD7FFEB4Eull, 0x1503E602893DD18Eull},
+    {0x8E7065DD8DFFE622ull, 0x1A44DF832B8D45F1ull},
+    {0xF9063FAA78BFEFD5ull, 0x106B0BB1FB384BB6ull},
+    {0xB747CF9516EFEBCAull, 0x1485CE9E7A065EA4ull},
+    {0xE519C37A5CABE6BDull, 0x19A742461887F64Dull},
+    {0xAF301A2C79EB7036ull, 0x1008896BCF54F9F0ull},
+    {0xDAFC20B798664C43ull, 0x140AABC6C32A386Cull},
+    {0x11BB28E57E7FDF54ull, 0x190D56B873F4C688ull},
+    {0x1629F31EDE1FD72Aull, 0x1F50AC6690F1F82Aull},
+    {0x4DDA37F34AD3E67Aull, 0x13926BC01A973B1Aull},
+    {0xE150C5F01D88E019ull, 0x187706B0213D09E0ull},
+    {0x19A4F76C24EB181Full, 0x1E94C85C298C4C59ull},
+    {0xB0071AA39712EF13ull, 0x131CFD3999F7AFB7ull},
+    {0x9C08E14C7CD7AAD8ull, 0x17E43C8800759BA5ull},
+    {0x030B199F9C0D958Eull, 0x1DDD4BAA0093028Full},
+    {0x61E6F003C1887D79ull, 0x12AA4F4A405BE199ull},
+    {0xBA60AC04B1EA9CD7ull, 0x1754E31CD072D9FFull},
+    {0xA8F8D705DE65440Dull, 0x1D2A1BE4048F907Full},
+    {0xC99B8663AAFF4A88ull, 0x123A516E82D9BA4Full},
+    {0xBC0267FC95BF1D2Aull, 0x16C8E5CA239028E3ull},
+    {0xAB0301FBBB2EE474ull, 0x1C7B1F3CAC74331Cull},
+    {0xEAE1E13D54FD4EC9ull, 0x11CCF385EBC89FF1ull},
+    {0x659A598CAA3CA27Bull, 0x1640306766BAC7EEull},
+    {0xFF00EFEFD4CBCB1Aull, 0x1BD03C81406979E9ull},
+    {0x3F6095F5E4FF5EF0ull, 0x116225D0C841EC32ull},
+    {0xCF38BB735E3F36ACull, 0x15BAAF44FA52673Eull},
+    {0x8306EA5035CF0457ull, 0x1B295B1638E7010Eull},
+    {0x11E4527221A162B6ull, 0x10F9D8EDE39060A9ull},
+    {0x565D670EAA09BB64ull, 0x15384F295C7478D3ull},
+    {0x2BF4C0D2548C2A3Dull, 0x1A8662F3B3919708ull},
+    {0x1B78F88374D79A66ull, 0x1093FDD8503AFE65ull},
+    {0x625736A4520D8100ull, 0x14B8FD4E6449BDFEull},
+    {0xFAED044D6690E140ull, 0x19E73CA1FD5C2D7Dull},
+    {0xBCD422B0601A8CC8ull, 0x103085E53E599C6Eull},
+    {0x6C092B5C78212FFAull, 0x143CA75E8DF0038Aull},
+    {0x070B763396297BF8ull, 0x194BD136316C046Dull},
+    {0x48CE53C07BB3DAF6ull, 0x1F9EC583BDC70588ull},
+    {0x2D80F4584D5068DAull, 0x13C33B72569C6375ull},
+    {0x78E1316E60A48310ull, 0x18B40A4EEC437C52ull},
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Decimal value, mantissa times 10 to the exponent.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Decimal
+{
+    Uint64 mantissa;    //<!
+    Int32 exponent;     //<!
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param e In [0, 3528]
+///
+/// \return The number of bits of 5^e
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Int32 pow5Bits(Int32 e)
+{
+    return ((Int32)(((Uint32)e * 1217359) >> 19) + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param e In [0, 1650]
+///
+/// \return floor(log10(2^e))
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint32 log10Pow2(Int32 e)
+{
+    return (((Uint32)e * 78913) >> 18);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param e In [0, 2620]
+///
+/// \return floor(log10(5^e))
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint32 log10Pow5(Int32 e)
+{
+    return (((Uint32)e * 732923) >> 20);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param value
+/// \param p
+///
+/// \return Whether 5^p divides `value`
+///
+///////////////////////////////////////////////////////////////////////////////
+inline bool multipleOfPowerOf5(Uint64 value, Uint32 p)
+{
+    Uint32 count = 0;
+
+    while (value % 5 == 0)
+    {
+        value /= 5;
+        count++;
+    }
+    return (count >= p);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param value
+/// \param p
+///
+/// \return Whether 2^p divides `value`
+///
+///////////////////////////////////////////////////////////////////////////////
+inline bool multipleOfPowerOf2(Uint64 value, Uint32 p)
+{
+    return ((value & ((1ull << p) - 1)) == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param m
+/// \param factor 128-bit factor, as {low, high}
+/// \param shift Greater than 64
+///
+/// \return floor(m * factor / 2^shift)
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint64 mulShift64(Uint64 m, const Uint64* factor, Int32 shift)
+{
+    const Uint128 low = multiply(m, factor[0]);
+    const Uint128 high = multiply(m, factor[1]);
+    const Uint64 sum = high.low + low.high;
+    const Uint64 carry = sum < high.low ? 1 : 0;
+    const Int32 bits = shift - 64;
+    return ((sum >> bits) | ((high.high + carry) << (64 - bits)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Shortest decimal that reads back as the given binary value (Ryu).
+///
+/// Written for doubles, it also serves floats: the interval of the values
+/// rounding to a float is narrower, and the 128-bit factors are more than
+/// precise enough for its shorter mantissa.
+///
+/// \param ieeeMantissa
+/// \param ieeeExponent
+/// \param mantissaBits
+/// \param bias
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+Decimal shortest(Uint64 ieeeMantissa, Uint32 ieeeExponent,
+    Uint32 mantissaBits, Int32 bias)
+{
+    Int32 e2;
+    Uint64 m2;
+
+    if (ieeeExponent == 0)
+    {
+        e2 = 1 - bias - (Int32)mantissaBits - 2;
+        m2 = ieeeMantissa;
+    }
+    else
+    {
+        e2 = (Int32)ieeeExponent - bias - (Int32)mantissaBits - 2;
+        m2 = (1ull << mantissaBits) | ieeeMantissa;
+    }
+    const bool acceptBounds = (m2 & 1) == 0;
+
+    // The interval of the values that round to m2 is (mm, mp) * 2^e2, and
+    // mm is closer when m2 is the lowest mantissa of its binade
+    const Uint64 mv = 4 * m2;
+    const Uint32 mmShift = (ieeeMantissa != 0 || ieeeExponent <= 1) ? 1 : 0;
+
+    Uint64 vr;
+    Uint64 vp;
+    Uint64 vm;
+    Int32 e10;
+    bool vmIsTrailingZeros = false;
+    bool vrIsTrailingZeros = false;
+    if (e2 >= 0)
+    {
+        const Uint32 q = log10Pow2(e2) - (e2 > 3 ? 1 : 0);
+        e10 = (Int32)q;
+        const Int32 k = 125 + pow5Bits((Int32)q) - 1;
+        const Int32 i = -e2 + (Int32)q + k;
+        vr = mulShift64(mv, pow5InvSplit[q], i);
+        vp = mulShift64(mv + 2, pow5InvSplit[q], i);
+        vm = mulShift64(mv - 1 - mmShift, pow5InvSplit[q], i);
+        if (q <= 21)
+        {
+            // Only one of mp, mv and mm can be a multiple of 5, if any
+            if (mv % 5 == 0)
+            {
+                vrIsTrailingZeros = multipleOfPowerOf5(mv, q);
+            }
+            else if (acceptBounds)
+            {
+                vmIsTrailingZeros = multipleOfPowerOf5(mv - 1 - mmShift, q);
+            }
+            else
+            {
+                vp -= multipleOfPowerOf5(mv + 2, q) ? 1 : 0;
+            }
+        }
+    }
+    else
+    {
+        const Uint32 q = log10Pow5(-e2) - (-e2 > 1 ? 1 : 0);
+        e10 = (Int32)q + e2;
+        const Int32 i = -e2 - (Int32)q;
+        const Int32 k = pow5Bits(i) - 125;
+        const Int32 j = (Int32)q - k;
+        vr = mulShift64(mv, pow5Split[i], j);
+        vp = mulShift64(mv + 2, pow5Split[i], j);
+        vm = mulShift64(mv - 1 - mmShift, pow5Split[i], j);
+        if (q <= 1)
+        {
+            // mv has at least two trailing zero bits, mp at least one, and
+            // mm one exactly when mmShift is one
+            vrIsTrailingZeros = true;
+            if (acceptBounds)
+            {
+                vmIsTrailingZeros = mmShift == 1;
+            }
+            else
+            {
+                vp--;
+            }
+        }
+        else if (q < 63)
+        {
+            vrIsTrailingZeros = multipleOfPowerOf2(mv, q);
+        }
+    }
+
+    // Remove the digits that vp and vm share no more, rounding vr
+    Int32 removed = 0;
+    Uint32 lastRemovedDigit = 0;
+    Uint64 output;
+    if (vmIsTrailingZeros || vrIsTrailingZeros)
+    {
+        while (vp / 10 > vm / 10)
+        {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = (Uint32)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vmIsTrailingZeros)
+        {
+            while (vm % 10 == 0)
+            {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = (Uint32)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0)
+        {
+            // Exactly halfway, round to even
+            lastRemovedDigit = 4;
+        }
+        output = vr + (((vr == vm && (!acceptBounds || !vmIsTrailingZeros))
+            || lastRemovedDigit >= 5) ? 1 : 0);
+    }
+    else
+    {
+        bool roundUp = false;
+        if (vp / 100 > vm / 100)
+        {
+            roundUp = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10)
+        {
+            roundUp = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + ((vr == vm || roundUp) ? 1 : 0);
+    }
+    return (Decimal{output, e10 + removed});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Lay a decimal out, in fixed or scientific notation.
+///
+/// \param buffer
+/// \param negative
+/// \param decimal
+///
+/// \return The number of characters written
+///
+///////////////////////////////////////////////////////////////////////////////
+Uint64 writeDecimal(char* buffer, bool negative, Decimal decimal)
+{
+    char* out = buffer;
+
+    if (negative)
+    {
+        *out++ = '-';
+    }
+    const Int32 digits = (Int32)countDigits(decimal.mantissa);
+    const Int32 scientific = digits - 1 + decimal.exponent;
+
+    if (scientific >= -6 && scientific < 21)
+    {
+        if (decimal.exponent >= 0)
+        {
+            // Integer, 1500 written as 15 and two zeros
+            writeDigits(out + digits, decimal.mantissa);
+            out += digits;
+            std::memset(out, '0', (Uint64)decimal.exponent);
+            out += decimal.exponent;
+        }
+        else if (scientific >= 0)
+        {
+            // Point inside the digits, the integer part moves one left
+            writeDigits(out + digits + 1, decimal.mantissa);
+            std::memmove(out, out + 1, (Uint64)scientific + 1);
+            out[scientific + 1] = '.';
+            out += digits + 1;
+        }
+        else
+        {
+            // Below one, leading zeros after the point
+            const Int32 zeros = -scientific - 1;
+            out[0] = '0';
+            out[1] = '.';
+            std::memset(out + 2, '0', (Uint64)zeros);
+            out += 2 + zeros;
+            writeDigits(out + digits, decimal.mantissa);
+            out += digits;
+        }
+        return ((Uint64)(out - buffer));
+    }
+
+    // First digit, point, other digits, then the exponent
+    writeDigits(out + digits + 1, decimal.mantissa);
+    out[0] = out[1];
+    if (digits > 1)
+    {
+        out[1] = '.';
+        out += digits + 1;
+    }
+    else
+    {
+        out += 1;
+    }
+    *out++ = 'e';
+    *out++ = scientific < 0 ? '-' : '+';
+    const Uint32 exponent = (Uint32)(scientific < 0 ? -scientific
+        : scientific);
+    const Uint32 exponentDigits = countDigits(exponent);
+    writeDigits(out + exponentDigits, exponent);
+    out += exponentDigits;
+    return ((Uint64)(out - buffer));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Format a binary floating-point value given by its fields.
+///
+/// \param buffer
+/// \param negative
+/// \param ieeeMantissa
+/// \param ieeeExponent
+/// \param mantissaBits
+/// \param exponentBits
+///
+/// \return The number of characters written
+///
+///////////////////////////////////////////////////////////////////////////////
+Uint64 formatBinary(char* buffer, bool negative, Uint64 ieeeMantissa,
+    Uint32 ieeeExponent, Uint32 mantissaBits, Uint32 exponentBits)
+{
+    const Uint32 maxExponent = (1u << exponentBits) - 1;
+
+    if (ieeeExponent == maxExponent)
+    {
+        if (ieeeMantissa != 0)
+        {
+            std::memcpy(buffer, "nan", 3);
+            return (3);
+        }
+        char* out = buffer;
+        if (negative)
+        {
+            *out++ = '-';
+        }
+        std::memcpy(out, "inf", 3);
+        return ((Uint64)(out - buffer) + 3);
+    }
+    if (ieeeExponent == 0 && ieeeMantissa == 0)
+    {
+        char* out = buffer;
+        if (negative)
+        {
+            *out++ = '-';
+        }
+        *out = '0';
+        return ((Uint64)(out - buffer) + 1);
+    }
+    const Int32 bias = (Int32)(maxExponent >> 1);
+    return (writeDecimal(buffer, negative, shortest(ieeeMantissa,
+        ieeeExponent, mantissaBits, bias)));
+}
+
+// !SECTION
+
+// SECTION - Floating-Point Parsing
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Top 128 bits of 5^q for q in [-342, 308], as {high, low}, the
+/// negative powers being rounded up.
+///
+///////////////////////////////////////////////////////////////////////////////
+const Uint64 powersOfFive[651][2] = {
+    {0xEEF453D6923BD65Aull, 0x113FAA2906A13B3Full},
+    {0x9558B4661B6565F8ull, 0x4AC7CA59A424C507ull},
+    {0xBAAEE17FA23EBF76ull, 0x5D79BCF00D2DF649ull},
+    {0xE95A99DF8ACE6F53ull, 0xF4D82C2C107973DCull},
+    {0x91D8A02BB6C10594ull, 0x79071B9B8A4BE869ull},
+    {0xB64EC836A47146F9ull, 0x9748E2826CDEE284ull},
+    {0xE3E27A444D8D98B7ull, 0xFD1B1B2308169B25ull},
+    {0x8E6D8C6AB0787F72ull, 0xFE30F0F5E50E20F7ull},
+    {0xB208EF855C969F4Full, 0xBDBD2D335E51A935ull},
+    {0xDE8B2B66B3BC4723ull, 0xAD2C788035E61382ull},
+    {0x8B16FB203055AC76ull, 0x4C3BCB5021AFCC31ull},
+    {0xADDCB9E83C6B1793ull, 0xDF4ABE242A1BBF3Dull},
+    {0xD953E8624B85DD78ull, 0xD71D6DAD34A2AF0Dull},
+    {0x87D4713D6F33AA6Bull, 0x8672648C40E5AD68ull},
+    {0xA9C98D8CCB009506ull, 0x680EFDAF511F18C2ull},
+    {0xD43BF0EFFDC0BA48ull, 0x0212BD1B2566DEF2ull},
+    {0x84A57695FE98746Dull, 0x014BB630F7604B57ull},
+    {0xA5CED43B7E3E9188ull, 0x419EA3BD35385E2Dull},
+    {0xCF42894A5DCE35EAull, 0x52064CAC828675B9ull},
+    {0x818995CE7AA0E1B2ull, 0x7343EFEBD1940993ull},
+    {0xA1EBFB4219491A1Full, 0x1014EBE6C5F90BF8ull},
+    {0xCA66FA129F9B60A6ull, 0xD41A26E077774EF6ull},
+    {0xFD00B897478238D0ull, 0x8920B098955522B4ull},
+    {0x9E20735E8CB16382ull, 0x55B46E5F5D5535B0ull},
+    {0xC5A890362FDDBC62ull, 0xEB2189F734AA831Dull},
+    {0xF712B443BBD52B7Bull, 0xA5E9EC7501D523E4ull},
+    {0x9A6BB0AA55653B2Dull, 0x47B233C92125366Eull},
+    {0xC1069CD4EABE89F8ull, 0x999EC0BB696E840Aull},
+    {0xF148440A256E2C76ull, 0xC00670EA43CA250Dull},
+    {0x96CD2A865764DBCAull, 0x380406926A5E5728ull},
+    {0xBC807527ED3E12BCull, 0xC605083704F5ECF2ull},
+    {0xEBA09271E88D976Bull, 0xF7864A44C633682Eull},
+    {0x93445B8731587EA3ull, 0x7AB3EE6AFBE0211Dull},
+    {0xB8157268FDAE9E4Cull, 0x5960EA05BAD82964ull},
+    {0xE61ACF033D1A45DFull, 0x6FB92487298E33BDull},
+    {0x8FD0C16206306BABull, 0xA5D3B6D479F8E056ull},
+    {0xB3C4F1BA87BC8696ull, 0x8F48A4899877186Cull},
+    {0xE0B62E2929ABA83Cull, 0x331ACDABFE94DE87ull},
+    {0x8C71DCD9BA0B4925ull, 0x9FF0C08B7F1D0B14ull},
+    {0xAF8E5410288E1B6Full, 0x07ECF0AE5EE44DD9ull},
+    {0xDB71E91432B1A24Aull, 0xC9E82CD9F69D6150ull},
+    {0x892731AC9FAF056Eull, 0xBE311C083A225CD2ull},
+    {0xAB70FE17C79AC6CAull, 0x6DBD630A48AAF406ull},
+    {0xD64D3D9DB981787Dull, 0x092CBBCCDAD5B108ull},
+    {0x85F0468293F0EB4Eull, 0x25BBF56008C58EA5ull},
+    {0xA76C582338ED2621ull, 0xAF2AF2B80AF6F24Eull},
+    {0xD1476E2C07286FAAull, 0x1AF5AF660DB4AEE1ull},
+    {0x82CCA4DB847945CAull, 0x50D98D9FC890ED4Dull},
+    {0xA37FCE126597973Cull, 0xE50FF107BAB528A0ull},
+    {0xCC5FC196FEFD7D0Cull, 0x1E53ED49A96272C8ull},
+    {0xFF77B1FCBEBCDC4Full, 0x25E8E89C13BB0F7Aull},
+    {0x9FAACF3DF73609B1ull, 0x77B191618C54E9ACull},
+    {0xC795830D75038C1Dull, 0xD59DF5B9EF6A2417ull},
+    {0xF97AE3D0D2446F25ull, 0x4B0573286B44AD1Dull},
+    {0x9BECCE62836AC577ull, 0x4EE367F9430AEC32ull},
+    {0xC2E801FB244576D5ull, 0x229C41F793CDA73Full},
+    {0xF3A20279ED56D48Aull, 0x6B43527578C1110Full},
+    {0x9845418C345644D6ull, 0x830A13896B78AAA9ull},
+    {0xBE5691EF416BD60Cull, 0x23CC986BC656D553ull},
+    {0xEDEC366B11C6CB8Full, 0x2CBFBE86B7EC8AA8ull},
+    {0x94B3A202EB1C3F39ull, 0x7BF7D71432F3D6A9ull},
+    {0xB9E08A83A5E34F07ull, 0xDAF5CCD93FB0CC53ull},
+    {0xE858AD248F5C22C9ull, 0xD1B3400F8F9CFF68ull},
+    {0x91376C36D99995BEull, 0x23100809B9C21FA1ull},
+    {0xB58547448FFFFB2Dull, 0xABD40A0C2832A78Aull},
+    {0xE2E69915B3FFF9F9ull, 0x16C90C8F323F516Cull},
+    {0x8DD01FAD907FFC3Bull, 0xAE3DA7D97F6792E3ull},
+    {0xB1442798F49FFB4Aull, 0x99CD11CFDF41779Cull},
+    {0xDD95317F31C7FA1Dull, 0x40405643D711D583ull},
+    {0x8A7D3EEF7F1CFC52ull, 0x482835EA666B2572ull},
+    {0xAD1C8EAB5EE43B66ull, 0xDA3243650005EECFull},
+    {0xD863B256369D4A40ull, 0x90BED43E40076A82ull},
+    {0x873E4F75E2224E68ull, 0x5A7744A6E804A291ull},
+    {0xA90DE3535AAAE202ull, 0x711515D0A205CB36ull},
+    {0xD3515C2831559A83ull, 0x0D5A5B44CA873E03ull},
+    {0x8412D9991ED58091ull, 0xE858790AFE9486C2ull},
+    {0xA5178FFF668AE0B6ull, 0x626E974DBE39A872ull},
+    {0xCE5D73FF402D98E3ull, 0xFB0A3D212DC8128Full},
+    {0x80FA687F881C7F8Eull, 0x7CE66634BC9D0B99ull},
+    {0xA139029F6A239F72ull, 0x1C1FFFC1EBC44E80ull},
+    {0xC987434744AC874Eull, 0xA327FFB266B56220ull},
+    {0xFBE9141915D7A922ull, 0x4BF1FF9F0062BAA8ull},
+    {0x9D71AC8FADA6C9B5ull, 0x6F773FC3603DB4A9ull},
+    {0xC4CE17B399107C22ull, 0xCB550FB4384D21D3ull},
+    {0xF6019DA07F549B2Bull, 0x7E2A53A146606A48ull},
+    {0x99C102844F94E0FBull, 0x2EDA7444CBFC426Dull},
+    {0xC0314325637A1939ull, 0xFA911155FEFB5308ull},
+    {0xF03D93EEBC589F88ull, 0x793555AB7EBA27CAull},
+    {0x96267C7535B763B5ull, 0x4BC1558B2F3458DEull},
+    {0xBBB01B9283253CA2ull, 0x9EB1AAEDFB016F16ull},
+    {0xEA9C227723EE8BCBull, 0x465E15A979C1CADCull},
+    {0x92A1958A7675175Full, 0x0BFACD89EC191EC9ull},
+    {0xB749FAED14125D36ull, 0xCEF980EC671F667Bull},
+    {0xE51C79A85916F484ull, 0x82B7E12780E7401Aull},
+    {0x8F31CC0937AE58D2ull, 0xD1B2ECB8B0908810ull},
+    {0xB2FE3F0B8599EF07ull, 0x861FA7E6DCB4AA15ull},
+    {0xDFBDCECE67006AC9ull, 0x67A791E093E1D49Aull},
+    {0x8BD6A141006042BDull, 0xE0C8BB2C5C6D24E0ull},
+    {0xAECC49914078536Dull, 0x58FAE9F773886E18ull},
+    {0xDA7F5BF590966848ull, 0xAF39A475506A899Eull},
+    {0x888F99797A5E012Dull, 0x6D8406C952429603ull},
+    {0xAAB37FD7D8F58178ull, 0xC8E5087BA6D33B83ull},
+    {0xD5605FCDCF32E1D6ull, 0xFB1E4A9A90880A64ull},
+    {0x855C3BE0A17FCD26ull, 0x5CF2EEA09A55067Full},
+    {0xA6B34AD8C9DFC06Full, 0xF42FAA48C0EA481Eull},
+    {0xD0601D8EFC57B08Bull, 0xF13B94DAF124DA26ull},
+    {0x823C12795DB6CE57ull, 0x76C53D08D6B70858ull},
+    {0xA2CB1717B52481EDull, 0x54768C4B0C64CA6Eull},
+    {0xCB7DDCDDA26DA268ull, 0xA9942F5DCF7DFD09ull},
+    {0xFE5D54150B090B02ull, 0xD3F93B35435D7C4Cull},
+    {0x9EFA548D26E5A6E1ull, 0xC47BC5014A1A6DAFull},
+    {0xC6B8E9B0709F109Aull, 0x359AB6419CA1091Bull},
+    {0xF867241C8CC6D4C0ull, 0xC30163D203C94B62ull},
+    {0x9B407691D7FC44F8ull, 0x79E0DE63425DCF1Dull},
+    {0xC21094364DFB5636ull, 0x985915FC12F542E4ull},
+    {0xF294B943E17A2BC4ull, 0x3E6F5B7B17B2939Dull},
+    {0x979CF3CA6CEC5B5Aull, 0xA705992CEECF9C42ull},
+    {0xBD8430BD08277231ull, 0x50C6FF782A838353ull},
+    {0xECE53CEC4A314EBDull, 0xA4F8BF5635246428ull},
+    {0x940F4613AE5ED136ull, 0x871B7795E136BE99ull},
+    {0xB913179899F68584ull, 0x28E2557B59846E3Full},
+    {0xE757DD7EC07426E5ull, 0x331AEADA2FE589CFull},
+    {0x9096EA6F3848984Full, 0x3FF0D2C85DEF7621ull},
+    {0xB4BCA50B065ABE63ull, 0x0FED077A756B53A9ull},
+    {0xE1EBCE4DC7F16DFBull, 0xD3E8495912C62894ull},
+    {0x8D3360F09CF6E4BDull, 0x64712DD7ABBBD95Cull},
+    {0xB080392CC4349DECull, 0xBD8D794D96AACFB3ull},
+    {0xDCA04777F541C567ull, 0xECF0D7A0FC5583A0ull},
+    {0x89E42CAAF9491B60ull, 0xF41686C49DB57244ull},
+    {0xAC5D37D5B79B6239ull, 0x311C2875C522CED5ull},
+    {0xD77485CB25823AC7ull, 0x7D633293366B828Bull},
+    {0x86A8D39EF77164BCull, 0xAE5DFF9C02033197ull},
+    {0xA8530886B54DBDEBull, 0xD9F57F830283FDFCull},
+    {0xD267CAA862A12D66ull, 0xD072DF63C324FD7Bull},
+    {0x8380DEA93DA4BC60ull, 0x4247CB9E59F71E6Dull},
+    {0xA46116538D0DEB78ull, 0x52D9BE85F074E608ull},
+    {0xCD795BE870516656ull, 0x67902E276C921F8Bull},
+    {0x806BD9714632DFF6ull, 0x00BA1CD8A3DB53B6ull},
+    {0xA086CFCD97BF97F3ull, 0x80E8A40ECCD228A4ull},
+    {0xC8A883C0FDAF7DF0ull, 0x6122CD128006B2CDull},
+    {0xFAD2A4B13D1B5D6Cull, 0x796B805720085F81ull},
+    {0x9CC3A6EEC6311A63ull, 0xCBE3303674053BB0ull},
+    {0xC3F490AA77BD60FCull, 0xBEDBFC4411068A9Cull},
+    {0xF4F1B4D515ACB93Bull, 0xEE92FB5515482D44ull},
+    {0x991711052D8BF3C5ull, 0x751BDD152D4D1C4Aull},
+    {0xBF5CD54678EEF0B6ull, 0xD262D45A78A0635Dull},
+    {0xEF340A98172AACE4ull, 0x86FB897116C87C34ull},
+    {0x9580869F0E7AAC0Eull, 0xD45D35E6AE3D4DA0ull},
+    {0xBAE0A846D2195712ull, 0x8974836059CCA109ull},
+    {0xE998D258869FACD7ull, 0x2BD1A438703FC94Bull},
+    {0x91FF83775423CC06ull, 0x7B6306A34627DDCFull},
+    {0xB67F6455292CBF08ull, 0x1A3BC84C17B1D542ull},
+    {0xE41F3D6A7377EECAull, 0x20CABA5F1D9E4A93ull},
+    {0x8E938662882AF53Eull, 0x547EB47B7282EE9Cull},
+    {0xB23867FB2A35B28Dull, 0xE99E619A4F23AA43ull},
+    {0xDEC681F9F4C31F31ull, 0x6405FA00E2EC94D4ull},
+    {0x8B3C113C38F9F37Eull, 0xDE83BC408DD3DD04ull},
+    {0xAE0B158B4738705Eull, 0x9624AB50B148D445ull},
+    {0xD98DDAEE19068C76ull, 0x3BADD624DD9B0957ull},
+    {0x87F8A8D4CFA417C9ull, 0xE54CA5D70A80E5D6ull},
+    {0xA9F6D30A038D1DBCull, 0x5E9FCF4CCD211F4Cull},
+    {0xD47487CC8470652Bull, 0x7647C3200069671Full},
+    {0x84C8D4DFD2C63F3Bull, 0x29ECD9F40041E073ull},
+    {0xA5FB0A17C777CF09ull, 0xF468107100525890ull},
+    {0xCF79CC9DB955C2CCull, 0x7182148D4066EEB4ull},
+    {0x81AC1FE293D599BFull, 0xC6F14CD848405530ull},
+    {0xA21727DB38CB002Full, 0xB8ADA00E5A506A7Cull},
+    {0xCA9CF1D206FDC03Bull, 0xA6D90811F0E4851Cull},
+    {0xFD442E4688BD304Aull, 0x908F4A166D1DA663ull},
+    {0x9E4A9CEC15763E2Eull, 0x9A598E4E043287FEull},
+    {0xC5DD44271AD3CDBAull, 0x40EFF1E1853F29FDull},
+    {0xF7549530E188C128ull, 0xD12BEE59E68EF47Cull},
+    {0x9A94DD3E8CF578B9ull, 0x82BB74F8301958CEull},
+    {0xC13A148E3032D6E7ull, 0xE36A52363C1FAF01ull},
+    {0xF18899B1BC3F8CA1ull, 0xDC44E6C3CB279AC1ull},
+    {0x96F5600F15A7B7E5ull, 0x29AB103A5EF8C0B9ull},
+    {0xBCB2B812DB11A5DEull, 0x7415D448F6B6F0E7ull},
+    {0xEBDF661791D60F56ull, 0x111B495B3464AD21ull},
+    {0x936B9FCEBB25C995ull, 0xCAB10DD900BEEC34ull},
+    {0xB84687C269EF3BFBull, 0x3D5D514F40EEA742ull},
+    {0xE65829B3046B0AFAull, 0x0CB4A5A3112A5112ull},
+    {0x8FF71A0FE2C2E6DCull, 0x47F0E785EABA72ABull},
+    {0xB3F4E093DB73A093ull, 0x59ED216765690F56ull},
+    {0xE0F218B8D25088B8ull, 0x306869C13EC3532Cull},
+    {0x8C974F7383725573ull, 0x1E414218C73A13FBull},
+    {0xAFBD2350644EEACFull, 0xE5D1929EF90898FAull},
+    {0xDBAC6C247D62A583ull, 0xDF45F746B74ABF39ull},
+    {0x894BC396CE5DA772ull, 0x6B8BBA8C328EB783ull},
+    {0xAB9EB47C81F5114Full, 0x066EA92F3F326564ull},
+    {0xD686619BA27255A2ull, 0xC80A537B0EFEFEBDull},
+    {0x8613FD0145877585ull, 0xBD06742CE95F5F36ull},
+    {0xA798FC4196E952E7ull, 0x2C48113823B73704ull},
+    {0xD17F3B51FCA3A7A0ull, 0xF75A15862CA504C5ull},
+    {0x82EF85133DE648C4ull, 0x9A984D73DBE722FBull},
+    {0xA3AB66580D5FDAF5ull, 0xC13E60D0D2E0EBBAull},
+    {0xCC963FEE10B7D1B3ull, 0x318DF905079926A8ull},
+    {0xFFBBCFE994E5C61Full, 0xFDF17746497F7052ull},
+    {0x9FD561F1FD0F9BD3ull, 0xFEB6EA8BEDEFA633ull},
+    {0xC7CABA6E7C5382C8ull, 0xFE64A52EE96B8FC0ull},
+    {0xF9BD690A1B68637Bull, 0x3DFDCE7AA3C673B0ull},
+    {0x9C1661A651213E2Dull, 0x06BEA10CA65C084Eull},
+    {0xC31BFA0FE5698DB8ull, 0x486E494FCFF30A62ull},
+    {0xF3E2F893DEC3F126ull, 0x5A89DBA3C3EFCCFAull},
+    {0x986DDB5C6B3A76B7ull, 0xF89629465A75E01Cull},
+    {0xBE89523386091465ull, 0xF6BBB397F1135823ull},
+    {0xEE2BA6C0678B597Full, 0x746AA07DED582E2Cull},
+    {0x94DB483840B717EFull, 0xA8C2A44EB4571CDCull},
+    {0xBA121A4650E4DDEBull, 0x92F34D62616CE413ull},
+    {0xE896A0D7E51E1566ull, 0x77B020BAF9C81D17ull},
+    {0x915E2486EF32CD60ull, 0x0ACE1474DC1D122Eull},
+    {0xB5B5ADA8AAFF80B8ull, 0x0D819992132456BAull},
+    {0xE3231912D5BF60E6ull, 0x10E1FFF697ED6C69ull},
+    {0x8DF5EFABC5979C8Full, 0xCA8D3FFA1EF463C1ull},
+    {0xB1736B96B6FD83B3ull, 0xBD308FF8A6B17CB2ull},
+    {0xDDD0467C64BCE4A0ull, 0xAC7CB3F6D05DDBDEull},
+    {0x8AA22C0DBEF60EE4ull, 0x6BCDF07A423AA96Bull},
+    {0xAD4AB7112EB3929Dull, 0x86C16C98D2C953C6ull},
+    {0xD89D64D57A607744ull, 0xE871C7BF077BA8B7ull},
+    {0x87625F056C7C4A8Bull, 0x11471CD764AD4972ull},
+    {0xA93AF6C6C79B5D2Dull, 0xD598E40D3DD89BCFull},
+    {0xD389B47879823479ull, 0x4AFF1D108D4EC2C3ull},
+    {0x843610CB4BF160CBull, 0xCEDF722A585139BAull},
+    {0xA54394FE1EEDB8FEull, 0xC2974EB4EE658828ull},
+    {0xCE947A3DA6A9273Eull, 0x733D226229FEEA32ull},
+    {0x811CCC668829B887ull, 0x0806357D5A3F525Full},
+    {0xA163FF802A3426A8ull, 0xCA07C2DCB0CF26F7ull},
+    {0xC9BCFF6034C13052ull, 0xFC89B393DD02F0B5ull},
+    {0xFC2C3F3841F17C67ull, 0xBBAC2078D443ACE2ull},
+    {0x9D9BA7832936EDC0ull, 0xD54B944B84AA4C0Dull},
+    {0xC5029163F384A931ull, 0x0A9E795E65D4DF11ull},
+    {0xF64335BCF065D37Dull, 0x4D4617B5FF4A16D5ull},
+    {0x99EA0196163FA42Eull, 0x504BCED1BF8E4E45ull},
+    {0xC06481FB9BCF8D39ull, 0xE45EC2862F71E1D6ull},
+    {0xF07DA27A82C37088ull, 0x5D767327BB4E5A4Cull},
+    {0x964E858C91BA2655ull, 0x3A6A07F8D510F86Full},
+    {0xBBE226EFB628AFEAull, 0x890489F70A55368Bull},
+    {0xEADAB0ABA3B2DBE5ull, 0x2B45AC74CCEA842Eull},
+    {0x92C8AE6B464FC96Full, 0x3B0B8BC90012929Dull},
+    {0xB77ADA0617E3BBCBull, 0x09CE6EBB40173744ull},
+    {0xE55990879DDCAABDull, 0xCC420A6A101D0515ull},
+    {0x8F57FA54C2A9EAB6ull, 0x9FA946824A12232Dull},
+    {0xB32DF8E9F3546564ull, 0x47939822DC96ABF9ull},
+    {0xDFF9772470297EBDull, 0x59787E2B93BC56F7ull},
+    {0x8BFBEA76C619EF36ull, 0x57EB4EDB3C55B65Aull},
+    {0xAEFAE51477A06B03ull, 0xEDE622920B6B23F1ull},
+    {0xDAB99E59958885C4ull, 0xE95FAB368E45ECEDull},
+    {0x88B402F7FD75539Bull, 0x11DBCB0218EBB414ull},
+    {0xAAE103B5FCD2A881ull, 0xD652BDC29F26A119ull},
+    {0xD59944A37C0752A2ull, 0x4BE76D3346F0495Full},
+    {0x857FCAE62D8493A5ull, 0x6F70A4400C562DDBull},
+    {0xA6DFBD9FB8E5B88Eull, 0xCB4CCD500F6BB952ull},
+    {0xD097AD07A71F26B2ull, 0x7E2000A41346A7A7ull},
+    {0x825ECC24C873782Full, 0x8ED400668C0C28C8ull},
+    {0xA2F67F2DFA90563Bull, 0x728900802F0F32FAull},
+    {0xCBB41EF979346BCAull, 0x4F2B40A03AD2FFB9ull},
+    {0xFEA126B7D78186BCull, 0xE2F610C84987BFA8ull},
+    {0x9F24B832E6B0F436ull, 0x0DD9CA7D2DF4D7C9ull},
+    {0xC6EDE63FA05D3143ull, 0x91503D1C79720DBBull},
+    {0xF8A95FCF88747D94ull, 0x75A44C6397CE912Aull},
+    {0x9B69DBE1B548CE7Cull, 0xC986AFBE3EE11ABAull},
+    {0xC24452DA229B021Bull, 0xFBE85BADCE996168ull},
+    {0xF2D56790AB41C2A2ull, 0xFAE27299423FB9C3ull},
+    {0x97C560BA6B0919A5ull, 0xDCCD879FC967D41Aull},
+    {0xBDB6B8E905CB600Full, 0x5400E987BBC1C920ull},
+    {0xED246723473E3813ull, 0x290123E9AAB23B68ull},
+    {0x9436C0760C86E30Bull, 0xF9A0B6720AAF6521ull},
+    {0xB94470938FA89BCEull, 0xF808E40E8D5B3E69ull},
+    {0xE7958CB87392C2C2ull, 0xB60B1D1230B20E04ull},
+    {0x90BD77F3483BB9B9ull, 0xB1C6F22B5E6F48C2ull},
+    {0xB4ECD5F01A4AA828ull, 0x1E38AEB6360B1AF3ull},
+    {0xE2280B6C20DD5232ull, 0x25C6DA63C38DE1B0ull},
+    {0x8D590723948A535Full, 0x579C487E5A38AD0Eull},
+    {0xB0AF48EC79ACE837ull, 0x2D835A9DF0C6D851ull},
+    {0xDCDB1B2798182244ull, 0xF8E431456CF88E65ull},
+    {0x8A08F0F8BF0F156Bull, 0x1B8E9ECB641B58FFull},
+    {0xAC8B2D36EED2DAC5ull, 0xE272467E3D222F3Full},
+    {0xD7ADF884AA879177ull, 0x5B0ED81DCC6ABB0Full},
+    {0x86CCBB52EA94BAEAull, 0x98E947129FC2B4E9ull},
+    {0xA87FEA27A539E9A5ull, 0x3F2398D747B36224ull},
+    {0xD29FE4B18E88640Eull, 0x8EEC7F0D19A03AADull},
+    {0x83A3EEEEF9153E89ull, 0x1953CF68300424ACull},
+    {0xA48CEAAAB75A8E2Bull, 0x5FA8C3423C052DD7ull},
+    {0xCDB02555653131B6ull, 0x3792F412CB06794Dull},
+    {0x808E17555F3EBF11ull, 0xE2BBD88BBEE40BD0ull},
+    {0xA0B19D2AB70E6ED6ull, 0x5B6ACEAEAE9D0EC4ull},
+    {0xC8DE047564D20A8Bull, 0xF245825A5A445275ull},
+    {0xFB158592BE068D2Eull, 0xEED6E2F0F0D56712ull},
+    {0x9CED737BB6C4183Dull, 0x55464DD69685606Bull},
+    {0xC428D05AA4751E4Cull, 0xAA97E14C3C26B886ull},
+    {0xF53304714D9265DFull, 0xD53DD99F4B3066A8ull},
+    {0x993FE2C6D07B7FABull, 0xE546A8038EFE4029ull},
+    {0xBF8FDB78849A5F96ull, 0xDE98520472BDD033ull},
+    {0xEF73D256A5C0F77Cull, 0x963E66858F6D4440ull},
+    {0x95A8637627989AADull, 0xDDE7001379A44AA8ull},
+    {0xBB127C53B17EC159ull, 0x5560C018580D5D52ull},
+    {0xE9D71B689DDE71AFull, 0xAAB8F01E6E10B4A6ull},
+    {0x9226712162AB070Dull, 0xCAB3961304CA70E8ull},
+    {0xB6B00D69BB55C8D1ull, 0x3D607B97C5FD0D22ull},
+    {0xE45C10C42A2B3B05ull, 0x8CB89A7DB77C506Aull},
+    {0x8EB98A7A9A5B04E3ull, 0x77F3608E92ADB242ull},
+    {0xB267ED1940F1C61Cull, 0x55F038B237591ED3ull},
+    {0xDF01E85F912E37A3ull, 0x6B6C46DEC52F6688ull},
+    {0x8B61313BBABCE2C6ull, 0x2323AC4B3B3DA015ull},
+    {0xAE397D8AA96C1B77ull, 0xABEC975E0A0D081Aull},
+    {0xD9C7DCED53C72255ull, 0x96E7BD358C904A21ull},
+    {0x881CEA14545C7575ull, 0x7E50D64177DA2E54ull},
+    {0xAA242499697392D2ull, 0xDDE50BD1D5D0B9E9ull},
+    {0xD4AD2DBFC3D07787ull, 0x955E4EC64B44E864ull},
+    {0x84EC3C97DA624AB4ull, 0xBD5AF13BEF0B113Eull},
+    {0xA6274BBDD0FADD61ull, 0xECB1AD8AEACDD58Eull},
+    {0xCFB11EAD453994BAull, 0x67DE18EDA5814AF2ull},
+    {0x81CEB32C4B43FCF4ull, 0x80EACF948770CED7ull},
+    {0xA2425FF75E14FC31ull, 0xA1258379A94D028Dull},
+    {0xCAD2F7F5359A3B3Eull, 0x096EE45813A04330ull},
+    {0xFD87B5F28300CA0Dull, 0x8BCA9D6E188853FCull},
+    {0x9E74D1B791E07E48ull, 0x775EA264CF55347Eull},
+    {0xC612062576589DDAull, 0x95364AFE032A819Eull},
+    {0xF79687AED3EEC551ull, 0x3A83DDBD83F52205ull},
+    {0x9ABE14CD44753B52ull, 0xC4926A9672793543ull},
+    {0xC16D9A0095928A27ull, 0x75B7053C0F178294ull},
+    {0xF1C90080BAF72CB1ull, 0x5324C68B12DD6339ull},
+    {0x971DA05074DA7BEEull, 0xD3F6FC16EBCA5E04ull},
+    {0xBCE5086492111AEAull, 0x88F4BB1CA6BCF585ull},
+    {0xEC1E4A7DB69561A5ull, 0x2B31E9E3D06C32E6ull},
+    {0x9392EE8E921D5D07ull, 0x3AFF322E62439FD0ull},
+    {0xB877AA3236A4B449ull, 0x09BEFEB9FAD487C3ull},
+    {0xE69594BEC44DE15Bull, 0x4C2EBE687989A9B4ull},
+    {0x901D7CF73AB0ACD9ull, 0x0F9D37014BF60A11ull},
+    {0xB424DC35095CD80Full, 0x538484C19EF38C95ull},
+    {0xE12E13424BB40E13ull, 0x2865A5F206B06FBAull},
+    {0x8CBCCC096F5088CBull, 0xF93F87B7442E45D4ull},
+    {0xAFEBFF0BCB24AAFEull, 0xF78F69A51539D749ull},
+    {0xDBE6FECEBDEDD5BEull, 0xB573440E5A884D1Cull},
+    {0x89705F4136B4A597ull, 0x31680A88F8953031ull},
+    {0xABCC77118461CEFCull, 0xFDC20D2B36BA7C3Eull},
+    {0xD6BF94D5E57A42BCull, 0x3D32907604691B4Dull},
+    {0x8637BD05AF6C69B5ull, 0xA63F9A49C2C1B110ull},
+    {0xA7C5AC471B478423ull, 0x0FCF80DC33721D54ull},
+    {0xD1B71758E219652Bull, 0xD3C36113404EA4A9ull},
+    {0x83126E978D4FDF3Bull, 0x645A1CAC083126EAull},
+    {0xA3D70A3D70A3D70Aull, 0x3D70A3D70A3D70A4ull},
+    {0xCCCCCCCCCCCCCCCCull, 0xCCCCCCCCCCCCCCCDull},
+    {0x8000000000000000ull, 0x0000000000000000ull},
+    {0xA000000000000000ull, 0x0000000000000000ull},
+    {0xC800000000000000ull, 0x0000000000000000ull},
+    {0xFA00000000000000ull, 0x0000000000000000ull},
+    {0x9C40000000000000ull, 0x0000000000000000ull},
+    {0xC350000000000000ull, 0x0000000000000000ull},
+    {0xF424000000000000ull, 0x0000000000000000ull},
+    {0x9896800000000000ull, 0x0000000000000000ull},
+    {0xBEBC200000000000ull, 0x0000000000000000ull},
+    {0xEE6B280000000000ull, 0x0000000000000000ull},
+    {0x9502F90000000000ull, 0x0000000000000000ull},
+    {0xBA43B74000000000ull, 0x0000000000000000ull},
+    {0xE8D4A51000000000ull, 0x0000000000000000ull},
+    {0x9184E72A00000000ull, 0x0000000000000000ull},
+    {0xB5E620F480000000ull, 0x0000000000000000ull},
+    {0xE35FA931A0000000ull, 0x0000000000000000ull},
+    {0x8E1BC9BF04000000ull, 0x0000000000000000ull},
+    {0xB1A2BC2EC5000000ull, 0x0000000000000000ull},
+    {0xDE0B6B3A76400000ull, 0x0000000000000000ull},
+    {0x8AC7230489E80000ull, 0x0000000000000000ull},
+    {0xAD78EBC5AC620000ull, 0x0000000000000000ull},
+    {0xD8D726B7177A8000ull, 0x0000000000000000ull},
+    {0x878678326EAC9000ull, 0x0000000000000000ull},
+    {0xA968163F0A57B400ull, 0x0000000000000000ull},
+    {0xD3C21BCECCEDA100ull, 0x0000000000000000ull},
+    {0x84595161401484A0ull, 0x0000000000000000ull},
+    {0xA56FA5B99019A5C8ull, 0x0000000000000000ull},
+    {0xCECB8F27F4200F3Aull, 0x0000000000000000ull},
+    {0x813F3978F8940984ull, 0x4000000000000000ull},
+    {0xA18F07D736B90BE5ull, 0x5000000000000000ull},
+    {0xC9F2C9CD04674EDEull, 0xA400000000000000ull},
+    {0xFC6F7C4045812296ull, 0x4D00000000000000ull},
+    {0x9DC5ADA82B70B59Dull, 0xF020000000000000ull},
+    {0xC5371912364CE305ull, 0x6C28000000000000ull},
+    {0xF684DF56C3E01BC6ull, 0xC732000000000000ull},
+    {0x9A130B963A6C115Cull, 0x3C7F400000000000ull},
+    {0xC097CE7BC90715B3ull, 0x4B9F100000000000ull},
+    {0xF0BDC21ABB48DB20ull, 0x1E86D40000000000ull},
+    {0x96769950B50D88F4ull, 0x1314448000000000ull},
+    {0xBC143FA4E250EB31ull, 0x17D955A000000000ull},
+    {0xEB194F8E1AE525FDull, 0x5DCFAB0800000000ull},
+    {0x92EFD1B8D0CF37BEull, 0x5AA1CAE500000000ull},
+    {0xB7ABC627050305ADull, 0xF14A3D9E40000000ull},
+    {0xE596B7B0C643C719ull, 0x6D9CCD05D0000000ull},
+    {0x8F7E32CE7BEA5C6Full, 0xE4820023A2000000ull},
+    {0xB35DBF821AE4F38Bull, 0xDDA2802C8A800000ull},
+    {0xE0352F62A19E306Eull, 0xD50B2037AD200000ull},
+    {0x8C213D9DA502DE45ull, 0x4526F422CC340000ull},
+    {0xAF298D050E4395D6ull, 0x9670B12B7F410000ull},
+    {0xDAF3F04651D47B4Cull, 0x3C0CDD765F114000ull},
+    {0x88D8762BF324CD0Full, 0xA5880A69FB6AC800ull},
+    {0xAB0E93B6EFEE0053ull, 0x8EEA0D047A457A00ull},
+    {0xD5D238A4ABE98068ull, 0x72A4904598D6D880ull},
+    {0x85A36366EB71F041ull, 0x47A6DA2B7F864750ull},
+    {0xA70C3C40A64E6C51ull, 0x999090B65F67D924ull},
+    {0xD0CF4B50CFE20765ull, 0xFFF4B4E3F741CF6Dull},
+    {0x82818F1281ED449Full, 0xBFF8F10E7A8921A4ull},
+    {0xA321F2D7226895C7ull, 0xAFF72D52192B6A0Dull},
+    {0xCBEA6F8CEB02BB39ull, 0x9BF4F8A69F764490ull},
+    {0xFEE50B7025C36A08ull, 0x02F236D04753D5B4ull},
+    {0x9F4F2726179A2245ull, 0x01D762422C946590ull},
+    {0xC722F0EF9D80AAD6ull, 0x424D3AD2B7B97EF5ull},
+    {0xF8EBAD2B84E0D58Bull, 0xD2E0898765A7DEB2ull},
+    {0x9B934C3B330C8577ull, 0x63CC55F49F88EB2Full},
+    {0xC2781F49FFCFA6D5ull, 0x3CBF6B71C76B25FBull},
+    {0xF316271C7FC3908Aull, 0x8BEF464E3945EF7Aull},
+    {0x97EDD871CFDA3A56ull, 0x97758BF0E3CBB5ACull},
+    {0xBDE94E8E43D0C8ECull, 0x3D52EEED1CBEA317ull},
+    {0xED63A231D4C4FB27ull, 0x4CA7AAA863EE4BDDull},
+    {0x945E455F24FB1CF8ull, 0x8FE8CAA93E74EF6Aull},
+    {0xB975D6B6EE39E436ull, 0xB3E2FD538E122B44ull},
+    {0xE7D34C64A9C85D44ull, 0x60DBBCA87196B616ull},
+    {0x90E40FBEEA1D3A4Aull, 0xBC8955E946FE31CDull},
+    {0xB51D13AEA4A488DDull, 0x6BABAB6398BDBE41ull},
+    {0xE264589A4DCDAB14ull, 0xC696963C7EED2DD1ull},
+    {0x8D7EB76070A08AECull, 0xFC1E1DE5CF543CA2ull},
+    {0xB0DE65388CC8ADA8ull, 0x3B25A55F43294BCBull},
+    {0xDD15FE86AFFAD912ull, 0x49EF0EB713F39EBEull},
+    {0x8A2DBF142DFCC7ABull, 0x6E3569326C784337ull},
+    {0xACB92ED9397BF996ull, 0x49C2C37F07965404ull},
+    {0xD7E77A8F87DAF7FBull, 0xDC33745EC97BE906ull},
+    {0x86F0AC99B4E8DAFDull, 0x69A028BB3DED71A3ull},
+    {0xA8ACD7C0222311BCull, 0xC40832EA0D68CE0Cull},
+    {0xD2D80DB02AABD62Bull, 0xF50A3FA490C30190ull},
+    {0x83C7088E1AAB65DBull, 0x792667C6DA79E0FAull},
+    {0xA4B8CAB1A1563F52ull, 0x577001B891185938ull},
+    {0xCDE6FD5E09ABCF26ull, 0xED4C0226B55E6F86ull},
+    {0x80B05E5AC60B6178ull, 0x544F8158315B05B4ull},
+    {0xA0DC75F1778E39D6ull, 0x696361AE3DB1C721ull},
+    {0xC913936DD571C84Cull, 0x03BC3A19CD1E38E9ull},
+    {0xFB5878494ACE3A5Full, 0x04AB48A04065C723ull},
+    {0x9D174B2DCEC0E47Bull, 0x62EB0D64283F9C76ull},
+    {0xC45D1DF942711D9Aull, 0x3BA5D0BD324F8394ull},
+    {0xF5746577930D6500ull, 0xCA8F44EC7EE36479ull},
+    {0x9968BF6ABBE85F20ull, 0x7E998B13CF4E1ECBull},
+    {0xBFC2EF456AE276E8ull, 0x9E3FEDD8C321A67Eull},
+    {0xEFB3AB16C59B14A2ull, 0xC5CFE94EF3EA101Eull},
+    {0x95D04AEE3B80ECE5ull, 0xBBA1F1D158724A12ull},
+    {0xBB445DA9CA61281Full, 0x2A8A6E45AE8EDC97ull},
+    {0xEA1575143CF97226ull, 0xF52D09D71A3293BDull},
+    {0x924D692CA61BE758ull, 0x593C2626705F9C56ull},
+    {0xB6E0C377CFA2E12Eull, 0x6F8B2FB00C77836Cull},
+    {0xE498F455C38B997Aull, 0x0B6DFB9C0F956447ull},
+    {0x8EDF98B59A373FECull, 0x4724BD4189BD5EACull},
+    {0xB2977EE300C50FE7ull, 0x58EDEC91EC2CB657ull},
+    {0xDF3D5E9BC0F653E1ull, 0x2F2967B66737E3EDull},
+    {0x8B865B215899F46Cull, 0xBD79E0D20082EE74ull},
+    {0xAE67F1E9AEC07187ull, 0xECD8590680A3AA11ull},
+    {0xDA01EE641A708DE9ull, 0xE80E6F4820CC9495ull},
+    {0x884134FE908658B2ull, 0x3109058D147FDCDDull},
+    {0xAA51823E34A7EEDEull, 0xBD4B46F0599FD415ull},
+    {0xD4E5E2CDC1D1EA96ull, 0x6C9E18AC7007C91Aull},
+    {0x850FADC09923329Eull, 0x03E2CF6BC604DDB0ull},
+    {0xA6539930BF6BFF45ull, 0x84DB8346B786151Cull},
+    {0xCFE87F7CEF46FF16ull, 0xE612641865679A63ull},
+    {0x81F14FAE158C5F6Eull, 0x4FCB7E8F3F60C07Eull},
+    {0xA26DA3999AEF7749ull, 0xE3BE5E330F38F09Dull},
+    {0xCB090C8001AB551Cull, 0x5CADF5BFD3072CC5ull},
+    {0xFDCB4FA002162A63ull, 0x73D9732FC7C8F7F6ull},
+    {0x9E9F11C4014DDA7Eull, 0x2867E7FDDCDD9AFAull},
+    {0xC646D63501A1511Dull, 0xB281E1FD541501B8ull},
+    {0xF7D88BC24209A565ull, 0x1F225A7CA91A4226ull},
+    {0x9AE757596946075Full, 0x3375788DE9B06958ull},
+    {0xC1A12D2FC3978937ull, 0x0052D6B1641C83AEull},
+    {0xF209787BB47D6B84ull, 0xC0678C5DBD23A49Aull},
+    {0x9745EB4D50CE6332ull, 0xF840B7BA963646E0ull},
+    {0xBD176620A501FBFFull, 0xB650E5A93BC3D898ull},
+    {0xEC5D3FA8CE427AFFull, 0xA3E51F138AB4CEBEull},
+    {0x93BA47C980E98CDFull, 0xC66F336C36B10137ull},
+    {0xB8A8D9BBE123F017ull, 0xB80B0047445D4184ull},
+    {0xE6D3102AD96CEC1Dull, 0xA60DC059157491E5ull},
+    {0x9043EA1AC7E41392ull, 0x87C89837AD68DB2Full},
+    {0xB454E4A179DD1877ull, 0x29BABE4598C311FBull},
+    {0xE16A1DC9D8545E94ull, 0xF4296DD6FEF3D67Aull},
+    {0x8CE2529E2734BB1Dull, 0x1899E4A65F58660Cull},
+    {0xB01AE745B101E9E4ull, 0x5EC05DCFF72E7F8Full},
+    {0xDC21A1171D42645Dull, 0x76707543F4FA1F73ull},
+    {0x899504AE72497EBAull, 0x6A06494A791C53A8ull},
+    {0xABFA45DA0EDBDE69ull, 0x0487DB9D17636892ull},
+    {0xD6F8D7509292D603ull, 0x45A9D2845D3C42B6ull},
+    {0x865B86925B9BC5C2ull, 0x0B8A2392BA45A9B2ull},
+    {0xA7F26836F282B732ull, 0x8E6CAC7768D7141Eull},
+    {0xD1EF0244AF2364FFull, 0x3207D795430CD926ull},
+    {0x8335616AED761F1Full, 0x7F44E6BD49E807B8ull},
+    {0xA402B9C5A8D3A6E7ull, 0x5F16206C9C6209A6ull},
+    {0xCD036837130890A1ull, 0x36DBA887C37A8C0Full},
+    {0x802221226BE55A64ull, 0xC2494954DA2C9789ull},
+    {0xA02AA96B06DEB0FDull, 0xF2DB9BAA10B7BD6Cull},
+    {0xC83553C5C8965D3Dull, 0x6F92829494E5ACC7ull},
+    {0xFA42A8B73ABBF48Cull, 0xCB772339BA1F17F9ull},
+    {0x9C69A97284B578D7ull, 0xFF2A760414536EFBull},
+    {0xC38413CF25E2D70Dull, 0xFEF5138519684ABAull},
+    {0xF46518C2EF5B8CD1ull, 0x7EB258665FC25D69ull},
+    {0x98BF2F79D5993802ull, 0xEF2F773FFBD97A61ull},
+    {0xBEEEFB584AFF8603ull, 0xAAFB550FFACFD8FAull},
+    {0xEEAABA2E5DBF6784ull, 0x95BA2A53F983CF38ull},
+    {0x952AB45CFA97A0B2ull, 0xDD945A747BF26183ull},
+    {0xBA756174393D88DFull, 0x94F971119AEEF9E4ull},
+    {0xE912B9D1478CEB17ull, 0x7A37CD5601AAB85Dull},
+    {0x91ABB422CCB812EEull, 0xAC62E055C10AB33Aull},
+    {0xB616A12B7FE617AAull, 0x577B986B314D6009ull},
+    {0xE39C49765FDF9D94ull, 0xED5A7E85FDA0B80Bull},
+    {0x8E41ADE9FBEBC27Dull, 0x14588F13BE847307ull},
+    {0xB1D219647AE6B31Cull, 0x596EB2D8AE258FC8ull},
+    {0xDE469FBD99A05FE3ull, 0x6FCA5F8ED9AEF3BBull},
+    {0x8AEC23D680043BEEull, 0x25DE7BB9480D5854ull},
+    {0xADA72CCC20054AE9ull, 0xAF561AA79A10AE6Aull},
+    {0xD910F7FF28069DA4ull, 0x1B2BA1518094DA04ull},
+    {0x87AA9AFF79042286ull, 0x90FB44D2F05D0842ull},
+    {0xA99541BF57452B28ull, 0x353A1607AC744A53ull},
+    {0xD3FA922F2D1675F2ull, 0x42889B8997915CE8ull},
+    {0x847C9B5D7C2E09B7ull, 0x69956135FEBADA11ull},
+    {0xA59BC234DB398C25ull, 0x43FAB9837E699095ull},
+    {0xCF02B2C21207EF2Eull, 0x94F967E45E03F4BBull},
+    {0x8161AFB94B44F57Dull, 0x1D1BE0EEBAC278F5ull},
+    {0xA1BA1BA79E1632DCull, 0x6462D92A69731732ull},
+    {0xCA28A291859BBF93ull, 0x7D7B8F7503CFDCFEull},
+    {0xFCB2CB35E702AF78ull, 0x5CDA735244C3D43Eull},
+    {0x9DEFBF01B061ADABull, 0x3A0888136AFA64A7ull},
+    {0xC56BAEC21C7A1916ull, 0x088AAA1845B8FDD0ull},
+    {0xF6C69A72A3989F5Bull, 0x8AAD549E57273D45ull},
+    {0x9A3C2087A63F6399ull, 0x36AC54E2F678864Bull},
+    {0xC0CB28A98FCF3C7Full, 0x84576A1BB416A7DDull},
+    {0xF0FDF2D3F3C30B9Full, 0x656D44A2A11C51D5ull},
+    {0x969EB7C47859E743ull, 0x9F644AE5A4B1B325ull},
+    {0xBC4665B596706114ull, 0x873D5D9F0DDE1FEEull},
+    {0xEB57FF22FC0C7959ull, 0xA90CB506D155A7EAull},
+    {0x9316FF75DD87CBD8ull, 0x09A7F12442D588F2ull},
+    {0xB7DCBF5354E9BECEull, 0x0C11ED6D538AEB2Full},
+    {0xE5D3EF282A242E81ull, 0x8F1668C8A86DA5FAull},
+    {0x8FA475791A569D10ull, 0xF96E017D694487BCull},
+    {0xB38D92D760EC4455ull, 0x37C981DCC395A9ACull},
+    {0xE070F78D3927556Aull, 0x85BBE253F47B1417ull},
+    {0x8C469AB843B89562ull, 0x93956D7478CCEC8Eull},
+    {0xAF58416654A6BABBull, 0x387AC8D1970027B2ull},
+    {0xDB2E51BFE9D0696Aull, 0x06997B05FCC0319Eull},
+    {0x88FCF317F22241E2ull, 0x441FECE3BDF81F03ull},
+    {0xAB3C2FDDEEAAD25Aull, 0xD527E81CAD7626C3ull},
+    {0xD60B3BD56A5586F1ull, 0x8A71E223D8D3B074ull},
+    {0x85C7056562757456ull, 0xF6872D5667844E49ull},
+    {0xA738C6BEBB12D16Cull, 0xB428F8AC016561DBull},
+    {0xD106F86E69D785C7ull, 0xE13336D701BEBA52ull},
+    {0x82A45B450226B39Cull, 0xECC0024661173473ull},
+    {0xA34D721642B06084ull, 0x27F002D7F95D0190ull},
+    {0xCC20CE9BD35C78A5ull, 0x31EC038DF7B441F4ull},
+    {0xFF290242C83396CEull, 0x7E67047175A15271ull},
+    {0x9F79A169BD203E41ull, 0x0F0062C6E984D386ull},
+    {0xC75809C42C684DD1ull, 0x52C07B78A3E60868ull},
+    {0xF92E0C3537826145ull, 0xA7709A56CCDF8A82ull},
+    {0x9BBCC7A142B17CCBull, 0x88A66076400BB691ull},
+    {0xC2ABF989935DDBFEull, 0x6ACFF893D00EA435ull},
+    {0xF356F7EBF83552FEull, 0x0583F6B8C4124D43ull},
+    {0x98165AF37B2153DEull, 0xC3727A337A8B704Aull},
+    {0xBE1BF1B059E9A8D6ull, 0x744F18C0592E4C5Cull},
+    {0xEDA2EE1C7064130Cull, 0x1162DEF06F79DF73ull},
+    {0x9485D4D1C63E8BE7ull, 0x8ADDCB5645AC2BA8ull},
+    {0xB9A74A0637CE2EE1ull, 0x6D953E2BD7173692ull},
+    {0xE8111C87C5C1BA99ull, 0xC8FA8DB6CCDD0437ull},
+    {0x910AB1D4DB9914A0ull, 0x1D9C9892400A22A2ull},
+    {0xB54D5E4A127F59C8ull, 0x2503BEB6D00CAB4Bull},
+    {0xE2A0B5DC971F303Aull, 0x2E44AE64840FD61Dull},
+    {0x8DA471A9DE737E24ull, 0x5CEAECFED289E5D2ull},
+    {0xB10D8E1456105DADull, 0x7425A83E872C5F47ull},
+    {0xDD50F1996B947518ull, 0xD12F124E28F77719ull},
+    {0x8A5296FFE33CC92Full, 0x82BD6B70D99AAA6Full},
+    {0xACE73CBFDC0BFB7Bull, 0x636CC64D1001550Bull},
+    {0xD8210BEFD30EFA5Aull, 0x3C47F7E05401AA4Eull},
+    {0x8714A775E3E95C78ull, 0x65ACFAEC34810A71ull},
+    {0xA8D9D1535CE3B396ull, 0x7F1839A741A14D0Dull},
+    {0xD31045A8341CA07Cull, 0x1EDE48111209A050ull},
+    {0x83EA2B892091E44Dull, 0x934AED0AAB460432ull},
+    {0xA4E4B66B68B65D60ull, 0xF81DA84D5617853Full},
+    {0xCE1DE40642E3F4B9ull, 0x36251260AB9D668Eull},
+    {0x80D2AE83E9CE78F3ull, 0xC1D72B7C6B426019ull},
+    {0xA1075A24E4421730ull, 0xB24CF65B8612F81Full},
+    {0xC94930AE1D529CFCull, 0xDEE033F26797B627ull},
+    {0xFB9B7CD9A4A7443Cull, 0x169840EF017DA3B1ull},
+    {0x9D412E0806E88AA5ull, 0x8E1F289560EE864Eull},
+    {0xC491798A08A2AD4Eull, 0xF1A6F2BAB92A27E2ull},
+    {0xF5B5D7EC8ACB58A2ull, 0xAE10AF696774B1DBull},
+    {0x9991A6F3D6BF1765ull, 0xACCA6DA1E0A8EF29ull},
+    {0xBFF610B0CC6EDD3Full, 0x17FD090A58D32AF3ull},
+    {0xEFF394DCFF8A948Eull, 0xDDFC4B4CEF07F5B0ull},
+    {0x95F83D0A1FB69CD9ull, 0x4ABDAF101564F98Eull},
+    {0xBB764C4CA7A4440Full, 0x9D6D1AD41ABE37F1ull},
+    {0xEA53DF5FD18D5513ull, 0x84C86189216DC5EDull},
+    {0x92746B9BE2F8552Cull, 0x32FD3CF5B4E49BB4ull},
+    {0xB7118682DBB66A77ull, 0x3FBC8C33221DC2A1ull},
+    {0xE4D5E82392A40515ull, 0x0FABAF3FEAA5334Aull},
+    {0x8F05B1163BA6832Dull, 0x29CB4D87F2A7400Eull},
+    {0xB2C71D5BCA9023F8ull, 0x743E20E9EF511012ull},
+    {0xDF78E4B2BD342CF6ull, 0x914DA9246B255416ull},
+    {0x8BAB8EEFB6409C1Aull, 0x1AD089B6C2F7548Eull},
+    {0xAE9672ABA3D0C320ull, 0xA184AC2473B529B1ull},
+    {0xDA3C0F568CC4F3E8ull, 0xC9E5D72D90A2741Eull},
+    {0x8865899617FB1871ull, 0x7E2FA67C7A658892ull},
+    {0xAA7EEBFB9DF9DE8Dull, 0xDDBB901B98FEEAB7ull},
+    {0xD51EA6FA85785631ull, 0x552A74227F3EA565ull},
+    {0x8533285C936B35DEull, 0xD53A88958F87275Full},
+    {0xA67FF273B8460356ull, 0x8A892ABAF368F137ull},
+    {0xD01FEF10A657842Cull, 0x2D2B7569B0432D85ull},
+    {0x8213F56A67F6B29Bull, 0x9C3B29620E29FC73ull},
+    {0xA298F2C501F45F42ull, 0x8349F3BA91B47B8Full},
+    {0xCB3F2F7642717713ull, 0x241C70A936219A73ull},
+    {0xFE0EFB53D30DD4D7ull, 0xED238CD383AA0110ull},
+    {0x9EC95D1463E8A506ull, 0xF4363804324A40AAull},
+    {0xC67BB4597CE2CE48ull, 0xB143C6053EDCD0D5ull},
+    {0xF81AA16FDC1B81DAull, 0xDD94B7868E94050Aull},
+    {0x9B10A4E5E9913128ull, 0xCA7CF2B4191C8326ull},
+    {0xC1D4CE1F63F57D72ull, 0xFD1C2F611F63A3F0ull},
+    {0xF24A01A73CF2DCCFull, 0xBC633B39673C8CECull},
+    {0x976E41088617CA01ull, 0xD5BE0503E085D813ull},
+    {0xBD49D14AA79DBC82ull, 0x4B2D8644D8A74E18ull},
+    {0xEC9C459D51852BA2ull, 0xDDF8E7D60ED1219Eull},
+    {0x93E1AB8252F33B45ull, 0xCABB90E5C942B503ull},
+    {0xB8DA1662E7B00A17ull, 0x3D6A751F3B936243ull},
+    {0xE7109BFBA19C0C9Dull, 0x0CC512670A783AD4ull},
+    {0x906A617D450187E2ull, 0x27FB2B80668B24C5ull},
+    {0xB484F9DC9641E9DAull, 0xB1F9F660802DEDF6ull},
+    {0xE1A63853BBD26451ull, 0x5E7873F8A0396973ull},
+    {0x8D07E33455637EB2ull, 0xDB0B487B6423E1E8ull},
+    {0xB049DC016ABC5E5Full, 0x91CE1A9A3D2CDA62ull},
+    {0xDC5C5301C56B75F7ull, 0x7641A140CC7810FBull},
+    {0x89B9B3E11B6329BAull, 0xA9E904C87FCB0A9Dull},
+    {0xAC2820D9623BF429ull, 0x546345FA9FBDCD44ull},
+    {0xD732290FBACAF133ull, 0xA97C177947AD4095ull},
+    {0x867F59A9D4BED6C0ull, 0x49ED8EABCCCC485Dull},
+    {0xA81F301449EE8C70ull, 0x5C68F256BFFF5A74ull},
+    {0xD226FC195C6A2F8Cull, 0x73832EEC6FFF3111ull},
+    {0x83585D8FD9C25DB7ull, 0xC831FD53C5FF7EABull},
+    {0xA42E74F3D032F525ull, 0xBA3E7CA8B77F5E55ull},
+    {0xCD3A1230C43FB26Full, 0x28CE1BD2E55F35EBull},
+    {0x80444B5E7AA7CF85ull, 0x7980D163CF5B81B3ull},
+    {0xA0555E361951C366ull, 0xD7E105BCC332621Full},
+    {0xC86AB5C39FA63440ull, 0x8DD9472BF3FEFAA7ull},
+    {0xFA856334878FC150ull, 0xB14F98F6F0FEB951ull},
+    {0x9C935E00D4B9D8D2ull, 0x6ED1BF9A569F33D3ull},
+    {0xC3B8358109E84F07ull, 0x0A862F80EC4700C8ull},
+    {0xF4A642E14C6262C8ull, 0xCD27BB612758C0FAull},
+    {0x98E7E9CCCFBD7DBDull, 0x8038D51CB897789Cull},
+    {0xBF21E44003ACDD2Cull, 0xE0470A63E6BD56C3ull},
+    {0xEEEA5D5004981478ull, 0x1858CCFCE06CAC74ull},
+    {0x95527A5202DF0CCBull, 0x0F37801E0C43EBC8ull},
+    {0xBAA718E68396CFFDull, 0xD30560258F54E6BAull},
+    {0xE950DF20247C83FDull, 0x47C6B82EF32A2069ull},
+    {0x91D28B7416CDD27Eull, 0x4CDC331D57FA5441ull},
+    {0xB6472E511C81471Dull, 0xE0133FE4ADF8E952ull},
+    {0xE3D8F9E563A198E5ull, 0x58180FDDD97723A6ull},
+    {0x8E679C2F5E44FF8Full, 0x570F09EAA7EA7648ull},
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Powers of ten that are exact in a double.
+///
+///////////////////////////////////////////////////////////////////////////////
+const double exactPowersOfTen[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+    1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Powers of ten that are exact in a float.
+///
+///////////////////////////////////////////////////////////////////////////////
+const float exactPowersOfTenFloat[11] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Layout of a binary floating-point type.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct BinaryFormat
+{
+    Int32 mantissaBits;     //<! Explicit mantissa bits
+    Int32 exponentBits;     //<!
+    Int32 minimumExponent;  //<! Exponent bias, negated
+    Int32 infinitePower;    //<! Biased exponent of the infinities
+    Int32 smallestPower;    //<! Powers of ten below round to zero
+    Int32 largestPower;     //<! Powers of ten above round to infinity
+    Int32 minRoundToEven;   //<! Powers of ten where a product can tie
+    Int32 maxRoundToEven;   //<!
+    Uint64 maxDigits;       //<! Above the digits of any halfway value
+};
+
+///////////////////////////////////////////////////////////////////////////////
+const BinaryFormat doubleFormat = {
+    52, 11, -1023, 0x7FF, -342, 308, -4, 23, 800
+};
+
+///////////////////////////////////////////////////////////////////////////////
+const BinaryFormat floatFormat = {
+    23, 8, -127, 0xFF, -64, 38, -17, 10, 128
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Binary value, as the fields of its floating-point type.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct Binary
+{
+    Uint64 mantissa;    //<! Without the implicit bit
+    Int32 power;        //<! Biased exponent
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Decimal number as read, before any rounding.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct ParsedNumber
+{
+    const char* integer;    //<!
+    Uint64 integerLength;   //<!
+    const char* fraction;   //<!
+    Uint64 fractionLength;  //<!
+    Int64 exponent;         //<! Written exponent
+    Uint64 mantissa;        //<! At most the first 19 significant digits
+    Int64 power;            //<! Power of ten applying to the mantissa
+    bool negative;          //<!
+    bool truncated;         //<! Whether the mantissa lost nonzero digits
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param c
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline bool isDigit(char c)
+{
+    return ((unsigned char)(c - '0') < 10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Accumulate digits into a mantissa, eight at a time when possible.
+///
+/// The mantissa wraps around past 19 digits, which the caller detects from
+/// the number of digits read.
+///
+/// \param ptr
+/// \param end
+/// \param mantissa
+///
+/// \return One past the last digit
+///
+///////////////////////////////////////////////////////////////////////////////
+const char* accumulate(const char* ptr, const char* end, Uint64& mantissa)
+{
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    while (end - ptr >= 8)
+    {
+        Uint64 word;
+        std::memcpy(&word, ptr, sizeof(word));
+        // Every byte in '0' to '9' has 3 as its high nibble, even plus 6
+        if (((word & 0xF0F0F0F0F0F0F0F0ull)
+            | (((word + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+            != 0x3333333333333333ull)
+        {
+            break;
+        }
+        // Pairs, then groups of four, then all eight, the first digit being
+        // the lowest byte
+        word -= 0x3030303030303030ull;
+        word = (word * 10) + (word >> 8);
+        word = (((word & 0x000000FF000000FFull) * 0x000F424000000064ull)
+            + (((word >> 16) & 0x000000FF000000FFull)
+            * 0x0000271000000001ull)) >> 32;
+        mantissa = mantissa * 100000000 + word;
+        ptr += 8;
+    }
+#endif
+    for (; ptr != end && isDigit(*ptr); ptr++)
+    {
+        mantissa = mantissa * 10 + (Uint64)(*ptr - '0');
+    }
+    return (ptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param number
+/// \param index Among the digits of the integer then of the fraction
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline char digitAt(const ParsedNumber& number, Uint64 index)
+{
+    return (index < number.integerLength ? number.integer[index]
+        : number.fraction[index - number.integerLength]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param number
+///
+/// \return The index of the first nonzero digit, the digit count if none
+///
+///////////////////////////////////////////////////////////////////////////////
+Uint64 firstSignificant(const ParsedNumber& number)
+{
+    const Uint64 count = number.integerLength + number.fractionLength;
+    Uint64 index = 0;
+
+    while (index < count && digitAt(number, index) == '0')
+    {
+        index++;
+    }
+    return (index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read a decimal number, the mantissa keeping 19 digits at most.
+///
+/// \param data
+/// \param length
+/// \param number
+///
+/// \return The number of characters read, zero if there are no digits
+///
+///////////////////////////////////////////////////////////////////////////////
+Uint64 scanNumber(const char* data, Uint64 length, ParsedNumber& number)
+{
+    const char* ptr = data;
+    const char* end = data + length;
+    Uint64 mantissa = 0;
+
+    number.negative = false;
+    if (ptr != end && (*ptr == '-' || *ptr == '+'))
+    {
+        number.negative = *ptr == '-';
+        ptr++;
+    }
+    number.integer = ptr;
+    ptr = accumulate(ptr, end, mantissa);
+    number.integerLength = (Uint64)(ptr - number.integer);
+    number.fraction = ptr;
+    number.fractionLength = 0;
+    if (ptr != end && *ptr == '.')
+    {
+        number.fraction = ++ptr;
+        ptr = accumulate(ptr, end, mantissa);
+        number.fractionLength = (Uint64)(ptr - number.fraction);
+    }
+    const Uint64 count = number.integerLength + number.fractionLength;
+    if (count == 0)
+    {
+        return (0);
+    }
+
+    // An exponent without digits is not part of the number
+    number.exponent = 0;
+    if (ptr != end && (*ptr == 'e' || *ptr == 'E'))
+    {
+        const char* cursor = ptr + 1;
+        bool negative = false;
+        if (cursor != end && (*cursor == '-' || *cursor == '+'))
+        {
+            negative = *cursor == '-';
+            cursor++;
+        }
+        if (cursor != end && isDigit(*cursor))
+        {
+            Int64 exponent = 0;
+            for (; cursor != end && isDigit(*cursor); cursor++)
+            {
+                // Far past any rounding to zero or infinity already
+                if (exponent < 0x10000000)
+                {
+                    exponent = exponent * 10 + (*cursor - '0');
+                }
+            }
+            number.exponent = negative ? -exponent : exponent;
+            ptr = cursor;
+        }
+    }
+
+    number.mantissa = mantissa;
+    number.power = number.exponent - (Int64)number.fractionLength;
+    number.truncated = false;
+    if (count > 19)
+    {
+        const Uint64 first = firstSignificant(number);
+        if (count - first > 19)
+        {
+            mantissa = 0;
+            for (Uint64 i = first; i < first + 19; i++)
+            {
+                mantissa = mantissa * 10 + (Uint64)(digitAt(number, i) - '0');
+            }
+            number.mantissa = mantissa;
+            number.power += (Int64)(count - first - 19);
+            number.truncated = true;
+        }
+    }
+    return ((Uint64)(ptr - data));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read `inf`, `infinity` or `nan`, in any case.
+///
+/// \param data
+/// \param length
+/// \param negative
+/// \param notANumber
+///
+/// \return The number of characters read, zero if there is no match
+///
+///////////////////////////////////////////////////////////////////////////////
+Uint64 scanSpecial(const char* data, Uint64 length, bool& negative,
+    bool& notANumber)
+{
+    Uint64 index = 0;
+
+    negative = false;
+    notANumber = false;
+    if (index < length && (data[index] == '-' || data[index] == '+'))
+    {
+        negative = data[index] == '-';
+        index++;
+    }
+
+    // Setting the 0x20 bit lowers the case of letters
+    auto matches = [&](const char* word, Uint64 count)
+    {
+        if (length - index < count)
+        {
+            return (false);
+        }
+        for (Uint64 i = 0; i < count; i++)
+        {
+            if ((data[index + i] | 0x20) != word[i])
+            {
+                return (false);
+            }
+        }
+        return (true);
+    };
+
+    if (matches("nan", 3))
+    {
+        notANumber = true;
+        return (index + 3);
+    }
+    if (matches("infinity", 8))
+    {
+        return (index + 8);
+    }
+    if (matches("inf", 3))
+    {
+        return (index + 3);
+    }
+    return (0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Round w * 10^q to the nearest binary value (Eisel-Lemire).
+///
+/// The 128-bit truncated product is always precise enough to round the
+/// exact product correctly.
+///
+/// \param format
+/// \param q
+/// \param w
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+Binary computeFloat(const BinaryFormat& format, Int64 q, Uint64 w)
+{
+    if (w == 0 || q < format.smallestPower)
+    {
+        return (Binary{0, 0});
+    }
+    if (q > format.largestPower)
+    {
+        return (Binary{0, format.infinitePower});
+    }
+    const Int32 zeros = 63 - (Int32)ax::utility::highestBit(w);
+    w <<= zeros;
+
+    // Only the top mantissa bits plus three matter, the second half of the
+    // power of five is needed when the lower bits of the product may carry
+    const Uint64* power = powersOfFive[q + 342];
+    const Uint64 precisionMask = ~0ull >> (format.mantissaBits + 3);
+    Uint128 product = multiply(w, power[0]);
+    if ((product.high & precisionMask) == precisionMask)
+    {
+        const Uint128 second = multiply(w, power[1]);
+        product.low += second.high;
+        if (second.high > product.low)
+        {
+            product.high++;
+        }
+    }
+
+    const Int32 upperBit = (Int32)(product.high >> 63);
+    const Int32 shift = upperBit + 64 - format.mantissaBits - 3;
+    Binary result;
+    result.mantissa = product.high >> shift;
+    // floor(log2(10^q)) + 63, as 217706 / 65536 is slightly above log2(10)
+    result.power = (Int32)(((217706 * q) >> 16) + 63) + upperBit - zeros
+        - format.minimumExponent;
+
+    if (result.power <= 0)
+    {
+        // Subnormal, round to nearest as the exponent cannot grow further
+        if (-result.power + 1 >= 64)
+        {
+            return (Binary{0, 0});
+        }
+        result.mantissa >>= -result.power + 1;
+        result.mantissa += result.mantissa & 1;
+        result.mantissa >>= 1;
+        result.power = result.mantissa < (1ull << format.mantissaBits) ? 0 : 1;
+        return (result);
+    }
+
+    // Exactly halfway only for small powers of ten, where the product is
+    // exact, then ties go to even
+    if (product.low <= 1 && q >= format.minRoundToEven
+        && q <= format.maxRoundToEven && (result.mantissa & 3) == 1
+        && (result.mantissa << shift) == product.high)
+    {
+        result.mantissa &= ~1ull;
+    }
+    result.mantissa += result.mantissa & 1;
+    result.mantissa >>= 1;
+    if (result.mantissa >= (2ull << format.mantissaBits))
+    {
+        result.mantissa = 1ull << format.mantissaBits;
+        result.power++;
+    }
+    result.mantissa &= ~(1ull << format.mantissaBits);
+    if (result.power >= format.infinitePower)
+    {
+        return (Binary{0, format.infinitePower});
+    }
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Unsigned integer of fixed capacity, for exact comparisons.
+///
+///////////////////////////////////////////////////////////////////////////////
+class BigInteger
+{
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Enough for 800 digits times the largest power of five needed.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr Uint32 capacity = 128;
+
+private:
+    Uint32 m_limbs[capacity];   //<! Least significant first
+    Uint32 m_size;              //<!
+
+public:
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param value
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit BigInteger(Uint64 value)
+        : m_size(0)
+    {
+        for (; value != 0; value >>= 32)
+        {
+            m_limbs[m_size++] = (Uint32)value;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Multiply by a factor, then add a value.
+    ///
+    /// \param factor
+    /// \param addend
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void multiplyAdd(Uint32 factor, Uint32 addend)
+    {
+        Uint64 carry = addend;
+
+        for (Uint32 i = 0; i < m_size; i++)
+        {
+            const Uint64 product = (Uint64)m_limbs[i] * factor + carry;
+            m_limbs[i] = (Uint32)product;
+            carry = product >> 32;
+        }
+        if (carry != 0 && m_size < capacity)
+        {
+            m_limbs[m_size++] = (Uint32)carry;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param exponent
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void multiplyPow5(Uint64 exponent)
+    {
+        // 5^13 is the largest power of five that fits in a limb
+        for (; exponent >= 13; exponent -= 13)
+        {
+            multiplyAdd(1220703125, 0);
+        }
+        Uint32 factor = 1;
+        for (; exponent > 0; exponent--)
+        {
+            factor *= 5;
+        }
+        multiplyAdd(factor, 0);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param bits
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void shiftLeft(Uint64 bits)
+    {
+        if (m_size == 0)
+        {
+            return;
+        }
+        const Uint32 limbs = (Uint32)(bits / 32);
+        const Uint32 shift = (Uint32)(bits % 32);
+        if (shift != 0)
+        {
+            const Uint32 top = m_limbs[m_size - 1] >> (32 - shift);
+            for (Uint32 i = m_size - 1; i > 0; i--)
+            {
+                m_limbs[i] = (m_limbs[i] << shift)
+                    | (m_limbs[i - 1] >> (32 - shift));
+            }
+            m_limbs[0] <<= shift;
+            if (top != 0 && m_size < capacity)
+            {
+                m_limbs[m_size++] = top;
+            }
+        }
+        if (limbs != 0 && m_size + limbs <= capacity)
+        {
+            std::memmove(m_limbs + limbs, m_limbs, m_size * sizeof(Uint32));
+            std::memset(m_limbs, 0, limbs * sizeof(Uint32));
+            m_size += limbs;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief
+    ///
+    /// \param other
+    ///
+    /// \return Negative, zero or positive as this is below, equal to or
+    /// above `other`
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    int compare(const BigInteger& other) const
+    {
+        if (m_size != other.m_size)
+        {
+            return (m_size < other.m_size ? -1 : 1);
+        }
+        for (Uint32 i = m_size; i > 0; i--)
+        {
+            if (m_limbs[i - 1] != other.m_limbs[i - 1])
+            {
+                return (m_limbs[i - 1] < other.m_limbs[i - 1] ? -1 : 1);
+            }
+        }
+        return (0);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Round a number whose mantissa was truncated, given the rounding of
+/// the truncated mantissa.
+///
+/// The number lies between the truncated mantissa and the next one, so it
+/// rounds to the candidate or to the value just above. Comparing all of its
+/// digits with the halfway point between the two decides which, exactly.
+///
+/// \param format
+/// \param number
+/// \param candidate
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+Binary refine(const BinaryFormat& format, const ParsedNumber& number,
+    Binary candidate)
+{
+    const Uint64 count = number.integerLength + number.fractionLength;
+    const Uint64 first = firstSignificant(number);
+    const Uint64 last = count - first > format.maxDigits
+        ? first + format.maxDigits : count;
+
+    // Digits nine at a time, a nonzero digit beyond the kept ones only
+    // telling that the number lies above them
+    BigInteger digits(0);
+    for (Uint64 i = first; i < last;)
+    {
+        Uint32 chunk = 0;
+        Uint32 scale = 1;
+        for (; i < last && scale != 1000000000; i++)
+        {
+            chunk = chunk * 10 + (Uint32)(digitAt(number, i) - '0');
+            scale *= 10;
+        }
+        digits.multiplyAdd(scale, chunk);
+    }
+    Int64 power = number.exponent - (Int64)number.fractionLength
+        + (Int64)(count - last);
+    for (Uint64 i = last; i < count; i++)
+    {
+        if (digitAt(number, i) != '0')
+        {
+            digits.multiplyAdd(10, 1);
+            power--;
+            break;
+        }
+    }
+
+    // Halfway is (2m + 1) * 2^(e - 1), compared to digits * 5^p * 2^p with
+    // the powers of five and two moved to the side keeping them whole
+    const Uint64 implicit = 1ull << format.mantissaBits;
+    const Uint64 m = candidate.mantissa | (candidate.power > 0 ? implicit : 0);
+    const Int64 e = (Int64)(candidate.power > 0 ? candidate.power : 1)
+        + format.minimumExponent - format.mantissaBits;
+    BigInteger halfway(2 * m + 1);
+    if (power >= 0)
+    {
+        digits.multiplyPow5((Uint64)power);
+    }
+    else
+    {
+        halfway.multiplyPow5((Uint64)-power);
+    }
+    const Int64 shift = power - (e - 1);
+    if (shift > 0)
+    {
+        digits.shiftLeft((Uint64)shift);
+    }
+    else
+    {
+        halfway.shiftLeft((Uint64)-shift);
+    }
+
+    const int order = digits.compare(halfway);
+    if (order > 0 || (order == 0 && (m & 1) != 0))
+    {
+        candidate.mantissa++;
+        if (candidate.mantissa == implicit)
+        {
+            candidate.mantissa = 0;
+            candidate.power++;
+        }
+    }
+    return (candidate);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Round a number to the nearest binary value.
+///
+/// \param format
+/// \param number
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+Binary toBinary(const BinaryFormat& format, const ParsedNumber& number)
+{
+    Binary result = computeFloat(format, number.power, number.mantissa);
+
+    // Both ends of the truncated range rounding the same settles it
+    if (number.truncated)
+    {
+        const Binary above = computeFloat(format, number.power,
+            number.mantissa + 1);
+        if (above.mantissa != result.mantissa || above.power != result.power)
+        {
+            result = refine(format, number, result);
+        }
+    }
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param format
+/// \param negative
+/// \param binary
+///
+/// \return The bits of the floating-point value
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint64 toBits(const BinaryFormat& format, bool negative, Binary binary)
+{
+    return (binary.mantissa
+        | ((Uint64)binary.power << format.mantissaBits)
+        | ((negative ? 1ull : 0ull)
+        << (format.mantissaBits + format.exponentBits)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read an infinity or a quiet NaN, as the bits of its format.
+///
+/// \param format
+/// \param data
+/// \param length
+/// \param bits
+///
+/// \return The number of characters read, zero if there is no match
+///
+///////////////////////////////////////////////////////////////////////////////
+Uint64 parseSpecial(const BinaryFormat& format, const char* data,
+    Uint64 length, Uint64& bits)
+{
+    bool negative;
+    bool notANumber;
+    const Uint64 read = scanSpecial(data, length, negative, notANumber);
+
+    if (read != 0)
+    {
+        const Uint64 quiet = notANumber ? 1ull << (format.mantissaBits - 1)
+            : 0;
+        bits = toBits(format, negative, Binary{quiet, format.infinitePower});
+    }
+    return (read);
+}
+
+// !SECTION
+
+// SECTION - Integer Parsing
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read digits, the first 19 significant ones never overflowing.
+///
+/// \param data
+/// \param length
+/// \param value
+///
+/// \return The number of characters read, zero if there are no digits or
+/// the value does not fit
+///
+///////////////////////////////////////////////////////////////////////////////
+Uint64 scanUint(const char* data, Uint64 length, Uint64& value)
+{
+    Uint64 index = 0;
+
+    while (index < length && data[index] == '0')
+    {
+        index++;
+    }
+    const Uint64 safe = length - index < 19 ? length : index + 19;
+    Uint64 result = 0;
+    for (; index < safe && isDigit(data[index]); index++)
+    {
+        result = result * 10 + (Uint64)(data[index] - '0');
+    }
+    if (index == safe && index < length && isDigit(data[index]))
+    {
+        const Uint64 digit = (Uint64)(data[index] - '0');
+        if (result > (~0ull - digit) / 10)
+        {
+            return (0);
+        }
+        result = result * 10 + digit;
+        index++;
+        if (index < length && isDigit(data[index]))
+        {
+            return (0);
+        }
+    }
+    if (index == 0)
+    {
+        return (0);
+    }
+    value = result;
+    return (index);
+}
+
+// !SECTION
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 StringNumber::formatInt(char* buffer, Int64 value)
+{
+    if (value < 0)
+    {
+        buffer[0] = '-';
+        return (formatUint(buffer + 1, 0 - (Uint64)value) + 1);
+    }
+    return (formatUint(buffer, (Uint64)value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 StringNumber::formatUint(char* buffer, Uint64 value)
+{
+    const Uint32 length = countDigits(value);
+
+    writeDigits(buffer + length, value);
+    return (length);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 StringNumber::formatFloat(char* buffer, double value)
+{
+    Uint64 bits;
+
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (formatBinary(buffer, (bits >> 63) != 0,
+        bits & ((1ull << 52) - 1), (Uint32)(bits >> 52) & 0x7FF, 52, 11));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 StringNumber::formatFloat(char* buffer, float value)
+{
+    Uint32 bits;
+
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (formatBinary(buffer, (bits >> 31) != 0,
+        bits & ((1u << 23) - 1), (bits >> 23) & 0xFF, 23, 8));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 StringNumber::parseInt(const char* data, Uint64 length, Int64& value)
+{
+    const bool negative = length != 0 && data[0] == '-';
+    const Uint64 sign = (length != 0 && (data[0] == '-' || data[0] == '+'))
+        ? 1 : 0;
+    Uint64 magnitude;
+
+    const Uint64 read = scanUint(data + sign, length - sign, magnitude);
+    if (read == 0 || magnitude > (negative ? 1ull << 63 : (1ull << 63) - 1))
+    {
+        return (0);
+    }
+    value = negative ? (Int64)(0 - magnitude) : (Int64)magnitude;
+    return (read + sign);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 StringNumber::parseUint(const char* data, Uint64 length,
+    Uint64& value)
+{
+    const Uint64 sign = (length != 0 && data[0] == '+') ? 1 : 0;
+    Uint64 magnitude;
+
+    const Uint64 read = scanUint(data + sign, length - sign, magnitude);
+    if (read == 0)
+    {
+        return (0);
+    }
+    value = magnitude;
+    return (read + sign);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 StringNumber::parseFloat(const char* data, Uint64 length,
+    double& value)
+{
+    ParsedNumber number;
+    Uint64 bits;
+
+    const Uint64 read = scanNumber(data, length, number);
+    if (read == 0)
+    {
+        const Uint64 special = parseSpecial(doubleFormat, data, length, bits);
+        if (special != 0)
+        {
+            std::memcpy(&value, &bits, sizeof(value));
+        }
+        return (special);
+    }
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    // Both the mantissa and the power of ten are exact, so is the result
+    if (!number.truncated && number.power >= -22 && number.power <= 22
+        && number.mantissa <= (1ull << 53))
+    {
+        double result = (double)number.mantissa;
+        result = number.power < 0 ? result / exactPowersOfTen[-number.power]
+            : result * exactPowersOfTen[number.power];
+        value = number.negative ? -result : result;
+        return (read);
+    }
+#endif
+    bits = toBits(doubleFormat, number.negative,
+        toBinary(doubleFormat, number));
+    std::memcpy(&value, &bits, sizeof(value));
+    return (read);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 StringNumber::parseFloat(const char* data, Uint64 length,
+    float& value)
+{
+    ParsedNumber number;
+    Uint64 bits;
+
+    const Uint64 read = scanNumber(data, length, number);
+    if (read == 0)
+    {
+        const Uint64 special = parseSpecial(floatFormat, data, length, bits);
+        if (special != 0)
+        {
+            const Uint32 narrow = (Uint32)bits;
+            std::memcpy(&value, &narrow, sizeof(value));
+        }
+        return (special);
+    }
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    // Both the mantissa and the power of ten are exact, so is the result
+    if (!number.truncated && number.power >= -10 && number.power <= 10
+        && number.mantissa <= (1ull << 24))
+    {
+        float result = (float)number.mantissa;
+        result = number.power < 0
+            ? result / exactPowersOfTenFloat[-number.power]
+            : result * exactPowersOfTenFloat[number.power];
+        value = number.negative ? -result : result;
+        return (read);
+    }
+#endif
+    bits = toBits(floatFormat, number.negative,
+        toBinary(floatFormat, number));
+    const Uint32 narrow = (Uint32)bits;
+    std::memcpy(&value, &narrow, sizeof(value));
+    return (read);
+}
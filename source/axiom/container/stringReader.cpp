@@ -0,0 +1,315 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/container/stringReader.hpp>
+#include <axiom/container/cstring.hpp>
+#include <cerrno>
+#include <climits>
+#include <algorithm>
+#include <cstring>
+#if defined(AXIOM_SYSTEM_WINDOWS)
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward StringReader, String, StringView and CString from ax::container
+///////////////////////////////////////////////////////////////////////////////
+using ax::container::StringReader;
+using ax::container::String;
+using ax::container::StringView;
+using ax::container::CString;
+
+///////////////////////////////////////////////////////////////////////////////
+// Private helpers
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// One read() call, retried when a signal interrupts it
+Uint64 readDescriptor(int descriptor, char* data, Uint64 length)
+{
+#if defined(AXIOM_SYSTEM_WINDOWS)
+    const int n = _read(descriptor, data,
+        length > INT_MAX ? INT_MAX : static_cast<unsigned int>(length));
+#else
+    ssize_t n;
+    do
+    {
+        n = ::read(descriptor, data, length > SSIZE_MAX ? SSIZE_MAX
+            : length);
+    } while (n < 0 && errno == EINTR);
+#endif
+    return ((n > 0) ? static_cast<Uint64>(n) : 0);
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+StringReader::StringReader(std::FILE* file, Uint64 bufferSize)
+    : m_source(Source::File)
+    , m_file(file)
+{
+    CHECK(file != nullptr && bufferSize != 0);
+    m_buffer.resize(bufferSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringReader::StringReader(int descriptor, Uint64 bufferSize)
+    : m_source(Source::Descriptor)
+    , m_descriptor(descriptor)
+{
+    CHECK(descriptor >= 0 && bufferSize != 0);
+    m_buffer.resize(bufferSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringReader::StringReader(std::istream& stream, Uint64 bufferSize)
+    : m_source(Source::Stream)
+    , m_stream(&stream)
+{
+    CHECK(stream.rdbuf() != nullptr && bufferSize != 0);
+    m_buffer.resize(bufferSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool StringReader::readLine(String& line, char delimiter)
+{
+    bool isRead = false;
+
+    line.clear();
+    while (m_begin != m_end || _fill() != 0)
+    {
+        const char* first = m_buffer.data() + m_begin;
+        const Uint64 available = m_end - m_begin;
+        const char* hit = static_cast<const char*>(
+            CString::memchr(first, delimiter, available));
+
+        if (hit)
+        {
+            line.append(first, hit - first);
+            m_begin += (hit - first) + 1;
+            return (true);
+        }
+        line.append(first, available);
+        m_begin = m_end;
+        isRead = true;
+    }
+    return (isRead);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool StringReader::readLine(StringView& line, char delimiter)
+{
+    Uint64 scanned = 0;
+
+    for (;;)
+    {
+        // Filling moves the unread characters to the front of the buffer,
+        // so the scan resumes from an offset rather than a pointer
+        const char* first = m_buffer.data() + m_begin;
+        const void* hit = CString::memchr(first + scanned, delimiter,
+            m_end - m_begin - scanned);
+
+        if (hit)
+        {
+            const Uint64 length = static_cast<const char*>(hit) - first;
+
+            line = StringView(first, length);
+            m_begin += length + 1;
+            return (true);
+        }
+        scanned = m_end - m_begin;
+        if (_fill() == 0)
+        {
+            break;
+        }
+    }
+    if (scanned == 0)
+    {
+        return (false);
+    }
+    line = StringView(m_buffer.data() + m_begin, scanned);
+    m_begin = m_end;
+    return (true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 StringReader::read(char* data, Uint64 length)
+{
+    Uint64 count = 0;
+
+    while (count < length)
+    {
+        if (m_begin == m_end)
+        {
+            // Reads of at least a buffer go straight to the destination
+            if (length - count >= m_buffer.size())
+            {
+                const Uint64 n = m_isExhausted ? 0
+                    : _readSource(data + count, length - count);
+
+                if (n == 0)
+                {
+                    break;
+                }
+                count += n;
+                continue;
+            }
+            if (_fill() == 0)
+            {
+                break;
+            }
+        }
+        Uint64 n = m_end - m_begin;
+        if (n > length - count)
+        {
+            n = length - count;
+        }
+        std::memcpy(data + count, m_buffer.data() + m_begin, n);
+        m_begin += n;
+        count += n;
+    }
+    return (count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 StringReader::readAll(String& str)
+{
+    Uint64 count = 0;
+
+    while (m_begin != m_end || _fill() != 0)
+    {
+        str.append(m_buffer.data() + m_begin, m_end - m_begin);
+        count += m_end - m_begin;
+        m_begin = m_end;
+    }
+    return (count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool StringReader::isEndOfFile(void)
+{
+    return (m_begin == m_end && _fill() == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringReader::getBufferSize(void) const
+{
+    return (m_buffer.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 StringReader::_fill(void)
+{
+    if (m_isExhausted)
+    {
+        return (0);
+    }
+    if (m_begin != 0)
+    {
+        std::memmove(m_buffer.data(), m_buffer.data() + m_begin,
+            m_end - m_begin);
+        m_end -= m_begin;
+        m_begin = 0;
+    }
+    if (m_end == m_buffer.size())
+    {
+        m_buffer.resize(m_buffer.size() * 2);
+    }
+    const Uint64 count = _readSource(m_buffer.data() + m_end,
+        m_buffer.size() - m_end);
+
+    m_end += count;
+    return (count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 StringReader::_readSource(char* data, Uint64 length)
+{
+    // Descriptors and streams only wait for the first character, then take
+    // what is already there: a pipe or a terminal must not hold back lines
+    // until `length` arrive. stdio offers no such read, files go through
+    // fread and keep its buffering
+    Uint64 count = 0;
+
+    if (m_source == Source::File)
+    {
+        count = std::fread(data, 1, length, m_file);
+    }
+    else if (m_source == Source::Descriptor)
+    {
+        count = readDescriptor(m_descriptor, data, length);
+    }
+    else
+    {
+        using Traits = std::istream::traits_type;
+        std::streambuf* buffer = m_stream->rdbuf();
+
+        if (!Traits::eq_int_type(buffer->sgetc(), Traits::eof()))
+        {
+            const std::streamsize available = buffer->in_avail();
+
+            if (available > 0)
+            {
+                count = static_cast<Uint64>(buffer->sgetn(data,
+                    static_cast<std::streamsize>(std::min<Uint64>(
+                    available, length))));
+            }
+            else
+            {
+                // Unbuffered, like std::cin synced with stdio: stop at the
+                // end of a line, past which the next character may block
+                Traits::int_type ch = buffer->sgetc();
+                while (count < length && !Traits::eq_int_type(ch,
+                    Traits::eof()))
+                {
+                    data[count++] = Traits::to_char_type(ch);
+                    buffer->sbumpc();
+                    if (data[count - 1] == '\n')
+                    {
+                        break;
+                    }
+                    ch = buffer->sgetc();
+                }
+            }
+        }
+        if (count == 0)
+        {
+            m_stream->setstate(std::ios_base::eofbit);
+        }
+    }
+    if (count == 0)
+    {
+        m_isExhausted = true;
+    }
+    return (count);
+}
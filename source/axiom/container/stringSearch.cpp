@@ -0,0 +1,558 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/container/stringSearch.hpp>
+#include <axiom/container/cstring.hpp>
+#include <axiom/utility.hpp>
+#include <cstring>
+#if defined(AXIOM_SIMD_SSE2) || defined(AXIOM_SIMD_AVX2)
+    #include <immintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward StringSearch and CString from ax::container
+///////////////////////////////////////////////////////////////////////////////
+using ax::container::StringSearch;
+using ax::container::CString;
+
+///////////////////////////////////////////////////////////////////////////////
+// Private Two-Way helpers
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Byte `index` of a buffer, counted from its end when reading backwards
+template <bool IsReverse>
+inline unsigned char byteAt(const unsigned char* data, Uint64 size,
+    Uint64 index)
+{
+    return (IsReverse ? data[size - 1 - index] : data[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Critical factorization of the needle read in the given direction, the
+// period of its right half going to `period`
+template <bool IsReverse>
+Uint64 criticalFactorization(const unsigned char* needle,
+    Uint64 needleLength, Uint64& period)
+{
+    const Uint64 npos = StringSearch::npos;
+    auto at = [needle, needleLength](Uint64 index) {
+        return (byteAt<IsReverse>(needle, needleLength, index));
+    };
+    Uint64 maxSuffix = npos;
+    Uint64 maxSuffixReverse = npos;
+    Uint64 j = 0;
+    Uint64 k = 1;
+    Uint64 p = 1;
+
+    // Maximal suffix for the natural ordering. `maxSuffix + k` wraps to
+    // `k - 1` while no suffix has been recorded yet.
+    while (j + k < needleLength)
+    {
+        unsigned char a = at(j + k);
+        unsigned char b = at(maxSuffix + k);
+        if (a < b)
+        {
+            j += k;
+            k = 1;
+            p = j - maxSuffix;
+        }
+        else if (a == b)
+        {
+            if (k != p)
+            {
+                k++;
+            }
+            else
+            {
+                j += p;
+                k = 1;
+            }
+        }
+        else
+        {
+            maxSuffix = j++;
+            k = p = 1;
+        }
+    }
+    period = p;
+
+    // Maximal suffix for the reversed ordering.
+    j = 0;
+    k = p = 1;
+    while (j + k < needleLength)
+    {
+        unsigned char a = at(j + k);
+        unsigned char b = at(maxSuffixReverse + k);
+        if (b < a)
+        {
+            j += k;
+            k = 1;
+            p = j - maxSuffixReverse;
+        }
+        else if (a == b)
+        {
+            if (k != p)
+            {
+                k++;
+            }
+            else
+            {
+                j += p;
+                k = 1;
+            }
+        }
+        else
+        {
+            maxSuffixReverse = j++;
+            k = p = 1;
+        }
+    }
+
+    if (maxSuffixReverse + 1 < maxSuffix + 1)
+    {
+        return (maxSuffix + 1);
+    }
+    period = p;
+    return (maxSuffixReverse + 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Two-Way search of the needle in the text, both read in the given
+// direction, so that a backward search finds the last occurrence first
+template <bool IsReverse>
+Uint64 twoWay(const unsigned char* text, Uint64 length,
+    const unsigned char* word, Uint64 needleLength)
+{
+    const Uint64 npos = StringSearch::npos;
+    auto wordAt = [word, needleLength](Uint64 index) {
+        return (byteAt<IsReverse>(word, needleLength, index));
+    };
+    auto textAt = [text, length](Uint64 index) {
+        return (byteAt<IsReverse>(text, length, index));
+    };
+    Uint64 period = 0;
+    const Uint64 suffix = criticalFactorization<IsReverse>(word,
+        needleLength, period);
+    Uint64 j = 0;
+    Uint64 i = 0;
+
+    // Backwards, both halves compared are read from the end of the needle
+    const bool isPeriodic = IsReverse
+        ? std::memcmp(word + needleLength - suffix,
+            word + needleLength - period - suffix, suffix) == 0
+        : std::memcmp(word, word + period, suffix) == 0;
+
+    if (isPeriodic)
+    {
+        // Periodic needle: remember how much of the left half already
+        // matched so it is never compared twice.
+        Uint64 memory = 0;
+        while (j <= length - needleLength)
+        {
+            i = (suffix > memory) ? suffix : memory;
+            while (i < needleLength && wordAt(i) == textAt(i + j))
+            {
+                i++;
+            }
+            if (i < needleLength)
+            {
+                j += i - suffix + 1;
+                memory = 0;
+                continue;
+            }
+            i = suffix - 1;
+            while (memory < i + 1 && wordAt(i) == textAt(i + j))
+            {
+                i--;
+            }
+            if (i + 1 < memory + 1)
+            {
+                return (j);
+            }
+            j += period;
+            memory = needleLength - period;
+        }
+        return (npos);
+    }
+
+    // Non periodic needle: a mismatch in the left half shifts by more than
+    // half of the needle.
+    period = ((suffix > needleLength - suffix) ? suffix :
+        needleLength - suffix) + 1;
+    while (j <= length - needleLength)
+    {
+        i = suffix;
+        while (i < needleLength && wordAt(i) == textAt(i + j))
+        {
+            i++;
+        }
+        if (i < needleLength)
+        {
+            j += i - suffix + 1;
+            continue;
+        }
+        i = suffix - 1;
+        while (i != npos && wordAt(i) == textAt(i + j))
+        {
+            i--;
+        }
+        if (i == npos)
+        {
+            return (j);
+        }
+        j += period;
+    }
+    return (npos);
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringSearch::find(const char* haystack, Uint64 length,
+    const char* needle, Uint64 needleLength, Uint64 position)
+{
+    if (position > length)
+    {
+        return (npos);
+    }
+    if (needleLength == 0)
+    {
+        return (position);
+    }
+    if (needleLength > length - position)
+    {
+        return (npos);
+    }
+
+    const char* start = haystack + position;
+    const Uint64 remaining = length - position;
+    Uint64 index = npos;
+
+    if (needleLength == 1)
+    {
+        index = findChar(start, remaining, *needle);
+    }
+    else
+    {
+        index = _findFiltered(start, remaining, needle, needleLength);
+    }
+    return (index == npos ? npos : index + position);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringSearch::rfind(const char* haystack, Uint64 length,
+    const char* needle, Uint64 needleLength, Uint64 position)
+{
+    if (needleLength > length)
+    {
+        return (npos);
+    }
+
+    Uint64 start = length - needleLength;
+
+    if (position < start)
+    {
+        start = position;
+    }
+    if (needleLength == 0)
+    {
+        return (start);
+    }
+    if (needleLength == 1)
+    {
+        return (rfindChar(haystack, start + 1, *needle));
+    }
+    return (_rfindFiltered(haystack, start + needleLength, needle,
+        needleLength));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringSearch::findChar(const char* haystack,
+    Uint64 length, char ch)
+{
+    const void* hit = CString::memchr(haystack, ch, length);
+
+    return (hit ? static_cast<const char*>(hit) - haystack : npos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringSearch::rfindChar(const char* haystack,
+    Uint64 length, char ch)
+{
+    const void* hit = CString::memrchr(haystack, ch, length);
+
+    return (hit ? static_cast<const char*>(hit) - haystack : npos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringSearch::_findFiltered(const char* haystack,
+    Uint64 length, const char* needle, Uint64 needleLength)
+{
+    const Uint64 last = needleLength - 1;
+    const Uint64 candidates = length - last;
+    const bool isLong = (needleLength >= longNeedle);
+    Uint64 verified = 0;
+    Uint64 i = 0;
+
+    // The dispatched memchr skips past a rare first character faster than
+    // the filter below, which only takes over once the hits get dense
+    for (Uint64 hits = 0; i < candidates && hits < (i >> sparseShift) + 8;
+        hits++)
+    {
+        Uint64 hit = findChar(haystack + i, candidates - i, needle[0]);
+        if (hit == npos)
+        {
+            return (npos);
+        }
+        i += hit;
+        if (isLong && ++verified > (i >> 4) + 16)
+        {
+            return (_findTwoWayFrom(haystack, length, needle, needleLength,
+                i));
+        }
+        if (haystack[i + last] == needle[last] &&
+            std::memcmp(haystack + i + 1, needle + 1, last - 1) == 0)
+        {
+            return (i);
+        }
+        i++;
+    }
+#if defined(AXIOM_SIMD_AVX2)
+    const __m256i first32 = _mm256_set1_epi8(needle[0]);
+    const __m256i last32 = _mm256_set1_epi8(needle[last]);
+    for (; i + 32 <= candidates; i += 32)
+    {
+        __m256i head = _mm256_loadu_si256((const __m256i*)(haystack + i));
+        __m256i tail = _mm256_loadu_si256(
+            (const __m256i*)(haystack + i + last));
+        Uint32 mask = (Uint32)_mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(head, first32),
+            _mm256_cmpeq_epi8(tail, last32)));
+        while (mask)
+        {
+            Uint64 index = i + axu::countTrailingZeros(mask);
+            if (isLong && ++verified > (index >> 4) + 16)
+            {
+                return (_findTwoWayFrom(haystack, length, needle,
+                    needleLength, index));
+            }
+            if (std::memcmp(haystack + index + 1, needle + 1, last - 1) == 0)
+            {
+                return (index);
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+#if defined(AXIOM_SIMD_SSE2)
+    const __m128i first16 = _mm_set1_epi8(needle[0]);
+    const __m128i last16 = _mm_set1_epi8(needle[last]);
+    for (; i + 16 <= candidates; i += 16)
+    {
+        __m128i head = _mm_loadu_si128((const __m128i*)(haystack + i));
+        __m128i tail = _mm_loadu_si128((const __m128i*)(haystack + i + last));
+        Uint32 mask = (Uint32)_mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(head, first16), _mm_cmpeq_epi8(tail, last16)));
+        while (mask)
+        {
+            Uint64 index = i + axu::countTrailingZeros(mask);
+            if (isLong && ++verified > (index >> 4) + 16)
+            {
+                return (_findTwoWayFrom(haystack, length, needle,
+                    needleLength, index));
+            }
+            if (std::memcmp(haystack + index + 1, needle + 1, last - 1) == 0)
+            {
+                return (index);
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+    while (i < candidates)
+    {
+        Uint64 hit = findChar(haystack + i, candidates - i, needle[0]);
+        if (hit == npos)
+        {
+            return (npos);
+        }
+        i += hit;
+        if (isLong && ++verified > (i >> 4) + 16)
+        {
+            return (_findTwoWayFrom(haystack, length, needle, needleLength,
+                i));
+        }
+        if (haystack[i + last] == needle[last] &&
+            std::memcmp(haystack + i + 1, needle + 1, last - 1) == 0)
+        {
+            return (i);
+        }
+        i++;
+    }
+    return (npos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringSearch::_rfindFiltered(const char* haystack,
+    Uint64 length, const char* needle, Uint64 needleLength)
+{
+    const Uint64 last = needleLength - 1;
+    const bool isLong = (needleLength >= longNeedle);
+    Uint64 verified = 0;
+    Uint64 end = length - last;
+
+    // Same as the forward search, the filter only takes over from memrchr
+    // once the hits get dense
+    for (Uint64 hits = 0;
+        end > 0 && hits < ((length - end) >> sparseShift) + 8; hits++)
+    {
+        Uint64 hit = rfindChar(haystack, end, needle[0]);
+        if (hit == npos)
+        {
+            return (npos);
+        }
+        if (isLong && ++verified > ((length - hit) >> 4) + 16)
+        {
+            return (_rfindTwoWay(haystack, hit + needleLength, needle,
+                needleLength));
+        }
+        if (haystack[hit + last] == needle[last] &&
+            std::memcmp(haystack + hit + 1, needle + 1, last - 1) == 0)
+        {
+            return (hit);
+        }
+        end = hit;
+    }
+#if defined(AXIOM_SIMD_AVX2)
+    const __m256i first32 = _mm256_set1_epi8(needle[0]);
+    const __m256i last32 = _mm256_set1_epi8(needle[last]);
+    for (; end >= 32; end -= 32)
+    {
+        const char* base = haystack + end - 32;
+        __m256i head = _mm256_loadu_si256((const __m256i*)base);
+        __m256i tail = _mm256_loadu_si256((const __m256i*)(base + last));
+        Uint32 mask = (Uint32)_mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(head, first32),
+            _mm256_cmpeq_epi8(tail, last32)));
+        while (mask)
+        {
+            Uint32 bit = axu::highestBit(mask);
+            Uint64 index = end - 32 + bit;
+            if (isLong && ++verified > ((length - index) >> 4) + 16)
+            {
+                return (_rfindTwoWay(haystack, index + needleLength, needle,
+                    needleLength));
+            }
+            if (std::memcmp(base + bit + 1, needle + 1, last - 1) == 0)
+            {
+                return (index);
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+#endif
+#if defined(AXIOM_SIMD_SSE2)
+    const __m128i first16 = _mm_set1_epi8(needle[0]);
+    const __m128i last16 = _mm_set1_epi8(needle[last]);
+    for (; end >= 16; end -= 16)
+    {
+        const char* base = haystack + end - 16;
+        __m128i head = _mm_loadu_si128((const __m128i*)base);
+        __m128i tail = _mm_loadu_si128((const __m128i*)(base + last));
+        Uint32 mask = (Uint32)_mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(head, first16), _mm_cmpeq_epi8(tail, last16)));
+        while (mask)
+        {
+            Uint32 bit = axu::highestBit(mask);
+            Uint64 index = end - 16 + bit;
+            if (isLong && ++verified > ((length - index) >> 4) + 16)
+            {
+                return (_rfindTwoWay(haystack, index + needleLength, needle,
+                    needleLength));
+            }
+            if (std::memcmp(base + bit + 1, needle + 1, last - 1) == 0)
+            {
+                return (index);
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+#endif
+    while (end > 0)
+    {
+        Uint64 hit = rfindChar(haystack, end, needle[0]);
+        if (hit == npos)
+        {
+            return (npos);
+        }
+        if (isLong && ++verified > ((length - hit) >> 4) + 16)
+        {
+            return (_rfindTwoWay(haystack, hit + needleLength, needle,
+                needleLength));
+        }
+        if (haystack[hit + last] == needle[last] &&
+            std::memcmp(haystack + hit + 1, needle + 1, last - 1) == 0)
+        {
+            return (hit);
+        }
+        end = hit;
+    }
+    return (npos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringSearch::_findTwoWay(const char* haystack,
+    Uint64 length, const char* needle, Uint64 needleLength)
+{
+    return (twoWay<false>((const unsigned char*)haystack, length,
+        (const unsigned char*)needle, needleLength));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringSearch::_rfindTwoWay(const char* haystack,
+    Uint64 length, const char* needle, Uint64 needleLength)
+{
+    Uint64 index = twoWay<true>((const unsigned char*)haystack, length,
+        (const unsigned char*)needle, needleLength);
+
+    return (index == npos ? npos : length - needleLength - index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringSearch::_findTwoWayFrom(const char* haystack,
+    Uint64 length, const char* needle, Uint64 needleLength, Uint64 position)
+{
+    Uint64 index = _findTwoWay(haystack + position, length - position, needle,
+        needleLength);
+
+    return (index == npos ? npos : index + position);
+}
@@ -0,0 +1,495 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/container/stringView.hpp>
+#include <axiom/container/stringSearch.hpp>
+#include <axiom/container/cstring.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward StringView, StringSplit, StringSearch, CharSet and CString from
+// ax::container
+///////////////////////////////////////////////////////////////////////////////
+using ax::container::StringView;
+using ax::container::StringSplit;
+using ax::container::StringSearch;
+using ax::container::CharSet;
+using ax::container::CString;
+
+///////////////////////////////////////////////////////////////////////////////
+StringView::StringView(void) {}
+
+///////////////////////////////////////////////////////////////////////////////
+StringView::StringView(const char* other)
+{
+    if (other != nullptr)
+    {
+        m_data = other;
+        m_length = CString::strlen(other);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringView::StringView(const char* other, Uint64 length)
+{
+    CHECK(other != nullptr || length == 0);
+    if (other != nullptr)
+    {
+        m_data = other;
+        m_length = length;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringView::StringView(const std::string& other)
+    : m_data(other.data())
+    , m_length(other.length())
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const char& StringView::operator[](Uint64 index) const
+{
+    return (m_data[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringView::operator std::string(void) const
+{
+    return (std::string(m_data, m_length));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const char* StringView::data(void) const
+{
+    return (m_data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringView::length(void) const
+{
+    return (m_length);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringView::size(void) const
+{
+    return (m_length);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool StringView::isEmpty(void) const
+{
+    return (m_length == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const char& StringView::at(Uint64 index) const
+{
+    CHECK(index < m_length);
+    return (m_data[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const char& StringView::front(void) const
+{
+    return (at(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const char& StringView::back(void) const
+{
+    return (at(m_length - 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const char* StringView::begin(void) const
+{
+    return (m_data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const char* StringView::end(void) const
+{
+    return (m_data + m_length);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD StringView StringView::substr(Uint64 position,
+    Uint64 length) const
+{
+    CHECK(position <= m_length);
+    if (length > m_length - position)
+    {
+        length = m_length - position;
+    }
+    return (StringView(m_data + position, length));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StringView::removePrefix(Uint64 length)
+{
+    CHECK(length <= m_length);
+    m_data += length;
+    m_length -= length;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StringView::removeSuffix(Uint64 length)
+{
+    CHECK(length <= m_length);
+    m_length -= length;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD StringView StringView::trim(void) const
+{
+    return (trim(CharSet::whitespace()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD StringView StringView::trim(const CharSet& set) const
+{
+    Uint64 start = set.findFirstNotIn(m_data, m_length);
+
+    if (start == npos)
+    {
+        return (StringView(m_data + m_length, 0));
+    }
+    return (StringView(m_data + start,
+        set.findLastNotIn(m_data, m_length) + 1 - start));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD StringSplit StringView::split(char delimiter) const
+{
+    return (StringSplit(*this, delimiter));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD StringSplit StringView::split(StringView delimiter) const
+{
+    return (StringSplit(*this, delimiter));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD StringSplit StringView::tokenize(const CharSet& delimiters)
+    const
+{
+    return (StringSplit(*this, delimiters));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD int StringView::compare(StringView other) const
+{
+    Uint64 length = m_length < other.m_length ? m_length : other.m_length;
+    int result = CString::memcmp(m_data, other.m_data, length);
+
+    if (result != 0)
+    {
+        return (result);
+    }
+    if (m_length == other.m_length)
+    {
+        return (0);
+    }
+    return (m_length < other.m_length ? -1 : 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool StringView::startsWith(StringView prefix) const
+{
+    return (prefix.m_length <= m_length &&
+        CString::memcmp(m_data, prefix.m_data, prefix.m_length) == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool StringView::endsWith(StringView suffix) const
+{
+    return (suffix.m_length <= m_length &&
+        CString::memcmp(m_data + m_length - suffix.m_length, suffix.m_data,
+            suffix.m_length) == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringView::find(StringView other, Uint64 position)
+    const
+{
+    return (StringSearch::find(m_data, m_length, other.m_data, other.m_length,
+        position));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringView::find(char ch, Uint64 position) const
+{
+    return (StringSearch::find(m_data, m_length, &ch, 1, position));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringView::rfind(StringView other, Uint64 position)
+    const
+{
+    return (StringSearch::rfind(m_data, m_length, other.m_data,
+        other.m_length, position));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringView::rfind(char ch, Uint64 position) const
+{
+    return (StringSearch::rfind(m_data, m_length, &ch, 1, position));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringView::findFirstOf(const CharSet& set,
+    Uint64 position) const
+{
+    return (set.findFirstIn(m_data, m_length, position));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringView::findLastOf(const CharSet& set,
+    Uint64 position) const
+{
+    return (set.findLastIn(m_data, m_length, position));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringView::findFirstNotOf(const CharSet& set,
+    Uint64 position) const
+{
+    return (set.findFirstNotIn(m_data, m_length, position));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 StringView::findLastNotOf(const CharSet& set,
+    Uint64 position) const
+{
+    return (set.findLastNotIn(m_data, m_length, position));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringSplit::Iterator::Iterator(void) {}
+
+///////////////////////////////////////////////////////////////////////////////
+StringSplit::Iterator::Iterator(const StringSplit* range)
+    : m_range(range)
+    , m_rest(range->m_source)
+{
+    _advance();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const StringView& StringSplit::Iterator::operator*(void) const
+{
+    return (m_current);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const StringView* StringSplit::Iterator::operator->(void)
+    const
+{
+    return (&m_current);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringSplit::Iterator& StringSplit::Iterator::operator++(void)
+{
+    _advance();
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringSplit::Iterator StringSplit::Iterator::operator++(int)
+{
+    Iterator previous = *this;
+
+    _advance();
+    return (previous);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool StringSplit::Iterator::operator==(const Iterator& other)
+    const
+{
+    if (m_range == nullptr || other.m_range == nullptr)
+    {
+        return (m_range == other.m_range);
+    }
+    return (m_current.data() == other.m_current.data() &&
+        m_current.length() == other.m_current.length());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool StringSplit::Iterator::operator!=(const Iterator& other)
+    const
+{
+    return (!(*this == other));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StringSplit::Iterator::_advance(void)
+{
+    if (m_range == nullptr)
+    {
+        return;
+    }
+    if (m_range->m_isTokenizer)
+    {
+        const CharSet& set = m_range->m_set;
+        Uint64 start = m_rest.findFirstNotOf(set);
+        if (start == StringView::npos)
+        {
+            m_range = nullptr;
+            return;
+        }
+        Uint64 stop = m_rest.findFirstOf(set, start);
+        m_current = m_rest.substr(start, stop - start);
+        m_rest.removePrefix(stop == StringView::npos ? m_rest.length() : stop);
+        return;
+    }
+    if (m_isLast)
+    {
+        m_range = nullptr;
+        return;
+    }
+
+    const StringView& delimiter = m_range->m_delimiter;
+    Uint64 stop = m_rest.find(delimiter);
+
+    if (stop == StringView::npos)
+    {
+        m_current = m_rest;
+        m_isLast = true;
+        return;
+    }
+    m_current = m_rest.substr(0, stop);
+    m_rest.removePrefix(stop + delimiter.length());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringSplit::StringSplit(StringView source, char delimiter)
+    : m_source(source)
+    , m_char(delimiter)
+{
+    m_delimiter = StringView(&m_char, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringSplit::StringSplit(StringView source, StringView delimiter)
+    : m_source(source)
+    , m_delimiter(delimiter)
+{
+    CHECK(!delimiter.isEmpty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringSplit::StringSplit(StringView source, const CharSet& delimiters)
+    : m_source(source)
+    , m_set(delimiters)
+    , m_isTokenizer(true)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+StringSplit::StringSplit(const StringSplit& other)
+{
+    *this = other;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+StringSplit& StringSplit::operator=(const StringSplit& other)
+{
+    m_source = other.m_source;
+    m_char = other.m_char;
+    m_set = other.m_set;
+    m_isTokenizer = other.m_isTokenizer;
+    m_delimiter = other.m_delimiter;
+    if (other.m_delimiter.data() == &other.m_char)
+    {
+        m_delimiter = StringView(&m_char, 1);
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD StringSplit::Iterator StringSplit::begin(void) const
+{
+    return (Iterator(this));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD StringSplit::Iterator StringSplit::end(void) const
+{
+    return (Iterator());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool operator==(const axc::StringView& lhs,
+    const axc::StringView& rhs)
+{
+    return (lhs.length() == rhs.length() && lhs.compare(rhs) == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool operator!=(const axc::StringView& lhs,
+    const axc::StringView& rhs)
+{
+    return (!(lhs == rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool operator<(const axc::StringView& lhs,
+    const axc::StringView& rhs)
+{
+    return (lhs.compare(rhs) < 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool operator<=(const axc::StringView& lhs,
+    const axc::StringView& rhs)
+{
+    return (lhs.compare(rhs) <= 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool operator>(const axc::StringView& lhs,
+    const axc::StringView& rhs)
+{
+    return (lhs.compare(rhs) > 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool operator>=(const axc::StringView& lhs,
+    const axc::StringView& rhs)
+{
+    return (lhs.compare(rhs) >= 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const axc::StringView& rhs)
+{
+    return (lhs.write(rhs.data(), rhs.length()));
+}
@@ -0,0 +1,190 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Pragma once
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/math/types.hpp>
+#if !defined(AXIOM_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64) || \
+    defined(__i386__) || defined(_M_IX86))
+    #define AXIOM_CPU_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Compile the SIMD kernels for their instruction set, whatever the flags of
+// the build, the dispatch making sure they only run where supported
+///////////////////////////////////////////////////////////////////////////////
+#if defined(AXIOM_CPU_X86) && !defined(_MSC_VER)
+    #define AXIOM_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define AXIOM_TARGET(isa)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Namespace ax::detail
+///////////////////////////////////////////////////////////////////////////////
+namespace ax::detail
+{
+
+#if defined(AXIOM_CPU_X86)
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Query a CPUID leaf.
+///
+/// \param leaf
+/// \param subleaf
+/// \param registers Receives EAX, EBX, ECX and EDX
+///
+///////////////////////////////////////////////////////////////////////////////
+inline void cpuid(Uint32 leaf, Uint32 subleaf, Uint32 registers[4])
+{
+#if defined(_MSC_VER)
+    int values[4];
+    __cpuidex(values, (int)leaf, (int)subleaf);
+    for (int i = 0; i < 4; i++)
+    {
+        registers[i] = (Uint32)values[i];
+    }
+#else
+    __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2],
+        registers[3]);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read the register state the OS saves on context switches.
+///
+/// \return XCR0, only valid once OSXSAVE is known to be set
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint64 getSavedState(void)
+{
+#if defined(_MSC_VER)
+    return (_xgetbv(0));
+#else
+    Uint32 low, high;
+    __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+    return (((Uint64)high << 32) | low);
+#endif
+}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \return Whether SSE2 instructions can run
+///
+///////////////////////////////////////////////////////////////////////////////
+inline bool hasSse2(void)
+{
+#if defined(AXIOM_CPU_X86)
+    Uint32 registers[4];
+    cpuid(1, 0, registers);
+    return ((registers[3] >> 26) & 1);
+#else
+    return (false);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \return Whether the leaf 7 features of AVX and later can be used, the
+/// OS saving the YMM registers
+///
+///////////////////////////////////////////////////////////////////////////////
+inline bool hasAvx(void)
+{
+#if defined(AXIOM_CPU_X86)
+    Uint32 registers[4];
+    cpuid(0, 0, registers);
+    const Uint32 maxLeaf = registers[0];
+    cpuid(1, 0, registers);
+    // AVX needs both the OSXSAVE and AVX bits, and the OS saving the YMM
+    // registers, before the bits of leaf 7 mean anything
+    return (((registers[2] >> 27) & 3) == 3 && maxLeaf >= 7 &&
+        (getSavedState() & 0x6) == 0x6);
+#else
+    return (false);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \return Whether AVX2 instructions can run
+///
+///////////////////////////////////////////////////////////////////////////////
+inline bool hasAvx2(void)
+{
+#if defined(AXIOM_CPU_X86)
+    Uint32 registers[4];
+    if (!hasAvx())
+    {
+        return (false);
+    }
+    cpuid(7, 0, registers);
+    return ((registers[1] >> 5) & 1);
+#else
+    return (false);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \return Whether AVX-512F instructions can run
+///
+///////////////////////////////////////////////////////////////////////////////
+inline bool hasAvx512(void)
+{
+#if defined(AXIOM_CPU_X86)
+    Uint32 registers[4];
+    if (!hasAvx())
+    {
+        return (false);
+    }
+    cpuid(7, 0, registers);
+    // AVX-512 also needs the opmask and ZMM registers saved
+    return (((registers[1] >> 16) & 1) && (getSavedState() & 0xE6) == 0xE6);
+#else
+    return (false);
+#endif
+}
+
+} // namespace ax::detail
@@ -36,3 +36,95 @@
 // Forward Shader from ax::graphics
 ///////////////////////////////////////////////////////////////////////////////
 using ax::graphics::Shader;
+
+///////////////////////////////////////////////////////////////////////////////
+void Shader::setUniform(const axc::String& name, float x)
+{
+    setUniform(axc::Name(name), x);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shader::setUniform(const axc::String& name, int x)
+{
+    setUniform(axc::Name(name), x);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shader::setUniform(const axc::String& name, const axm::Vector2& x)
+{
+    setUniform(axc::Name(name), x);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shader::setUniform(const axc::String& name, const axm::Vector3& x)
+{
+    setUniform(axc::Name(name), x);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shader::setUniform(const axc::String& name, const axm::Vector4& x)
+{
+    setUniform(axc::Name(name), x);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shader::setUniform(const axc::String& name, bool x)
+{
+    setUniform(axc::Name(name), x);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shader::setUniform(axc::Name name, float x)
+{
+    glUniform1f(getUniformLocation(name), x);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shader::setUniform(axc::Name name, int x)
+{
+    glUniform1i(getUniformLocation(name), x);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shader::setUniform(axc::Name name, const axm::Vector2& x)
+{
+    glUniform2f(getUniformLocation(name), x.x, x.y);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shader::setUniform(axc::Name name, const axm::Vector3& x)
+{
+    glUniform3f(getUniformLocation(name), x.x, x.y, x.z);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shader::setUniform(axc::Name name, const axm::Vector4& x)
+{
+    glUniform4f(getUniformLocation(name), x.x, x.y, x.z, x.w);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Shader::setUniform(axc::Name name, bool x)
+{
+    glUniform1i(getUniformLocation(name), x ? 1 : 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD int Shader::getUniformLocation(const axc::String& name)
+{
+    return (getUniformLocation(axc::Name(name)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD int Shader::getUniformLocation(axc::Name name)
+{
+    const int* cached = m_uniforms.get(name);
+
+    if (cached != nullptr)
+    {
+        return (*cached);
+    }
+    const int location = glGetUniformLocation(object, name.cstr());
+    m_uniforms.tryEmplace(name, location);
+    return (location);
+}
@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/hash/hash.hpp>
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Wyhash from ax::hash
+///////////////////////////////////////////////////////////////////////////////
+using ax::hash::Wyhash;
+
+///////////////////////////////////////////////////////////////////////////////
+// Anonymous namespace
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param data
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint64 read8(const unsigned char* data)
+{
+    Uint64 value;
+
+    std::memcpy(&value, data, 8);
+    return (value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief
+///
+/// \param data
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint64 read4(const unsigned char* data)
+{
+    Uint32 value;
+
+    std::memcpy(&value, data, 4);
+    return (value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Read one to three bytes, the first, middle and last ones.
+///
+/// \param data
+/// \param length
+///
+/// \return
+///
+///////////////////////////////////////////////////////////////////////////////
+inline Uint64 read3(const unsigned char* data, Uint64 length)
+{
+    return (((Uint64)data[0] << 16) | ((Uint64)data[length >> 1] << 8)
+        | data[length - 1]);
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 ax::hash::hashBytes(const void* data, Uint64 length)
+{
+    // Same steps as `Wyhash::hash`, with unaligned loads instead of the
+    // byte shifts a constant expression needs
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    Uint64 seed = Wyhash::secret0;
+    Uint64 a = 0;
+    Uint64 b = 0;
+
+    if (length <= 16)
+    {
+        if (length >= 4)
+        {
+            a = (read4(bytes) << 32) | read4(bytes + ((length >> 3) << 2));
+            b = (read4(bytes + length - 4) << 32)
+                | read4(bytes + length - 4 - ((length >> 3) << 2));
+        }
+        else if (length > 0)
+        {
+            a = read3(bytes, length);
+        }
+    }
+    else
+    {
+        Uint64 left = length;
+        if (left > 48)
+        {
+            Uint64 seed1 = seed;
+            Uint64 seed2 = seed;
+            do
+            {
+                seed = hashMix(read8(bytes) ^ Wyhash::secret1,
+                    read8(bytes + 8) ^ seed);
+                seed1 = hashMix(read8(bytes + 16) ^ Wyhash::secret2,
+                    read8(bytes + 24) ^ seed1);
+                seed2 = hashMix(read8(bytes + 32) ^ Wyhash::secret3,
+                    read8(bytes + 40) ^ seed2);
+                bytes += 48;
+                left -= 48;
+            } while (left > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (left > 16)
+        {
+            seed = hashMix(read8(bytes) ^ Wyhash::secret1,
+                read8(bytes + 8) ^ seed);
+            bytes += 16;
+            left -= 16;
+        }
+        a = read8(bytes + left - 16);
+        b = read8(bytes + left - 8);
+    }
+    return (hashMix(Wyhash::secret1 ^ length,
+        hashMix(a ^ Wyhash::secret1, b ^ seed)));
+}
@@ -0,0 +1,933 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/math/batch.hpp>
+#include <axiom/math/simd.hpp>
+#include <cmath>
+#include "../detail/cpu.hpp"
+#if defined(AXIOM_SIMD_SSE2) || defined(AXIOM_SIMD_NEON)
+    #define AXIOM_BATCH_FLOAT4
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Batch from ax::math
+///////////////////////////////////////////////////////////////////////////////
+using ax::math::Batch;
+
+///////////////////////////////////////////////////////////////////////////////
+// Private kernels and dispatch table
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// Each kernel handles the vectors in [begin, end), a multiple of `lanes` of
+// them, except for the scalar ones which also take the leftovers
+struct Kernels
+{
+    Uint64 lanes;
+    void (*scaleOffset)(float*, Uint64, Uint64, float, float);
+    void (*multiplyAdd)(float*, const float*, Uint64, Uint64, float);
+    void (*bounds)(const float*, Uint64, Uint64, float&, float&);
+    void (*distance)(const float* const*, Uint32, Uint64, Uint64,
+        const float*, float*);
+    void (*dot)(const float* const*, const float* const*, Uint32, Uint64,
+        Uint64, float*);
+    void (*normalize)(float* const*, Uint32, Uint64, Uint64, float);
+    void (*transform)(float* const*, Uint32, Uint64, Uint64, const float*);
+};
+
+// SECTION - Scalar kernels
+
+///////////////////////////////////////////////////////////////////////////////
+void scaleOffsetScalar(float* data, Uint64 begin, Uint64 end, float scale,
+    float offset)
+{
+    for (Uint64 i = begin; i < end; i++)
+    {
+        data[i] = data[i] * scale + offset;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void multiplyAddScalar(float* data, const float* other, Uint64 begin,
+    Uint64 end, float factor)
+{
+    for (Uint64 i = begin; i < end; i++)
+    {
+        data[i] += other[i] * factor;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void boundsScalar(const float* data, Uint64 begin, Uint64 end, float& min,
+    float& max)
+{
+    for (Uint64 i = begin; i < end; i++)
+    {
+        min = data[i] < min ? data[i] : min;
+        max = data[i] > max ? data[i] : max;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void distanceScalar(const float* const* components, Uint32 dimension,
+    Uint64 begin, Uint64 end, const float* point, float* out)
+{
+    for (Uint64 i = begin; i < end; i++)
+    {
+        float squared = 0.f;
+        for (Uint32 c = 0; c < dimension; c++)
+        {
+            float delta = components[c][i] - point[c];
+            squared += delta * delta;
+        }
+        out[i] = std::sqrt(squared);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void dotScalar(const float* const* lhs, const float* const* rhs,
+    Uint32 dimension, Uint64 begin, Uint64 end, float* out)
+{
+    for (Uint64 i = begin; i < end; i++)
+    {
+        float sum = 0.f;
+        for (Uint32 c = 0; c < dimension; c++)
+        {
+            sum += lhs[c][i] * rhs[c][i];
+        }
+        out[i] = sum;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void normalizeScalar(float* const* components, Uint32 dimension,
+    Uint64 begin, Uint64 end, float tolerance)
+{
+    for (Uint64 i = begin; i < end; i++)
+    {
+        float squared = 0.f;
+        for (Uint32 c = 0; c < dimension; c++)
+        {
+            squared += components[c][i] * components[c][i];
+        }
+        float scale = 0.f;
+        if (squared > tolerance)
+        {
+            scale = 1.f / std::sqrt(squared);
+        }
+        for (Uint32 c = 0; c < dimension; c++)
+        {
+            components[c][i] = squared > tolerance
+                ? components[c][i] * scale : 0.f;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void transformScalar(float* const* components, Uint32 dimension,
+    Uint64 begin, Uint64 end, const float* matrix)
+{
+    for (Uint64 i = begin; i < end; i++)
+    {
+        float in[3];
+        for (Uint32 c = 0; c < dimension; c++)
+        {
+            in[c] = components[c][i];
+        }
+        for (Uint32 r = 0; r < dimension; r++)
+        {
+            const float* row = matrix + r * (dimension + 1);
+            float sum = row[0] * in[0];
+            for (Uint32 c = 1; c < dimension; c++)
+            {
+                sum += row[c] * in[c];
+            }
+            components[r][i] = sum + row[dimension];
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr Kernels scalarKernels = {1, &scaleOffsetScalar, &multiplyAddScalar,
+    &boundsScalar, &distanceScalar, &dotScalar, &normalizeScalar,
+    &transformScalar};
+
+// !SECTION
+
+#if defined(AXIOM_BATCH_FLOAT4)
+
+// SECTION - Float4 kernels
+
+///////////////////////////////////////////////////////////////////////////////
+namespace simd = ax::math::simd;
+
+///////////////////////////////////////////////////////////////////////////////
+void scaleOffsetFloat4(float* data, Uint64 begin, Uint64 end, float scale,
+    float offset)
+{
+    simd::Float4 factor = simd::splat(scale);
+    simd::Float4 shift = simd::splat(offset);
+    for (Uint64 i = begin; i < end; i += 4)
+    {
+        simd::Float4 value = simd::loadUnaligned(data + i);
+        simd::storeUnaligned(data + i,
+            simd::add(simd::multiply(value, factor), shift));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void multiplyAddFloat4(float* data, const float* other, Uint64 begin,
+    Uint64 end, float factor)
+{
+    simd::Float4 scale = simd::splat(factor);
+    for (Uint64 i = begin; i < end; i += 4)
+    {
+        simd::Float4 product =
+            simd::multiply(simd::loadUnaligned(other + i), scale);
+        simd::storeUnaligned(data + i,
+            simd::add(simd::loadUnaligned(data + i), product));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void boundsFloat4(const float* data, Uint64 begin, Uint64 end, float& min,
+    float& max)
+{
+    simd::Float4 lower = simd::splat(min);
+    simd::Float4 upper = simd::splat(max);
+    for (Uint64 i = begin; i < end; i += 4)
+    {
+        simd::Float4 value = simd::loadUnaligned(data + i);
+        lower = simd::min(lower, value);
+        upper = simd::max(upper, value);
+    }
+    alignas(16) float lanes[8];
+    simd::store(lanes, lower);
+    simd::store(lanes + 4, upper);
+    boundsScalar(lanes, 0, 4, min, max);
+    boundsScalar(lanes, 4, 8, min, max);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <Uint32 N>
+void distanceFloat4(const float* const* components, Uint64 begin, Uint64 end,
+    const float* point, float* out)
+{
+    simd::Float4 origin[N];
+    for (Uint32 c = 0; c < N; c++)
+    {
+        origin[c] = simd::splat(point[c]);
+    }
+    for (Uint64 i = begin; i < end; i += 4)
+    {
+        simd::Float4 squared = simd::zero();
+        for (Uint32 c = 0; c < N; c++)
+        {
+            simd::Float4 delta = simd::subtract(
+                simd::loadUnaligned(components[c] + i), origin[c]);
+            squared = simd::add(squared, simd::multiply(delta, delta));
+        }
+        simd::storeUnaligned(out + i, simd::sqrt(squared));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void distanceFloat4(const float* const* components, Uint32 dimension,
+    Uint64 begin, Uint64 end, const float* point, float* out)
+{
+    dimension == 3 ? distanceFloat4<3>(components, begin, end, point, out)
+        : distanceFloat4<2>(components, begin, end, point, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <Uint32 N>
+void dotFloat4(const float* const* lhs, const float* const* rhs,
+    Uint64 begin, Uint64 end, float* out)
+{
+    for (Uint64 i = begin; i < end; i += 4)
+    {
+        simd::Float4 sum = simd::zero();
+        for (Uint32 c = 0; c < N; c++)
+        {
+            sum = simd::add(sum, simd::multiply(
+                simd::loadUnaligned(lhs[c] + i),
+                simd::loadUnaligned(rhs[c] + i)));
+        }
+        simd::storeUnaligned(out + i, sum);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void dotFloat4(const float* const* lhs, const float* const* rhs,
+    Uint32 dimension, Uint64 begin, Uint64 end, float* out)
+{
+    dimension == 3 ? dotFloat4<3>(lhs, rhs, begin, end, out)
+        : dotFloat4<2>(lhs, rhs, begin, end, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <Uint32 N>
+void normalizeFloat4(float* const* components, Uint64 begin, Uint64 end,
+    float tolerance)
+{
+    simd::Float4 limit = simd::splat(tolerance);
+    simd::Float4 one = simd::splat(1.f);
+    for (Uint64 i = begin; i < end; i += 4)
+    {
+        simd::Float4 value[N];
+        simd::Float4 squared = simd::zero();
+        for (Uint32 c = 0; c < N; c++)
+        {
+            value[c] = simd::loadUnaligned(components[c] + i);
+            squared = simd::add(squared, simd::multiply(value[c], value[c]));
+        }
+        simd::Float4 mask = simd::greater(squared, limit);
+        simd::Float4 scale = simd::divide(one, simd::sqrt(squared));
+        for (Uint32 c = 0; c < N; c++)
+        {
+            simd::storeUnaligned(components[c] + i, simd::select(mask,
+                simd::multiply(value[c], scale), simd::zero()));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void normalizeFloat4(float* const* components, Uint32 dimension,
+    Uint64 begin, Uint64 end, float tolerance)
+{
+    dimension == 3 ? normalizeFloat4<3>(components, begin, end, tolerance)
+        : normalizeFloat4<2>(components, begin, end, tolerance);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <Uint32 N>
+void transformFloat4(float* const* components, Uint64 begin, Uint64 end,
+    const float* matrix)
+{
+    simd::Float4 m[N][N + 1];
+    for (Uint32 r = 0; r < N; r++)
+    {
+        for (Uint32 c = 0; c <= N; c++)
+        {
+            m[r][c] = simd::splat(matrix[r * (N + 1) + c]);
+        }
+    }
+    for (Uint64 i = begin; i < end; i += 4)
+    {
+        simd::Float4 in[N];
+        for (Uint32 c = 0; c < N; c++)
+        {
+            in[c] = simd::loadUnaligned(components[c] + i);
+        }
+        for (Uint32 r = 0; r < N; r++)
+        {
+            simd::Float4 sum = simd::multiply(m[r][0], in[0]);
+            for (Uint32 c = 1; c < N; c++)
+            {
+                sum = simd::add(sum, simd::multiply(m[r][c], in[c]));
+            }
+            simd::storeUnaligned(components[r] + i, simd::add(sum, m[r][N]));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void transformFloat4(float* const* components, Uint32 dimension,
+    Uint64 begin, Uint64 end, const float* matrix)
+{
+    dimension == 3 ? transformFloat4<3>(components, begin, end, matrix)
+        : transformFloat4<2>(components, begin, end, matrix);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr Kernels float4Kernels = {4, &scaleOffsetFloat4, &multiplyAddFloat4,
+    &boundsFloat4, &distanceFloat4, &dotFloat4, &normalizeFloat4,
+    &transformFloat4};
+
+// !SECTION
+
+#endif
+
+#if defined(AXIOM_CPU_X86)
+
+// SECTION - AVX2 kernels
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") void scaleOffsetAvx2(float* data, Uint64 begin,
+    Uint64 end, float scale, float offset)
+{
+    __m256 factor = _mm256_set1_ps(scale);
+    __m256 shift = _mm256_set1_ps(offset);
+    for (Uint64 i = begin; i < end; i += 8)
+    {
+        __m256 value = _mm256_loadu_ps(data + i);
+        _mm256_storeu_ps(data + i,
+            _mm256_add_ps(_mm256_mul_ps(value, factor), shift));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") void multiplyAddAvx2(float* data, const float* other,
+    Uint64 begin, Uint64 end, float factor)
+{
+    __m256 scale = _mm256_set1_ps(factor);
+    for (Uint64 i = begin; i < end; i += 8)
+    {
+        __m256 product = _mm256_mul_ps(_mm256_loadu_ps(other + i), scale);
+        _mm256_storeu_ps(data + i,
+            _mm256_add_ps(_mm256_loadu_ps(data + i), product));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") void boundsAvx2(const float* data, Uint64 begin,
+    Uint64 end, float& min, float& max)
+{
+    __m256 lower = _mm256_set1_ps(min);
+    __m256 upper = _mm256_set1_ps(max);
+    for (Uint64 i = begin; i < end; i += 8)
+    {
+        __m256 value = _mm256_loadu_ps(data + i);
+        lower = _mm256_min_ps(lower, value);
+        upper = _mm256_max_ps(upper, value);
+    }
+    alignas(32) float lanes[16];
+    _mm256_store_ps(lanes, lower);
+    _mm256_store_ps(lanes + 8, upper);
+    boundsScalar(lanes, 0, 8, min, max);
+    boundsScalar(lanes, 8, 16, min, max);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <Uint32 N>
+AXIOM_TARGET("avx2") void distanceAvx2(const float* const* components,
+    Uint64 begin, Uint64 end, const float* point, float* out)
+{
+    __m256 origin[N];
+    for (Uint32 c = 0; c < N; c++)
+    {
+        origin[c] = _mm256_set1_ps(point[c]);
+    }
+    for (Uint64 i = begin; i < end; i += 8)
+    {
+        __m256 squared = _mm256_setzero_ps();
+        for (Uint32 c = 0; c < N; c++)
+        {
+            __m256 delta = _mm256_sub_ps(_mm256_loadu_ps(components[c] + i),
+                origin[c]);
+            squared = _mm256_add_ps(squared, _mm256_mul_ps(delta, delta));
+        }
+        _mm256_storeu_ps(out + i, _mm256_sqrt_ps(squared));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") void distanceAvx2(const float* const* components,
+    Uint32 dimension, Uint64 begin, Uint64 end, const float* point,
+    float* out)
+{
+    dimension == 3 ? distanceAvx2<3>(components, begin, end, point, out)
+        : distanceAvx2<2>(components, begin, end, point, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <Uint32 N>
+AXIOM_TARGET("avx2") void dotAvx2(const float* const* lhs,
+    const float* const* rhs, Uint64 begin, Uint64 end, float* out)
+{
+    for (Uint64 i = begin; i < end; i += 8)
+    {
+        __m256 sum = _mm256_setzero_ps();
+        for (Uint32 c = 0; c < N; c++)
+        {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(
+                _mm256_loadu_ps(lhs[c] + i), _mm256_loadu_ps(rhs[c] + i)));
+        }
+        _mm256_storeu_ps(out + i, sum);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") void dotAvx2(const float* const* lhs,
+    const float* const* rhs, Uint32 dimension, Uint64 begin, Uint64 end,
+    float* out)
+{
+    dimension == 3 ? dotAvx2<3>(lhs, rhs, begin, end, out)
+        : dotAvx2<2>(lhs, rhs, begin, end, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <Uint32 N>
+AXIOM_TARGET("avx2") void normalizeAvx2(float* const* components,
+    Uint64 begin, Uint64 end, float tolerance)
+{
+    __m256 limit = _mm256_set1_ps(tolerance);
+    __m256 one = _mm256_set1_ps(1.f);
+    for (Uint64 i = begin; i < end; i += 8)
+    {
+        __m256 value[N];
+        __m256 squared = _mm256_setzero_ps();
+        for (Uint32 c = 0; c < N; c++)
+        {
+            value[c] = _mm256_loadu_ps(components[c] + i);
+            squared = _mm256_add_ps(squared,
+                _mm256_mul_ps(value[c], value[c]));
+        }
+        __m256 mask = _mm256_cmp_ps(squared, limit, _CMP_GT_OQ);
+        __m256 scale = _mm256_div_ps(one, _mm256_sqrt_ps(squared));
+        for (Uint32 c = 0; c < N; c++)
+        {
+            _mm256_storeu_ps(components[c] + i,
+                _mm256_and_ps(mask, _mm256_mul_ps(value[c], scale)));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") void normalizeAvx2(float* const* components,
+    Uint32 dimension, Uint64 begin, Uint64 end, float tolerance)
+{
+    dimension == 3 ? normalizeAvx2<3>(components, begin, end, tolerance)
+        : normalizeAvx2<2>(components, begin, end, tolerance);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <Uint32 N>
+AXIOM_TARGET("avx2") void transformAvx2(float* const* components,
+    Uint64 begin, Uint64 end, const float* matrix)
+{
+    __m256 m[N][N + 1];
+    for (Uint32 r = 0; r < N; r++)
+    {
+        for (Uint32 c = 0; c <= N; c++)
+        {
+            m[r][c] = _mm256_set1_ps(matrix[r * (N + 1) + c]);
+        }
+    }
+    for (Uint64 i = begin; i < end; i += 8)
+    {
+        __m256 in[N];
+        for (Uint32 c = 0; c < N; c++)
+        {
+            in[c] = _mm256_loadu_ps(components[c] + i);
+        }
+        for (Uint32 r = 0; r < N; r++)
+        {
+            __m256 sum = _mm256_mul_ps(m[r][0], in[0]);
+            for (Uint32 c = 1; c < N; c++)
+            {
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(m[r][c], in[c]));
+            }
+            _mm256_storeu_ps(components[r] + i, _mm256_add_ps(sum, m[r][N]));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx2") void transformAvx2(float* const* components,
+    Uint32 dimension, Uint64 begin, Uint64 end, const float* matrix)
+{
+    dimension == 3 ? transformAvx2<3>(components, begin, end, matrix)
+        : transformAvx2<2>(components, begin, end, matrix);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr Kernels avx2Kernels = {8, &scaleOffsetAvx2, &multiplyAddAvx2,
+    &boundsAvx2, &distanceAvx2, &dotAvx2, &normalizeAvx2, &transformAvx2};
+
+// !SECTION
+
+// SECTION - AVX-512 kernels
+
+///////////////////////////////////////////////////////////////////////////////
+// Every lane set: the zero-masked forms of sqrt, min and max, unlike the
+// plain ones, raise no uninitialized warnings with the GCC 12 headers
+constexpr __mmask16 allLanes = 0xFFFF;
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx512f") void scaleOffsetAvx512(float* data, Uint64 begin,
+    Uint64 end, float scale, float offset)
+{
+    __m512 factor = _mm512_set1_ps(scale);
+    __m512 shift = _mm512_set1_ps(offset);
+    for (Uint64 i = begin; i < end; i += 16)
+    {
+        __m512 value = _mm512_loadu_ps(data + i);
+        _mm512_storeu_ps(data + i,
+            _mm512_add_ps(_mm512_mul_ps(value, factor), shift));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx512f") void multiplyAddAvx512(float* data,
+    const float* other, Uint64 begin, Uint64 end, float factor)
+{
+    __m512 scale = _mm512_set1_ps(factor);
+    for (Uint64 i = begin; i < end; i += 16)
+    {
+        __m512 product = _mm512_mul_ps(_mm512_loadu_ps(other + i), scale);
+        _mm512_storeu_ps(data + i,
+            _mm512_add_ps(_mm512_loadu_ps(data + i), product));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx512f") void boundsAvx512(const float* data, Uint64 begin,
+    Uint64 end, float& min, float& max)
+{
+    __m512 lower = _mm512_set1_ps(min);
+    __m512 upper = _mm512_set1_ps(max);
+    for (Uint64 i = begin; i < end; i += 16)
+    {
+        __m512 value = _mm512_loadu_ps(data + i);
+        lower = _mm512_maskz_min_ps(allLanes, lower, value);
+        upper = _mm512_maskz_max_ps(allLanes, upper, value);
+    }
+    alignas(64) float lanes[32];
+    _mm512_store_ps(lanes, lower);
+    _mm512_store_ps(lanes + 16, upper);
+    boundsScalar(lanes, 0, 16, min, max);
+    boundsScalar(lanes, 16, 32, min, max);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <Uint32 N>
+AXIOM_TARGET("avx512f") void distanceAvx512(const float* const* components,
+    Uint64 begin, Uint64 end, const float* point, float* out)
+{
+    __m512 origin[N];
+    for (Uint32 c = 0; c < N; c++)
+    {
+        origin[c] = _mm512_set1_ps(point[c]);
+    }
+    for (Uint64 i = begin; i < end; i += 16)
+    {
+        __m512 squared = _mm512_setzero_ps();
+        for (Uint32 c = 0; c < N; c++)
+        {
+            __m512 delta = _mm512_sub_ps(_mm512_loadu_ps(components[c] + i),
+                origin[c]);
+            squared = _mm512_add_ps(squared, _mm512_mul_ps(delta, delta));
+        }
+        _mm512_storeu_ps(out + i,
+            _mm512_maskz_sqrt_ps(allLanes, squared));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx512f") void distanceAvx512(const float* const* components,
+    Uint32 dimension, Uint64 begin, Uint64 end, const float* point,
+    float* out)
+{
+    dimension == 3 ? distanceAvx512<3>(components, begin, end, point, out)
+        : distanceAvx512<2>(components, begin, end, point, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <Uint32 N>
+AXIOM_TARGET("avx512f") void dotAvx512(const float* const* lhs,
+    const float* const* rhs, Uint64 begin, Uint64 end, float* out)
+{
+    for (Uint64 i = begin; i < end; i += 16)
+    {
+        __m512 sum = _mm512_setzero_ps();
+        for (Uint32 c = 0; c < N; c++)
+        {
+            sum = _mm512_add_ps(sum, _mm512_mul_ps(
+                _mm512_loadu_ps(lhs[c] + i), _mm512_loadu_ps(rhs[c] + i)));
+        }
+        _mm512_storeu_ps(out + i, sum);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx512f") void dotAvx512(const float* const* lhs,
+    const float* const* rhs, Uint32 dimension, Uint64 begin, Uint64 end,
+    float* out)
+{
+    dimension == 3 ? dotAvx512<3>(lhs, rhs, begin, end, out)
+        : dotAvx512<2>(lhs, rhs, begin, end, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <Uint32 N>
+AXIOM_TARGET("avx512f") void normalizeAvx512(float* const* components,
+    Uint64 begin, Uint64 end, float tolerance)
+{
+    __m512 limit = _mm512_set1_ps(tolerance);
+    __m512 one = _mm512_set1_ps(1.f);
+    for (Uint64 i = begin; i < end; i += 16)
+    {
+        __m512 value[N];
+        __m512 squared = _mm512_setzero_ps();
+        for (Uint32 c = 0; c < N; c++)
+        {
+            value[c] = _mm512_loadu_ps(components[c] + i);
+            squared = _mm512_add_ps(squared,
+                _mm512_mul_ps(value[c], value[c]));
+        }
+        __mmask16 mask = _mm512_cmp_ps_mask(squared, limit, _CMP_GT_OQ);
+        __m512 scale = _mm512_div_ps(one,
+            _mm512_maskz_sqrt_ps(allLanes, squared));
+        for (Uint32 c = 0; c < N; c++)
+        {
+            _mm512_storeu_ps(components[c] + i,
+                _mm512_maskz_mul_ps(mask, value[c], scale));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx512f") void normalizeAvx512(float* const* components,
+    Uint32 dimension, Uint64 begin, Uint64 end, float tolerance)
+{
+    dimension == 3 ? normalizeAvx512<3>(components, begin, end, tolerance)
+        : normalizeAvx512<2>(components, begin, end, tolerance);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <Uint32 N>
+AXIOM_TARGET("avx512f") void transformAvx512(float* const* components,
+    Uint64 begin, Uint64 end, const float* matrix)
+{
+    __m512 m[N][N + 1];
+    for (Uint32 r = 0; r < N; r++)
+    {
+        for (Uint32 c = 0; c <= N; c++)
+        {
+            m[r][c] = _mm512_set1_ps(matrix[r * (N + 1) + c]);
+        }
+    }
+    for (Uint64 i = begin; i < end; i += 16)
+    {
+        __m512 in[N];
+        for (Uint32 c = 0; c < N; c++)
+        {
+            in[c] = _mm512_loadu_ps(components[c] + i);
+        }
+        for (Uint32 r = 0; r < N; r++)
+        {
+            __m512 sum = _mm512_mul_ps(m[r][0], in[0]);
+            for (Uint32 c = 1; c < N; c++)
+            {
+                sum = _mm512_add_ps(sum, _mm512_mul_ps(m[r][c], in[c]));
+            }
+            _mm512_storeu_ps(components[r] + i, _mm512_add_ps(sum, m[r][N]));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_TARGET("avx512f") void transformAvx512(float* const* components,
+    Uint32 dimension, Uint64 begin, Uint64 end, const float* matrix)
+{
+    dimension == 3 ? transformAvx512<3>(components, begin, end, matrix)
+        : transformAvx512<2>(components, begin, end, matrix);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr Kernels avx512Kernels = {16, &scaleOffsetAvx512,
+    &multiplyAddAvx512, &boundsAvx512, &distanceAvx512, &dotAvx512,
+    &normalizeAvx512, &transformAvx512};
+
+// !SECTION
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+bool isSupported(Batch::Implementation implementation)
+{
+    switch (implementation)
+    {
+        case Batch::Implementation::Scalar:
+            return (true);
+#if defined(AXIOM_BATCH_FLOAT4)
+        case Batch::Implementation::Float4:
+            return (true);
+#endif
+        default:
+            break;
+    }
+    if (implementation == Batch::Implementation::Avx2)
+    {
+        return (ax::detail::hasAvx2());
+    }
+    return (implementation == Batch::Implementation::Avx512 &&
+        ax::detail::hasAvx512());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Constant-initialized, so calls made before the selection below, from other
+// static initializers, safely use the scalar kernels
+Kernels kernels = scalarKernels;
+Batch::Implementation current = Batch::Implementation::Scalar;
+
+///////////////////////////////////////////////////////////////////////////////
+Batch::Implementation selectBest(void)
+{
+    if (Batch::setImplementation(Batch::Implementation::Avx512) ||
+        Batch::setImplementation(Batch::Implementation::Avx2))
+    {
+        return (current);
+    }
+    Batch::setImplementation(Batch::Implementation::Float4);
+    return (current);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Batch::Implementation selected = selectBest();
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 getSplit(Uint64 count)
+{
+    return (count - count % kernels.lanes);
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+void Batch::scaleOffset(float* data, Uint64 count, float scale,
+    float offset)
+{
+    CHECK(count == 0 || data);
+    Uint64 split = getSplit(count);
+    kernels.scaleOffset(data, 0, split, scale, offset);
+    scaleOffsetScalar(data, split, count, scale, offset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Batch::multiplyAdd(float* data, const float* other, Uint64 count,
+    float factor)
+{
+    CHECK(count == 0 || (data && other));
+    Uint64 split = getSplit(count);
+    kernels.multiplyAdd(data, other, 0, split, factor);
+    multiplyAddScalar(data, other, split, count, factor);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Batch::bounds(const float* data, Uint64 count, float& min, float& max)
+{
+    CHECK(count > 0 && data);
+    Uint64 split = getSplit(count);
+    min = data[0];
+    max = data[0];
+    kernels.bounds(data, 0, split, min, max);
+    boundsScalar(data, split, count, min, max);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Batch::length(const float* const* components, Uint32 dimension,
+    Uint64 count, float* out)
+{
+    static const float origin[3] = {0.f, 0.f, 0.f};
+    distance(components, dimension, count, origin, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Batch::distance(const float* const* components, Uint32 dimension,
+    Uint64 count, const float* point, float* out)
+{
+    CHECK(dimension == 2 || dimension == 3);
+    CHECK(count == 0 || (components && point && out));
+    Uint64 split = getSplit(count);
+    kernels.distance(components, dimension, 0, split, point, out);
+    distanceScalar(components, dimension, split, count, point, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Batch::dot(const float* const* lhs, const float* const* rhs,
+    Uint32 dimension, Uint64 count, float* out)
+{
+    CHECK(dimension == 2 || dimension == 3);
+    CHECK(count == 0 || (lhs && rhs && out));
+    Uint64 split = getSplit(count);
+    kernels.dot(lhs, rhs, dimension, 0, split, out);
+    dotScalar(lhs, rhs, dimension, split, count, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Batch::normalize(float* const* components, Uint32 dimension,
+    Uint64 count, float tolerance)
+{
+    CHECK(dimension == 2 || dimension == 3);
+    CHECK(count == 0 || components);
+    Uint64 split = getSplit(count);
+    kernels.normalize(components, dimension, 0, split, tolerance);
+    normalizeScalar(components, dimension, split, count, tolerance);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Batch::transform(float* const* components, Uint32 dimension,
+    Uint64 count, const float* matrix)
+{
+    CHECK(dimension == 2 || dimension == 3);
+    CHECK(count == 0 || (components && matrix));
+    Uint64 split = getSplit(count);
+    kernels.transform(components, dimension, 0, split, matrix);
+    transformScalar(components, dimension, split, count, matrix);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Batch::Implementation Batch::getImplementation(void)
+{
+    return (current);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Batch::setImplementation(Implementation implementation)
+{
+    if (!isSupported(implementation))
+    {
+        return (false);
+    }
+    switch (implementation)
+    {
+#if defined(AXIOM_CPU_X86)
+        case Implementation::Avx512:
+            kernels = avx512Kernels;
+            break;
+        case Implementation::Avx2:
+            kernels = avx2Kernels;
+            break;
+#endif
+#if defined(AXIOM_BATCH_FLOAT4)
+        case Implementation::Float4:
+            kernels = float4Kernels;
+            break;
+#endif
+        default:
+            kernels = scalarKernels;
+            break;
+    }
+    current = implementation;
+    return (true);
+}
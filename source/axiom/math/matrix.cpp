@@ -0,0 +1,291 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/math/matrix.hpp>
+#include <axiom/math/vector3A.hpp>
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Matrix from ax::math
+///////////////////////////////////////////////////////////////////////////////
+using ax::math::Matrix;
+using ax::math::Vector3;
+using ax::math::Vector3A;
+namespace simd = ax::math::simd;
+
+///////////////////////////////////////////////////////////////////////////////
+const Matrix Matrix::identity;
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Matrix Matrix::getTransposed(void) const
+{
+    Matrix result;
+    for (int column = 0; column < 4; column++)
+    {
+        for (int row = 0; row < 4; row++)
+        {
+            result.m[column][row] = m[row][column];
+        }
+    }
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD float Matrix::getDeterminant(void) const
+{
+    // Expanded along the first column, with the 2x2 minors of the last two
+    // columns shared between the 3x3 ones
+    const float* a = m[0];
+    const float* b = m[1];
+    const float* c = m[2];
+    const float* d = m[3];
+    float s0 = c[0] * d[1] - c[1] * d[0];
+    float s1 = c[0] * d[2] - c[2] * d[0];
+    float s2 = c[0] * d[3] - c[3] * d[0];
+    float s3 = c[1] * d[2] - c[2] * d[1];
+    float s4 = c[1] * d[3] - c[3] * d[1];
+    float s5 = c[2] * d[3] - c[3] * d[2];
+
+    return (a[0] * (b[1] * s5 - b[2] * s4 + b[3] * s3)
+        - a[1] * (b[0] * s5 - b[2] * s2 + b[3] * s1)
+        + a[2] * (b[0] * s4 - b[1] * s2 + b[3] * s0)
+        - a[3] * (b[0] * s3 - b[1] * s1 + b[2] * s0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Matrix Matrix::getInverse(void) const
+{
+    // The 2x2 minors of the first two and of the last two columns give
+    // every cofactor with two multiplications each
+    const float* a = m[0];
+    const float* b = m[1];
+    const float* c = m[2];
+    const float* d = m[3];
+    float s0 = a[0] * b[1] - b[0] * a[1];
+    float s1 = a[0] * b[2] - b[0] * a[2];
+    float s2 = a[0] * b[3] - b[0] * a[3];
+    float s3 = a[1] * b[2] - b[1] * a[2];
+    float s4 = a[1] * b[3] - b[1] * a[3];
+    float s5 = a[2] * b[3] - b[2] * a[3];
+    float c5 = c[2] * d[3] - d[2] * c[3];
+    float c4 = c[1] * d[3] - d[1] * c[3];
+    float c3 = c[1] * d[2] - d[1] * c[2];
+    float c2 = c[0] * d[3] - d[0] * c[3];
+    float c1 = c[0] * d[2] - d[0] * c[2];
+    float c0 = c[0] * d[1] - d[0] * c[1];
+    float determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1
+        + s5 * c0;
+
+    if (determinant == 0.f)
+    {
+        return (Matrix());
+    }
+    float inv = 1.f / determinant;
+    Matrix result;
+    result.m[0][0] = (b[1] * c5 - b[2] * c4 + b[3] * c3) * inv;
+    result.m[0][1] = (-a[1] * c5 + a[2] * c4 - a[3] * c3) * inv;
+    result.m[0][2] = (d[1] * s5 - d[2] * s4 + d[3] * s3) * inv;
+    result.m[0][3] = (-c[1] * s5 + c[2] * s4 - c[3] * s3) * inv;
+    result.m[1][0] = (-b[0] * c5 + b[2] * c2 - b[3] * c1) * inv;
+    result.m[1][1] = (a[0] * c5 - a[2] * c2 + a[3] * c1) * inv;
+    result.m[1][2] = (-d[0] * s5 + d[2] * s2 - d[3] * s1) * inv;
+    result.m[1][3] = (c[0] * s5 - c[2] * s2 + c[3] * s1) * inv;
+    result.m[2][0] = (b[0] * c4 - b[1] * c2 + b[3] * c0) * inv;
+    result.m[2][1] = (-a[0] * c4 + a[1] * c2 - a[3] * c0) * inv;
+    result.m[2][2] = (d[0] * s4 - d[1] * s2 + d[3] * s0) * inv;
+    result.m[2][3] = (-c[0] * s4 + c[1] * s2 - c[3] * s0) * inv;
+    result.m[3][0] = (-b[0] * c3 + b[1] * c1 - b[2] * c0) * inv;
+    result.m[3][1] = (a[0] * c3 - a[1] * c1 + a[2] * c0) * inv;
+    result.m[3][2] = (-d[0] * s3 + d[1] * s1 - d[2] * s0) * inv;
+    result.m[3][3] = (c[0] * s3 - c[1] * s1 + c[2] * s0) * inv;
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Matrix Matrix::getInverseAffine(void) const
+{
+    // The rows of the inverse of [x y z] are the cross products of its
+    // columns over the determinant
+    simd::Float4 x = simd::multiply(columns[0], simd::set(1.f, 1.f, 1.f, 0.f));
+    simd::Float4 y = simd::multiply(columns[1], simd::set(1.f, 1.f, 1.f, 0.f));
+    simd::Float4 z = simd::multiply(columns[2], simd::set(1.f, 1.f, 1.f, 0.f));
+    simd::Float4 rows[3] = {simd::cross3(y, z), simd::cross3(z, x),
+        simd::cross3(x, y)};
+    simd::Float4 determinant = simd::dot3(x, rows[0]);
+
+    if (simd::getX(determinant) == 0.f)
+    {
+        return (Matrix());
+    }
+    alignas(16) float inverse[3][4];
+    for (int i = 0; i < 3; i++)
+    {
+        rows[i] = simd::divide(rows[i], determinant);
+        simd::store(inverse[i], rows[i]);
+    }
+    Matrix result;
+    for (int column = 0; column < 3; column++)
+    {
+        for (int row = 0; row < 3; row++)
+        {
+            result.m[column][row] = inverse[row][column];
+        }
+    }
+    for (int row = 0; row < 3; row++)
+    {
+        result.m[3][row] = -simd::getX(simd::dot3(rows[row], columns[3]));
+    }
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Matrix::transformPoints(const Vector3* points, Vector3* out,
+    Uint64 count) const
+{
+    static_assert(sizeof(Vector3) == 3 * sizeof(float),
+        "Vector3 arrays must be packed floats");
+    CHECK(count == 0 || (points && out));
+    // Four points at a time, one register per coordinate, each output
+    // coordinate being a row of the matrix dotted with them
+    const simd::Float4 m00 = simd::splat(m[0][0]);
+    const simd::Float4 m01 = simd::splat(m[1][0]);
+    const simd::Float4 m02 = simd::splat(m[2][0]);
+    const simd::Float4 m03 = simd::splat(m[3][0]);
+    const simd::Float4 m10 = simd::splat(m[0][1]);
+    const simd::Float4 m11 = simd::splat(m[1][1]);
+    const simd::Float4 m12 = simd::splat(m[2][1]);
+    const simd::Float4 m13 = simd::splat(m[3][1]);
+    const simd::Float4 m20 = simd::splat(m[0][2]);
+    const simd::Float4 m21 = simd::splat(m[1][2]);
+    const simd::Float4 m22 = simd::splat(m[2][2]);
+    const simd::Float4 m23 = simd::splat(m[3][2]);
+    Uint64 i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        simd::Float4 x, y, z;
+        simd::loadInterleaved3(points[i].xyz, x, y, z);
+        simd::storeInterleaved3(out[i].xyz,
+            simd::add(simd::add(simd::multiply(m00, x),
+                simd::multiply(m01, y)),
+                simd::add(simd::multiply(m02, z), m03)),
+            simd::add(simd::add(simd::multiply(m10, x),
+                simd::multiply(m11, y)),
+                simd::add(simd::multiply(m12, z), m13)),
+            simd::add(simd::add(simd::multiply(m20, x),
+                simd::multiply(m21, y)),
+                simd::add(simd::multiply(m22, z), m23)));
+    }
+    for (; i < count; i++)
+    {
+        out[i] = transformPoint(points[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Matrix Matrix::makeTranslation(const Vector3& translation)
+{
+    Matrix result;
+    result.columns[3] = simd::set(translation.x, translation.y,
+        translation.z, 1.f);
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Matrix Matrix::makeScale(const Vector3& scale)
+{
+    Matrix result;
+    result.m[0][0] = scale.x;
+    result.m[1][1] = scale.y;
+    result.m[2][2] = scale.z;
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Matrix Matrix::lookAt(const Vector3& eye,
+    const Vector3& target, const Vector3& up)
+{
+    Vector3A position(eye);
+    Vector3A forward = (Vector3A(target) - position).getSafeNormal();
+    Vector3A side = (forward ^ Vector3A(up)).getSafeNormal();
+    Vector3A top = side ^ forward;
+    Matrix result;
+
+    for (int column = 0; column < 3; column++)
+    {
+        result.m[column][0] = side[column];
+        result.m[column][1] = top[column];
+        result.m[column][2] = -forward[column];
+    }
+    result.m[3][0] = -(side | position);
+    result.m[3][1] = -(top | position);
+    result.m[3][2] = forward | position;
+    return (result);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Matrix Matrix::perspective(float fovY, float aspect,
+    float zNear, float zFar)
+{
+    CHECK(zNear != zFar && aspect != 0.f);
+    float focal = 1.f / std::tan(fovY * 0.5f);
+    float depth = 1.f / (zNear - zFar);
+
+    return (Matrix(simd::set(focal / aspect, 0.f, 0.f, 0.f),
+        simd::set(0.f, focal, 0.f, 0.f),
+        simd::set(0.f, 0.f, (zFar + zNear) * depth, -1.f),
+        simd::set(0.f, 0.f, 2.f * zFar * zNear * depth, 0.f)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Matrix Matrix::orthographic(float left, float right,
+    float bottom, float top, float zNear, float zFar)
+{
+    CHECK(left != right && bottom != top && zNear != zFar);
+    float width = 1.f / (right - left);
+    float height = 1.f / (top - bottom);
+    float depth = 1.f / (zFar - zNear);
+
+    return (Matrix(simd::set(2.f * width, 0.f, 0.f, 0.f),
+        simd::set(0.f, 2.f * height, 0.f, 0.f),
+        simd::set(0.f, 0.f, -2.f * depth, 0.f),
+        simd::set(-(right + left) * width, -(top + bottom) * height,
+            -(zFar + zNear) * depth, 1.f)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const Matrix& rhs)
+{
+    for (int row = 0; row < 4; row++)
+    {
+        lhs << (row ? "\n(" : "(") << rhs(row, 0) << ", " << rhs(row, 1)
+            << ", " << rhs(row, 2) << ", " << rhs(row, 3) << ')';
+    }
+    return (lhs);
+}
@@ -0,0 +1,341 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/math/quaternion.hpp>
+#include <axiom/math/matrix.hpp>
+#include <axiom/math/rotator.hpp>
+#include <axiom/math/utilities.hpp>
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Quaternion from ax::math
+///////////////////////////////////////////////////////////////////////////////
+using ax::math::Matrix;
+using ax::math::Quaternion;
+using ax::math::Rotator;
+using ax::math::Vector3;
+namespace simd = ax::math::simd;
+
+///////////////////////////////////////////////////////////////////////////////
+const Quaternion Quaternion::identity;
+
+///////////////////////////////////////////////////////////////////////////////
+Quaternion::Quaternion(const Vector3& axis, float angle)
+{
+    const float sine = std::sin(angle * 0.5f);
+
+    packed = simd::set(axis.x * sine, axis.y * sine, axis.z * sine,
+        std::cos(angle * 0.5f));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Quaternion::Quaternion(const Rotator& rotator)
+{
+    // The product yaw * pitch * roll of the rotations around Z, Y and X,
+    // expanded
+    const float halfPitch = ax::math::degreesToRadians(rotator.pitch) * 0.5f;
+    const float halfYaw = ax::math::degreesToRadians(rotator.yaw) * 0.5f;
+    const float halfRoll = ax::math::degreesToRadians(rotator.roll) * 0.5f;
+    const float sp = std::sin(halfPitch);
+    const float cp = std::cos(halfPitch);
+    const float sy = std::sin(halfYaw);
+    const float cy = std::cos(halfYaw);
+    const float sr = std::sin(halfRoll);
+    const float cr = std::cos(halfRoll);
+
+    packed = simd::set(cy * cp * sr - sy * sp * cr,
+        cy * sp * cr + sy * cp * sr, sy * cp * cr - cy * sp * sr,
+        cy * cp * cr + sy * sp * sr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Quaternion::Quaternion(const Matrix& matrix)
+{
+    // Start from the largest of w, x, y and z, so that the square root and
+    // the division stay away from zero
+    const float trace = matrix(0, 0) + matrix(1, 1) + matrix(2, 2);
+
+    if (trace > 0.f)
+    {
+        float s = 0.5f / std::sqrt(trace + 1.f);
+        packed = simd::set((matrix(2, 1) - matrix(1, 2)) * s,
+            (matrix(0, 2) - matrix(2, 0)) * s,
+            (matrix(1, 0) - matrix(0, 1)) * s, 0.25f / s);
+    }
+    else if (matrix(0, 0) > matrix(1, 1) && matrix(0, 0) > matrix(2, 2))
+    {
+        float s = 2.f * std::sqrt(1.f + matrix(0, 0) - matrix(1, 1)
+            - matrix(2, 2));
+        packed = simd::set(0.25f * s, (matrix(0, 1) + matrix(1, 0)) / s,
+            (matrix(0, 2) + matrix(2, 0)) / s,
+            (matrix(2, 1) - matrix(1, 2)) / s);
+    }
+    else if (matrix(1, 1) > matrix(2, 2))
+    {
+        float s = 2.f * std::sqrt(1.f + matrix(1, 1) - matrix(0, 0)
+            - matrix(2, 2));
+        packed = simd::set((matrix(0, 1) + matrix(1, 0)) / s, 0.25f * s,
+            (matrix(1, 2) + matrix(2, 1)) / s,
+            (matrix(0, 2) - matrix(2, 0)) / s);
+    }
+    else
+    {
+        float s = 2.f * std::sqrt(1.f + matrix(2, 2) - matrix(0, 0)
+            - matrix(1, 1));
+        packed = simd::set((matrix(0, 2) + matrix(2, 0)) / s,
+            (matrix(1, 2) + matrix(2, 1)) / s, 0.25f * s,
+            (matrix(1, 0) - matrix(0, 1)) / s);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD float Quaternion::size(void) const
+{
+    return (std::sqrt(squaredSize()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Quaternion Quaternion::getNormalized(float tolerance) const
+{
+    const simd::Float4 squared = simd::dot4(packed, packed);
+
+    if (simd::getX(squared) <= tolerance)
+    {
+        return (Quaternion());
+    }
+    return (Quaternion(simd::divide(packed, simd::sqrt(squared))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Quaternion Quaternion::getInverse(void) const
+{
+    const simd::Float4 squared = simd::dot4(packed, packed);
+
+    if (simd::getX(squared) == 0.f)
+    {
+        return (Quaternion());
+    }
+    return (Quaternion(simd::divide(getConjugate().packed, squared)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Quaternion::rotateVectors(const Vector3* vectors, Vector3* out,
+    Uint64 count) const
+{
+    static_assert(sizeof(Vector3) == 3 * sizeof(float),
+        "Vector3 arrays must be packed floats");
+    CHECK(count == 0 || (vectors && out));
+    // Same formula as rotateVector, on four vectors with one register per
+    // coordinate, the doubled vector part giving t without an addition
+    const simd::Float4 qx = simd::splat(x);
+    const simd::Float4 qy = simd::splat(y);
+    const simd::Float4 qz = simd::splat(z);
+    const simd::Float4 qw = simd::splat(w);
+    const simd::Float4 dx = simd::splat(x + x);
+    const simd::Float4 dy = simd::splat(y + y);
+    const simd::Float4 dz = simd::splat(z + z);
+    Uint64 i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        simd::Float4 vx, vy, vz;
+        simd::loadInterleaved3(vectors[i].xyz, vx, vy, vz);
+        simd::Float4 tx = simd::subtract(simd::multiply(dy, vz),
+            simd::multiply(dz, vy));
+        simd::Float4 ty = simd::subtract(simd::multiply(dz, vx),
+            simd::multiply(dx, vz));
+        simd::Float4 tz = simd::subtract(simd::multiply(dx, vy),
+            simd::multiply(dy, vx));
+        simd::storeInterleaved3(out[i].xyz,
+            simd::add(simd::add(vx, simd::multiply(qw, tx)),
+                simd::subtract(simd::multiply(qy, tz),
+                    simd::multiply(qz, ty))),
+            simd::add(simd::add(vy, simd::multiply(qw, ty)),
+                simd::subtract(simd::multiply(qz, tx),
+                    simd::multiply(qx, tz))),
+            simd::add(simd::add(vz, simd::multiply(qw, tz)),
+                simd::subtract(simd::multiply(qx, ty),
+                    simd::multiply(qy, tx))));
+    }
+    for (; i < count; i++)
+    {
+        out[i] = rotateVector(vectors[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Rotator Quaternion::getRotator(void) const
+{
+    // Sine of the pitch over two, whose cosine vanishes at the poles where
+    // the yaw and the roll turn around the same axis
+    const float singularity = w * y - z * x;
+    const float threshold = 0.4999995f;
+
+    if (singularity > threshold || singularity < -threshold)
+    {
+        return (Rotator(singularity > 0.f ? 90.f : -90.f,
+            ax::math::radiansToDegrees(ax::math::unwindRadians(
+                2.f * std::atan2(z, w))), 0.f));
+    }
+    return (Rotator(ax::math::radiansToDegrees(std::asin(2.f * singularity)),
+        ax::math::radiansToDegrees(std::atan2(2.f * (w * z + x * y),
+            1.f - 2.f * (y * y + z * z))),
+        ax::math::radiansToDegrees(std::atan2(2.f * (w * x + y * z),
+            1.f - 2.f * (x * x + y * y)))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Matrix Quaternion::getMatrix(void) const
+{
+    const float x2 = x + x;
+    const float y2 = y + y;
+    const float z2 = z + z;
+    const float xx = x * x2;
+    const float xy = x * y2;
+    const float xz = x * z2;
+    const float yy = y * y2;
+    const float yz = y * z2;
+    const float zz = z * z2;
+    const float wx = w * x2;
+    const float wy = w * y2;
+    const float wz = w * z2;
+
+    return (Matrix(simd::set(1.f - (yy + zz), xy + wz, xz - wy, 0.f),
+        simd::set(xy - wz, 1.f - (xx + zz), yz + wx, 0.f),
+        simd::set(xz + wy, yz - wx, 1.f - (xx + yy), 0.f),
+        simd::set(0.f, 0.f, 0.f, 1.f)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Quaternion Quaternion::nlerp(const Quaternion& from,
+    const Quaternion& to, float alpha)
+{
+    // q and -q are the same rotation: negating the weight of `to` when the
+    // dot product is negative takes the shortest way
+    const simd::Float4 dot = simd::dot4(from.packed, to.packed);
+    const simd::Float4 weight = simd::select(simd::greater(simd::zero(), dot),
+        simd::splat(-alpha), simd::splat(alpha));
+    const simd::Float4 result = simd::add(
+        simd::multiply(from.packed, simd::splat(1.f - alpha)),
+        simd::multiply(to.packed, weight));
+
+    return (Quaternion(simd::divide(result,
+        simd::sqrt(simd::dot4(result, result)))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Quaternion Quaternion::slerp(const Quaternion& from,
+    const Quaternion& to, float alpha)
+{
+    float cosine = simd::getX(simd::dot4(from.packed, to.packed));
+    float sign = 1.f;
+
+    if (cosine < 0.f)
+    {
+        cosine = -cosine;
+        sign = -1.f;
+    }
+    if (cosine > 1.f - KINDA_SMALL_NUMBER)
+    {
+        return (nlerp(from, to, alpha));
+    }
+    const float angle = std::acos(cosine);
+    const float inverseSine = 1.f / std::sin(angle);
+
+    return (Quaternion(simd::add(
+        simd::multiply(from.packed,
+            simd::splat(std::sin((1.f - alpha) * angle) * inverseSine)),
+        simd::multiply(to.packed,
+            simd::splat(std::sin(alpha * angle) * inverseSine * sign)))));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Quaternion::blend(const Quaternion* from, const Quaternion* to,
+    Quaternion* out, Uint64 count, float alpha)
+{
+    CHECK(count == 0 || (from && to && out));
+    // nlerp on four pairs at a time: once transposed, the dot products and
+    // sizes are plain multiplications and additions, with no shuffle
+    const simd::Float4 fromWeight = simd::splat(1.f - alpha);
+    const simd::Float4 toWeight = simd::splat(alpha);
+    const simd::Float4 flippedWeight = simd::splat(-alpha);
+    const simd::Float4 one = simd::splat(1.f);
+    Uint64 i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        simd::Float4 fx = from[i].packed;
+        simd::Float4 fy = from[i + 1].packed;
+        simd::Float4 fz = from[i + 2].packed;
+        simd::Float4 fw = from[i + 3].packed;
+        simd::Float4 tx = to[i].packed;
+        simd::Float4 ty = to[i + 1].packed;
+        simd::Float4 tz = to[i + 2].packed;
+        simd::Float4 tw = to[i + 3].packed;
+        simd::transpose(fx, fy, fz, fw);
+        simd::transpose(tx, ty, tz, tw);
+        simd::Float4 dot = simd::add(
+            simd::add(simd::multiply(fx, tx), simd::multiply(fy, ty)),
+            simd::add(simd::multiply(fz, tz), simd::multiply(fw, tw)));
+        simd::Float4 weight = simd::select(
+            simd::greater(simd::zero(), dot), flippedWeight, toWeight);
+        simd::Float4 rx = simd::add(simd::multiply(fx, fromWeight),
+            simd::multiply(tx, weight));
+        simd::Float4 ry = simd::add(simd::multiply(fy, fromWeight),
+            simd::multiply(ty, weight));
+        simd::Float4 rz = simd::add(simd::multiply(fz, fromWeight),
+            simd::multiply(tz, weight));
+        simd::Float4 rw = simd::add(simd::multiply(fw, fromWeight),
+            simd::multiply(tw, weight));
+        simd::Float4 scale = simd::divide(one, simd::sqrt(simd::add(
+            simd::add(simd::multiply(rx, rx), simd::multiply(ry, ry)),
+            simd::add(simd::multiply(rz, rz), simd::multiply(rw, rw)))));
+        rx = simd::multiply(rx, scale);
+        ry = simd::multiply(ry, scale);
+        rz = simd::multiply(rz, scale);
+        rw = simd::multiply(rw, scale);
+        simd::transpose(rx, ry, rz, rw);
+        out[i].packed = rx;
+        out[i + 1].packed = ry;
+        out[i + 2].packed = rz;
+        out[i + 3].packed = rw;
+    }
+    for (; i < count; i++)
+    {
+        out[i] = nlerp(from[i], to[i], alpha);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const Quaternion& rhs)
+{
+    lhs << '(' << rhs.x << ", " << rhs.y << ", " << rhs.z << ", " << rhs.w
+        << ')';
+    return (lhs);
+}
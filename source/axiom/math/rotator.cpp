@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/math/rotator.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Rotator from ax::math
+///////////////////////////////////////////////////////////////////////////////
+using ax::math::Rotator;
+
+///////////////////////////////////////////////////////////////////////////////
+const Rotator Rotator::zeroRotator(0.f, 0.f, 0.f);
+
+///////////////////////////////////////////////////////////////////////////////
+Rotator::Rotator(void) : pitch(0.f), yaw(0.f), roll(0.f) {}
+
+///////////////////////////////////////////////////////////////////////////////
+Rotator::Rotator(float f) : pitch(f), yaw(f), roll(f) {}
+
+///////////////////////////////////////////////////////////////////////////////
+Rotator::Rotator(float pitch, float yaw, float roll)
+    : pitch(pitch), yaw(yaw), roll(roll)
+{}
@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/math/transform.hpp>
+#include <cmath>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Transform from ax::math
+///////////////////////////////////////////////////////////////////////////////
+using ax::math::Matrix;
+using ax::math::Quaternion;
+using ax::math::Transform;
+using ax::math::Vector3;
+namespace simd = ax::math::simd;
+
+///////////////////////////////////////////////////////////////////////////////
+// Private helpers
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// The inverse of each component, zero for those too small to divide by
+Vector3 getSafeReciprocal(const Vector3& scale)
+{
+    return (Vector3(std::fabs(scale.x) <= SMALL_NUMBER ? 0.f : 1.f / scale.x,
+        std::fabs(scale.y) <= SMALL_NUMBER ? 0.f : 1.f / scale.y,
+        std::fabs(scale.z) <= SMALL_NUMBER ? 0.f : 1.f / scale.z));
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+const Transform Transform::identity;
+
+///////////////////////////////////////////////////////////////////////////////
+Transform::Transform(void)
+    : rotation(), translation(0.f), scale(1.f)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Transform::Transform(const Vector3& translation, const Quaternion& rotation,
+    const Vector3& scale)
+    : rotation(rotation), translation(translation), scale(scale)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Matrix Transform::getMatrix(void) const
+{
+    // The columns of the rotation scaled one by one, then the translation
+    const Matrix rotationMatrix = rotation.getMatrix();
+
+    return (Matrix(
+        simd::multiply(rotationMatrix.columns[0], simd::splat(scale.x)),
+        simd::multiply(rotationMatrix.columns[1], simd::splat(scale.y)),
+        simd::multiply(rotationMatrix.columns[2], simd::splat(scale.z)),
+        simd::set(translation.x, translation.y, translation.z, 1.f)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Transform Transform::getInverse(void) const
+{
+    const Quaternion inverseRotation = rotation.getConjugate();
+    const Vector3 inverseScale = getSafeReciprocal(scale);
+
+    return (Transform(inverseRotation.rotateVector(-translation)
+        * inverseScale, inverseRotation, inverseScale));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Vector3 Transform::transformPoint(const Vector3& point) const
+{
+    return (rotation.rotateVector(point * scale) + translation);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Vector3 Transform::transformVector(const Vector3& vector)
+    const
+{
+    return (rotation.rotateVector(vector * scale));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Vector3 Transform::inverseTransformPoint(const Vector3& point)
+    const
+{
+    return (rotation.unrotateVector(point - translation)
+        * getSafeReciprocal(scale));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Transform operator*(const Transform& lhs,
+    const Transform& rhs)
+{
+    return (Transform(lhs.transformPoint(rhs.translation),
+        lhs.rotation * rhs.rotation, lhs.scale * rhs.scale));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Transform& operator*=(Transform& lhs, const Transform& rhs)
+{
+    lhs = lhs * rhs;
+    return (lhs);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const Transform& rhs)
+{
+    lhs << "{translation: " << rhs.translation << ", rotation: "
+        << rhs.rotation << ", scale: " << rhs.scale << '}';
+    return (lhs);
+}
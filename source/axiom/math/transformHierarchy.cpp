@@ -0,0 +1,177 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/math/transformHierarchy.hpp>
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward TransformHierarchy from ax::math
+///////////////////////////////////////////////////////////////////////////////
+using ax::math::Matrix;
+using ax::math::Transform;
+using ax::math::TransformHierarchy;
+
+///////////////////////////////////////////////////////////////////////////////
+TransformHierarchy::TransformHierarchy(memory::Allocator& allocator)
+    : m_locals(allocator), m_worlds(allocator), m_parents(allocator),
+      m_dirty(allocator)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 TransformHierarchy::size(void) const
+{
+    return (m_locals.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool TransformHierarchy::isEmpty(void) const
+{
+    return (m_locals.isEmpty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool TransformHierarchy::isDirty(void) const
+{
+    return (m_firstDirty < m_locals.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TransformHierarchy::reserve(Uint64 capacity)
+{
+    m_locals.reserve(capacity);
+    m_worlds.reserve(capacity);
+    m_parents.reserve(capacity);
+    m_dirty.reserve(capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TransformHierarchy::clear(void)
+{
+    m_locals.clear();
+    m_worlds.clear();
+    m_parents.clear();
+    m_dirty.clear();
+    m_firstDirty = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint32 TransformHierarchy::add(const Transform& local, Uint32 parent)
+{
+    const Uint64 index = m_locals.size();
+
+    CHECK(index < noParent);
+    CHECK(parent == noParent || parent < index);
+    m_locals.pushBack(local);
+    m_worlds.pushBack(Matrix());
+    m_parents.pushBack(parent);
+    m_dirty.pushBack(1);
+    if (index < m_firstDirty)
+    {
+        m_firstDirty = index;
+    }
+    return (static_cast<Uint32>(index));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint32 TransformHierarchy::getParent(Uint32 index) const
+{
+    CHECK(index < m_parents.size());
+    return (m_parents[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const Transform& TransformHierarchy::getLocal(Uint32 index)
+    const
+{
+    CHECK(index < m_locals.size());
+    return (m_locals[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TransformHierarchy::setLocal(Uint32 index, const Transform& local)
+{
+    CHECK(index < m_locals.size());
+    m_locals[index] = local;
+    m_dirty[index] = 1;
+    if (index < m_firstDirty)
+    {
+        m_firstDirty = index;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const Matrix& TransformHierarchy::getWorld(Uint32 index) const
+{
+    CHECK(index < m_worlds.size());
+    return (m_worlds[index]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const Matrix* TransformHierarchy::getWorldMatrices(void) const
+{
+    return (m_worlds.data());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TransformHierarchy::update(void)
+{
+    const Uint64 count = m_locals.size();
+
+    if (m_firstDirty >= count)
+    {
+        return;
+    }
+    // Nothing before the first flagged node can change. After it, the flag
+    // of a parent is read before the flags are cleared, so it also means
+    // "world changed" and carries down the subtree in the same pass
+    const Transform* locals = m_locals.data();
+    const Uint32* parents = m_parents.data();
+    Matrix* worlds = m_worlds.data();
+    Uint8* dirty = m_dirty.data();
+
+    for (Uint64 i = m_firstDirty; i < count; i++)
+    {
+        const Uint32 parent = parents[i];
+
+        if (parent == noParent)
+        {
+            if (dirty[i])
+            {
+                worlds[i] = locals[i].getMatrix();
+            }
+        }
+        else if (dirty[i] | dirty[parent])
+        {
+            dirty[i] = 1;
+            worlds[i] = worlds[parent] * locals[i].getMatrix();
+        }
+    }
+    std::memset(dirty + m_firstDirty, 0, count - m_firstDirty);
+    m_firstDirty = count;
+}
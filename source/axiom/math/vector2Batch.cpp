@@ -0,0 +1,330 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/math/vector2Batch.hpp>
+#include <axiom/math/batch.hpp>
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Vector2Batch from ax::math
+///////////////////////////////////////////////////////////////////////////////
+using ax::math::Vector2Batch;
+using ax::math::Vector2;
+using ax::math::Batch;
+
+///////////////////////////////////////////////////////////////////////////////
+// Alignment of each component array
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr Uint64 alignment = 64;
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+Vector2Batch::Vector2Batch(memory::Allocator& allocator)
+    : m_allocator(&allocator)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Vector2Batch::Vector2Batch(Uint64 size)
+{
+    resize(size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vector2Batch::Vector2Batch(const Vector2Batch& other)
+{
+    *this = other;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vector2Batch::Vector2Batch(Vector2Batch&& other) noexcept
+    : m_data(other.m_data)
+    , m_size(other.m_size)
+    , m_capacity(other.m_capacity)
+    , m_allocator(other.m_allocator)
+{
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_capacity = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vector2Batch::~Vector2Batch(void)
+{
+    _deallocate();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vector2Batch& Vector2Batch::operator=(const Vector2Batch& other)
+{
+    if (this == &other)
+    {
+        return (*this);
+    }
+    m_size = 0;
+    if (other.m_size)
+    {
+        reserve(other.m_size);
+        std::memcpy(getX(), other.getX(), other.m_size * sizeof(float));
+        std::memcpy(getY(), other.getY(), other.m_size * sizeof(float));
+        m_size = other.m_size;
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vector2Batch& Vector2Batch::operator=(Vector2Batch&& other)
+{
+    if (this == &other)
+    {
+        return (*this);
+    }
+    if (m_allocator != other.m_allocator
+        && &getAllocator() != &other.getAllocator())
+    {
+        return (*this = other);
+    }
+    _deallocate();
+    m_data = other.m_data;
+    m_size = other.m_size;
+    m_capacity = other.m_capacity;
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_capacity = 0;
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 Vector2Batch::size(void) const
+{
+    return (m_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 Vector2Batch::capacity(void) const
+{
+    return (m_capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool Vector2Batch::isEmpty(void) const
+{
+    return (m_size == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD ax::memory::Allocator& Vector2Batch::getAllocator(void) const
+{
+    return (m_allocator ? *m_allocator : memory::Allocator::getDefault());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::reserve(Uint64 capacity)
+{
+    if (capacity > m_capacity)
+    {
+        _reallocate((capacity + granularity - 1) / granularity * granularity);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::resize(Uint64 size)
+{
+    if (size > m_size)
+    {
+        if (size > m_capacity)
+        {
+            Uint64 grown = m_capacity * 2;
+            reserve(grown > size ? grown : size);
+        }
+        Uint64 added = (size - m_size) * sizeof(float);
+        std::memset(getX() + m_size, 0, added);
+        std::memset(getY() + m_size, 0, added);
+    }
+    m_size = size;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::clear(void)
+{
+    m_size = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::pushBack(const Vector2& vector)
+{
+    if (m_size == m_capacity)
+    {
+        reserve(m_capacity ? m_capacity * 2 : granularity);
+    }
+    getX()[m_size] = vector.x;
+    getY()[m_size] = vector.y;
+    m_size++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::set(Uint64 index, const Vector2& vector)
+{
+    CHECK(index < m_size);
+    getX()[index] = vector.x;
+    getY()[index] = vector.y;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Vector2 Vector2Batch::get(Uint64 index) const
+{
+    CHECK(index < m_size);
+    return (Vector2(getX()[index], getY()[index]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD float* Vector2Batch::getX(void)
+{
+    return (m_data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const float* Vector2Batch::getX(void) const
+{
+    return (m_data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD float* Vector2Batch::getY(void)
+{
+    return (m_data + m_capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const float* Vector2Batch::getY(void) const
+{
+    return (m_data + m_capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::add(const Vector2& offset)
+{
+    Batch::scaleOffset(getX(), m_size, 1.f, offset.x);
+    Batch::scaleOffset(getY(), m_size, 1.f, offset.y);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::scale(float factor)
+{
+    Batch::scaleOffset(getX(), m_size, factor, 0.f);
+    Batch::scaleOffset(getY(), m_size, factor, 0.f);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::multiplyAdd(const Vector2Batch& other, float factor)
+{
+    CHECK(m_size == other.m_size);
+    Batch::multiplyAdd(getX(), other.getX(), m_size, factor);
+    Batch::multiplyAdd(getY(), other.getY(), m_size, factor);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::transform(const Vector2& xAxis, const Vector2& yAxis,
+    const Vector2& translation)
+{
+    const float matrix[6] = {
+        xAxis.x, yAxis.x, translation.x,
+        xAxis.y, yAxis.y, translation.y
+    };
+    float* components[2] = {getX(), getY()};
+    Batch::transform(components, 2, m_size, matrix);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::normalize(float tolerance)
+{
+    float* components[2] = {getX(), getY()};
+    Batch::normalize(components, 2, m_size, tolerance);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::getLengths(float* out) const
+{
+    const float* components[2] = {getX(), getY()};
+    Batch::length(components, 2, m_size, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::getDots(const Vector2Batch& other, float* out) const
+{
+    CHECK(m_size == other.m_size);
+    const float* lhs[2] = {getX(), getY()};
+    const float* rhs[2] = {other.getX(), other.getY()};
+    Batch::dot(lhs, rhs, 2, m_size, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::getDistances(const Vector2& point, float* out) const
+{
+    const float* components[2] = {getX(), getY()};
+    Batch::distance(components, 2, m_size, point.xy, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::getBounds(Vector2& min, Vector2& max) const
+{
+    CHECK(m_size > 0);
+    Batch::bounds(getX(), m_size, min.x, max.x);
+    Batch::bounds(getY(), m_size, min.y, max.y);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::_reallocate(Uint64 capacity)
+{
+    memory::Allocator& allocator = getAllocator();
+    float* data = static_cast<float*>(
+        allocator.allocate(capacity * 2 * sizeof(float), alignment));
+    for (Uint64 c = 0; m_data && c < 2; c++)
+    {
+        std::memcpy(data + capacity * c, m_data + m_capacity * c,
+            m_size * sizeof(float));
+    }
+    _deallocate();
+    m_data = data;
+    m_capacity = capacity;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector2Batch::_deallocate(void)
+{
+    if (m_data)
+    {
+        getAllocator().deallocate(m_data, m_capacity * 2 * sizeof(float),
+            alignment);
+    }
+}
@@ -0,0 +1,351 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/math/vector3Batch.hpp>
+#include <axiom/math/batch.hpp>
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Vector3Batch from ax::math
+///////////////////////////////////////////////////////////////////////////////
+using ax::math::Vector3Batch;
+using ax::math::Vector3;
+using ax::math::Batch;
+
+///////////////////////////////////////////////////////////////////////////////
+// Alignment of each component array
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr Uint64 alignment = 64;
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+Vector3Batch::Vector3Batch(memory::Allocator& allocator)
+    : m_allocator(&allocator)
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+Vector3Batch::Vector3Batch(Uint64 size)
+{
+    resize(size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vector3Batch::Vector3Batch(const Vector3Batch& other)
+{
+    *this = other;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vector3Batch::Vector3Batch(Vector3Batch&& other) noexcept
+    : m_data(other.m_data)
+    , m_size(other.m_size)
+    , m_capacity(other.m_capacity)
+    , m_allocator(other.m_allocator)
+{
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_capacity = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vector3Batch::~Vector3Batch(void)
+{
+    _deallocate();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vector3Batch& Vector3Batch::operator=(const Vector3Batch& other)
+{
+    if (this == &other)
+    {
+        return (*this);
+    }
+    m_size = 0;
+    if (other.m_size)
+    {
+        reserve(other.m_size);
+        std::memcpy(getX(), other.getX(), other.m_size * sizeof(float));
+        std::memcpy(getY(), other.getY(), other.m_size * sizeof(float));
+        std::memcpy(getZ(), other.getZ(), other.m_size * sizeof(float));
+        m_size = other.m_size;
+    }
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Vector3Batch& Vector3Batch::operator=(Vector3Batch&& other)
+{
+    if (this == &other)
+    {
+        return (*this);
+    }
+    if (m_allocator != other.m_allocator
+        && &getAllocator() != &other.getAllocator())
+    {
+        return (*this = other);
+    }
+    _deallocate();
+    m_data = other.m_data;
+    m_size = other.m_size;
+    m_capacity = other.m_capacity;
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_capacity = 0;
+    return (*this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 Vector3Batch::size(void) const
+{
+    return (m_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Uint64 Vector3Batch::capacity(void) const
+{
+    return (m_capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD bool Vector3Batch::isEmpty(void) const
+{
+    return (m_size == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD ax::memory::Allocator& Vector3Batch::getAllocator(void) const
+{
+    return (m_allocator ? *m_allocator : memory::Allocator::getDefault());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::reserve(Uint64 capacity)
+{
+    if (capacity > m_capacity)
+    {
+        _reallocate((capacity + granularity - 1) / granularity * granularity);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::resize(Uint64 size)
+{
+    if (size > m_size)
+    {
+        if (size > m_capacity)
+        {
+            Uint64 grown = m_capacity * 2;
+            reserve(grown > size ? grown : size);
+        }
+        Uint64 added = (size - m_size) * sizeof(float);
+        std::memset(getX() + m_size, 0, added);
+        std::memset(getY() + m_size, 0, added);
+        std::memset(getZ() + m_size, 0, added);
+    }
+    m_size = size;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::clear(void)
+{
+    m_size = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::pushBack(const Vector3& vector)
+{
+    if (m_size == m_capacity)
+    {
+        reserve(m_capacity ? m_capacity * 2 : granularity);
+    }
+    getX()[m_size] = vector.x;
+    getY()[m_size] = vector.y;
+    getZ()[m_size] = vector.z;
+    m_size++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::set(Uint64 index, const Vector3& vector)
+{
+    CHECK(index < m_size);
+    getX()[index] = vector.x;
+    getY()[index] = vector.y;
+    getZ()[index] = vector.z;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD Vector3 Vector3Batch::get(Uint64 index) const
+{
+    CHECK(index < m_size);
+    return (Vector3(getX()[index], getY()[index], getZ()[index]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD float* Vector3Batch::getX(void)
+{
+    return (m_data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const float* Vector3Batch::getX(void) const
+{
+    return (m_data);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD float* Vector3Batch::getY(void)
+{
+    return (m_data + m_capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const float* Vector3Batch::getY(void) const
+{
+    return (m_data + m_capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD float* Vector3Batch::getZ(void)
+{
+    return (m_data + m_capacity * 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AXIOM_NODISCARD const float* Vector3Batch::getZ(void) const
+{
+    return (m_data + m_capacity * 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::add(const Vector3& offset)
+{
+    Batch::scaleOffset(getX(), m_size, 1.f, offset.x);
+    Batch::scaleOffset(getY(), m_size, 1.f, offset.y);
+    Batch::scaleOffset(getZ(), m_size, 1.f, offset.z);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::scale(float factor)
+{
+    Batch::scaleOffset(getX(), m_size, factor, 0.f);
+    Batch::scaleOffset(getY(), m_size, factor, 0.f);
+    Batch::scaleOffset(getZ(), m_size, factor, 0.f);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::multiplyAdd(const Vector3Batch& other, float factor)
+{
+    CHECK(m_size == other.m_size);
+    Batch::multiplyAdd(getX(), other.getX(), m_size, factor);
+    Batch::multiplyAdd(getY(), other.getY(), m_size, factor);
+    Batch::multiplyAdd(getZ(), other.getZ(), m_size, factor);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::transform(const Vector3& xAxis, const Vector3& yAxis,
+    const Vector3& zAxis, const Vector3& translation)
+{
+    const float matrix[12] = {
+        xAxis.x, yAxis.x, zAxis.x, translation.x,
+        xAxis.y, yAxis.y, zAxis.y, translation.y,
+        xAxis.z, yAxis.z, zAxis.z, translation.z
+    };
+    float* components[3] = {getX(), getY(), getZ()};
+    Batch::transform(components, 3, m_size, matrix);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::normalize(float tolerance)
+{
+    float* components[3] = {getX(), getY(), getZ()};
+    Batch::normalize(components, 3, m_size, tolerance);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::getLengths(float* out) const
+{
+    const float* components[3] = {getX(), getY(), getZ()};
+    Batch::length(components, 3, m_size, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::getDots(const Vector3Batch& other, float* out) const
+{
+    CHECK(m_size == other.m_size);
+    const float* lhs[3] = {getX(), getY(), getZ()};
+    const float* rhs[3] = {other.getX(), other.getY(), other.getZ()};
+    Batch::dot(lhs, rhs, 3, m_size, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::getDistances(const Vector3& point, float* out) const
+{
+    const float* components[3] = {getX(), getY(), getZ()};
+    Batch::distance(components, 3, m_size, point.xyz, out);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::getBounds(Vector3& min, Vector3& max) const
+{
+    CHECK(m_size > 0);
+    Batch::bounds(getX(), m_size, min.x, max.x);
+    Batch::bounds(getY(), m_size, min.y, max.y);
+    Batch::bounds(getZ(), m_size, min.z, max.z);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::_reallocate(Uint64 capacity)
+{
+    memory::Allocator& allocator = getAllocator();
+    float* data = static_cast<float*>(
+        allocator.allocate(capacity * 3 * sizeof(float), alignment));
+    for (Uint64 c = 0; m_data && c < 3; c++)
+    {
+        std::memcpy(data + capacity * c, m_data + m_capacity * c,
+            m_size * sizeof(float));
+    }
+    _deallocate();
+    m_data = data;
+    m_capacity = capacity;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Vector3Batch::_deallocate(void)
+{
+    if (m_data)
+    {
+        getAllocator().deallocate(m_data, m_capacity * 3 * sizeof(float),
+            alignment);
+    }
+}
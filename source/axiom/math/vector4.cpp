@@ -0,0 +1,58 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/math/vector4.hpp>
+#include <axiom/math/vector3.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Vector3 and Vector4 from ax::math
+///////////////////////////////////////////////////////////////////////////////
+using ax::math::Vector3;
+using ax::math::Vector4;
+
+///////////////////////////////////////////////////////////////////////////////
+const Vector4 Vector4::zeroVector(0.f, 0.f, 0.f, 0.f);
+const Vector4 Vector4::oneVector(1.f, 1.f, 1.f, 1.f);
+const Vector4 Vector4::xAxisVector(1.f, 0.f, 0.f, 0.f);
+const Vector4 Vector4::yAxisVector(0.f, 1.f, 0.f, 0.f);
+const Vector4 Vector4::zAxisVector(0.f, 0.f, 1.f, 0.f);
+const Vector4 Vector4::wAxisVector(0.f, 0.f, 0.f, 1.f);
+
+///////////////////////////////////////////////////////////////////////////////
+Vector4::Vector4(const Vector3& vector, float w)
+    : packed(ax::math::simd::set(vector.x, vector.y, vector.z, w))
+{}
+
+///////////////////////////////////////////////////////////////////////////////
+std::ostream& operator<<(std::ostream& lhs, const Vector4& rhs)
+{
+    lhs << '(' << rhs.x << ", " << rhs.y << ", " << rhs.z << ", " << rhs.w
+        << ')';
+    return (lhs);
+}
@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/memory/allocator.hpp>
+#include <axiom/memory/systemAllocator.hpp>
+#include <new>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Allocator and SystemAllocator from ax::memory
+///////////////////////////////////////////////////////////////////////////////
+using ax::memory::Allocator;
+using ax::memory::SystemAllocator;
+
+///////////////////////////////////////////////////////////////////////////////
+Allocator::Allocator(void) {}
+
+///////////////////////////////////////////////////////////////////////////////
+Allocator::~Allocator(void) {}
+
+///////////////////////////////////////////////////////////////////////////////
+Allocator& Allocator::getDefault(void)
+{
+    // Built in place and never destroyed: statics of other translation
+    // units may still free through it while the program exits
+    alignas(SystemAllocator) static unsigned char storage[
+        sizeof(SystemAllocator)];
+    static SystemAllocator* allocator = new (storage) SystemAllocator();
+    return (*allocator);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* Allocator::allocate(Uint64 size, Uint64 alignment)
+{
+    CHECK(alignment != 0 && (alignment & (alignment - 1)) == 0);
+    void* pointer = _allocate(size, alignment);
+
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+    m_bytesAllocated.fetch_add(size, std::memory_order_relaxed);
+    Uint64 inUse = m_bytesInUse.fetch_add(size, std::memory_order_relaxed)
+        + size;
+    Uint64 peak = m_peakBytesInUse.load(std::memory_order_relaxed);
+    while (inUse > peak && !m_peakBytesInUse.compare_exchange_weak(peak,
+        inUse, std::memory_order_relaxed))
+    {}
+    return (pointer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Allocator::deallocate(void* pointer, Uint64 size, Uint64 alignment)
+{
+    if (!pointer)
+    {
+        return;
+    }
+    _deallocate(pointer, size, alignment);
+    m_deallocations.fetch_add(1, std::memory_order_relaxed);
+    m_bytesInUse.fetch_sub(size, std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Allocator::Stats Allocator::getStats(void) const
+{
+    Stats stats;
+    stats.allocations = m_allocations.load(std::memory_order_relaxed);
+    stats.deallocations = m_deallocations.load(std::memory_order_relaxed);
+    stats.bytesAllocated = m_bytesAllocated.load(std::memory_order_relaxed);
+    stats.bytesInUse = m_bytesInUse.load(std::memory_order_relaxed);
+    stats.peakBytesInUse = m_peakBytesInUse.load(std::memory_order_relaxed);
+    return (stats);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Allocator::resetStats(void)
+{
+    m_allocations.store(0, std::memory_order_relaxed);
+    m_deallocations.store(0, std::memory_order_relaxed);
+    m_bytesAllocated.store(0, std::memory_order_relaxed);
+    m_peakBytesInUse.store(m_bytesInUse.load(std::memory_order_relaxed),
+        std::memory_order_relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Allocator::_releaseAll(void)
+{
+    m_bytesInUse.store(0, std::memory_order_relaxed);
+}
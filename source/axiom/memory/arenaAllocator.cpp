@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/memory/arenaAllocator.hpp>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Allocator and ArenaAllocator from ax::memory
+///////////////////////////////////////////////////////////////////////////////
+using ax::memory::Allocator;
+using ax::memory::ArenaAllocator;
+
+///////////////////////////////////////////////////////////////////////////////
+ArenaAllocator::ArenaAllocator(Uint64 chunkSize, Allocator& upstream)
+    : m_upstream(&upstream)
+    , m_chunkSize(chunkSize)
+{
+    CHECK(chunkSize != 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ArenaAllocator::~ArenaAllocator(void)
+{
+    release();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ArenaAllocator::reset(void)
+{
+    m_chunk = nullptr;
+    m_cursor = nullptr;
+    m_end = nullptr;
+    if (m_head)
+    {
+        _enter(m_head);
+    }
+    _releaseAll();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ArenaAllocator::release(void)
+{
+    while (m_head)
+    {
+        Chunk* next = m_head->next;
+        m_upstream->deallocate(m_head, sizeof(Chunk) + m_head->size);
+        m_head = next;
+    }
+    m_chunk = nullptr;
+    m_cursor = nullptr;
+    m_end = nullptr;
+    _releaseAll();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 ArenaAllocator::getCapacity(void) const
+{
+    Uint64 capacity = 0;
+
+    for (const Chunk* chunk = m_head; chunk; chunk = chunk->next)
+    {
+        capacity += chunk->size;
+    }
+    return (capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* ArenaAllocator::_allocate(Uint64 size, Uint64 alignment)
+{
+    const Uint64 padding = (0 - reinterpret_cast<std::uintptr_t>(m_cursor))
+        & (alignment - 1);
+
+    if (m_chunk && padding + size <= Uint64(m_end - m_cursor))
+    {
+        void* pointer = m_cursor + padding;
+        m_cursor += padding + size;
+        return (pointer);
+    }
+    return (_allocateSlow(size, alignment));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ArenaAllocator::_deallocate(void* pointer, Uint64 size,
+    Uint64 alignment)
+{
+    (void)alignment;
+    if (static_cast<char*>(pointer) + size == m_cursor)
+    {
+        m_cursor = static_cast<char*>(pointer);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ArenaAllocator::_enter(Chunk* chunk)
+{
+    m_chunk = chunk;
+    m_cursor = reinterpret_cast<char*>(chunk + 1);
+    m_end = m_cursor + chunk->size;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* ArenaAllocator::_allocateSlow(Uint64 size, Uint64 alignment)
+{
+    const Uint64 worstCase = size + alignment;
+
+    while (m_chunk && m_chunk->next)
+    {
+        _enter(m_chunk->next);
+        if (m_chunk->size >= worstCase)
+        {
+            return (_allocate(size, alignment));
+        }
+    }
+
+    Uint64 chunkSize = m_chunkSize;
+    while (chunkSize < worstCase)
+    {
+        chunkSize *= 2;
+    }
+    Chunk* chunk = static_cast<Chunk*>(m_upstream->allocate(
+        sizeof(Chunk) + chunkSize));
+    chunk->next = nullptr;
+    chunk->size = chunkSize;
+    if (m_chunk)
+    {
+        m_chunk->next = chunk;
+    }
+    else
+    {
+        m_head = chunk;
+    }
+    m_chunkSize = chunkSize * 2;
+    _enter(chunk);
+    return (_allocate(size, alignment));
+}
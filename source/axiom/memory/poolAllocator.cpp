@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/memory/poolAllocator.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward Allocator and PoolAllocator from ax::memory
+///////////////////////////////////////////////////////////////////////////////
+using ax::memory::Allocator;
+using ax::memory::PoolAllocator;
+
+///////////////////////////////////////////////////////////////////////////////
+PoolAllocator::PoolAllocator(Uint64 blockSize, Uint64 blocksPerChunk,
+    Allocator& upstream)
+    : m_upstream(&upstream)
+    , m_blockSize(sizeof(FreeBlock))
+    , m_blockAlignment(defaultAlignment)
+    , m_blocksPerChunk(blocksPerChunk)
+{
+    CHECK(blocksPerChunk != 0);
+    while (m_blockSize < blockSize)
+    {
+        m_blockSize += sizeof(FreeBlock);
+    }
+    while (m_blockSize % m_blockAlignment != 0)
+    {
+        m_blockAlignment /= 2;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+PoolAllocator::~PoolAllocator(void)
+{
+    release();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PoolAllocator::reset(void)
+{
+    m_free = nullptr;
+    m_chunk = m_head;
+    m_cursor = nullptr;
+    m_end = nullptr;
+    if (m_head)
+    {
+        m_cursor = reinterpret_cast<char*>(m_head + 1);
+        m_end = m_cursor + m_head->size;
+    }
+    _releaseAll();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PoolAllocator::release(void)
+{
+    while (m_head)
+    {
+        Chunk* next = m_head->next;
+        m_upstream->deallocate(m_head, sizeof(Chunk) + m_head->size);
+        m_head = next;
+    }
+    m_free = nullptr;
+    m_chunk = nullptr;
+    m_cursor = nullptr;
+    m_end = nullptr;
+    _releaseAll();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Uint64 PoolAllocator::getBlockSize(void) const
+{
+    return (m_blockSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void* PoolAllocator::_allocate(Uint64 size, Uint64 alignment)
+{
+    if (!_isPooled(size, alignment))
+    {
+        return (m_upstream->allocate(size, alignment));
+    }
+    if (m_free)
+    {
+        FreeBlock* block = m_free;
+        m_free = block->next;
+        return (block);
+    }
+    if (m_cursor == m_end)
+    {
+        _nextChunk();
+    }
+    void* pointer = m_cursor;
+    m_cursor += m_blockSize;
+    return (pointer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PoolAllocator::_deallocate(void* pointer, Uint64 size, Uint64 alignment)
+{
+    if (!_isPooled(size, alignment))
+    {
+        m_upstream->deallocate(pointer, size, alignment);
+        return;
+    }
+    FreeBlock* block = static_cast<FreeBlock*>(pointer);
+    block->next = m_free;
+    m_free = block;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool PoolAllocator::_isPooled(Uint64 size, Uint64 alignment) const
+{
+    return (size <= m_blockSize && alignment <= m_blockAlignment);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PoolAllocator::_nextChunk(void)
+{
+    Chunk* chunk = m_chunk ? m_chunk->next : m_head;
+
+    if (!chunk)
+    {
+        const Uint64 size = m_blockSize * m_blocksPerChunk;
+        chunk = static_cast<Chunk*>(m_upstream->allocate(
+            sizeof(Chunk) + size));
+        chunk->next = nullptr;
+        chunk->size = size;
+        if (m_chunk)
+        {
+            m_chunk->next = chunk;
+        }
+        else
+        {
+            m_head = chunk;
+        }
+    }
+    m_chunk = chunk;
+    m_cursor = reinterpret_cast<char*>(chunk + 1);
+    m_end = m_cursor + chunk->size;
+}
@@ -0,0 +1,59 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// MIT License
+///
+/// Copyright(c) 2024 Mallory SCOTTON
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following coditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software?
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////////
+#include <axiom/memory/systemAllocator.hpp>
+#include <new>
+
+///////////////////////////////////////////////////////////////////////////////
+// Forward SystemAllocator from ax::memory
+///////////////////////////////////////////////////////////////////////////////
+using ax::memory::SystemAllocator;
+
+///////////////////////////////////////////////////////////////////////////////
+void* SystemAllocator::_allocate(Uint64 size, Uint64 alignment)
+{
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        return (::operator new(size, std::align_val_t(alignment)));
+    }
+    return (::operator new(size));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SystemAllocator::_deallocate(void* pointer, Uint64 size,
+    Uint64 alignment)
+{
+    (void)size;
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        ::operator delete(pointer, std::align_val_t(alignment));
+        return;
+    }
+    ::operator delete(pointer);
+}